@@ -58,6 +58,26 @@ void TChunkSliceFetcherConfig::Register(TRegistrar registrar)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void TCompressionDictionaryWriterConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("enable", &TThis::Enable)
+        .Default(false);
+    registrar.Parameter("dictionary_size", &TThis::DictionarySize)
+        .GreaterThanOrEqual(1_KB)
+        .Default(32_KB);
+    registrar.Parameter("sample_size", &TThis::SampleSize)
+        .GreaterThan(0)
+        .Default(1_MB);
+
+    registrar.Postprocessor([] (TThis* config) {
+        if (config->SampleSize < config->DictionarySize) {
+            THROW_ERROR_EXCEPTION("\"sample_size\" cannot be less than \"dictionary_size\"");
+        }
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void TEncodingWriterConfig::Register(TRegistrar registrar)
 {
     registrar.Parameter("encode_window_size", &TThis::EncodeWindowSize)
@@ -86,6 +86,30 @@ DEFINE_REFCOUNTED_TYPE(TChunkSliceFetcherConfig)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class TCompressionDictionaryWriterConfig
+    : public NYTree::TYsonStruct
+{
+public:
+    //! If |true|, a dictionary is trained from the first blocks of each chunk
+    //! and all blocks of the chunk are compressed with it.
+    //! Only applies to Zstd codecs and to chunk writers that support dictionaries.
+    bool Enable;
+
+    //! Maximum size of a dictionary.
+    i64 DictionarySize;
+
+    //! Amount of uncompressed block data held back to train a dictionary.
+    i64 SampleSize;
+
+    REGISTER_YSON_STRUCT(TCompressionDictionaryWriterConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TCompressionDictionaryWriterConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TEncodingWriterConfig
     : public virtual TWorkloadConfig
     , public virtual TBlockReordererConfig
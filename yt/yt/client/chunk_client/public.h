@@ -143,6 +143,7 @@ DECLARE_REFCOUNTED_STRUCT(IReaderBase)
 DECLARE_REFCOUNTED_CLASS(TFetchChunkSpecConfig)
 DECLARE_REFCOUNTED_CLASS(TFetcherConfig)
 DECLARE_REFCOUNTED_CLASS(TChunkSliceFetcherConfig)
+DECLARE_REFCOUNTED_CLASS(TCompressionDictionaryWriterConfig)
 DECLARE_REFCOUNTED_CLASS(TEncodingWriterConfig)
 DECLARE_REFCOUNTED_CLASS(TErasureReaderConfig)
 DECLARE_REFCOUNTED_CLASS(TMultiChunkReaderConfig)
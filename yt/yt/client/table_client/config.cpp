@@ -118,6 +118,18 @@ void TChunkWriterTestingOptions::Register(TRegistrar registrar)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void TKeyFilterWriterConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("enable", &TThis::Enable)
+        .Default(false);
+    registrar.Parameter("false_positive_rate", &TThis::FalsePositiveRate)
+        .GreaterThan(0.0)
+        .LessThanOrEqual(1.0)
+        .Default(0.03);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void TChunkWriterConfig::Register(TRegistrar registrar)
 {
     // Allow very small blocks for testing purposes.
@@ -160,6 +172,12 @@ void TChunkWriterConfig::Register(TRegistrar registrar)
     registrar.Parameter("versioned_row_digest", &TThis::VersionedRowDigest)
         .DefaultNew();
 
+    registrar.Parameter("key_filter", &TThis::KeyFilter)
+        .DefaultNew();
+
+    registrar.Parameter("compression_dictionary", &TThis::CompressionDictionary)
+        .DefaultNew();
+
     registrar.Parameter("testing_options", &TThis::TestingOptions)
         .DefaultNew();
 }
@@ -132,6 +132,24 @@ DEFINE_REFCOUNTED_TYPE(TSlimVersionedWriterConfig)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class TKeyFilterWriterConfig
+    : public NYTree::TYsonStruct
+{
+public:
+    bool Enable;
+
+    //! Target false positive rate of a single filter block.
+    double FalsePositiveRate;
+
+    REGISTER_YSON_STRUCT(TKeyFilterWriterConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TKeyFilterWriterConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TChunkWriterConfig
     : public NChunkClient::TEncodingWriterConfig
 {
@@ -157,6 +175,10 @@ public:
 
     TVersionedRowDigestConfigPtr VersionedRowDigest;
 
+    TKeyFilterWriterConfigPtr KeyFilter;
+
+    NChunkClient::TCompressionDictionaryWriterConfigPtr CompressionDictionary;
+
     TChunkWriterTestingOptionsPtr TestingOptions;
 
     REGISTER_YSON_STRUCT(TChunkWriterConfig);
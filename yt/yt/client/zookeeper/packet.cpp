@@ -182,6 +182,7 @@ public:
         EPacketFlags flags,
         bool /*generateChecksums*/,
         int /*checksummedPartCount*/,
+        TRange<TChecksum> /*partChecksums*/,
         TPacketId /*packetId*/,
         TSharedRefArray messageParts) override
     {
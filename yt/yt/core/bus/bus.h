@@ -24,6 +24,9 @@ namespace NYT::NBus {
     func(OutBytes, out_bytes) \
     func(OutPackets, out_packets) \
     \
+    func(ZeroCopyOutBytes, zero_copy_out_bytes) \
+    func(ZeroCopyFallbackOutBytes, zero_copy_fallback_out_bytes) \
+    \
     func(StalledReads, stalled_reads) \
     func(StalledWrites, stalled_writes) \
     \
@@ -69,6 +72,10 @@ struct TSendOptions
     EDeliveryTrackingLevel TrackingLevel;
     int ChecksummedPartCount;
     bool EnableSendCancelation = false;
+
+    //! Checksums of message parts known in advance (e.g. taken from block meta), indexed by part.
+    //! The transport reuses them instead of computing; missing and null entries are computed as usual.
+    std::vector<TChecksum> PartChecksums;
 };
 
 //! A bus, i.e. something capable of transmitting messages.
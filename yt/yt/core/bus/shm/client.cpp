@@ -0,0 +1,188 @@
+#include "client.h"
+#include "config.h"
+#include "connection.h"
+
+#include <yt/yt/core/bus/client.h>
+
+#include <yt/yt/core/bus/tcp/dispatcher_impl.h>
+
+#include <yt/yt/core/concurrency/thread_affinity.h>
+
+#include <yt/yt/core/ytree/convert.h>
+#include <yt/yt/core/ytree/fluent.h>
+
+namespace NYT::NBus {
+
+using namespace NYTree;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const auto& Logger = BusLogger;
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! A lightweight proxy controlling the lifetime of client #TShmConnection.
+/*!
+ *  When the last strong reference vanishes, it calls IBus::Terminate
+ *  for the underlying connection.
+ */
+class TShmClientBusProxy
+    : public IBus
+{
+public:
+    explicit TShmClientBusProxy(TShmConnectionPtr connection)
+        : Connection_(std::move(connection))
+    { }
+
+    ~TShmClientBusProxy()
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        Connection_->Terminate(TError(NBus::EErrorCode::TransportError, "Bus terminated"));
+    }
+
+    const TString& GetEndpointDescription() const override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->GetEndpointDescription();
+    }
+
+    const IAttributeDictionary& GetEndpointAttributes() const override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->GetEndpointAttributes();
+    }
+
+    const TString& GetEndpointAddress() const override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->GetEndpointAddress();
+    }
+
+    const NNet::TNetworkAddress& GetEndpointNetworkAddress() const override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->GetEndpointNetworkAddress();
+    }
+
+    bool IsEndpointLocal() const override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->IsEndpointLocal();
+    }
+
+    TBusNetworkStatistics GetNetworkStatistics() const override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->GetNetworkStatistics();
+    }
+
+    TFuture<void> GetReadyFuture() const override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->GetReadyFuture();
+    }
+
+    TFuture<void> Send(TSharedRefArray message, const TSendOptions& options) override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->Send(std::move(message), options);
+    }
+
+    void SetTosLevel(TTosLevel tosLevel) override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        return Connection_->SetTosLevel(tosLevel);
+    }
+
+    void Terminate(const TError& error) override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        Connection_->Terminate(error);
+    }
+
+    void SubscribeTerminated(const TCallback<void(const TError&)>& callback) override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        Connection_->SubscribeTerminated(callback);
+    }
+
+    void UnsubscribeTerminated(const TCallback<void(const TError&)>& callback) override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+        Connection_->UnsubscribeTerminated(callback);
+    }
+
+private:
+    const TShmConnectionPtr Connection_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TShmBusClient
+    : public IBusClient
+{
+public:
+    explicit TShmBusClient(TShmBusClientConfigPtr config)
+        : Config_(std::move(config))
+        , EndpointDescription_(Format("shm://%v", Config_->UnixDomainSocketPath))
+        , EndpointAttributes_(ConvertToAttributes(BuildYsonStringFluently()
+            .BeginMap()
+                .Item("address").Value(EndpointDescription_)
+            .EndMap()))
+    { }
+
+    const TString& GetEndpointDescription() const override
+    {
+        return EndpointDescription_;
+    }
+
+    const IAttributeDictionary& GetEndpointAttributes() const override
+    {
+        return *EndpointAttributes_;
+    }
+
+    IBusPtr CreateBus(IMessageHandlerPtr handler, const TCreateBusOptions& /*options*/) override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+
+        auto id = TConnectionId::Create();
+
+        YT_LOG_DEBUG("Connecting to shared memory server (Address: %v, ConnectionId: %v)",
+            EndpointDescription_,
+            id);
+
+        auto endpointAttributes = ConvertToAttributes(BuildYsonStringFluently()
+            .BeginMap()
+                .Items(*EndpointAttributes_)
+                .Item("connection_id").Value(id)
+            .EndMap());
+
+        auto connection = New<TShmConnection>(
+            EConnectionType::Client,
+            id,
+            INVALID_SOCKET,
+            EndpointDescription_,
+            *endpointAttributes,
+            std::move(handler),
+            TTcpDispatcher::TImpl::Get()->GetXferPoller());
+        connection->StartClient(Config_->UnixDomainSocketPath, Config_->RingBufferSize);
+
+        return New<TShmClientBusProxy>(std::move(connection));
+    }
+
+private:
+    const TShmBusClientConfigPtr Config_;
+    const TString EndpointDescription_;
+    const IAttributeDictionaryPtr EndpointAttributes_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+IBusClientPtr CreateShmBusClient(TShmBusClientConfigPtr config)
+{
+    return New<TShmBusClient>(std::move(config));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "public.h"
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Initializes a new client passing messages via shared memory
+//! to a server running on the same host (see #CreateShmBusServer).
+/*!
+ *  Only the handshake goes through the kernel; messages are copied into a shared ring
+ *  by the sender and are handed to the receiver without copying.
+ */
+IBusClientPtr CreateShmBusClient(TShmBusClientConfigPtr config);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
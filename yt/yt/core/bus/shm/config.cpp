@@ -0,0 +1,51 @@
+#include "config.h"
+
+#include <util/generic/bitops.h>
+#include <util/generic/size_literals.h>
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TShmBusServerConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("unix_domain_socket_path", &TThis::UnixDomainSocketPath);
+    registrar.Parameter("max_backlog_size", &TThis::MaxBacklogSize)
+        .Default(8192);
+}
+
+TShmBusServerConfigPtr TShmBusServerConfig::Create(const TString& socketPath)
+{
+    auto config = New<TShmBusServerConfig>();
+    config->UnixDomainSocketPath = socketPath;
+    return config;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TShmBusClientConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("unix_domain_socket_path", &TThis::UnixDomainSocketPath);
+    registrar.Parameter("ring_buffer_size", &TThis::RingBufferSize)
+        .GreaterThanOrEqual(64_KB)
+        .LessThanOrEqual(1_GB)
+        .Default(64_MB);
+
+    registrar.Postprocessor([] (TThis* config) {
+        if (!IsPowerOf2(config->RingBufferSize)) {
+            THROW_ERROR_EXCEPTION("\"ring_buffer_size\" must be a power of two")
+                << TErrorAttribute("ring_buffer_size", config->RingBufferSize);
+        }
+    });
+}
+
+TShmBusClientConfigPtr TShmBusClientConfig::Create(const TString& socketPath)
+{
+    auto config = New<TShmBusClientConfig>();
+    config->UnixDomainSocketPath = socketPath;
+    return config;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
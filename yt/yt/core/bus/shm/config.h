@@ -0,0 +1,51 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/core/ytree/yson_struct.h>
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TShmBusServerConfig
+    : public NYTree::TYsonStruct
+{
+public:
+    //! Path of the Unix domain socket used to exchange shared memory segments with clients.
+    TString UnixDomainSocketPath;
+    int MaxBacklogSize;
+
+    static TShmBusServerConfigPtr Create(const TString& socketPath);
+
+    REGISTER_YSON_STRUCT(TShmBusServerConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TShmBusServerConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TShmBusClientConfig
+    : public NYTree::TYsonStruct
+{
+public:
+    TString UnixDomainSocketPath;
+
+    //! Size of each of the two (one per direction) rings of the shared memory segment.
+    //! Must be a power of two; messages larger than half of a ring cannot be sent.
+    i64 RingBufferSize;
+
+    static TShmBusClientConfigPtr Create(const TString& socketPath);
+
+    REGISTER_YSON_STRUCT(TShmBusClientConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TShmBusClientConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,836 @@
+#include "connection.h"
+
+#include <yt/yt/core/bus/tcp/dispatcher_impl.h>
+
+#include <yt/yt/core/net/address.h>
+#include <yt/yt/core/net/socket.h>
+
+#include <yt/yt/core/ytree/convert.h>
+#include <yt/yt/core/ytree/fluent.h>
+
+#include <util/system/error.h>
+
+#ifdef _linux_
+    #include <sys/eventfd.h>
+    #include <sys/socket.h>
+#endif
+
+#include <cerrno>
+
+namespace NYT::NBus {
+
+using namespace NConcurrency;
+using namespace NNet;
+using namespace NYTree;
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct TShmHandshake
+{
+    ui32 Signature;
+    ui32 Version;
+};
+
+constexpr ui32 ShmHandshakeSignature = 0x6873686d;
+constexpr ui32 ShmHandshakeVersion = 1;
+
+//! The segment, the client wakeup handle and the server wakeup handle.
+constexpr int HandshakeFDCount = 3;
+
+constexpr int MaxMessagesPerEvent = 256;
+
+struct TShmReceivedMessageTag
+{ };
+
+//! Frees the pool blocks of a received message part once the part is gone.
+class TShmBlockHolder
+    : public TSharedRangeHolder
+{
+public:
+    TShmBlockHolder(
+        TShmSegmentPtr segment,
+        EShmRing ring,
+        int blockIndex,
+        i64 size)
+        : Segment_(std::move(segment))
+        , Ring_(ring)
+        , BlockIndex_(blockIndex)
+        , Size_(size)
+    { }
+
+    ~TShmBlockHolder()
+    {
+        Segment_->GetPool(Ring_)->Free(BlockIndex_, Size_);
+    }
+
+private:
+    const TShmSegmentPtr Segment_;
+    const EShmRing Ring_;
+    const int BlockIndex_;
+    const i64 Size_;
+};
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShmWakeupHandle::TShmWakeupHandle()
+#ifdef _linux_
+    : FD_(HandleEintr(::eventfd, 0, EFD_CLOEXEC | EFD_NONBLOCK))
+#else
+    : FD_(-1)
+#endif
+{
+    if (FD_ < 0) {
+        THROW_ERROR_EXCEPTION("Error creating wakeup handle")
+            << TError::FromSystem();
+    }
+}
+
+TShmWakeupHandle::TShmWakeupHandle(TFileDescriptor fd)
+    : FD_(fd)
+{ }
+
+TShmWakeupHandle::~TShmWakeupHandle()
+{
+    SafeClose(FD_);
+}
+
+TFileDescriptor TShmWakeupHandle::GetFD() const
+{
+    return FD_;
+}
+
+void TShmWakeupHandle::Raise()
+{
+    ui64 one = 1;
+    // NB: The counter cannot realistically overflow, so the write never blocks.
+    YT_VERIFY(HandleEintr(::write, FD_, &one, sizeof(one)) == sizeof(one));
+}
+
+void TShmWakeupHandle::Clear()
+{
+    ui64 count;
+    auto result = HandleEintr(::read, FD_, &count, sizeof(count));
+    YT_VERIFY(result == sizeof(count) || (result < 0 && errno == EAGAIN));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Watches the Unix domain socket of the connection, which is used for the handshake
+//! and for detecting the peer's termination.
+/*!
+ *  A separate pollable since pollers support a single descriptor per pollable.
+ */
+class TShmConnection::TSocketWatcher
+    : public TPollableBase
+{
+public:
+    explicit TSocketWatcher(TShmConnection* connection)
+        : Connection_(MakeWeak(connection))
+        , LoggingTag_(connection->GetLoggingTag())
+    { }
+
+    const TString& GetLoggingTag() const override
+    {
+        return LoggingTag_;
+    }
+
+    void OnEvent(EPollControl /*control*/) override
+    {
+        if (auto connection = Connection_.Lock()) {
+            connection->OnSocketEvent();
+        }
+    }
+
+    void OnShutdown() override
+    { }
+
+private:
+    const TWeakPtr<TShmConnection> Connection_;
+    const TString LoggingTag_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShmConnection::TShmConnection(
+    EConnectionType connectionType,
+    TConnectionId id,
+    SOCKET socket,
+    const TString& endpointDescription,
+    const IAttributeDictionary& endpointAttributes,
+    IMessageHandlerPtr handler,
+    IPollerPtr poller)
+    : ConnectionType_(connectionType)
+    , Id_(id)
+    , EndpointDescription_(endpointDescription)
+    , EndpointAttributes_(endpointAttributes.Clone())
+    , Handler_(std::move(handler))
+    , Poller_(std::move(poller))
+    , NetworkCounters_(TTcpDispatcher::TImpl::Get()->GetCounters(LocalNetworkName))
+    , Logger(BusLogger.WithTag("ConnectionId: %v, ConnectionType: %v, RemoteAddress: %v, Transport: Shm",
+        Id_,
+        ConnectionType_,
+        EndpointDescription_))
+    , Socket_(socket)
+{
+    YT_VERIFY(Handler_);
+    YT_VERIFY(Poller_);
+}
+
+TShmConnection::~TShmConnection()
+{
+    if (Socket_ != INVALID_SOCKET) {
+        CloseSocket(Socket_);
+    }
+}
+
+void TShmConnection::StartClient(const TString& socketPath, i64 ringBufferSize)
+{
+    YT_VERIFY(ConnectionType_ == EConnectionType::Client);
+
+    try {
+        {
+            auto guard = Guard(Lock_);
+            Socket_ = CreateUnixClientSocket();
+        }
+
+        if (ConnectSocket(Socket_, TNetworkAddress::CreateUnixDomainSocketAddress(socketPath)) != 0) {
+            THROW_ERROR_EXCEPTION("Server backlog is full")
+                << TError::FromSystem();
+        }
+
+        TFile segmentFile;
+        Segment_ = TShmSegment::Create(ringBufferSize, &segmentFile);
+        InRingKind_ = EShmRing::ServerToClient;
+        InRing_ = Segment_->GetRing(EShmRing::ServerToClient);
+        OutRing_ = Segment_->GetRing(EShmRing::ClientToServer);
+        LocalWakeup_ = New<TShmWakeupHandle>();
+        PeerWakeup_ = New<TShmWakeupHandle>();
+
+        SendHandshake(segmentFile.GetHandle());
+
+        Register();
+        Open();
+    } catch (const std::exception& ex) {
+        Terminate(TError(
+            NBus::EErrorCode::TransportError,
+            "Error connecting to %v",
+            EndpointDescription_)
+            << ex);
+    }
+}
+
+void TShmConnection::StartServer()
+{
+    YT_VERIFY(ConnectionType_ == EConnectionType::Server);
+
+    try {
+        Register();
+    } catch (const std::exception& ex) {
+        Terminate(TError(NBus::EErrorCode::TransportError, "Error starting connection")
+            << ex);
+    }
+}
+
+void TShmConnection::Register()
+{
+    auto guard = Guard(Lock_);
+
+    if (State_ == EShmConnectionState::Closed) {
+        return;
+    }
+
+    if (!Poller_->TryRegister(this)) {
+        THROW_ERROR_EXCEPTION("Cannot register connection pollable");
+    }
+    SocketWatcher_ = New<TSocketWatcher>(this);
+    if (!Poller_->TryRegister(SocketWatcher_)) {
+        YT_UNUSED_FUTURE(Poller_->Unregister(this));
+        THROW_ERROR_EXCEPTION("Cannot register connection pollable");
+    }
+    Registered_ = true;
+
+    Poller_->Arm(Socket_, SocketWatcher_, EPollControl::Read | EPollControl::EdgeTriggered);
+}
+
+void TShmConnection::Open()
+{
+    {
+        auto guard = Guard(Lock_);
+
+        if (State_ == EShmConnectionState::Closed) {
+            return;
+        }
+
+        Poller_->Arm(LocalWakeup_->GetFD(), this, EPollControl::Read | EPollControl::EdgeTriggered);
+        State_ = EShmConnectionState::Open;
+        UpdateConnectionCount(+1);
+    }
+
+    YT_LOG_DEBUG("Shared memory connection established (RingBufferSize: %v)",
+        OutRing_->GetCapacity());
+
+    ReadyPromise_.TrySet();
+
+    // The peer might have already written something and gone to sleep.
+    Poller_->Retry(this);
+}
+
+void TShmConnection::SendHandshake(TFileDescriptor segmentFD)
+{
+#ifdef _linux_
+    TShmHandshake handshake{
+        .Signature = ShmHandshakeSignature,
+        .Version = ShmHandshakeVersion,
+    };
+    struct iovec iov{
+        .iov_base = &handshake,
+        .iov_len = sizeof(handshake),
+    };
+
+    // NB: Wakeup handles are listed from the client's point of view.
+    int fds[HandshakeFDCount] = {segmentFD, LocalWakeup_->GetFD(), PeerWakeup_->GetFD()};
+    alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(fds))] = {};
+
+    struct msghdr message{};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    auto* cmsg = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    ::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    auto result = HandleEintr(::sendmsg, Socket_, &message, MSG_NOSIGNAL);
+    if (result != sizeof(handshake)) {
+        THROW_ERROR_EXCEPTION("Error sending shared memory handshake")
+            << TError::FromSystem();
+    }
+#else
+    Y_UNUSED(segmentFD);
+    THROW_ERROR_EXCEPTION("Shared memory bus is not supported on this platform");
+#endif
+}
+
+bool TShmConnection::TryReceiveHandshake()
+{
+#ifdef _linux_
+    TShmHandshake handshake{};
+    struct iovec iov{
+        .iov_base = &handshake,
+        .iov_len = sizeof(handshake),
+    };
+
+    alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int) * HandshakeFDCount)] = {};
+
+    struct msghdr message{};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    auto result = HandleEintr(::recvmsg, Socket_, &message, MSG_CMSG_CLOEXEC);
+    if (result < 0) {
+        auto error = LastSystemError();
+        if (error == EAGAIN || error == EWOULDBLOCK) {
+            return false;
+        }
+        THROW_ERROR_EXCEPTION("Error receiving shared memory handshake")
+            << TError::FromSystem(error);
+    }
+
+    std::vector<TFileDescriptor> fds;
+    for (auto* cmsg = CMSG_FIRSTHDR(&message); cmsg; cmsg = CMSG_NXTHDR(&message, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            auto count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            auto* data = reinterpret_cast<const int*>(CMSG_DATA(cmsg));
+            fds.insert(fds.end(), data, data + count);
+        }
+    }
+
+    auto closeFds = [&] {
+        for (auto fd : fds) {
+            SafeClose(fd);
+        }
+    };
+
+    try {
+        if (result == 0) {
+            THROW_ERROR_EXCEPTION("Connection closed by peer during handshake");
+        }
+        if (result != sizeof(handshake) || (message.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) != 0) {
+            THROW_ERROR_EXCEPTION("Truncated shared memory handshake");
+        }
+        if (handshake.Signature != ShmHandshakeSignature) {
+            THROW_ERROR_EXCEPTION("Invalid shared memory handshake signature: expected %x, actual %x",
+                ShmHandshakeSignature,
+                handshake.Signature);
+        }
+        if (handshake.Version != ShmHandshakeVersion) {
+            THROW_ERROR_EXCEPTION("Unsupported shared memory handshake version: expected %v, actual %v",
+                ShmHandshakeVersion,
+                handshake.Version);
+        }
+        if (fds.size() != HandshakeFDCount) {
+            THROW_ERROR_EXCEPTION("Invalid number of descriptors in shared memory handshake: expected %v, actual %v",
+                HandshakeFDCount,
+                fds.size());
+        }
+
+        Segment_ = TShmSegment::Open(fds[0]);
+    } catch (const std::exception&) {
+        closeFds();
+        throw;
+    }
+
+    SafeClose(fds[0]);
+    PeerWakeup_ = New<TShmWakeupHandle>(fds[1]);
+    LocalWakeup_ = New<TShmWakeupHandle>(fds[2]);
+    InRingKind_ = EShmRing::ClientToServer;
+    InRing_ = Segment_->GetRing(EShmRing::ClientToServer);
+    OutRing_ = Segment_->GetRing(EShmRing::ServerToClient);
+
+    return true;
+#else
+    THROW_ERROR_EXCEPTION("Shared memory bus is not supported on this platform");
+#endif
+}
+
+const TString& TShmConnection::GetLoggingTag() const
+{
+    return Logger.GetTag();
+}
+
+void TShmConnection::OnEvent(EPollControl /*control*/)
+{
+    ProcessEvents();
+}
+
+void TShmConnection::OnShutdown()
+{ }
+
+void TShmConnection::OnSocketEvent()
+{
+    SocketEventPending_.store(true);
+    ProcessEvents();
+}
+
+void TShmConnection::ProcessEvents()
+{
+    // Only one thread at a time processes events; others just request another pass.
+    if (PendingEventCount_.fetch_add(1) > 0) {
+        return;
+    }
+
+    int eventCount = 1;
+    while (true) {
+        try {
+            DoProcessEvents();
+        } catch (const std::exception& ex) {
+            Terminate(TError(NBus::EErrorCode::TransportError, "Shared memory connection failed")
+                << ex);
+        }
+
+        eventCount = PendingEventCount_.fetch_sub(eventCount) - eventCount;
+        if (eventCount == 0) {
+            break;
+        }
+    }
+}
+
+void TShmConnection::DoProcessEvents()
+{
+    bool socketEventPending = SocketEventPending_.exchange(false);
+
+    if (State_ == EShmConnectionState::Handshaking) {
+        if (!socketEventPending || !TryReceiveHandshake()) {
+            return;
+        }
+        Open();
+        // The socket may have been closed right after the handshake.
+        socketEventPending = true;
+    }
+
+    if (State_ != EShmConnectionState::Open) {
+        return;
+    }
+
+    if (socketEventPending && !ReadSocket()) {
+        return;
+    }
+
+    LocalWakeup_->Clear();
+
+    ReceiveMessages();
+    FlushQueuedMessages();
+}
+
+bool TShmConnection::ReadSocket()
+{
+    // No data is expected to arrive via the socket after the handshake.
+    char buffer[16];
+    while (true) {
+        auto result = HandleEintr(::recv, Socket_, buffer, sizeof(buffer), 0);
+        if (result > 0) {
+            continue;
+        }
+        if (result == 0) {
+            Terminate(TError(NBus::EErrorCode::TransportError, "Connection closed by peer"));
+            return false;
+        }
+        auto error = LastSystemError();
+        if (error == EAGAIN || error == EWOULDBLOCK) {
+            return true;
+        }
+        Terminate(TError(NBus::EErrorCode::TransportError, "Socket read error")
+            << TError::FromSystem(error));
+        return false;
+    }
+}
+
+void TShmConnection::ReceiveMessages()
+{
+    auto& counters = NetworkCounters_->PerBandCounters[EMultiplexingBand::Default];
+
+    int messageCount = 0;
+    while (true) {
+        ui64 position;
+        while (InRing_->TryRead(&position, &ReceivedParts_)) {
+            // Parts residing in the ring are copied out so that the record is released right away
+            // and the handler retaining the message does not hold up the sender. Pooled parts
+            // are handed out as is; their blocks are freed independently once the parts are gone.
+            i64 inlineSize = 0;
+            for (const auto& part : ReceivedParts_) {
+                if (part.BlockIndex < 0) {
+                    inlineSize += part.Data.Size();
+                }
+            }
+            auto inlineData = inlineSize > 0
+                ? TSharedMutableRef::Allocate<TShmReceivedMessageTag>(inlineSize, {.InitializeStorage = false})
+                : TSharedMutableRef();
+
+            std::vector<TSharedRef> parts;
+            parts.reserve(ReceivedParts_.size());
+            i64 messageSize = 0;
+            i64 inlineOffset = 0;
+            for (const auto& part : ReceivedParts_) {
+                const auto& data = part.Data;
+                if (part.BlockIndex >= 0) {
+                    auto holder = New<TShmBlockHolder>(Segment_, InRingKind_, part.BlockIndex, data.Size());
+                    parts.push_back(TSharedRef(data, std::move(holder)));
+                } else if (!data.Begin()) {
+                    parts.push_back(TSharedRef());
+                } else if (data.Size() == 0) {
+                    parts.push_back(TSharedRef::MakeEmpty());
+                } else {
+                    auto copy = inlineData.Slice(inlineOffset, inlineOffset + data.Size());
+                    ::memcpy(copy.Begin(), data.Begin(), data.Size());
+                    inlineOffset += data.Size();
+                    parts.push_back(std::move(copy));
+                }
+                messageSize += data.Size();
+            }
+
+            if (InRing_->Release(position)) {
+                PeerWakeup_->Raise();
+            }
+
+            counters.InBytes.fetch_add(messageSize, std::memory_order::relaxed);
+            counters.InPackets.fetch_add(1, std::memory_order::relaxed);
+
+            Handler_->HandleMessage(TSharedRefArray(std::move(parts), TSharedRefArray::TMoveParts{}), this);
+
+            if (State_ != EShmConnectionState::Open) {
+                return;
+            }
+
+            if (++messageCount >= MaxMessagesPerEvent) {
+                // Let other pollables run; the ring is not empty so no wakeup is to come.
+                Poller_->Retry(this, /*wakeup*/ false);
+                return;
+            }
+        }
+
+        if (InRing_->PrepareConsumerWait()) {
+            break;
+        }
+    }
+}
+
+TFuture<void> TShmConnection::Send(TSharedRefArray message, const TSendOptions& options)
+{
+    if (State_ != EShmConnectionState::Open) {
+        auto guard = Guard(Lock_);
+        return MakeFuture<void>(Error_.IsOK()
+            ? TError(NBus::EErrorCode::TransportError, "Connection is not open")
+            : Error_);
+    }
+
+    auto recordSize = TShmRingBuffer::GetRecordSize(message);
+    if (recordSize > OutRing_->GetMaxRecordSize()) {
+        return MakeFuture<void>(TError(
+            NBus::EErrorCode::TransportError,
+            "Message is too large to be sent via shared memory")
+            << TErrorAttribute("size", recordSize)
+            << TErrorAttribute("max_size", OutRing_->GetMaxRecordSize()));
+    }
+
+    auto promise = options.TrackingLevel != EDeliveryTrackingLevel::None
+        ? NewPromise<void>()
+        : TPromise<void>();
+
+    {
+        auto guard = Guard(QueueLock_);
+        QueuedMessages_.push_back({
+            .Message = std::move(message),
+            .Promise = promise,
+            .TrackingLevel = options.TrackingLevel,
+        });
+    }
+
+    FlushQueuedMessages();
+
+    return promise ? promise.ToFuture() : VoidFuture;
+}
+
+void TShmConnection::FlushQueuedMessages()
+{
+    // Only one thread at a time writes into the ring; others just request another pass.
+    if (PendingFlushCount_.fetch_add(1) > 0) {
+        return;
+    }
+
+    int flushCount = 1;
+    while (true) {
+        DoFlushQueuedMessages();
+
+        flushCount = PendingFlushCount_.fetch_sub(flushCount) - flushCount;
+        if (flushCount == 0) {
+            break;
+        }
+    }
+}
+
+void TShmConnection::DoFlushQueuedMessages()
+{
+    if (State_ == EShmConnectionState::Closed) {
+        std::deque<TQueuedMessage> queuedMessages;
+        {
+            auto guard = Guard(QueueLock_);
+            queuedMessages.swap(QueuedMessages_);
+        }
+
+        TError error;
+        {
+            auto guard = Guard(Lock_);
+            error = Error_;
+        }
+
+        for (auto& queuedMessage : queuedMessages) {
+            if (queuedMessage.Promise) {
+                queuedMessage.Promise.TrySet(error);
+            }
+        }
+
+        auto unackedMessages = std::move(UnackedMessages_);
+        UnackedMessages_.clear();
+        for (auto& unackedMessage : unackedMessages) {
+            unackedMessage.Promise.TrySet(error);
+        }
+        return;
+    }
+
+    auto& counters = NetworkCounters_->PerBandCounters[EMultiplexingBand::Default];
+
+    bool wakeupPeer = false;
+    while (State_ == EShmConnectionState::Open) {
+        TQueuedMessage* queuedMessage;
+        {
+            auto guard = Guard(QueueLock_);
+            if (QueuedMessages_.empty()) {
+                break;
+            }
+            // NB: Deque references are stable under push_back and only this thread pops.
+            queuedMessage = &QueuedMessages_.front();
+        }
+
+        ui64 endPosition;
+        bool wakeupConsumer = false;
+        if (!OutRing_->TryWrite(queuedMessage->Message, &endPosition, &wakeupConsumer)) {
+            // The peer will wake us up upon releasing some space.
+            YT_LOG_TRACE("Shared memory ring is full, waiting for peer");
+            break;
+        }
+        wakeupPeer |= wakeupConsumer;
+
+        counters.OutBytes.fetch_add(GetByteSize(queuedMessage->Message), std::memory_order::relaxed);
+        counters.OutPackets.fetch_add(1, std::memory_order::relaxed);
+
+        auto promise = std::move(queuedMessage->Promise);
+        auto trackingLevel = queuedMessage->TrackingLevel;
+        {
+            auto guard = Guard(QueueLock_);
+            QueuedMessages_.pop_front();
+        }
+
+        if (promise) {
+            if (trackingLevel == EDeliveryTrackingLevel::Full) {
+                UnackedMessages_.push_back({
+                    .EndPosition = endPosition,
+                    .Promise = std::move(promise),
+                });
+            } else {
+                promise.TrySet();
+            }
+        }
+    }
+
+    if (wakeupPeer) {
+        PeerWakeup_->Raise();
+    }
+
+    ProcessAcks();
+}
+
+void TShmConnection::ProcessAcks()
+{
+    while (!UnackedMessages_.empty()) {
+        auto& unackedMessage = UnackedMessages_.front();
+        if (!OutRing_->IsConsumed(unackedMessage.EndPosition)) {
+            // The peer will wake us up upon consuming the message.
+            if (OutRing_->PrepareAckWait(unackedMessage.EndPosition)) {
+                break;
+            }
+            continue;
+        }
+
+        auto promise = std::move(unackedMessage.Promise);
+        UnackedMessages_.pop_front();
+        promise.TrySet();
+    }
+}
+
+const TString& TShmConnection::GetEndpointDescription() const
+{
+    return EndpointDescription_;
+}
+
+const IAttributeDictionary& TShmConnection::GetEndpointAttributes() const
+{
+    return *EndpointAttributes_;
+}
+
+const TString& TShmConnection::GetEndpointAddress() const
+{
+    static const TString EmptyAddress;
+    return EmptyAddress;
+}
+
+const TNetworkAddress& TShmConnection::GetEndpointNetworkAddress() const
+{
+    static const TNetworkAddress EmptyAddress;
+    return EmptyAddress;
+}
+
+bool TShmConnection::IsEndpointLocal() const
+{
+    return false;
+}
+
+TBusNetworkStatistics TShmConnection::GetNetworkStatistics() const
+{
+    return NetworkCounters_->ToStatistics();
+}
+
+TFuture<void> TShmConnection::GetReadyFuture() const
+{
+    return ReadyPromise_.ToFuture();
+}
+
+void TShmConnection::SetTosLevel(TTosLevel /*tosLevel*/)
+{ }
+
+void TShmConnection::Terminate(const TError& error)
+{
+    YT_VERIFY(!error.IsOK());
+
+    TError detailedError;
+    bool registered;
+    {
+        auto guard = Guard(Lock_);
+
+        if (State_ == EShmConnectionState::Closed) {
+            return;
+        }
+
+        if (State_ == EShmConnectionState::Open) {
+            UpdateConnectionCount(-1);
+        }
+
+        Error_ = error << *EndpointAttributes_;
+        detailedError = Error_;
+        State_ = EShmConnectionState::Closed;
+
+        registered = Registered_;
+        if (registered) {
+            Poller_->Unarm(Socket_, SocketWatcher_);
+            if (LocalWakeup_) {
+                Poller_->Unarm(LocalWakeup_->GetFD(), this);
+            }
+        }
+
+        if (Socket_ != INVALID_SOCKET) {
+            // Let the peer know; the descriptor itself is closed upon destruction.
+            ::shutdown(Socket_, SHUT_RDWR);
+        }
+    }
+
+    YT_LOG_DEBUG(detailedError, "Shared memory connection terminated");
+
+    if (registered) {
+        YT_UNUSED_FUTURE(Poller_->Unregister(SocketWatcher_));
+        YT_UNUSED_FUTURE(Poller_->Unregister(this));
+    }
+
+    ReadyPromise_.TrySet(detailedError);
+
+    // Fail the messages that have not been written yet.
+    FlushQueuedMessages();
+
+    Terminated_.Fire(detailedError);
+}
+
+void TShmConnection::SubscribeTerminated(const TCallback<void(const TError&)>& callback)
+{
+    Terminated_.Subscribe(callback);
+}
+
+void TShmConnection::UnsubscribeTerminated(const TCallback<void(const TError&)>& callback)
+{
+    Terminated_.Unsubscribe(callback);
+}
+
+void TShmConnection::UpdateConnectionCount(int delta)
+{
+    auto& counters = NetworkCounters_->PerBandCounters[EMultiplexingBand::Default];
+    switch (ConnectionType_) {
+        case EConnectionType::Client:
+            counters.ClientConnections.fetch_add(delta, std::memory_order::relaxed);
+            break;
+        case EConnectionType::Server:
+            counters.ServerConnections.fetch_add(delta, std::memory_order::relaxed);
+            break;
+        default:
+            YT_ABORT();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "public.h"
+#include "segment.h"
+
+#include <yt/yt/core/bus/bus.h>
+#include <yt/yt/core/bus/private.h>
+
+#include <yt/yt/core/bus/tcp/public.h>
+
+#include <yt/yt/core/concurrency/pollable_detail.h>
+
+#include <yt/yt/core/logging/log.h>
+
+#include <yt/yt/core/misc/proc.h>
+
+#include <library/cpp/yt/threading/spin_lock.h>
+
+#include <util/network/init.h>
+
+#include <atomic>
+#include <deque>
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+DEFINE_ENUM(EShmConnectionState,
+    (Handshaking)
+    (Open)
+    (Closed)
+);
+
+DECLARE_REFCOUNTED_CLASS(TShmWakeupHandle)
+
+//! An eventfd one party of a shared memory connection is waiting on and the other raises.
+class TShmWakeupHandle
+    : public TRefCounted
+{
+public:
+    //! Creates a new eventfd.
+    TShmWakeupHandle();
+    //! Takes ownership of #fd received from the peer.
+    explicit TShmWakeupHandle(TFileDescriptor fd);
+
+    ~TShmWakeupHandle();
+
+    TFileDescriptor GetFD() const;
+
+    void Raise();
+    void Clear();
+
+private:
+    const TFileDescriptor FD_;
+};
+
+DEFINE_REFCOUNTED_TYPE(TShmWakeupHandle)
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! A bus connection passing messages through a shared memory segment.
+/*!
+ *  The client creates the segment (see #TShmSegment) and a pair of wakeup handles
+ *  and passes them to the server over a Unix domain socket. Afterwards the socket only
+ *  serves to detect the peer's termination.
+ *
+ *  Outgoing messages are copied into the segment once. With #EDeliveryTrackingLevel::ErrorOnly
+ *  they are considered sent as soon as they are committed to the ring; with #EDeliveryTrackingLevel::Full
+ *  the send completes once the peer has consumed the message.
+ *
+ *  Small incoming parts are copied out of the ring so that the ring space is reclaimed
+ *  before the message is dispatched. Large parts are placed into the block pool by the sender
+ *  and are handed to the handler as references to shared memory; holding them for long
+ *  only makes further large parts go through the ring.
+ */
+class TShmConnection
+    : public IBus
+    , public NConcurrency::TPollableBase
+{
+public:
+    TShmConnection(
+        EConnectionType connectionType,
+        TConnectionId id,
+        SOCKET socket,
+        const TString& endpointDescription,
+        const NYTree::IAttributeDictionary& endpointAttributes,
+        IMessageHandlerPtr handler,
+        NConcurrency::IPollerPtr poller);
+
+    ~TShmConnection();
+
+    //! Connects to the server listening at #socketPath and passes it a newly created segment.
+    //! Errors are reported by terminating the connection.
+    void StartClient(const TString& socketPath, i64 ringBufferSize);
+
+    //! Starts waiting for the client's handshake on the accepted socket.
+    void StartServer();
+
+    // IPollable implementation.
+    const TString& GetLoggingTag() const override;
+    void OnEvent(NConcurrency::EPollControl control) override;
+    void OnShutdown() override;
+
+    // IBus implementation.
+    const TString& GetEndpointDescription() const override;
+    const NYTree::IAttributeDictionary& GetEndpointAttributes() const override;
+    const TString& GetEndpointAddress() const override;
+    const NNet::TNetworkAddress& GetEndpointNetworkAddress() const override;
+    bool IsEndpointLocal() const override;
+    TBusNetworkStatistics GetNetworkStatistics() const override;
+    TFuture<void> GetReadyFuture() const override;
+    TFuture<void> Send(TSharedRefArray message, const TSendOptions& options) override;
+    void SetTosLevel(TTosLevel tosLevel) override;
+    void Terminate(const TError& error) override;
+
+    DECLARE_SIGNAL_OVERRIDE(void(const TError&), Terminated);
+
+private:
+    class TSocketWatcher;
+
+    struct TQueuedMessage
+    {
+        TSharedRefArray Message;
+        TPromise<void> Promise;
+        EDeliveryTrackingLevel TrackingLevel;
+    };
+
+    struct TUnackedMessage
+    {
+        //! The message is consumed once the peer's read position reaches this one.
+        ui64 EndPosition;
+        TPromise<void> Promise;
+    };
+
+    const EConnectionType ConnectionType_;
+    const TConnectionId Id_;
+    const TString EndpointDescription_;
+    const NYTree::IAttributeDictionaryPtr EndpointAttributes_;
+    const IMessageHandlerPtr Handler_;
+    const NConcurrency::IPollerPtr Poller_;
+    const TBusNetworkCountersPtr NetworkCounters_;
+    const NLogging::TLogger Logger;
+
+    const TPromise<void> ReadyPromise_ = NewPromise<void>();
+
+    TSingleShotCallbackList<void(const TError&)> Terminated_;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, Lock_);
+    std::atomic<EShmConnectionState> State_ = EShmConnectionState::Handshaking;
+    TError Error_;
+    SOCKET Socket_;
+    NConcurrency::IPollablePtr SocketWatcher_;
+    bool Registered_ = false;
+
+    // These are set before the connection becomes open and are immutable afterwards.
+    TShmSegmentPtr Segment_;
+    EShmRing InRingKind_;
+    TShmRingBuffer* InRing_ = nullptr;
+    TShmRingBuffer* OutRing_ = nullptr;
+    TShmWakeupHandlePtr LocalWakeup_;
+    TShmWakeupHandlePtr PeerWakeup_;
+
+    //! Serializes event processing which can be requested by several poller threads at once.
+    std::atomic<int> PendingEventCount_ = 0;
+    std::atomic<bool> SocketEventPending_ = false;
+    std::vector<TShmReceivedPart> ReceivedParts_;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, QueueLock_);
+    std::deque<TQueuedMessage> QueuedMessages_;
+    //! Serializes writing into #OutRing_ which can be requested by any thread.
+    std::atomic<int> PendingFlushCount_ = 0;
+    //! Fully tracked messages written into #OutRing_ but not consumed by the peer yet.
+    //! Only accessed by the flushing thread.
+    std::deque<TUnackedMessage> UnackedMessages_;
+
+    void Open();
+    void Register();
+    void SendHandshake(TFileDescriptor segmentFD);
+    bool TryReceiveHandshake();
+
+    void OnSocketEvent();
+    void ProcessEvents();
+    void DoProcessEvents();
+    bool ReadSocket();
+    void ReceiveMessages();
+
+    void FlushQueuedMessages();
+    void DoFlushQueuedMessages();
+    void ProcessAcks();
+
+    void UpdateConnectionCount(int delta);
+};
+
+DEFINE_REFCOUNTED_TYPE(TShmConnection)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <yt/yt/core/bus/public.h>
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+DECLARE_REFCOUNTED_CLASS(TShmBusServerConfig)
+DECLARE_REFCOUNTED_CLASS(TShmBusClientConfig)
+
+DECLARE_REFCOUNTED_CLASS(TShmSegment)
+DECLARE_REFCOUNTED_CLASS(TShmConnection)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,429 @@
+#include "ring_buffer.h"
+
+#include <yt/yt/core/misc/error.h>
+
+#include <library/cpp/yt/small_containers/compact_vector.h>
+
+#include <util/generic/bitops.h>
+
+#include <util/system/align.h>
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct TRecordHeader
+{
+    //! Total size of the record including the header; a multiple of #RecordAlignment.
+    ui32 Size;
+    ui32 PartCount;
+};
+
+static_assert(sizeof(TRecordHeader) == 8);
+
+struct TPartDescriptor
+{
+    ui32 Size;
+    //! Index of the first pool block holding the part or #InlineBlockIndex.
+    ui32 BlockIndex;
+};
+
+static_assert(sizeof(TPartDescriptor) == 8);
+
+constexpr i64 RecordAlignment = 8;
+constexpr ui32 PaddingPartCount = std::numeric_limits<ui32>::max();
+constexpr ui32 NullPartSize = std::numeric_limits<ui32>::max();
+constexpr ui32 InlineBlockIndex = std::numeric_limits<ui32>::max();
+
+i64 GetPartDescriptorsSize(i64 partCount)
+{
+    return AlignUp<i64>(partCount * sizeof(TPartDescriptor), RecordAlignment);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShmBlockPool::TShmBlockPool(std::atomic<ui32>* blockStates, TMutableRef data)
+    : BlockStates_(blockStates)
+    , Data_(data.Begin())
+    , BlockCount_(data.Size() / BlockSize)
+{
+    YT_VERIFY(data.Size() % BlockSize == 0);
+}
+
+void TShmBlockPool::Initialize(std::atomic<ui32>* blockStates, int blockCount)
+{
+    for (int index = 0; index < blockCount; ++index) {
+        new (&blockStates[index]) std::atomic<ui32>(0);
+    }
+}
+
+int TShmBlockPool::GetBlockCount() const
+{
+    return BlockCount_;
+}
+
+int TShmBlockPool::GetBlockCount(i64 size)
+{
+    return (size + BlockSize - 1) / BlockSize;
+}
+
+int TShmBlockPool::TryAllocate(i64 size)
+{
+    auto count = GetBlockCount(size);
+    if (count == 0 || count > BlockCount_) {
+        return -1;
+    }
+
+    // Looks for a run of free blocks starting in [begin, end).
+    auto findRun = [&] (int begin, int end) {
+        int runStart = begin;
+        int runLength = 0;
+        for (int index = begin; index < BlockCount_ && runStart < end; ++index) {
+            // NB: Acquire pairs with the release in #Free so that the consumer is done with the data.
+            if (BlockStates_[index].load(std::memory_order::acquire) != 0) {
+                runStart = index + 1;
+                runLength = 0;
+                continue;
+            }
+            if (++runLength == count) {
+                return runStart;
+            }
+        }
+        return -1;
+    };
+
+    auto blockIndex = findRun(NextBlockIndex_, BlockCount_);
+    if (blockIndex < 0) {
+        blockIndex = findRun(0, NextBlockIndex_);
+    }
+    if (blockIndex < 0) {
+        return -1;
+    }
+
+    for (int index = blockIndex; index < blockIndex + count; ++index) {
+        BlockStates_[index].store(1, std::memory_order::relaxed);
+    }
+    NextBlockIndex_ = (blockIndex + count) % BlockCount_;
+
+    return blockIndex;
+}
+
+TMutableRef TShmBlockPool::GetData(int blockIndex, i64 size) const
+{
+    if (blockIndex < 0 || size < 0 || blockIndex + GetBlockCount(size) > BlockCount_) {
+        THROW_ERROR_EXCEPTION("Invalid shared memory block range")
+            << TErrorAttribute("block_index", blockIndex)
+            << TErrorAttribute("size", size)
+            << TErrorAttribute("block_count", BlockCount_);
+    }
+    return TMutableRef(Data_ + blockIndex * BlockSize, size);
+}
+
+void TShmBlockPool::Free(int blockIndex, i64 size)
+{
+    auto count = GetBlockCount(size);
+    YT_VERIFY(blockIndex >= 0 && blockIndex + count <= BlockCount_);
+    for (int index = blockIndex; index < blockIndex + count; ++index) {
+        YT_ASSERT(BlockStates_[index].load(std::memory_order::relaxed) != 0);
+        BlockStates_[index].store(0, std::memory_order::release);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShmRingBuffer::TShmRingBuffer(TShmRingHeader* header, TMutableRef data, TShmBlockPool* pool)
+    : Header_(header)
+    , Data_(data.Begin())
+    , Capacity_(data.Size())
+    , Pool_(pool)
+    , ReadCursor_(Header_->ReadPosition.load())
+{
+    YT_VERIFY(IsPowerOf2(Capacity_));
+    YT_VERIFY(Capacity_ <= std::numeric_limits<ui32>::max());
+    YT_VERIFY(reinterpret_cast<uintptr_t>(Data_) % RecordAlignment == 0);
+}
+
+i64 TShmRingBuffer::GetCapacity() const
+{
+    return Capacity_;
+}
+
+i64 TShmRingBuffer::GetMaxRecordSize() const
+{
+    // Guarantees that a record together with the preceding padding always fits into an empty ring.
+    return Capacity_ / 2;
+}
+
+i64 TShmRingBuffer::GetRecordSize(const TSharedRefArray& message)
+{
+    i64 size = sizeof(TRecordHeader) + GetPartDescriptorsSize(message.Size());
+    for (const auto& part : message) {
+        size += AlignUp<i64>(part.Size(), RecordAlignment);
+    }
+    return size;
+}
+
+void TShmRingBuffer::Initialize(TShmRingHeader* header)
+{
+    new (header) TShmRingHeader();
+    header->WritePosition.store(0);
+    header->ReadPosition.store(0);
+    header->ProducerWaiting.store(0);
+    header->AckWaiting.store(0);
+    header->ConsumerWaiting.store(0);
+}
+
+bool TShmRingBuffer::HasFreeSpace(ui64 writePosition, i64 size) const
+{
+    auto readPosition = Header_->ReadPosition.load();
+    return static_cast<i64>(writePosition + size - readPosition) <= Capacity_;
+}
+
+bool TShmRingBuffer::TryWrite(const TSharedRefArray& message, ui64* endPosition, bool* wakeupConsumer)
+{
+    YT_VERIFY(GetRecordSize(message) <= GetMaxRecordSize());
+
+    // Large parts go to the pool while it has room; the rest is stored in the record.
+    TCompactVector<int, 4> blockIndexes(message.Size(), -1);
+    i64 recordSize = sizeof(TRecordHeader) + GetPartDescriptorsSize(message.Size());
+    for (int index = 0; index < std::ssize(message); ++index) {
+        const auto& part = message[index];
+        if (Pool_ && part && static_cast<i64>(part.Size()) >= TShmBlockPool::BlockSize) {
+            blockIndexes[index] = Pool_->TryAllocate(part.Size());
+        }
+        if (blockIndexes[index] < 0) {
+            recordSize += AlignUp<i64>(part.Size(), RecordAlignment);
+        }
+    }
+
+    auto freeBlocks = [&] {
+        for (int index = 0; index < std::ssize(message); ++index) {
+            if (blockIndexes[index] >= 0) {
+                Pool_->Free(blockIndexes[index], message[index].Size());
+            }
+        }
+    };
+
+    auto writePosition = Header_->WritePosition.load(std::memory_order::relaxed);
+    auto offset = static_cast<i64>(writePosition & (Capacity_ - 1));
+    // Records never wrap around; the tail of the ring is skipped if needed.
+    auto paddingSize = offset + recordSize > Capacity_ ? Capacity_ - offset : 0;
+
+    if (!HasFreeSpace(writePosition, paddingSize + recordSize)) {
+        // Recheck after raising the flag to avoid missing a concurrent release.
+        Header_->ProducerWaiting.store(1);
+        if (!HasFreeSpace(writePosition, paddingSize + recordSize)) {
+            freeBlocks();
+            return false;
+        }
+        Header_->ProducerWaiting.store(0);
+    }
+
+    if (paddingSize > 0) {
+        TRecordHeader paddingHeader{
+            .Size = static_cast<ui32>(paddingSize),
+            .PartCount = PaddingPartCount,
+        };
+        ::memcpy(Data_ + offset, &paddingHeader, sizeof(paddingHeader));
+        offset = 0;
+    }
+
+    auto* current = Data_ + offset;
+
+    TRecordHeader recordHeader{
+        .Size = static_cast<ui32>(recordSize),
+        .PartCount = static_cast<ui32>(message.Size()),
+    };
+    ::memcpy(current, &recordHeader, sizeof(recordHeader));
+    current += sizeof(recordHeader);
+
+    auto* partDescriptors = current;
+    current += GetPartDescriptorsSize(message.Size());
+
+    for (int index = 0; index < std::ssize(message); ++index) {
+        const auto& part = message[index];
+        auto blockIndex = blockIndexes[index];
+        TPartDescriptor partDescriptor{
+            .Size = part ? static_cast<ui32>(part.Size()) : NullPartSize,
+            .BlockIndex = blockIndex >= 0 ? static_cast<ui32>(blockIndex) : InlineBlockIndex,
+        };
+        ::memcpy(partDescriptors + index * sizeof(TPartDescriptor), &partDescriptor, sizeof(partDescriptor));
+        if (blockIndex >= 0) {
+            ::memcpy(Pool_->GetData(blockIndex, part.Size()).Begin(), part.Begin(), part.Size());
+        } else if (part) {
+            ::memcpy(current, part.Begin(), part.Size());
+            current += AlignUp<i64>(part.Size(), RecordAlignment);
+        }
+    }
+
+    YT_ASSERT(current == Data_ + offset + recordSize);
+
+    *endPosition = writePosition + paddingSize + recordSize;
+
+    // NB: Sequentially consistent store and load pair with those in #PrepareConsumerWait.
+    Header_->WritePosition.store(*endPosition);
+    *wakeupConsumer = Header_->ConsumerWaiting.load() && Header_->ConsumerWaiting.exchange(0);
+    return true;
+}
+
+bool TShmRingBuffer::IsConsumed(ui64 endPosition) const
+{
+    return Header_->ReadPosition.load() >= endPosition;
+}
+
+bool TShmRingBuffer::PrepareAckWait(ui64 endPosition)
+{
+    // NB: Sequentially consistent store and load pair with those in #Release.
+    Header_->AckWaiting.store(1);
+    if (IsConsumed(endPosition)) {
+        Header_->AckWaiting.store(0);
+        return false;
+    }
+    return true;
+}
+
+bool TShmRingBuffer::TryRead(ui64* position, std::vector<TShmReceivedPart>* parts)
+{
+    auto throwMalformed = [&] (TStringBuf reason) {
+        THROW_ERROR_EXCEPTION("Malformed shared memory ring record: %v", reason)
+            << TErrorAttribute("position", ReadCursor_);
+    };
+
+    while (true) {
+        auto writePosition = Header_->WritePosition.load(std::memory_order::acquire);
+        if (writePosition == ReadCursor_) {
+            return false;
+        }
+
+        auto available = static_cast<i64>(writePosition - ReadCursor_);
+        auto offset = static_cast<i64>(ReadCursor_ & (Capacity_ - 1));
+        if (available > Capacity_ || available < static_cast<i64>(sizeof(TRecordHeader))) {
+            throwMalformed("invalid write position");
+        }
+
+        TRecordHeader header;
+        ::memcpy(&header, Data_ + offset, sizeof(header));
+        if (header.Size < sizeof(TRecordHeader) ||
+            header.Size % RecordAlignment != 0 ||
+            header.Size > available ||
+            offset + header.Size > Capacity_)
+        {
+            throwMalformed("invalid record size");
+        }
+
+        auto recordPosition = ReadCursor_;
+        auto recordEndPosition = ReadCursor_ + header.Size;
+
+        if (header.PartCount == PaddingPartCount) {
+            // Padding is always followed by a record which reclaims it when released.
+            ReadCursor_ = recordEndPosition;
+            AddPendingRecord(recordPosition, recordEndPosition, /*released*/ true);
+            continue;
+        }
+
+        auto* recordBegin = Data_ + offset;
+        auto* recordEnd = recordBegin + header.Size;
+        auto* partDescriptors = recordBegin + sizeof(TRecordHeader);
+        auto* current = partDescriptors + GetPartDescriptorsSize(header.PartCount);
+        if (header.PartCount > header.Size || current > recordEnd) {
+            throwMalformed("invalid part count");
+        }
+
+        parts->clear();
+        parts->reserve(header.PartCount);
+        for (ui32 index = 0; index < header.PartCount; ++index) {
+            TPartDescriptor partDescriptor;
+            ::memcpy(&partDescriptor, partDescriptors + index * sizeof(TPartDescriptor), sizeof(partDescriptor));
+            if (partDescriptor.Size == NullPartSize) {
+                parts->push_back({});
+                continue;
+            }
+            if (partDescriptor.BlockIndex != InlineBlockIndex) {
+                if (!Pool_) {
+                    throwMalformed("unexpected pooled part");
+                }
+                parts->push_back({
+                    .Data = Pool_->GetData(partDescriptor.BlockIndex, partDescriptor.Size),
+                    .BlockIndex = static_cast<int>(partDescriptor.BlockIndex),
+                });
+                continue;
+            }
+            if (static_cast<i64>(partDescriptor.Size) > recordEnd - current) {
+                throwMalformed("invalid part size");
+            }
+            parts->push_back({
+                .Data = TRef(current, partDescriptor.Size),
+            });
+            current += AlignUp<i64>(partDescriptor.Size, RecordAlignment);
+        }
+
+        ReadCursor_ = recordEndPosition;
+        AddPendingRecord(recordPosition, recordEndPosition, /*released*/ false);
+
+        *position = recordPosition;
+        return true;
+    }
+}
+
+bool TShmRingBuffer::PrepareConsumerWait()
+{
+    // NB: Sequentially consistent store and load pair with those in #TryWrite.
+    Header_->ConsumerWaiting.store(1);
+    if (Header_->WritePosition.load() != ReadCursor_) {
+        Header_->ConsumerWaiting.store(0);
+        return false;
+    }
+    return true;
+}
+
+void TShmRingBuffer::AddPendingRecord(ui64 position, ui64 endPosition, bool released)
+{
+    auto guard = Guard(PendingRecordsLock_);
+    PendingRecords_.push_back({
+        .Position = position,
+        .EndPosition = endPosition,
+        .Released = released,
+    });
+}
+
+bool TShmRingBuffer::Release(ui64 position)
+{
+    std::optional<ui64> readPosition;
+    {
+        auto guard = Guard(PendingRecordsLock_);
+
+        auto it = std::lower_bound(
+            PendingRecords_.begin(),
+            PendingRecords_.end(),
+            position,
+            [] (const TPendingRecord& record, ui64 position) {
+                return record.Position < position;
+            });
+        YT_VERIFY(it != PendingRecords_.end() && it->Position == position && !it->Released);
+        it->Released = true;
+
+        while (!PendingRecords_.empty() && PendingRecords_.front().Released) {
+            readPosition = PendingRecords_.front().EndPosition;
+            PendingRecords_.pop_front();
+        }
+
+        if (!readPosition) {
+            return false;
+        }
+
+        // NB: Sequentially consistent store and load pair with those in #TryWrite and #PrepareAckWait.
+        Header_->ReadPosition.store(*readPosition);
+    }
+
+    bool wakeupProducer = Header_->ProducerWaiting.load() && Header_->ProducerWaiting.exchange(0);
+    bool wakeupAckWaiter = Header_->AckWaiting.load() && Header_->AckWaiting.exchange(0);
+    return wakeupProducer || wakeupAckWaiter;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "public.h"
+
+#include <library/cpp/yt/memory/ref.h>
+
+#include <library/cpp/yt/threading/spin_lock.h>
+
+#include <util/generic/size_literals.h>
+
+#include <atomic>
+#include <deque>
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Control block of a ring; resides in the shared memory segment next to the ring data.
+struct TShmRingHeader
+{
+    //! Total number of bytes ever committed by the producer.
+    alignas(64) std::atomic<ui64> WritePosition;
+    //! Total number of bytes ever reclaimed by the consumer.
+    alignas(64) std::atomic<ui64> ReadPosition;
+    //! Raised by the producer when it runs out of space.
+    alignas(64) std::atomic<ui32> ProducerWaiting;
+    //! Raised by the producer when it waits for some records to be consumed.
+    std::atomic<ui32> AckWaiting;
+    //! Raised by the consumer when it runs out of data.
+    std::atomic<ui32> ConsumerWaiting;
+};
+
+static_assert(std::atomic<ui64>::is_always_lock_free);
+static_assert(std::atomic<ui32>::is_always_lock_free);
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Fixed-size blocks of shared memory holding large message parts outside of a ring.
+/*!
+ *  Unlike ring records, blocks are reclaimed in any order, so the parts retained by the consumer
+ *  for long only occupy their own blocks and never prevent the producer from making progress.
+ *
+ *  Blocks are allocated by the producer and freed by the consumer (from any thread).
+ */
+class TShmBlockPool
+{
+public:
+    static constexpr i64 BlockSize = 4_KB;
+
+    TShmBlockPool(std::atomic<ui32>* blockStates, TMutableRef data);
+
+    //! Marks all blocks free in freshly allocated shared memory.
+    static void Initialize(std::atomic<ui32>* blockStates, int blockCount);
+
+    int GetBlockCount() const;
+
+    //! Returns the number of blocks needed to hold #size bytes.
+    static int GetBlockCount(i64 size);
+
+    // Producer side.
+
+    //! Finds a run of free blocks to hold #size bytes and marks them used.
+    //! Returns the index of the first block or |-1| if there is no such run at the moment.
+    int TryAllocate(i64 size);
+
+    // Both sides.
+
+    //! Returns the memory of #size bytes starting at block #blockIndex.
+    //! Throws if the range is out of the pool.
+    TMutableRef GetData(int blockIndex, i64 size) const;
+
+    //! Marks the blocks allocated for #size bytes starting at #blockIndex free.
+    void Free(int blockIndex, i64 size);
+
+private:
+    std::atomic<ui32>* const BlockStates_;
+    char* const Data_;
+    const int BlockCount_;
+
+    //! Producer-side hint for the next allocation.
+    int NextBlockIndex_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! A part of a message fetched from a ring.
+struct TShmReceivedPart
+{
+    //! Null for null parts.
+    TRef Data;
+    //! Index of the first pool block holding the part or |-1| if the part is stored in the ring record.
+    /*!
+     *  Pool blocks are owned by the consumer once the part has been read and must be freed via
+     *  #TShmBlockPool::Free; ring memory only stays valid until the record is released.
+     */
+    int BlockIndex = -1;
+};
+
+//! A single-producer single-consumer ring of bus messages placed in shared memory.
+/*!
+ *  Every message is stored contiguously as a record: a header, part descriptors and then
+ *  the parts themselves, each aligned to 8 bytes. Records never wrap around the end
+ *  of the ring; the producer inserts a padding record instead.
+ *
+ *  Parts of at least #TShmBlockPool::BlockSize bytes are placed into the block pool (if any)
+ *  rather than into the record while the pool has room for them.
+ *
+ *  The consumer may release records in any order; space is reclaimed in ring order, though.
+ *  Hence the consumer is expected to release records promptly, e.g. by copying the ring-resident
+ *  parts out, while pooled parts may be retained for as long as needed.
+ *
+ *  Both sides may sleep when there is nothing to do. Before sleeping a side raises its
+ *  waiting flag in #TShmRingHeader; the other side clears the flag and reports
+ *  that a wakeup is needed (which is delivered out of band).
+ *
+ *  Producer and consumer methods must be invoked from at most one thread at a time
+ *  (per side), except for #Release which is thread-safe.
+ */
+class TShmRingBuffer
+{
+public:
+    //! #pool may be null in which case all parts are stored in the ring.
+    TShmRingBuffer(TShmRingHeader* header, TMutableRef data, TShmBlockPool* pool = nullptr);
+
+    i64 GetCapacity() const;
+
+    //! Returns the number of bytes occupied by #message when stored in a ring
+    //! with all parts placed into the record.
+    static i64 GetRecordSize(const TSharedRefArray& message);
+
+    //! Returns the maximum size of a record the ring can hold.
+    i64 GetMaxRecordSize() const;
+
+    //! Initializes an empty ring in freshly allocated shared memory.
+    static void Initialize(TShmRingHeader* header);
+
+    // Producer side.
+
+    //! Copies #message into the ring.
+    /*!
+     *  The record size of #message must not exceed #GetMaxRecordSize.
+     *
+     *  Returns |false| if there is not enough free space at the moment. The producer is
+     *  then marked as waiting and #Release reports the need for a wakeup once some space is reclaimed.
+     *  On success, #endPosition is set to the position the consumer is to pass for the record
+     *  to be consumed (see #IsConsumed) and #wakeupConsumer is set if the consumer is sleeping
+     *  and must be woken up.
+     */
+    bool TryWrite(const TSharedRefArray& message, ui64* endPosition, bool* wakeupConsumer);
+
+    //! Returns |true| if all the records up to #endPosition have been released by the consumer.
+    bool IsConsumed(ui64 endPosition) const;
+
+    //! Marks the producer as waiting for the records up to #endPosition to be consumed.
+    //! Returns |false| (and clears the mark) if they have been consumed meanwhile.
+    bool PrepareAckWait(ui64 endPosition);
+
+    // Consumer side.
+
+    //! Fetches the next message from the ring.
+    /*!
+     *  Returns |false| if the ring is empty. Otherwise fills #parts and #position with the record
+     *  position to be passed to #Release once the ring-resident parts are no longer needed.
+     *
+     *  Throws if the ring contents are malformed.
+     */
+    bool TryRead(ui64* position, std::vector<TShmReceivedPart>* parts);
+
+    //! Marks the consumer as waiting for data.
+    //! Returns |false| (and clears the mark) if some data has arrived meanwhile.
+    bool PrepareConsumerWait();
+
+    //! Releases the record at #position.
+    //! Returns |true| if the producer is waiting for space or for an ack and must be woken up.
+    bool Release(ui64 position);
+
+private:
+    TShmRingHeader* const Header_;
+    char* const Data_;
+    const i64 Capacity_;
+    TShmBlockPool* const Pool_;
+
+    //! Position of the next record to be read by the consumer.
+    ui64 ReadCursor_;
+
+    struct TPendingRecord
+    {
+        ui64 Position;
+        ui64 EndPosition;
+        bool Released;
+    };
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, PendingRecordsLock_);
+    //! Records that have been read but not reclaimed yet, in ring order.
+    std::deque<TPendingRecord> PendingRecords_;
+
+    bool HasFreeSpace(ui64 writePosition, i64 size) const;
+    void AddPendingRecord(ui64 position, ui64 endPosition, bool released);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,235 @@
+#include "segment.h"
+
+#include <yt/yt/core/misc/error.h>
+#include <yt/yt/core/misc/proc.h>
+
+#include <util/generic/bitops.h>
+#include <util/generic/size_literals.h>
+
+#include <util/system/align.h>
+
+#ifdef _linux_
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+
+    // Not every libc we build against exposes memfd sealing constants.
+    #ifndef MFD_CLOEXEC
+        #define MFD_CLOEXEC 0x0001U
+    #endif
+    #ifndef MFD_ALLOW_SEALING
+        #define MFD_ALLOW_SEALING 0x0002U
+    #endif
+    #ifndef F_ADD_SEALS
+        #define F_ADD_SEALS 1033
+        #define F_GET_SEALS 1034
+        #define F_SEAL_SEAL 0x0001
+        #define F_SEAL_SHRINK 0x0002
+        #define F_SEAL_GROW 0x0004
+    #endif
+#endif
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr ui32 ShmSegmentSignature = 0x6d687362;
+constexpr ui32 ShmSegmentVersion = 2;
+constexpr i64 MaxRingCapacity = 1_GB;
+
+#ifdef _linux_
+// The segment size is fixed once it is sealed, so the peer cannot
+// truncate it under the mapping and make accesses fault with SIGBUS.
+constexpr int RequiredShmSegmentSeals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL;
+#endif
+
+struct TShmSegmentHeader
+{
+    ui32 Signature;
+    ui32 Version;
+    ui64 RingCapacity;
+    TShmRingHeader Rings[TEnumTraits<EShmRing>::GetDomainSize()];
+};
+
+constexpr int RingCount = TEnumTraits<EShmRing>::GetDomainSize();
+constexpr i64 RingDataOffset = AlignUp<i64>(sizeof(TShmSegmentHeader), 4_KB);
+
+// The segment consists of the header, ring data, block pool states and block pool data;
+// every ring has a block pool of the same capacity.
+
+i64 GetPoolBlockCount(i64 ringCapacity)
+{
+    return ringCapacity / TShmBlockPool::BlockSize;
+}
+
+i64 GetBlockStatesOffset(i64 ringCapacity)
+{
+    return RingDataOffset + ringCapacity * RingCount;
+}
+
+i64 GetBlockDataOffset(i64 ringCapacity)
+{
+    auto blockStatesSize = GetPoolBlockCount(ringCapacity) * RingCount * static_cast<i64>(sizeof(std::atomic<ui32>));
+    return GetBlockStatesOffset(ringCapacity) + AlignUp<i64>(blockStatesSize, 4_KB);
+}
+
+i64 GetSegmentSize(i64 ringCapacity)
+{
+    return GetBlockDataOffset(ringCapacity) + GetPoolBlockCount(ringCapacity) * TShmBlockPool::BlockSize * RingCount;
+}
+
+std::atomic<ui32>* GetBlockStates(void* address, i64 ringCapacity, int ringIndex)
+{
+    auto* blockStates = reinterpret_cast<std::atomic<ui32>*>(static_cast<char*>(address) + GetBlockStatesOffset(ringCapacity));
+    return blockStates + GetPoolBlockCount(ringCapacity) * ringIndex;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TShmSegment::TShmSegment(void* address, i64 size)
+    : Address_(address)
+    , Size_(size)
+{
+    auto* header = static_cast<TShmSegmentHeader*>(Address_);
+    auto ringCapacity = static_cast<i64>(header->RingCapacity);
+    auto* data = static_cast<char*>(Address_) + RingDataOffset;
+    auto* blockData = static_cast<char*>(Address_) + GetBlockDataOffset(ringCapacity);
+    auto poolCapacity = GetPoolBlockCount(ringCapacity) * TShmBlockPool::BlockSize;
+    for (auto ring : TEnumTraits<EShmRing>::GetDomainValues()) {
+        auto ringIndex = static_cast<int>(ring);
+        Pools_[ring] = std::make_unique<TShmBlockPool>(
+            GetBlockStates(Address_, ringCapacity, ringIndex),
+            TMutableRef(blockData + poolCapacity * ringIndex, poolCapacity));
+        Rings_[ring] = std::make_unique<TShmRingBuffer>(
+            &header->Rings[ringIndex],
+            TMutableRef(data + ringCapacity * ringIndex, ringCapacity),
+            Pools_[ring].get());
+    }
+}
+
+TShmSegment::~TShmSegment()
+{
+#ifdef _linux_
+    YT_VERIFY(::munmap(Address_, Size_) == 0);
+#endif
+}
+
+TShmSegmentPtr TShmSegment::Create(i64 ringCapacity, TFile* file)
+{
+#ifdef _linux_
+    YT_VERIFY(IsPowerOf2(ringCapacity) && ringCapacity <= MaxRingCapacity);
+
+    auto size = GetSegmentSize(ringCapacity);
+
+    *file = MemfdCreate("yt-bus-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    file->Resize(size);
+
+    if (::fcntl(file->GetHandle(), F_ADD_SEALS, RequiredShmSegmentSeals) != 0) {
+        THROW_ERROR_EXCEPTION("Error sealing shared memory segment")
+            << TError::FromSystem();
+    }
+
+    auto* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file->GetHandle(), 0);
+    if (address == MAP_FAILED) {
+        THROW_ERROR_EXCEPTION("Error mapping shared memory segment")
+            << TError::FromSystem();
+    }
+
+    auto* header = static_cast<TShmSegmentHeader*>(address);
+    header->Signature = ShmSegmentSignature;
+    header->Version = ShmSegmentVersion;
+    header->RingCapacity = ringCapacity;
+    for (int ringIndex = 0; ringIndex < RingCount; ++ringIndex) {
+        TShmRingBuffer::Initialize(&header->Rings[ringIndex]);
+        TShmBlockPool::Initialize(
+            GetBlockStates(address, ringCapacity, ringIndex),
+            GetPoolBlockCount(ringCapacity));
+    }
+
+    return New<TShmSegment>(address, size);
+#else
+    Y_UNUSED(ringCapacity);
+    Y_UNUSED(file);
+    THROW_ERROR_EXCEPTION("Shared memory bus is not supported on this platform");
+#endif
+}
+
+TShmSegmentPtr TShmSegment::Open(TFileDescriptor fd)
+{
+#ifdef _linux_
+    auto seals = ::fcntl(fd, F_GET_SEALS);
+    if (seals == -1) {
+        THROW_ERROR_EXCEPTION("Error getting shared memory segment seals")
+            << TError::FromSystem();
+    }
+    if ((seals & RequiredShmSegmentSeals) != RequiredShmSegmentSeals) {
+        THROW_ERROR_EXCEPTION("Shared memory segment is not sealed")
+            << TErrorAttribute("seals", seals)
+            << TErrorAttribute("required_seals", RequiredShmSegmentSeals);
+    }
+
+    struct stat stat;
+    if (::fstat(fd, &stat) != 0) {
+        THROW_ERROR_EXCEPTION("Error getting shared memory segment size")
+            << TError::FromSystem();
+    }
+
+    auto size = static_cast<i64>(stat.st_size);
+    if (size < RingDataOffset) {
+        THROW_ERROR_EXCEPTION("Shared memory segment is too small")
+            << TErrorAttribute("size", size);
+    }
+
+    auto* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        THROW_ERROR_EXCEPTION("Error mapping shared memory segment")
+            << TError::FromSystem();
+    }
+
+    try {
+        const auto* header = static_cast<const TShmSegmentHeader*>(address);
+        if (header->Signature != ShmSegmentSignature) {
+            THROW_ERROR_EXCEPTION("Invalid shared memory segment signature: expected %x, actual %x",
+                ShmSegmentSignature,
+                header->Signature);
+        }
+        if (header->Version != ShmSegmentVersion) {
+            THROW_ERROR_EXCEPTION("Unsupported shared memory segment version: expected %v, actual %v",
+                ShmSegmentVersion,
+                header->Version);
+        }
+        auto ringCapacity = static_cast<i64>(header->RingCapacity);
+        if (!IsPowerOf2(ringCapacity) || ringCapacity > MaxRingCapacity || GetSegmentSize(ringCapacity) != size) {
+            THROW_ERROR_EXCEPTION("Invalid shared memory segment ring capacity")
+                << TErrorAttribute("ring_capacity", ringCapacity)
+                << TErrorAttribute("size", size);
+        }
+    } catch (const std::exception&) {
+        YT_VERIFY(::munmap(address, size) == 0);
+        throw;
+    }
+
+    return New<TShmSegment>(address, size);
+#else
+    Y_UNUSED(fd);
+    THROW_ERROR_EXCEPTION("Shared memory bus is not supported on this platform");
+#endif
+}
+
+TShmRingBuffer* TShmSegment::GetRing(EShmRing ring)
+{
+    return Rings_[ring].get();
+}
+
+TShmBlockPool* TShmSegment::GetPool(EShmRing ring)
+{
+    return Pools_[ring].get();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "public.h"
+#include "ring_buffer.h"
+
+#include <library/cpp/yt/misc/enum.h>
+
+#include <util/system/file.h>
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+DEFINE_ENUM(EShmRing,
+    ((ClientToServer) (0))
+    ((ServerToClient) (1))
+);
+
+//! A memfd-backed shared memory segment holding a pair of rings, one per direction,
+//! each accompanied by a block pool for large message parts.
+/*!
+ *  The segment stays mapped while there are references to it, in particular
+ *  while some received message parts referring to its memory are alive.
+ */
+class TShmSegment
+    : public TRefCounted
+{
+public:
+    //! Creates and maps a new segment with rings of #ringCapacity bytes each.
+    //! #file receives the memfd which is to be passed to the peer; its size is sealed.
+    static TShmSegmentPtr Create(i64 ringCapacity, TFile* file);
+
+    //! Maps the segment created by the peer and received via #fd.
+    //! The descriptor is not retained. Throws if the segment is malformed
+    //! or its size is not sealed.
+    static TShmSegmentPtr Open(TFileDescriptor fd);
+
+    ~TShmSegment();
+
+    TShmRingBuffer* GetRing(EShmRing ring);
+    TShmBlockPool* GetPool(EShmRing ring);
+
+private:
+    void* const Address_;
+    const i64 Size_;
+
+    TEnumIndexedVector<EShmRing, std::unique_ptr<TShmBlockPool>> Pools_;
+    TEnumIndexedVector<EShmRing, std::unique_ptr<TShmRingBuffer>> Rings_;
+
+    TShmSegment(void* address, i64 size);
+
+    DECLARE_NEW_FRIEND();
+};
+
+DEFINE_REFCOUNTED_TYPE(TShmSegment)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
@@ -0,0 +1,285 @@
+#include "server.h"
+#include "config.h"
+#include "connection.h"
+
+#include <yt/yt/core/bus/server.h>
+
+#include <yt/yt/core/bus/tcp/dispatcher_impl.h>
+
+#include <yt/yt/core/concurrency/pollable_detail.h>
+
+#include <yt/yt/core/misc/atomic_object.h>
+#include <yt/yt/core/misc/fs.h>
+
+#include <yt/yt/core/net/address.h>
+#include <yt/yt/core/net/socket.h>
+
+#include <yt/yt/core/ytree/convert.h>
+#include <yt/yt/core/ytree/fluent.h>
+
+#include <library/cpp/yt/threading/rw_spin_lock.h>
+#include <library/cpp/yt/threading/spin_lock.h>
+
+namespace NYT::NBus {
+
+using namespace NConcurrency;
+using namespace NNet;
+using namespace NYTree;
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TShmBusServer
+    : public TPollableBase
+{
+public:
+    TShmBusServer(
+        TShmBusServerConfigPtr config,
+        IPollerPtr poller,
+        IMessageHandlerPtr handler)
+        : Config_(std::move(config))
+        , Poller_(std::move(poller))
+        , Handler_(std::move(handler))
+        , EndpointDescription_(Format("shm://%v", Config_->UnixDomainSocketPath))
+        , Logger(BusLogger.WithTag("UnixDomainSocketPath: %v, Transport: Shm",
+            Config_->UnixDomainSocketPath))
+    {
+        YT_VERIFY(Poller_);
+        YT_VERIFY(Handler_);
+    }
+
+    ~TShmBusServer()
+    {
+        CloseServerSocket();
+    }
+
+    void Start()
+    {
+        OpenServerSocket();
+        if (!Poller_->TryRegister(this)) {
+            CloseServerSocket();
+            THROW_ERROR_EXCEPTION("Cannot register server pollable");
+        }
+        ArmPoller();
+    }
+
+    TFuture<void> Stop()
+    {
+        YT_LOG_INFO("Stopping shared memory bus server");
+        UnarmPoller();
+        return Poller_->Unregister(this).Apply(BIND([this, this_ = MakeStrong(this)] {
+            YT_LOG_INFO("Shared memory bus server stopped");
+        }));
+    }
+
+    // IPollable implementation.
+    const TString& GetLoggingTag() const override
+    {
+        return Logger.GetTag();
+    }
+
+    void OnEvent(EPollControl /*control*/) override
+    {
+        OnAccept();
+    }
+
+    void OnShutdown() override
+    {
+        {
+            auto guard = Guard(ControlSpinLock_);
+            CloseServerSocket();
+        }
+
+        decltype(Connections_) connections;
+        {
+            auto guard = WriterGuard(ConnectionsSpinLock_);
+            std::swap(connections, Connections_);
+        }
+
+        for (const auto& connection : connections) {
+            connection->Terminate(TError(
+                NBus::EErrorCode::TransportError,
+                "Bus server terminated"));
+        }
+    }
+
+private:
+    const TShmBusServerConfigPtr Config_;
+    const IPollerPtr Poller_;
+    const IMessageHandlerPtr Handler_;
+    const TString EndpointDescription_;
+
+    const NLogging::TLogger Logger;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, ControlSpinLock_);
+    SOCKET ServerSocket_ = INVALID_SOCKET;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TReaderWriterSpinLock, ConnectionsSpinLock_);
+    THashSet<TShmConnectionPtr> Connections_;
+
+    void OnConnectionTerminated(const TShmConnectionPtr& connection, const TError& /*error*/)
+    {
+        auto guard = WriterGuard(ConnectionsSpinLock_);
+        // NB: Connection could be missing, see OnShutdown.
+        Connections_.erase(connection);
+    }
+
+    void OpenServerSocket()
+    {
+        auto guard = Guard(ControlSpinLock_);
+
+        YT_LOG_DEBUG("Opening server socket");
+
+        ServerSocket_ = CreateUnixServerSocket();
+
+        try {
+            // NB: Unix domain socket path cannot be longer than 108 symbols, so let's try to shorten it.
+            auto address = TNetworkAddress::CreateUnixDomainSocketAddress(NFS::GetShortestPath(Config_->UnixDomainSocketPath));
+            BindSocket(ServerSocket_, address);
+            ListenSocket(ServerSocket_, Config_->MaxBacklogSize);
+        } catch (const std::exception& ex) {
+            CloseServerSocket();
+            THROW_ERROR_EXCEPTION(NBus::EErrorCode::TransportError, "Failed to open a shared memory server socket")
+                << ex;
+        }
+
+        YT_LOG_DEBUG("Server socket opened");
+    }
+
+    void CloseServerSocket()
+    {
+        if (ServerSocket_ != INVALID_SOCKET) {
+            CloseSocket(ServerSocket_);
+            unlink(Config_->UnixDomainSocketPath.c_str());
+            ServerSocket_ = INVALID_SOCKET;
+            YT_LOG_DEBUG("Server socket closed");
+        }
+    }
+
+    void OnAccept()
+    {
+        while (true) {
+            TNetworkAddress clientAddress;
+            SOCKET clientSocket;
+            try {
+                clientSocket = AcceptSocket(ServerSocket_, &clientAddress);
+            } catch (const std::exception& ex) {
+                YT_LOG_WARNING(ex, "Error accepting client connection");
+                break;
+            }
+
+            if (clientSocket == INVALID_SOCKET) {
+                break;
+            }
+
+            auto connectionId = TConnectionId::Create();
+
+            YT_LOG_DEBUG("Connection accepted (ConnectionId: %v)",
+                connectionId);
+
+            auto endpointAttributes = ConvertToAttributes(BuildYsonStringFluently()
+                .BeginMap()
+                    .Item("address").Value(EndpointDescription_)
+                    .Item("connection_id").Value(connectionId)
+                .EndMap());
+
+            auto connection = New<TShmConnection>(
+                EConnectionType::Server,
+                connectionId,
+                clientSocket,
+                EndpointDescription_,
+                *endpointAttributes,
+                Handler_,
+                TTcpDispatcher::TImpl::Get()->GetXferPoller());
+
+            {
+                auto guard = WriterGuard(ConnectionsSpinLock_);
+                YT_VERIFY(Connections_.insert(connection).second);
+            }
+
+            connection->SubscribeTerminated(BIND_NO_PROPAGATE(
+                &TShmBusServer::OnConnectionTerminated,
+                MakeWeak(this),
+                connection));
+
+            connection->StartServer();
+        }
+    }
+
+    void ArmPoller()
+    {
+        auto guard = Guard(ControlSpinLock_);
+        if (ServerSocket_ != INVALID_SOCKET) {
+            Poller_->Arm(ServerSocket_, this, EPollControl::Read | EPollControl::EdgeTriggered);
+        }
+    }
+
+    void UnarmPoller()
+    {
+        auto guard = Guard(ControlSpinLock_);
+        if (ServerSocket_ != INVALID_SOCKET) {
+            Poller_->Unarm(ServerSocket_, this);
+        }
+    }
+};
+
+DECLARE_REFCOUNTED_CLASS(TShmBusServer)
+DEFINE_REFCOUNTED_TYPE(TShmBusServer)
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! A lightweight proxy controlling the lifetime of a shared memory bus server.
+/*!
+ *  When the last strong reference vanishes, it unregisters the underlying
+ *  server instance.
+ */
+class TShmBusServerProxy
+    : public IBusServer
+{
+public:
+    explicit TShmBusServerProxy(TShmBusServerConfigPtr config)
+        : Config_(std::move(config))
+    {
+        YT_VERIFY(Config_);
+    }
+
+    ~TShmBusServerProxy()
+    {
+        YT_UNUSED_FUTURE(Stop());
+    }
+
+    void Start(IMessageHandlerPtr handler) override
+    {
+        auto server = New<TShmBusServer>(
+            Config_,
+            TTcpDispatcher::TImpl::Get()->GetAcceptorPoller(),
+            std::move(handler));
+
+        Server_.Store(server);
+        server->Start();
+    }
+
+    TFuture<void> Stop() override
+    {
+        if (auto server = Server_.Exchange(nullptr)) {
+            return server->Stop();
+        } else {
+            return VoidFuture;
+        }
+    }
+
+private:
+    const TShmBusServerConfigPtr Config_;
+
+    TAtomicObject<TShmBusServerPtr> Server_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+IBusServerPtr CreateShmBusServer(TShmBusServerConfigPtr config)
+{
+    return New<TShmBusServerProxy>(std::move(config));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
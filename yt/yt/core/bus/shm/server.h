@@ -0,0 +1,15 @@
+#pragma once
+
+#include "public.h"
+
+namespace NYT::NBus {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Creates a server accepting shared memory connections from processes on the same host
+//! (see #CreateShmBusClient).
+IBusServerPtr CreateShmBusServer(TShmBusServerConfigPtr config);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NBus
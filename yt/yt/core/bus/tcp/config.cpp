@@ -2,6 +2,8 @@
 
 #include <yt/yt/core/net/address.h>
 
+#include <util/generic/size_literals.h>
+
 namespace NYT::NBus {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +24,13 @@ void TTcpDispatcherConfig::Register(TRegistrar registrar)
     registrar.Parameter("thread_pool_size", &TThis::ThreadPoolSize)
         .Default(8);
 
+    registrar.Parameter("poller_type", &TThis::PollerType)
+        .Default(NConcurrency::EPollerType::Epoll);
+
+    registrar.Parameter("checksum_thread_pool_size", &TThis::ChecksumThreadPoolSize)
+        .GreaterThan(0)
+        .Default(2);
+
     registrar.Parameter("network_bandwidth", &TThis::NetworkBandwidth)
         .Default();
 
@@ -37,6 +46,8 @@ TTcpDispatcherConfigPtr TTcpDispatcherConfig::ApplyDynamic(
 {
     auto mergedConfig = New<TTcpDispatcherConfig>();
     mergedConfig->ThreadPoolSize = dynamicConfig->ThreadPoolSize.value_or(ThreadPoolSize);
+    mergedConfig->PollerType = PollerType;
+    mergedConfig->ChecksumThreadPoolSize = dynamicConfig->ChecksumThreadPoolSize.value_or(ChecksumThreadPoolSize);
     mergedConfig->Networks = dynamicConfig->Networks.value_or(Networks);
     mergedConfig->MultiplexingBands = dynamicConfig->MultiplexingBands.value_or(MultiplexingBands);
     mergedConfig->Postprocess();
@@ -51,6 +62,10 @@ void TTcpDispatcherDynamicConfig::Register(TRegistrar registrar)
         .Optional()
         .GreaterThan(0);
 
+    registrar.Parameter("checksum_thread_pool_size", &TThis::ChecksumThreadPoolSize)
+        .Optional()
+        .GreaterThan(0);
+
     registrar.Parameter("network_bandwidth", &TThis::NetworkBandwidth)
         .Default();
 
@@ -107,6 +122,15 @@ void TBusConfig::Register(TRegistrar registrar)
         .Default(true);
     registrar.Parameter("generate_checksums", &TThis::GenerateChecksums)
         .Default(true);
+    registrar.Parameter("checksum_offload_threshold", &TThis::ChecksumOffloadThreshold)
+        .GreaterThan(0)
+        .Default(1_MB);
+    registrar.Parameter("enable_zero_copy_send", &TThis::EnableZeroCopySend)
+        .Default(false);
+    // Below this size page pinning and completion notifications cost more than copying.
+    registrar.Parameter("zero_copy_send_threshold", &TThis::ZeroCopySendThreshold)
+        .GreaterThan(0)
+        .Default(64_KB);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -5,6 +5,8 @@
 #include <yt/yt/core/net/config.h>
 #include <yt/yt/core/net/address.h>
 
+#include <yt/yt/core/concurrency/public.h>
+
 #include <yt/yt/core/ytree/yson_struct.h>
 
 namespace NYT::NBus {
@@ -33,6 +35,14 @@ class TTcpDispatcherConfig
 public:
     int ThreadPoolSize;
 
+    //! API used by bus threads to wait for socket readiness.
+    //! Falls back to epoll if io_uring is not available.
+    NConcurrency::EPollerType PollerType;
+
+    //! Number of threads computing checksums of large outcoming messages
+    //! (see TBusConfig::ChecksumOffloadThreshold).
+    int ChecksumThreadPoolSize;
+
     //! Used for profiling export and alerts.
     std::optional<i64> NetworkBandwidth;
 
@@ -57,6 +67,8 @@ class TTcpDispatcherDynamicConfig
 public:
     std::optional<int> ThreadPoolSize;
 
+    std::optional<int> ChecksumThreadPoolSize;
+
     std::optional<i64> NetworkBandwidth;
 
     std::optional<THashMap<TString, std::vector<NNet::TIP6Network>>> Networks;
@@ -87,6 +99,15 @@ public:
     bool VerifyChecksums;
     bool GenerateChecksums;
 
+    //! If set, checksums of outcoming messages with at least this many bytes to checksum
+    //! are computed in a separate thread pool rather than in bus threads.
+    std::optional<i64> ChecksumOffloadThreshold;
+
+    //! If set, message parts of at least #ZeroCopySendThreshold bytes are sent
+    //! with MSG_ZEROCOPY instead of being copied into the kernel.
+    bool EnableZeroCopySend;
+    i64 ZeroCopySendThreshold;
+
     REGISTER_YSON_STRUCT(TBusConfig);
 
     static void Register(TRegistrar registrar);
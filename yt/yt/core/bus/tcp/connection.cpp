@@ -4,12 +4,14 @@
 #include "server.h"
 #include "dispatcher_impl.h"
 
+#include <yt/yt/core/misc/checksum.h>
 #include <yt/yt/core/misc/fs.h>
 #include <yt/yt/core/misc/proc.h>
 
 #include <yt/yt/core/net/socket.h>
 #include <yt/yt/core/net/dialer.h>
 
+#include <yt/yt/core/concurrency/delayed_executor.h>
 #include <yt/yt/core/concurrency/thread_affinity.h>
 
 #include <yt/yt/core/ytree/convert.h>
@@ -24,6 +26,7 @@
 
 #ifdef __linux__
 #include <netinet/tcp.h>
+#include <linux/errqueue.h>
 #endif
 
 #include <cerrno>
@@ -47,7 +50,11 @@ static constexpr size_t MaxFragmentsPerWrite = 256;
 static constexpr size_t WriteBufferSize = 16_KB;
 static constexpr size_t MaxBatchWriteSize = 64_KB;
 static constexpr size_t MaxWriteCoalesceSize = 1_KB;
+// Zero-copy sends bypass the copy into the socket buffer and thus
+// may be batched more aggressively.
+static constexpr size_t MaxZeroCopyBatchWriteSize = 1_MB;
 static constexpr auto WriteTimeWarningThreshold = TDuration::MilliSeconds(100);
+static constexpr auto ZeroCopySendDrainPeriod = TDuration::MilliSeconds(100);
 
 static constexpr auto HandshakePacketId = TPacketId(1, 0, 0, 0);
 
@@ -60,6 +67,27 @@ struct TTcpConnectionWriteBufferTag { };
 
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+std::vector<TChecksum> ComputePartChecksums(
+    const TSharedRefArray& message,
+    int checksummedPartCount,
+    std::vector<TChecksum> partChecksums)
+{
+    partChecksums.resize(message.Size(), NullChecksum);
+    for (int index = 0; index < std::ssize(message); ++index) {
+        const auto& part = message[index];
+        if (part && IsChecksummedPart(index, checksummedPartCount) && partChecksums[index] == NullChecksum) {
+            partChecksums[index] = GetChecksum(part);
+        }
+    }
+    return partChecksums;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
 bool TTcpConnection::TPacket::MarkEncoded()
 {
     auto expected = EPacketState::Queued;
@@ -89,6 +117,56 @@ void TTcpConnection::TPacket::EnableCancel(TTcpConnectionPtr connection)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class TTcpConnection::TZeroCopySendDrainer
+    : public TRefCounted
+{
+public:
+    TZeroCopySendDrainer(
+        SOCKET socket,
+        std::deque<TZeroCopySend> pendingSends,
+        NLogging::TLogger logger)
+        : Socket_(socket)
+        , PendingSends_(std::move(pendingSends))
+        , Logger(std::move(logger))
+    {
+        // Let the peer see the connection closed while the sends are being completed.
+        ::shutdown(Socket_, SHUT_RDWR);
+
+        YT_LOG_DEBUG("Waiting for zero-copy sends to complete before closing socket (PendingSendCount: %v)",
+            PendingSends_.size());
+    }
+
+    ~TZeroCopySendDrainer()
+    {
+        NNet::CloseSocket(Socket_);
+    }
+
+    void Run(IInvokerPtr invoker)
+    {
+        std::vector<TZeroCopySend> completedSends;
+        DrainZeroCopyCompletions(Socket_, &PendingSends_, &completedSends, Logger);
+
+        if (PendingSends_.empty()) {
+            YT_LOG_DEBUG("Zero-copy sends completed, closing socket");
+            return;
+        }
+
+        // Once the socket is shut down the kernel either delivers or drops the data, and then
+        // reports the completions; no poller is armed for the socket anymore, so poll its error queue.
+        TDelayedExecutor::Submit(
+            BIND(&TZeroCopySendDrainer::Run, MakeStrong(this), invoker),
+            ZeroCopySendDrainPeriod,
+            invoker);
+    }
+
+private:
+    const SOCKET Socket_;
+    std::deque<TZeroCopySend> PendingSends_;
+    const NLogging::TLogger Logger;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 TTcpConnection::TTcpConnection(
     TBusConfigPtr config,
     EConnectionType connectionType,
@@ -113,6 +191,7 @@ TTcpConnection::TTcpConnection(
     , UnixDomainSocketPath_(unixDomainSocketPath)
     , Handler_(std::move(handler))
     , Poller_(std::move(poller))
+    , ReceivingPoller_(DynamicPointerCast<IReceivingPoller>(Poller_))
     , Logger(BusLogger.WithTag("ConnectionId: %v, RemoteAddress: %v",
         Id_,
         EndpointDescription_))
@@ -134,6 +213,7 @@ TTcpConnection::~TTcpConnection()
 
 void TTcpConnection::Close()
 {
+    TIntrusivePtr<TZeroCopySendDrainer> zeroCopySendDrainer;
     {
         auto guard = Guard(Lock_);
 
@@ -150,12 +230,30 @@ void TTcpConnection::Close()
 
         UnarmPoller();
 
+        // Zero-copy sends still reference message data until the kernel reports their completion
+        // via the socket error queue; hand the socket over to a drainer instead of closing it.
+        if (!PendingZeroCopySends_.empty() && Socket_ != INVALID_SOCKET) {
+            ReadZeroCopyCompletions();
+        }
+        if (!PendingZeroCopySends_.empty() && Socket_ != INVALID_SOCKET) {
+            zeroCopySendDrainer = New<TZeroCopySendDrainer>(
+                std::exchange(Socket_, INVALID_SOCKET),
+                std::move(PendingZeroCopySends_),
+                Logger);
+            PendingZeroCopySends_.clear();
+            HasPendingZeroCopySends_.store(false, std::memory_order::relaxed);
+        }
+
         CloseSocket();
 
         State_ = EState::Closed;
         PendingControl_.store(static_cast<ui64>(EPollControl::Offline));
     }
 
+    if (zeroCopySendDrainer) {
+        zeroCopySendDrainer->Run(Poller_->GetInvoker());
+    }
+
     DiscardOutcomingMessages();
     DiscardUnackedMessages();
 
@@ -226,6 +324,12 @@ void TTcpConnection::RunPeriodicCheck()
         return;
     }
 
+    // Error queue notifications may be coalesced by the kernel and missed by an idle connection;
+    // make sure pinned messages are released eventually.
+    if (HasPendingZeroCopySends_.load(std::memory_order::relaxed)) {
+        Poller_->Retry(this);
+    }
+
     FlushStatistics();
 
     auto now = NProfiling::GetCpuInstant();
@@ -389,6 +493,10 @@ void TTcpConnection::Open()
         LastIncompleteWriteTime_ = NProfiling::GetCpuInstant();
     }
 
+    if (Config_->EnableZeroCopySend) {
+        InitSocketZeroCopy();
+    }
+
     UpdateConnectionCount(+1);
     FlushStatistics();
 
@@ -812,6 +920,12 @@ void TTcpConnection::OnEvent(EPollControl control)
         OnSocketRead();
     }
 
+    // Completions are reported via the socket error queue regardless of the connection state
+    // and of whether there is anything else to write.
+    if (!PendingZeroCopySends_.empty()) {
+        ReadZeroCopyCompletions();
+    }
+
     if (State_ == EState::Open) {
         if (!std::exchange(HandshakeEnqueued_, true)) {
             EnqueueHandshake();
@@ -927,7 +1041,9 @@ bool TTcpConnection::HasUnreadData() const
 bool TTcpConnection::ReadSocket(char* buffer, size_t size, size_t* bytesRead)
 {
     NProfiling::TWallTimer timer;
-    auto result = HandleEintr(recv, Socket_, buffer, size, 0);
+    auto result = ReceivingPoller_
+        ? ReceivingPoller_->Receive(Socket_, this, TMutableRef(buffer, size))
+        : HandleEintr(recv, Socket_, buffer, size, 0);
     auto elapsed = timer.GetElapsedTime();
     if (elapsed > ReadTimeWarningThreshold) {
         YT_LOG_DEBUG("Socket read took too long (Elapsed: %v)",
@@ -1154,14 +1270,18 @@ bool TTcpConnection::WriteFragments(size_t* bytesWritten)
     auto fragmentIt = EncodedFragments_.begin();
     auto fragmentEnd = EncodedFragments_.end();
 
+    // Zero-copy fragments and regular ones are never sent by the same call.
+    bool zeroCopy = fragmentIt != fragmentEnd && fragmentIt->ZeroCopyHolder;
+
     SendVector_.clear();
-    size_t bytesAvailable = MaxBatchWriteSize;
+    size_t bytesAvailable = zeroCopy ? MaxZeroCopyBatchWriteSize : MaxBatchWriteSize;
 
     while (fragmentIt != fragmentEnd &&
+           static_cast<bool>(fragmentIt->ZeroCopyHolder) == zeroCopy &&
            SendVector_.size() < MaxFragmentsPerWrite &&
            bytesAvailable > 0)
     {
-        const auto& fragment = *fragmentIt;
+        const auto& fragment = fragmentIt->Data;
         size_t size = std::min(fragment.Size(), bytesAvailable);
         struct iovec item;
         item.iov_base = const_cast<char*>(fragment.Begin());
@@ -1172,7 +1292,9 @@ bool TTcpConnection::WriteFragments(size_t* bytesWritten)
     }
 
     NProfiling::TWallTimer timer;
-    auto result = HandleEintr(::writev, Socket_, SendVector_.data(), SendVector_.size());
+    auto result = zeroCopy
+        ? SendZeroCopy()
+        : HandleEintr(::writev, Socket_, SendVector_.data(), SendVector_.size());
     auto elapsed = timer.GetElapsedTime();
     if (elapsed > WriteTimeWarningThreshold) {
         YT_LOG_DEBUG("Socket write took too long (Elapsed: %v)",
@@ -1188,6 +1310,161 @@ bool TTcpConnection::WriteFragments(size_t* bytesWritten)
     return isOK;
 }
 
+ssize_t TTcpConnection::SendZeroCopy()
+{
+#ifdef _linux_
+    struct msghdr message{};
+    message.msg_iov = SendVector_.data();
+    message.msg_iovlen = SendVector_.size();
+
+    auto result = HandleEintr(::sendmsg, Socket_, &message, MSG_ZEROCOPY);
+    if (result < 0 && LastSystemError() == ENOBUFS) {
+        // Out of optmem for pinning pages; just copy the data this time.
+        YT_LOG_TRACE("Zero-copy send failed, falling back to regular write");
+        result = HandleEintr(::writev, Socket_, SendVector_.data(), SendVector_.size());
+        if (result > 0) {
+            UpdateBusCounter(&TBusNetworkBandCounters::ZeroCopyFallbackOutBytes, result);
+        }
+        return result;
+    }
+
+    if (result > 0) {
+        // Every successful send counts towards the kernel completion ids;
+        // pin the messages whose data has been (at least partially) handed over.
+        TZeroCopySend send{
+            .Id = NextZeroCopySendId_++,
+            .Size = static_cast<size_t>(result),
+        };
+        size_t bytesToPin = send.Size;
+        for (auto it = EncodedFragments_.begin(); bytesToPin > 0; EncodedFragments_.move_forward(it)) {
+            YT_ASSERT(it != EncodedFragments_.end());
+            const auto& holder = it->ZeroCopyHolder;
+            if (send.Holders.empty() || send.Holders.back().Begin() != holder.Begin()) {
+                send.Holders.push_back(holder);
+            }
+            bytesToPin -= std::min(bytesToPin, it->Data.Size());
+        }
+        PendingZeroCopySends_.push_back(std::move(send));
+        HasPendingZeroCopySends_.store(true, std::memory_order::relaxed);
+    }
+
+    return result;
+#else
+    YT_ABORT();
+#endif
+}
+
+void TTcpConnection::ReadZeroCopyCompletions()
+{
+    std::vector<TZeroCopySend> completedSends;
+    DrainZeroCopyCompletions(Socket_, &PendingZeroCopySends_, &completedSends, Logger);
+
+    for (const auto& send : completedSends) {
+        UpdateBusCounter(
+            send.Copied
+                ? &TBusNetworkBandCounters::ZeroCopyFallbackOutBytes
+                : &TBusNetworkBandCounters::ZeroCopyOutBytes,
+            send.Size);
+    }
+
+    HasPendingZeroCopySends_.store(!PendingZeroCopySends_.empty(), std::memory_order::relaxed);
+}
+
+void TTcpConnection::DrainZeroCopyCompletions(
+    SOCKET socket,
+    std::deque<TZeroCopySend>* pendingSends,
+    std::vector<TZeroCopySend>* completedSends,
+    const NLogging::TLogger& Logger)
+{
+#ifdef _linux_
+    while (!pendingSends->empty()) {
+        char control[CMSG_SPACE(sizeof(sock_extended_err))];
+        struct msghdr message{};
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        auto result = HandleEintr(::recvmsg, socket, &message, MSG_ERRQUEUE | MSG_DONTWAIT);
+        if (result < 0) {
+            auto error = LastSystemError();
+            if (error != EAGAIN && error != EWOULDBLOCK) {
+                YT_LOG_DEBUG(TError::FromSystem(error), "Failed to read socket error queue");
+            }
+            return;
+        }
+
+        for (auto* cmsg = CMSG_FIRSTHDR(&message); cmsg; cmsg = CMSG_NXTHDR(&message, cmsg)) {
+            bool isRecvError =
+                (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+            if (!isRecvError) {
+                continue;
+            }
+
+            const auto* error = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(cmsg));
+            if (error->ee_errno != 0 || error->ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+                continue;
+            }
+
+            CompleteZeroCopySends(
+                pendingSends,
+                error->ee_info,
+                error->ee_data,
+                /*copied*/ (error->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0,
+                completedSends,
+                Logger);
+        }
+    }
+#endif
+}
+
+void TTcpConnection::CompleteZeroCopySends(
+    std::deque<TZeroCopySend>* pendingSends,
+    ui32 firstId,
+    ui32 lastId,
+    bool copied,
+    std::vector<TZeroCopySend>* completedSends,
+    const NLogging::TLogger& Logger)
+{
+    YT_LOG_TRACE("Zero-copy sends completed (FirstId: %v, LastId: %v, Copied: %v)",
+        firstId,
+        lastId,
+        copied);
+
+    if (pendingSends->empty()) {
+        return;
+    }
+
+    // Ids wrap around, so compare offsets from the oldest pending send.
+    auto frontId = pendingSends->front().Id;
+    auto pendingCount = pendingSends->size();
+    for (auto id = firstId; ; ++id) {
+        auto index = static_cast<ui32>(id - frontId);
+        if (index < pendingCount) {
+            auto& send = (*pendingSends)[index];
+            if (!send.Completed) {
+                // Completions may arrive out of order; release the data right away
+                // and keep the entry until the older sends are completed.
+                send.Completed = true;
+                completedSends->push_back({
+                    .Id = send.Id,
+                    .Size = send.Size,
+                    .Holders = std::move(send.Holders),
+                    .Completed = true,
+                    .Copied = copied,
+                });
+                send.Holders.clear();
+            }
+        }
+        if (id == lastId) {
+            break;
+        }
+    }
+
+    while (!pendingSends->empty() && pendingSends->front().Completed) {
+        pendingSends->pop_front();
+    }
+}
+
 void TTcpConnection::FlushWrittenFragments(size_t bytesWritten)
 {
     size_t bytesToFlush = bytesWritten;
@@ -1195,7 +1472,7 @@ void TTcpConnection::FlushWrittenFragments(size_t bytesWritten)
 
     while (bytesToFlush != 0) {
         YT_ASSERT(!EncodedFragments_.empty());
-        auto& fragment = EncodedFragments_.front();
+        auto& fragment = EncodedFragments_.front().Data;
 
         if (fragment.Size() > bytesToFlush) {
             size_t bytesRemaining = fragment.Size() - bytesToFlush;
@@ -1255,7 +1532,7 @@ bool TTcpConnection::MaybeEncodeFragments()
 
     auto flushCoalesced = [&] () {
         if (coalescedSize > 0) {
-            EncodedFragments_.push(TRef(buffer->End() - coalescedSize, coalescedSize));
+            EncodedFragments_.push({.Data = TRef(buffer->End() - coalescedSize, coalescedSize)});
             coalescedSize = 0;
         }
     };
@@ -1277,6 +1554,19 @@ bool TTcpConnection::MaybeEncodeFragments()
            !QueuedPackets_.empty())
     {
         auto& queuedPacket = QueuedPackets_.front();
+        if (auto asyncPartChecksums = queuedPacket->AsyncPartChecksums) {
+            if (!asyncPartChecksums.IsSet()) {
+                // Packets are sent in order; writing is retried once the checksums are ready.
+                YT_LOG_TRACE("Waiting for packet checksums (PacketId: %v)", queuedPacket->PacketId);
+                break;
+            }
+            // NB: Should the checksum pool fail, the encoder computes the checksums itself.
+            if (const auto& partChecksumsOrError = asyncPartChecksums.Get(); partChecksumsOrError.IsOK()) {
+                queuedPacket->PartChecksums = partChecksumsOrError.Value();
+            }
+            queuedPacket->AsyncPartChecksums.Reset();
+        }
+
         YT_LOG_TRACE("Checking packet cancel state (PacketId: %v)", queuedPacket->PacketId);
         if (!queuedPacket->MarkEncoded()) {
             YT_LOG_TRACE("Packet was canceled (PacketId: %v)", queuedPacket->PacketId);
@@ -1301,6 +1591,7 @@ bool TTcpConnection::MaybeEncodeFragments()
             packet->Flags,
             GenerateChecksums_,
             packet->ChecksummedPartCount,
+            packet->PartChecksums,
             packet->PacketId,
             packet->Message);
         if (!encodeResult) {
@@ -1315,7 +1606,14 @@ bool TTcpConnection::MaybeEncodeFragments()
                 coalesce(fragment);
             } else {
                 flushCoalesced();
-                EncodedFragments_.push(fragment);
+                // Owned fragments refer to message parts which may be pinned
+                // until the kernel is done with them; coalesce buffers are reused.
+                bool zeroCopy = ZeroCopySendEnabled_ &&
+                    static_cast<i64>(fragment.Size()) >= Config_->ZeroCopySendThreshold;
+                EncodedFragments_.push({
+                    .Data = fragment,
+                    .ZeroCopyHolder = zeroCopy ? packet->Message : TSharedRefArray(),
+                });
             }
             YT_LOG_TRACE("Fragment encoded (Size: %v)", fragment.Size());
             Encoder_->NextFragment();
@@ -1329,9 +1627,61 @@ bool TTcpConnection::MaybeEncodeFragments()
 
     flushCoalesced();
 
+    // Nothing to write until checksums of the first queued packet are computed.
+    if (EncodedFragments_.empty() && !QueuedPackets_.empty()) {
+        return false;
+    }
+
     return true;
 }
 
+void TTcpConnection::MaybeOffloadPartChecksums(TPacket* packet)
+{
+    const auto& threshold = Config_->ChecksumOffloadThreshold;
+    if (!threshold || packet->ChecksummedPartCount == 0) {
+        return;
+    }
+
+    i64 checksummedSize = 0;
+    for (int index = 0; index < std::ssize(packet->Message); ++index) {
+        const auto& part = packet->Message[index];
+        bool precomputed = index < std::ssize(packet->PartChecksums) && packet->PartChecksums[index] != NullChecksum;
+        if (part && !precomputed && IsChecksummedPart(index, packet->ChecksummedPartCount)) {
+            checksummedSize += part.Size();
+        }
+    }
+
+    if (checksummedSize < *threshold) {
+        return;
+    }
+
+    YT_LOG_TRACE("Offloading packet checksums (PacketId: %v, ChecksummedSize: %v)",
+        packet->PacketId,
+        checksummedSize);
+
+    packet->AsyncPartChecksums = BIND(
+        &ComputePartChecksums,
+        packet->Message,
+        packet->ChecksummedPartCount,
+        packet->PartChecksums)
+        .AsyncVia(TTcpDispatcher::TImpl::Get()->GetChecksumInvoker())
+        .Run();
+    packet->AsyncPartChecksums.Subscribe(BIND([weakThis = MakeWeak(this)] (const TErrorOr<std::vector<TChecksum>>& /*partChecksumsOrError*/) {
+        if (auto this_ = weakThis.Lock()) {
+            this_->OnPartChecksumsComputed();
+        }
+    }));
+}
+
+void TTcpConnection::OnPartChecksumsComputed()
+{
+    auto previousPendingControl = static_cast<EPollControl>(PendingControl_.fetch_or(static_cast<ui64>(EPollControl::Write)));
+    if (None(previousPendingControl)) {
+        YT_LOG_TRACE("Retrying event processing for packet checksums");
+        Poller_->Retry(this);
+    }
+}
+
 bool TTcpConnection::CheckWriteError(ssize_t result)
 {
     if (result < 0) {
@@ -1431,6 +1781,9 @@ void TTcpConnection::ProcessQueuedMessages()
             std::move(queuedMessage.Message),
             queuedMessage.PayloadSize);
 
+        packet->PartChecksums = std::move(queuedMessage.Options.PartChecksums);
+        MaybeOffloadPartChecksums(packet);
+
         packet->Promise = queuedMessage.Promise;
         if (queuedMessage.Options.EnableSendCancelation) {
             packet->EnableCancel(MakeStrong(this));
@@ -1506,7 +1859,11 @@ void TTcpConnection::ArmPoller()
     VERIFY_SPINLOCK_AFFINITY(Lock_);
     YT_VERIFY(Socket_ != INVALID_SOCKET);
 
-    Poller_->Arm(Socket_, this, EPollControl::Read | EPollControl::Write | EPollControl::EdgeTriggered);
+    auto control = EPollControl::Read | EPollControl::Write | EPollControl::EdgeTriggered;
+    if (ReceivingPoller_) {
+        control |= EPollControl::Receive;
+    }
+    Poller_->Arm(Socket_, this, control);
 }
 
 void TTcpConnection::UnarmPoller()
@@ -1540,6 +1897,16 @@ void TTcpConnection::InitSocketTosLevel(TTosLevel tosLevel)
     }
 }
 
+void TTcpConnection::InitSocketZeroCopy()
+{
+    if (TrySetSocketZeroCopy(Socket_)) {
+        ZeroCopySendEnabled_ = true;
+        YT_LOG_DEBUG("Socket zero-copy send enabled");
+    } else {
+        YT_LOG_DEBUG("Failed to enable socket zero-copy send");
+    }
+}
+
 void TTcpConnection::FlushStatistics()
 {
     UpdateTcpStatistics();
@@ -24,6 +24,8 @@
 
 #include <yt/yt/core/concurrency/pollable_detail.h>
 
+#include <library/cpp/yt/small_containers/compact_vector.h>
+
 #include <library/cpp/yt/threading/spin_lock.h>
 
 #include <util/network/init.h>
@@ -37,6 +39,7 @@
 #endif
 
 #include <atomic>
+#include <deque>
 
 namespace NYT::NBus {
 
@@ -158,6 +161,12 @@ private:
         size_t PayloadSize;
         size_t PacketSize;
 
+        //! Known checksums of message parts (see TSendOptions::PartChecksums).
+        std::vector<TChecksum> PartChecksums;
+        //! Set if part checksums are being computed in the checksum pool;
+        //! the packet (and all subsequent ones) is not encoded until then.
+        TFuture<std::vector<TChecksum>> AsyncPartChecksums;
+
         std::atomic<EPacketState> State = EPacketState::Queued;
         TPromise<void> Promise;
         TTcpConnectionPtr Connection;
@@ -169,6 +178,29 @@ private:
 
     using TPacketPtr = TIntrusivePtr<TPacket>;
 
+    struct TEncodedFragment
+    {
+        TRef Data;
+        //! Non-null iff the fragment is to be sent with MSG_ZEROCOPY;
+        //! keeps the data alive until the kernel reports the send completion.
+        TSharedRefArray ZeroCopyHolder;
+    };
+
+    //! A send call issued with MSG_ZEROCOPY whose completion has not been reported yet.
+    struct TZeroCopySend
+    {
+        //! Sequence number of the send call as counted by the kernel.
+        ui32 Id;
+        size_t Size;
+        TCompactVector<TSharedRefArray, 1> Holders;
+        bool Completed = false;
+        //! Set if the kernel has copied the data instead of sending it from the pinned pages.
+        bool Copied = false;
+    };
+
+    //! Keeps the socket of a closed connection open until the kernel completes its zero-copy sends.
+    class TZeroCopySendDrainer;
+
     const TBusConfigPtr Config_;
     const EConnectionType ConnectionType_;
     const TConnectionId Id_;
@@ -180,6 +212,8 @@ private:
     const std::optional<TString> AbstractUnixDomainSocketName_;
     const IMessageHandlerPtr Handler_;
     const NConcurrency::IPollerPtr Poller_;
+    //! Set if the poller reads the socket itself, see NConcurrency::IReceivingPoller.
+    const NConcurrency::IReceivingPollerPtr ReceivingPoller_;
 
     const NLogging::TLogger Logger;
     const TString LoggingTag_;
@@ -231,9 +265,15 @@ private:
     const NProfiling::TCpuDuration WriteStallTimeout_;
     std::atomic<NProfiling::TCpuInstant> LastIncompleteWriteTime_ = std::numeric_limits<NProfiling::TCpuInstant>::max();
     std::vector<std::unique_ptr<TBlob>> WriteBuffers_;
-    TRingQueue<TRef> EncodedFragments_;
+    TRingQueue<TEncodedFragment> EncodedFragments_;
     TRingQueue<size_t> EncodedPacketSizes_;
 
+    bool ZeroCopySendEnabled_ = false;
+    ui32 NextZeroCopySendId_ = 0;
+    std::deque<TZeroCopySend> PendingZeroCopySends_;
+    //! Mirrors |!PendingZeroCopySends_.empty()| for the periodic check.
+    std::atomic<bool> HasPendingZeroCopySends_ = false;
+
     std::vector<struct iovec> SendVector_;
 
     std::atomic<TTosLevel> TosLevel_ = DefaultTosLevel;
@@ -290,9 +330,25 @@ private:
     void OnSocketWrite();
     bool HasUnsentData() const;
     bool WriteFragments(size_t* bytesWritten);
+    ssize_t SendZeroCopy();
+    void ReadZeroCopyCompletions();
+    static void DrainZeroCopyCompletions(
+        SOCKET socket,
+        std::deque<TZeroCopySend>* pendingSends,
+        std::vector<TZeroCopySend>* completedSends,
+        const NLogging::TLogger& Logger);
+    static void CompleteZeroCopySends(
+        std::deque<TZeroCopySend>* pendingSends,
+        ui32 firstId,
+        ui32 lastId,
+        bool copied,
+        std::vector<TZeroCopySend>* completedSends,
+        const NLogging::TLogger& Logger);
     void FlushWrittenFragments(size_t bytesWritten);
     void FlushWrittenPackets(size_t bytesWritten);
     bool MaybeEncodeFragments();
+    void MaybeOffloadPartChecksums(TPacket* packet);
+    void OnPartChecksumsComputed();
     bool CheckWriteError(ssize_t result);
     void OnPacketSent();
     void OnAckPacketSent(const TPacket& packet);
@@ -321,6 +377,7 @@ private:
     void FlushBusStatistics();
 
     void InitSocketTosLevel(int tosLevel);
+    void InitSocketZeroCopy();
 };
 
 DEFINE_REFCOUNTED_TYPE(TTcpConnection)
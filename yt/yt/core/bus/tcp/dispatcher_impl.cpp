@@ -4,6 +4,7 @@
 
 #include <yt/yt/core/concurrency/periodic_executor.h>
 #include <yt/yt/core/concurrency/thread_pool_poller.h>
+#include <yt/yt/core/concurrency/uring_poller.h>
 
 #include <yt/yt/core/actions/invoker_util.h>
 
@@ -89,7 +90,7 @@ IPollerPtr TTcpDispatcher::TImpl::GetOrCreatePoller(
     {
         auto guard = WriterGuard(PollerLock_);
         if (!*pollerPtr) {
-            *pollerPtr = CreateThreadPoolPoller(isXfer ? Config_->ThreadPoolSize : 1, threadNamePrefix);
+            *pollerPtr = CreatePoller(isXfer ? Config_->ThreadPoolSize : 1, threadNamePrefix);
         }
         poller = *pollerPtr;
     }
@@ -99,6 +100,21 @@ IPollerPtr TTcpDispatcher::TImpl::GetOrCreatePoller(
     return poller;
 }
 
+IThreadPoolPollerPtr TTcpDispatcher::TImpl::CreatePoller(int threadCount, const TString& threadNamePrefix)
+{
+    VERIFY_WRITER_SPINLOCK_AFFINITY(PollerLock_);
+
+    if (Config_->PollerType == EPollerType::Uring) {
+        if (IsUringPollerSupported()) {
+            return CreateUringThreadPoolPoller(threadCount, threadNamePrefix);
+        }
+        YT_LOG_WARNING("Uring poller is not supported, falling back to epoll (ThreadNamePrefix: %v)",
+            threadNamePrefix);
+    }
+
+    return CreateThreadPoolPoller(threadCount, threadNamePrefix);
+}
+
 void TTcpDispatcher::TImpl::DisableNetworking()
 {
     YT_LOG_INFO("Networking disabled");
@@ -156,6 +172,22 @@ IPollerPtr TTcpDispatcher::TImpl::GetXferPoller()
     return GetOrCreatePoller(&XferPoller_, true, ThreadNamePrefix);
 }
 
+IInvokerPtr TTcpDispatcher::TImpl::GetChecksumInvoker()
+{
+    {
+        auto guard = ReaderGuard(PollerLock_);
+        if (ChecksumThreadPool_) {
+            return ChecksumThreadPool_->GetInvoker();
+        }
+    }
+
+    auto guard = WriterGuard(PollerLock_);
+    if (!ChecksumThreadPool_) {
+        ChecksumThreadPool_ = CreateThreadPool(Config_->ChecksumThreadPoolSize, "BusChecksum");
+    }
+    return ChecksumThreadPool_->GetInvoker();
+}
+
 void TTcpDispatcher::TImpl::Configure(const TTcpDispatcherConfigPtr& config)
 {
     {
@@ -166,6 +198,9 @@ void TTcpDispatcher::TImpl::Configure(const TTcpDispatcherConfigPtr& config)
         if (XferPoller_) {
             XferPoller_->Reconfigure(Config_->ThreadPoolSize);
         }
+        if (ChecksumThreadPool_) {
+            ChecksumThreadPool_->Configure(Config_->ChecksumThreadPoolSize);
+        }
     }
 
     {
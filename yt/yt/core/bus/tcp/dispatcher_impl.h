@@ -8,6 +8,8 @@
 
 #include <yt/yt/library/syncmap/map.h>
 
+#include <yt/yt/core/concurrency/thread_pool.h>
+
 #include <yt/yt/core/net/address.h>
 
 #include <yt/yt/core/misc/error.h>
@@ -45,6 +47,9 @@ public:
     NConcurrency::IPollerPtr GetAcceptorPoller();
     NConcurrency::IPollerPtr GetXferPoller();
 
+    //! Returns the invoker for computing checksums of large outcoming messages.
+    IInvokerPtr GetChecksumInvoker();
+
     void Configure(const TTcpDispatcherConfigPtr& config);
 
     void RegisterConnection(TTcpConnectionPtr connection);
@@ -65,6 +70,7 @@ private:
         NConcurrency::IThreadPoolPollerPtr* poller,
         bool isXfer,
         const TString& threadNamePrefix);
+    NConcurrency::IThreadPoolPollerPtr CreatePoller(int threadCount, const TString& threadNamePrefix);
 
     std::vector<TTcpConnectionPtr> GetConnections();
     void BuildOrchid(NYson::IYsonConsumer* consumer);
@@ -73,6 +79,7 @@ private:
     TTcpDispatcherConfigPtr Config_ = New<TTcpDispatcherConfig>();
     NConcurrency::IThreadPoolPollerPtr AcceptorPoller_;
     NConcurrency::IThreadPoolPollerPtr XferPoller_;
+    NConcurrency::IThreadPoolPtr ChecksumThreadPool_;
 
     TMpscStack<TWeakPtr<TTcpConnection>> ConnectionsToRegister_;
     std::vector<TWeakPtr<TTcpConnection>> ConnectionList_;
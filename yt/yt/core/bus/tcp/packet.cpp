@@ -402,6 +402,7 @@ public:
         EPacketFlags flags,
         bool generateChecksums,
         int checksummedPartCount,
+        TRange<TChecksum> partChecksums,
         TPacketId packetId,
         TSharedRefArray message) override
     {
@@ -421,10 +422,13 @@ public:
                 const auto& part = Message_[index];
                 if (part) {
                     PartSizes_[index] = part.Size();
-                    PartChecksums_[index] =
-                        generateChecksums && (index < checksummedPartCount || checksummedPartCount == TSendOptions::AllParts)
-                        ? GetChecksum(part)
-                        : NullChecksum;
+                    if (generateChecksums && IsChecksummedPart(index, checksummedPartCount)) {
+                        PartChecksums_[index] = index < std::ssize(partChecksums) && partChecksums[index] != NullChecksum
+                            ? partChecksums[index]
+                            : GetChecksum(part);
+                    } else {
+                        PartChecksums_[index] = NullChecksum;
+                    }
                 } else {
                     PartSizes_[index] = NullPacketPartSize;
                     PartChecksums_[index] = NullChecksum;
@@ -524,6 +528,11 @@ IPacketTranscoderFactory* GetYTPacketTranscoderFactory()
     return LeakySingleton<TPacketTranscoderFactory>();
 }
 
+bool IsChecksummedPart(int index, int checksummedPartCount)
+{
+    return index < checksummedPartCount || checksummedPartCount == TSendOptions::AllParts;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NBus
@@ -46,11 +46,17 @@ struct IPacketEncoder
         const TSharedRefArray& message,
         size_t payloadSize) = 0;
 
+    //! Starts encoding #message.
+    /*!
+     *  Non-null entries of #partChecksums are used as checksums of the corresponding parts
+     *  instead of computing them.
+     */
     virtual bool Start(
         EPacketType type,
         EPacketFlags flags,
         bool generateChecksums,
         int checksummedPartCount,
+        TRange<TChecksum> partChecksums,
         TPacketId packetId,
         TSharedRefArray message) = 0;
 
@@ -79,6 +85,10 @@ struct IPacketTranscoderFactory
 
 IPacketTranscoderFactory* GetYTPacketTranscoderFactory();
 
+//! Returns |true| if part #index is to be checksummed when sending a message
+//! with #checksummedPartCount (see TSendOptions).
+bool IsChecksummedPart(int index, int checksummedPartCount);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NBus
@@ -10,6 +10,7 @@
 
 #include <yt/yt/core/net/socket.h>
 
+#include <yt/yt/core/misc/checksum.h>
 #include <yt/yt/core/misc/fs.h>
 
 #include <library/cpp/testing/common/network.h>
@@ -74,6 +75,30 @@ public:
     std::atomic<int> Count = 0;
 };
 
+//! Records the first part of every message received.
+class TRecordingBusHandler
+    : public IMessageHandler
+{
+public:
+    void HandleMessage(
+        TSharedRefArray message,
+        IBusPtr /*replyBus*/) noexcept override
+    {
+        auto guard = Guard(Lock_);
+        FirstParts_.emplace_back(message[0].Begin(), message[0].Size());
+    }
+
+    std::vector<TString> GetFirstParts()
+    {
+        auto guard = Guard(Lock_);
+        return FirstParts_;
+    }
+
+private:
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, Lock_);
+    std::vector<TString> FirstParts_;
+};
+
 class TReplying42BusHandler
     : public IMessageHandler
 {
@@ -341,6 +366,171 @@ TEST_F(TBusTest, SendCancel)
         .ThrowOnError();
 }
 
+TEST_F(TBusTest, ZeroCopySend)
+{
+    auto handler = New<TCountingBusHandler>();
+    auto server = StartBusServer(handler);
+
+    auto config = TBusClientConfig::CreateTcp(Address);
+    config->EnableZeroCopySend = true;
+    config->ZeroCopySendThreshold = 4_KB;
+
+    auto client = CreateBusClient(config);
+    auto bus = client->CreateBus(New<TEmptyBusHandler>());
+
+    // Mix parts below and above the threshold.
+    std::vector<TFuture<void>> futures;
+    for (i64 partSize : std::initializer_list<i64>{16, 4_KB, 1_MB}) {
+        auto message = CreateMessage(4, partSize);
+        for (int i = 0; i < 8; ++i) {
+            futures.push_back(bus->Send(message, NBus::TSendOptions(EDeliveryTrackingLevel::Full)));
+        }
+    }
+
+    AllSucceeded(futures)
+        .Get()
+        .ThrowOnError();
+    EXPECT_EQ(24, handler->Count);
+
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TBusTest, ZeroCopySendReleasesMessageOnIdleConnection)
+{
+    auto handler = New<TCountingBusHandler>();
+    auto server = StartBusServer(handler);
+
+    auto config = TBusClientConfig::CreateTcp(Address);
+    config->EnableZeroCopySend = true;
+    config->ZeroCopySendThreshold = 4_KB;
+
+    auto client = CreateBusClient(config);
+    auto bus = client->CreateBus(New<TEmptyBusHandler>());
+
+    TWeakPtr<TSharedRangeHolder> weakHolder;
+    {
+        auto message = CreateMessage(4, 1_MB);
+        weakHolder = message[0].GetHolder();
+        bus->Send(message, NBus::TSendOptions(EDeliveryTrackingLevel::Full))
+            .Get()
+            .ThrowOnError();
+    }
+    EXPECT_EQ(1, handler->Count);
+
+    // Nothing else is sent, yet the completion must be picked up and the message released.
+    WaitForPredicate([&] { return weakHolder.IsExpired(); });
+
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TBusTest, ZeroCopySendReleasesMessageAfterTermination)
+{
+    auto server = StartBusServer(New<TEmptyBusHandler>());
+
+    auto config = TBusClientConfig::CreateTcp(Address);
+    config->EnableZeroCopySend = true;
+    config->ZeroCopySendThreshold = 4_KB;
+
+    auto client = CreateBusClient(config);
+    auto bus = client->CreateBus(New<TEmptyBusHandler>());
+
+    TWeakPtr<TSharedRangeHolder> weakHolder;
+    {
+        auto message = CreateMessage(16, 1_MB);
+        weakHolder = message[0].GetHolder();
+        YT_UNUSED_FUTURE(bus->Send(message, NBus::TSendOptions(EDeliveryTrackingLevel::None)));
+    }
+
+    // The connection may be closed with zero-copy sends in flight;
+    // the message is kept until the kernel completes them.
+    bus->Terminate(TError("Terminated"));
+    bus.Reset();
+
+    WaitForPredicate([&] { return weakHolder.IsExpired(); });
+
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TBusTest, OffloadedChecksumsKeepPacketOrder)
+{
+    auto handler = New<TRecordingBusHandler>();
+    auto server = StartBusServer(handler);
+
+    auto config = TBusClientConfig::CreateTcp(Address);
+    config->ChecksumOffloadThreshold = 4_KB;
+
+    auto client = CreateBusClient(config);
+    auto bus = client->CreateBus(New<TEmptyBusHandler>());
+
+    // Checksums of larger messages take longer and complete after those of smaller ones
+    // queued later; messages below the threshold are not offloaded at all.
+    constexpr int MessageCount = 30;
+    const std::array<i64, 3> payloadSizes{4_MB, 16, 8_KB};
+    std::vector<TFuture<void>> futures;
+    std::vector<TString> expectedFirstParts;
+    for (int index = 0; index < MessageCount; ++index) {
+        auto payloadSize = payloadSizes[index % payloadSizes.size()];
+        auto message = TSharedRefArray(
+            std::vector<TSharedRef>{
+                TSharedRef::FromString(ToString(index)),
+                TSharedRef::FromString(TString(payloadSize, 'a' + index % 26)),
+            },
+            TSharedRefArray::TMoveParts{});
+        futures.push_back(bus->Send(message, NBus::TSendOptions(EDeliveryTrackingLevel::Full)));
+        expectedFirstParts.push_back(ToString(index));
+    }
+
+    // The server verifies checksums and drops the connection on a mismatch.
+    AllSucceeded(futures)
+        .Get()
+        .ThrowOnError();
+    EXPECT_EQ(expectedFirstParts, handler->GetFirstParts());
+
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TBusTest, PrecomputedPartChecksumsAreReused)
+{
+    auto handler = New<TCountingBusHandler>();
+    auto server = StartBusServer(handler);
+
+    auto config = TBusClientConfig::CreateTcp(Address);
+    config->ChecksumOffloadThreshold = 4_KB;
+
+    auto client = CreateBusClient(config);
+    auto bus = client->CreateBus(New<TEmptyBusHandler>());
+
+    auto send = [&] (const TSharedRefArray& message, std::vector<TChecksum> partChecksums) {
+        NBus::TSendOptions options(EDeliveryTrackingLevel::Full);
+        options.PartChecksums = std::move(partChecksums);
+        return bus->Send(message, options).Get();
+    };
+
+    // Correct checksums are passed both for a message checksummed inline
+    // and for one with the rest of checksums offloaded.
+    auto smallMessage = CreateMessage(2, 16);
+    EXPECT_TRUE(send(smallMessage, {GetChecksum(smallMessage[0]), GetChecksum(smallMessage[1])}).IsOK());
+    auto largeMessage = CreateMessage(2, 1_MB);
+    EXPECT_TRUE(send(largeMessage, {NullChecksum, GetChecksum(largeMessage[1])}).IsOK());
+    EXPECT_EQ(2, handler->Count);
+
+    // A bogus checksum makes it to the wire rather than being recomputed, so the server rejects the packet.
+    EXPECT_FALSE(send(largeMessage, {NullChecksum, GetChecksum(largeMessage[1]) ^ 1}).IsOK());
+    EXPECT_EQ(2, handler->Count);
+
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
 TEST_F(TBusTest, OneReplyNoTracking)
 {
     TestReplies(1, 1, EDeliveryTrackingLevel::None);
@@ -0,0 +1,562 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/core/bus/bus.h>
+#include <yt/yt/core/bus/client.h>
+#include <yt/yt/core/bus/server.h>
+
+#include <yt/yt/core/bus/shm/config.h>
+#include <yt/yt/core/bus/shm/client.h>
+#include <yt/yt/core/bus/shm/ring_buffer.h>
+#include <yt/yt/core/bus/shm/segment.h>
+#include <yt/yt/core/bus/shm/server.h>
+
+#include <yt/yt/core/misc/proc.h>
+
+#include <library/cpp/testing/common/env.h>
+
+#include <library/cpp/yt/threading/event_count.h>
+
+namespace NYT::NBus {
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSharedRefArray CreateMessage(std::vector<TString> parts)
+{
+    std::vector<TSharedRef> refs;
+    for (const auto& part : parts) {
+        refs.push_back(TSharedRef::FromString(part));
+    }
+    return TSharedRefArray(std::move(refs), TSharedRefArray::TMoveParts{});
+}
+
+std::vector<TString> ToStrings(const std::vector<TShmReceivedPart>& parts)
+{
+    std::vector<TString> result;
+    for (const auto& part : parts) {
+        const auto& data = part.Data;
+        result.push_back(data ? TString(data.Begin(), data.Size()) : TString("<null>"));
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TShmRingBufferTest
+    : public ::testing::Test
+{
+protected:
+    static constexpr i64 Capacity = 256;
+
+    TShmRingHeader Header_;
+    TSharedMutableRef Data_ = TSharedMutableRef::Allocate(Capacity);
+    std::optional<TShmRingBuffer> Ring_;
+
+    void SetUp() override
+    {
+        TShmRingBuffer::Initialize(&Header_);
+        Ring_.emplace(&Header_, Data_);
+    }
+
+    ui64 Write(std::vector<TString> parts)
+    {
+        ui64 endPosition = 0;
+        bool wakeupConsumer;
+        EXPECT_TRUE(Ring_->TryWrite(CreateMessage(std::move(parts)), &endPosition, &wakeupConsumer));
+        return endPosition;
+    }
+
+    std::pair<ui64, std::vector<TString>> Read()
+    {
+        ui64 position;
+        std::vector<TShmReceivedPart> parts;
+        EXPECT_TRUE(Ring_->TryRead(&position, &parts));
+        return {position, ToStrings(parts)};
+    }
+};
+
+TEST_F(TShmRingBufferTest, WriteRead)
+{
+    ui64 position;
+    std::vector<TShmReceivedPart> parts;
+    EXPECT_FALSE(Ring_->TryRead(&position, &parts));
+
+    Write({"hello", "", "world!"});
+
+    auto [recordPosition, readParts] = Read();
+    EXPECT_EQ(std::vector<TString>({"hello", "", "world!"}), readParts);
+    EXPECT_FALSE(Ring_->TryRead(&position, &parts));
+
+    EXPECT_FALSE(Ring_->Release(recordPosition));
+    EXPECT_EQ(Header_.WritePosition.load(), Header_.ReadPosition.load());
+}
+
+TEST_F(TShmRingBufferTest, NullParts)
+{
+    ui64 endPosition;
+    bool wakeupConsumer;
+    auto message = TSharedRefArray(
+        std::vector<TSharedRef>{TSharedRef::FromString("a"), TSharedRef(), TSharedRef::FromString("b")},
+        TSharedRefArray::TMoveParts{});
+    EXPECT_TRUE(Ring_->TryWrite(message, &endPosition, &wakeupConsumer));
+
+    auto [position, parts] = Read();
+    EXPECT_EQ(std::vector<TString>({"a", "<null>", "b"}), parts);
+}
+
+TEST_F(TShmRingBufferTest, OutOfOrderRelease)
+{
+    Write({"first"});
+    Write({"second"});
+
+    auto [firstPosition, firstParts] = Read();
+    auto [secondPosition, secondParts] = Read();
+    EXPECT_EQ(std::vector<TString>({"first"}), firstParts);
+    EXPECT_EQ(std::vector<TString>({"second"}), secondParts);
+
+    Ring_->Release(secondPosition);
+    EXPECT_EQ(0u, Header_.ReadPosition.load());
+
+    Ring_->Release(firstPosition);
+    EXPECT_EQ(Header_.WritePosition.load(), Header_.ReadPosition.load());
+}
+
+TEST_F(TShmRingBufferTest, WrapAround)
+{
+    // Each record takes 8 (header) + 8 (part descriptors) + 48 (part) = 64 bytes.
+    auto payload = TString(48, 'x');
+    ASSERT_EQ(64, TShmRingBuffer::GetRecordSize(CreateMessage({payload})));
+
+    // Misalign the ring with a small record so that large ones keep being preceded by padding.
+    Write({"a"});
+    Ring_->Release(Read().first);
+
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        Write({payload});
+        auto [position, parts] = Read();
+        EXPECT_EQ(std::vector<TString>({payload}), parts);
+        Ring_->Release(position);
+        EXPECT_EQ(Header_.WritePosition.load(), Header_.ReadPosition.load());
+    }
+}
+
+TEST_F(TShmRingBufferTest, ProducerWakeup)
+{
+    auto payload = TString(Ring_->GetMaxRecordSize() - 16, 'x');
+
+    Write({payload});
+    Write({payload});
+
+    ui64 endPosition;
+    bool wakeupConsumer;
+    EXPECT_FALSE(Ring_->TryWrite(CreateMessage({payload}), &endPosition, &wakeupConsumer));
+    EXPECT_EQ(1u, Header_.ProducerWaiting.load());
+
+    auto [position, parts] = Read();
+    EXPECT_TRUE(Ring_->Release(position));
+    EXPECT_EQ(0u, Header_.ProducerWaiting.load());
+
+    EXPECT_TRUE(Ring_->TryWrite(CreateMessage({payload}), &endPosition, &wakeupConsumer));
+}
+
+TEST_F(TShmRingBufferTest, ConsumerWakeup)
+{
+    EXPECT_TRUE(Ring_->PrepareConsumerWait());
+
+    ui64 endPosition;
+    bool wakeupConsumer;
+    EXPECT_TRUE(Ring_->TryWrite(CreateMessage({"a"}), &endPosition, &wakeupConsumer));
+    EXPECT_TRUE(wakeupConsumer);
+
+    EXPECT_FALSE(Ring_->PrepareConsumerWait());
+
+    EXPECT_TRUE(Ring_->TryWrite(CreateMessage({"b"}), &endPosition, &wakeupConsumer));
+    EXPECT_FALSE(wakeupConsumer);
+}
+
+TEST_F(TShmRingBufferTest, AckWakeup)
+{
+    auto firstEndPosition = Write({"a"});
+    auto secondEndPosition = Write({"b"});
+    EXPECT_FALSE(Ring_->IsConsumed(firstEndPosition));
+    EXPECT_TRUE(Ring_->PrepareAckWait(secondEndPosition));
+
+    auto [firstPosition, firstParts] = Read();
+    EXPECT_TRUE(Ring_->Release(firstPosition));
+    EXPECT_TRUE(Ring_->IsConsumed(firstEndPosition));
+    EXPECT_FALSE(Ring_->IsConsumed(secondEndPosition));
+    EXPECT_TRUE(Ring_->PrepareAckWait(secondEndPosition));
+
+    auto [secondPosition, secondParts] = Read();
+    EXPECT_TRUE(Ring_->Release(secondPosition));
+    EXPECT_TRUE(Ring_->IsConsumed(secondEndPosition));
+    EXPECT_FALSE(Ring_->PrepareAckWait(secondEndPosition));
+    EXPECT_EQ(0u, Header_.AckWaiting.load());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TShmPooledRingBufferTest
+    : public ::testing::Test
+{
+protected:
+    static constexpr i64 Capacity = 32_KB;
+    static constexpr int BlockCount = 4;
+
+    TShmRingHeader Header_;
+    TSharedMutableRef Data_ = TSharedMutableRef::Allocate(Capacity);
+    std::array<std::atomic<ui32>, BlockCount> BlockStates_;
+    TSharedMutableRef BlockData_ = TSharedMutableRef::Allocate(BlockCount * TShmBlockPool::BlockSize);
+    std::optional<TShmBlockPool> Pool_;
+    std::optional<TShmRingBuffer> Ring_;
+
+    void SetUp() override
+    {
+        TShmRingBuffer::Initialize(&Header_);
+        TShmBlockPool::Initialize(BlockStates_.data(), BlockCount);
+        Pool_.emplace(BlockStates_.data(), BlockData_);
+        Ring_.emplace(&Header_, Data_, &*Pool_);
+    }
+
+    std::pair<ui64, std::vector<TShmReceivedPart>> WriteRead(std::vector<TString> parts)
+    {
+        ui64 endPosition;
+        bool wakeupConsumer;
+        EXPECT_TRUE(Ring_->TryWrite(CreateMessage(std::move(parts)), &endPosition, &wakeupConsumer));
+
+        ui64 position;
+        std::vector<TShmReceivedPart> receivedParts;
+        EXPECT_TRUE(Ring_->TryRead(&position, &receivedParts));
+        return {position, std::move(receivedParts)};
+    }
+};
+
+TEST_F(TShmPooledRingBufferTest, LargePartsBypassRing)
+{
+    // Takes two blocks.
+    auto large = TString(TShmBlockPool::BlockSize + 1, 'x');
+    auto [position, parts] = WriteRead({"small", large});
+    EXPECT_EQ(std::vector<TString>({"small", large}), ToStrings(parts));
+    EXPECT_EQ(-1, parts[0].BlockIndex);
+    EXPECT_EQ(0, parts[1].BlockIndex);
+
+    // The ring space is reclaimed while the pooled part is still retained.
+    Ring_->Release(position);
+    EXPECT_EQ(Header_.WritePosition.load(), Header_.ReadPosition.load());
+    EXPECT_EQ(std::vector<TString>({large}), ToStrings({parts[1]}));
+    auto firstBlockIndex = parts[1].BlockIndex;
+
+    auto medium = TString(TShmBlockPool::BlockSize, 'y');
+    std::tie(position, parts) = WriteRead({medium});
+    EXPECT_EQ(2, parts[0].BlockIndex);
+    Ring_->Release(position);
+
+    // Only a single block is left so the part goes through the ring.
+    std::tie(position, parts) = WriteRead({large});
+    EXPECT_EQ(std::vector<TString>({large}), ToStrings(parts));
+    EXPECT_EQ(-1, parts[0].BlockIndex);
+    Ring_->Release(position);
+
+    // Blocks are freed out of order.
+    Pool_->Free(firstBlockIndex, large.size());
+    std::tie(position, parts) = WriteRead({large});
+    EXPECT_EQ(std::vector<TString>({large}), ToStrings(parts));
+    EXPECT_EQ(0, parts[0].BlockIndex);
+    Ring_->Release(position);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef _linux_
+
+class TEchoBusHandler
+    : public IMessageHandler
+{
+public:
+    void HandleMessage(TSharedRefArray message, IBusPtr replyBus) noexcept override
+    {
+        // NB: Replying with the very same parts also checks that they stay valid while referenced.
+        YT_UNUSED_FUTURE(replyBus->Send(std::move(message), NBus::TSendOptions(EDeliveryTrackingLevel::None)));
+    }
+};
+
+class TRetainingBusHandler
+    : public IMessageHandler
+{
+public:
+    void HandleMessage(TSharedRefArray message, IBusPtr /*replyBus*/) noexcept override
+    {
+        auto guard = Guard(Lock_);
+        Messages_.push_back(std::move(message));
+    }
+
+    std::vector<TSharedRefArray> GetMessages()
+    {
+        auto guard = Guard(Lock_);
+        return Messages_;
+    }
+
+private:
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, Lock_);
+    std::vector<TSharedRefArray> Messages_;
+};
+
+//! Blocks the dispatch of the first message until unblocked.
+class TBlockingBusHandler
+    : public IMessageHandler
+{
+public:
+    void HandleMessage(TSharedRefArray /*message*/, IBusPtr /*replyBus*/) noexcept override
+    {
+        if (!Entered_.exchange(true)) {
+            Unblocked_.Wait();
+        }
+    }
+
+    void Unblock()
+    {
+        Unblocked_.NotifyAll();
+    }
+
+private:
+    std::atomic<bool> Entered_ = false;
+    NThreading::TEvent Unblocked_;
+};
+
+class TCollectingBusHandler
+    : public IMessageHandler
+{
+public:
+    explicit TCollectingBusHandler(int expectedCount)
+        : ExpectedCount_(expectedCount)
+    { }
+
+    void HandleMessage(TSharedRefArray message, IBusPtr /*replyBus*/) noexcept override
+    {
+        // NB: Copy the parts out to avoid pinning the ring memory.
+        std::vector<TString> parts;
+        for (const auto& part : message) {
+            parts.emplace_back(part.Begin(), part.Size());
+        }
+
+        auto guard = Guard(Lock_);
+        Messages_.push_back(std::move(parts));
+        if (std::ssize(Messages_) == ExpectedCount_) {
+            Event_.NotifyAll();
+        }
+    }
+
+    std::vector<std::vector<TString>> WaitMessages()
+    {
+        Event_.Wait();
+        auto guard = Guard(Lock_);
+        return Messages_;
+    }
+
+private:
+    const int ExpectedCount_;
+
+    NThreading::TEvent Event_;
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, Lock_);
+    std::vector<std::vector<TString>> Messages_;
+};
+
+class TShmBusTest
+    : public ::testing::Test
+{
+protected:
+    const TString SocketPath_ = GetOutputPath() / Format("shm-bus-%v", TGuid::Create());
+
+    IBusServerPtr StartServer(IMessageHandlerPtr handler)
+    {
+        auto server = CreateShmBusServer(TShmBusServerConfig::Create(SocketPath_));
+        server->Start(std::move(handler));
+        return server;
+    }
+
+    IBusClientPtr CreateClient(i64 ringBufferSize = 64_KB)
+    {
+        auto config = TShmBusClientConfig::Create(SocketPath_);
+        config->RingBufferSize = ringBufferSize;
+        return CreateShmBusClient(config);
+    }
+};
+
+TEST_F(TShmBusTest, Echo)
+{
+    auto server = StartServer(New<TEchoBusHandler>());
+    auto client = CreateClient();
+
+    constexpr int MessageCount = 1000;
+    auto handler = New<TCollectingBusHandler>(MessageCount);
+    auto bus = client->CreateBus(handler);
+
+    // The total volume is way larger than the rings so the flow control gets exercised.
+    std::vector<TFuture<void>> results;
+    for (int index = 0; index < MessageCount; ++index) {
+        auto message = CreateMessage({ToString(index), TString(index % 100 * 100, 'x')});
+        results.push_back(bus->Send(message, NBus::TSendOptions(EDeliveryTrackingLevel::Full)));
+    }
+
+    WaitFor(AllSucceeded(results))
+        .ThrowOnError();
+
+    auto messages = handler->WaitMessages();
+    ASSERT_EQ(MessageCount, std::ssize(messages));
+    for (int index = 0; index < MessageCount; ++index) {
+        const auto& message = messages[index];
+        ASSERT_EQ(2, std::ssize(message));
+        EXPECT_EQ(ToString(index), message[0]);
+        EXPECT_EQ(static_cast<size_t>(index % 100 * 100), message[1].size());
+    }
+
+    bus->Terminate(TError("Test"));
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TShmBusTest, RetainedMessagesDoNotBlockSender)
+{
+    auto handler = New<TRetainingBusHandler>();
+    auto server = StartServer(handler);
+    auto client = CreateClient(64_KB);
+    auto bus = client->CreateBus(New<TCollectingBusHandler>(0));
+
+    // The retained volume is way larger than both the ring and the pool.
+    constexpr int MessageCount = 100;
+    std::vector<TFuture<void>> results;
+    for (int index = 0; index < MessageCount; ++index) {
+        auto message = CreateMessage({ToString(index), TString(8_KB, 'a' + index % 26)});
+        results.push_back(bus->Send(message, NBus::TSendOptions(EDeliveryTrackingLevel::Full)));
+    }
+
+    WaitFor(AllSucceeded(results).WithTimeout(TDuration::Seconds(30)))
+        .ThrowOnError();
+
+    auto messages = handler->GetMessages();
+    ASSERT_EQ(MessageCount, std::ssize(messages));
+    for (int index = 0; index < MessageCount; ++index) {
+        const auto& message = messages[index];
+        ASSERT_EQ(2u, message.Size());
+        EXPECT_EQ(ToString(index), TString(message[0].Begin(), message[0].Size()));
+        EXPECT_EQ(TString(8_KB, 'a' + index % 26), TString(message[1].Begin(), message[1].Size()));
+    }
+
+    bus->Terminate(TError("Test"));
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TShmBusTest, FullTrackingWaitsForPeer)
+{
+    auto handler = New<TBlockingBusHandler>();
+    auto server = StartServer(handler);
+    auto client = CreateClient();
+    auto bus = client->CreateBus(New<TCollectingBusHandler>(0));
+
+    WaitFor(bus->Send(CreateMessage({"first"}), NBus::TSendOptions(EDeliveryTrackingLevel::Full)))
+        .ThrowOnError();
+
+    // The server is stuck dispatching the first message and does not consume the second one.
+    auto result = bus->Send(CreateMessage({"second"}), NBus::TSendOptions(EDeliveryTrackingLevel::Full));
+    Sleep(TDuration::MilliSeconds(300));
+    EXPECT_FALSE(result.IsSet());
+
+    handler->Unblock();
+    WaitFor(result)
+        .ThrowOnError();
+
+    bus->Terminate(TError("Test"));
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TShmBusTest, MessageTooLarge)
+{
+    auto server = StartServer(New<TEchoBusHandler>());
+    auto client = CreateClient(64_KB);
+    auto bus = client->CreateBus(New<TCollectingBusHandler>(1));
+
+    auto message = CreateMessage({TString(64_KB, 'x')});
+    auto error = bus->Send(message, NBus::TSendOptions(EDeliveryTrackingLevel::Full))
+        .Get();
+    EXPECT_EQ(NBus::EErrorCode::TransportError, error.GetCode());
+
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_F(TShmBusTest, ServerStopTerminatesClient)
+{
+    auto server = StartServer(New<TEchoBusHandler>());
+    auto client = CreateClient();
+
+    auto handler = New<TCollectingBusHandler>(1);
+    auto bus = client->CreateBus(handler);
+    WaitFor(bus->Send(CreateMessage({"ping"}), NBus::TSendOptions(EDeliveryTrackingLevel::Full)))
+        .ThrowOnError();
+    handler->WaitMessages();
+
+    auto terminated = NewPromise<void>();
+    bus->SubscribeTerminated(BIND([=] (const TError& /*error*/) mutable {
+        terminated.TrySet();
+    }));
+
+    server->Stop()
+        .Get()
+        .ThrowOnError();
+
+    WaitFor(terminated.ToFuture())
+        .ThrowOnError();
+}
+
+TEST_F(TShmBusTest, NoServer)
+{
+    auto client = CreateClient();
+    auto bus = client->CreateBus(New<TCollectingBusHandler>(1));
+
+    auto error = bus->Send(CreateMessage({"ping"}), NBus::TSendOptions(EDeliveryTrackingLevel::Full))
+        .Get();
+    EXPECT_FALSE(error.IsOK());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(TShmSegmentTest, SizeIsSealed)
+{
+    TFile file;
+    auto segment = TShmSegment::Create(64_KB, &file);
+    auto size = file.GetLength();
+
+    EXPECT_THROW(file.Resize(size / 2), std::exception);
+    EXPECT_THROW(file.Resize(size * 2), std::exception);
+    EXPECT_EQ(size, file.GetLength());
+
+    EXPECT_NO_THROW(TShmSegment::Open(file.GetHandle()));
+}
+
+TEST(TShmSegmentTest, OpenRejectsUnsealedSegment)
+{
+    TFile sealedFile;
+    auto segment = TShmSegment::Create(64_KB, &sealedFile);
+
+    // Same size and contents as a valid segment, but the peer could still truncate it.
+    auto file = MemfdCreate("yt-bus-shm-test");
+    file.Resize(sealedFile.GetLength());
+    auto contents = TSharedMutableRef::Allocate(sealedFile.GetLength());
+    sealedFile.Pread(contents.Begin(), contents.Size(), 0);
+    file.Pwrite(contents.Begin(), contents.Size(), 0);
+
+    EXPECT_THROW_WITH_SUBSTRING(TShmSegment::Open(file.GetHandle()), "is not sealed");
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NBus
@@ -0,0 +1,516 @@
+#include "dictionary_codec.h"
+#include "private.h"
+
+#include <yt/yt/core/misc/blob.h>
+#include <yt/yt/core/misc/error.h>
+#include <yt/yt/core/misc/finally.h>
+
+#include <library/cpp/yt/memory/chunked_memory_pool.h>
+
+#include <library/cpp/yt/misc/preprocessor.h>
+
+#include <mutex>
+
+#define ZSTD_STATIC_LINKING_ONLY
+#include <contrib/libs/zstd/include/zstd.h>
+
+#define ZDICT_STATIC_LINKING_ONLY
+#include <contrib/libs/zstd/include/zdict.h>
+
+namespace NYT::NCompression {
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const auto& Logger = CompressionLogger;
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TCompressionDictionaryTag
+{ };
+
+struct TCompressionDictionarySamplesTag
+{ };
+
+struct TDictionaryCompressedBlockTag
+{ };
+
+struct TDictionaryDecompressedBlockTag
+{ };
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TDigestedCompressionDictionary
+    : public IDigestedCompressionDictionary
+{
+public:
+    TDigestedCompressionDictionary(TRef compressionDictionary, int compressionLevel)
+        : Dictionary_(ZSTD_createCDict(
+            compressionDictionary.Begin(),
+            compressionDictionary.Size(),
+            compressionLevel))
+    {
+        if (!Dictionary_) {
+            THROW_ERROR_EXCEPTION("Failed to digest compression dictionary")
+                << TErrorAttribute("dictionary_size", compressionDictionary.Size())
+                << TErrorAttribute("compression_level", compressionLevel);
+        }
+    }
+
+    ~TDigestedCompressionDictionary()
+    {
+        ZSTD_freeCDict(Dictionary_);
+    }
+
+    i64 GetMemoryUsage() const override
+    {
+        return ZSTD_sizeof_CDict(Dictionary_);
+    }
+
+    const ZSTD_CDict* GetUnderlying() const
+    {
+        return Dictionary_;
+    }
+
+private:
+    ZSTD_CDict* const Dictionary_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TDigestedDecompressionDictionary
+    : public IDigestedDecompressionDictionary
+{
+public:
+    explicit TDigestedDecompressionDictionary(TRef compressionDictionary)
+        : Dictionary_(ZSTD_createDDict(
+            compressionDictionary.Begin(),
+            compressionDictionary.Size()))
+    {
+        if (!Dictionary_) {
+            THROW_ERROR_EXCEPTION("Failed to digest decompression dictionary")
+                << TErrorAttribute("dictionary_size", compressionDictionary.Size());
+        }
+    }
+
+    ~TDigestedDecompressionDictionary()
+    {
+        ZSTD_freeDDict(Dictionary_);
+    }
+
+    i64 GetMemoryUsage() const override
+    {
+        return ZSTD_sizeof_DDict(Dictionary_);
+    }
+
+    const ZSTD_DDict* GetUnderlying() const
+    {
+        return Dictionary_;
+    }
+
+private:
+    ZSTD_DDict* const Dictionary_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TDictionaryCompressor
+    : public IDictionaryCompressor
+{
+public:
+    explicit TDictionaryCompressor(TIntrusivePtr<TDigestedCompressionDictionary> digestedDictionary)
+        : DigestedDictionary_(std::move(digestedDictionary))
+        , Context_(ZSTD_createCCtx())
+    {
+        YT_VERIFY(Context_);
+    }
+
+    ~TDictionaryCompressor()
+    {
+        ZSTD_freeCCtx(Context_);
+    }
+
+    TRef Compress(TChunkedMemoryPool* pool, TRef input) override
+    {
+        auto bound = ZSTD_compressBound(input.Size());
+        auto* output = pool->AllocateUnaligned(bound);
+
+        auto compressedSize = ZSTD_compress_usingCDict(
+            Context_,
+            output,
+            bound,
+            input.Begin(),
+            input.Size(),
+            DigestedDictionary_->GetUnderlying());
+        YT_LOG_FATAL_IF(ZSTD_isError(compressedSize), "Zstd dictionary compression failed (Error: %v)",
+            ZSTD_getErrorName(compressedSize));
+
+        pool->Free(output + compressedSize, output + bound);
+
+        return TRef(output, compressedSize);
+    }
+
+private:
+    const TIntrusivePtr<TDigestedCompressionDictionary> DigestedDictionary_;
+
+    ZSTD_CCtx* const Context_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TDictionaryDecompressor
+    : public IDictionaryDecompressor
+{
+public:
+    explicit TDictionaryDecompressor(TIntrusivePtr<TDigestedDecompressionDictionary> digestedDictionary)
+        : DigestedDictionary_(std::move(digestedDictionary))
+        , Context_(ZSTD_createDCtx())
+    {
+        YT_VERIFY(Context_);
+    }
+
+    ~TDictionaryDecompressor()
+    {
+        ZSTD_freeDCtx(Context_);
+    }
+
+    void Decompress(TRef input, TMutableRef output) override
+    {
+        auto decompressedSize = ZSTD_decompress_usingDDict(
+            Context_,
+            output.Begin(),
+            output.Size(),
+            input.Begin(),
+            input.Size(),
+            DigestedDictionary_->GetUnderlying());
+        if (ZSTD_isError(decompressedSize)) {
+            THROW_ERROR_EXCEPTION("Zstd dictionary decompression failed")
+                << TErrorAttribute("error", ZSTD_getErrorName(decompressedSize));
+        }
+        if (decompressedSize != output.Size()) {
+            THROW_ERROR_EXCEPTION("Zstd dictionary decompression failed: output size mismatch")
+                << TErrorAttribute("expected_size", output.Size())
+                << TErrorAttribute("actual_size", decompressedSize);
+        }
+    }
+
+private:
+    const TIntrusivePtr<TDigestedDecompressionDictionary> DigestedDictionary_;
+
+    ZSTD_DCtx* const Context_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TZstdDictionaryCompressionCodec
+    : public IDictionaryCompressionCodec
+{
+public:
+    int GetMinDictionarySize() const override
+    {
+        return ZDICT_DICTSIZE_MIN;
+    }
+
+    int GetMinCompressionLevel() const override
+    {
+        return 1;
+    }
+
+    int GetMaxCompressionLevel() const override
+    {
+        return ZSTD_maxCLevel();
+    }
+
+    int GetDefaultCompressionLevel() const override
+    {
+        return ZSTD_CLEVEL_DEFAULT;
+    }
+
+    TSharedRef TrainCompressionDictionary(
+        i64 dictionarySize,
+        const std::vector<TSharedRef>& samples) const override
+    {
+        if (dictionarySize < GetMinDictionarySize()) {
+            THROW_ERROR_EXCEPTION("Compression dictionary size is too small")
+                << TErrorAttribute("dictionary_size", dictionarySize)
+                << TErrorAttribute("min_dictionary_size", GetMinDictionarySize());
+        }
+
+        std::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        i64 totalSampleSize = 0;
+        for (const auto& sample : samples) {
+            sampleSizes.push_back(sample.Size());
+            totalSampleSize += sample.Size();
+        }
+
+        // Zstd expects samples to be laid out contiguously.
+        TBlob samplesBuffer(GetRefCountedTypeCookie<TCompressionDictionarySamplesTag>(), totalSampleSize, /*initializeStorage*/ false);
+        {
+            char* current = samplesBuffer.Begin();
+            for (const auto& sample : samples) {
+                ::memcpy(current, sample.Begin(), sample.Size());
+                current += sample.Size();
+            }
+        }
+
+        auto dictionary = TSharedMutableRef::Allocate<TCompressionDictionaryTag>(dictionarySize, {.InitializeStorage = false});
+        auto resultSize = ZDICT_trainFromBuffer(
+            dictionary.Begin(),
+            dictionary.Size(),
+            samplesBuffer.Begin(),
+            sampleSizes.data(),
+            sampleSizes.size());
+        if (ZDICT_isError(resultSize)) {
+            THROW_ERROR_EXCEPTION("Failed to train compression dictionary")
+                << TErrorAttribute("error", ZDICT_getErrorName(resultSize))
+                << TErrorAttribute("sample_count", samples.size())
+                << TErrorAttribute("total_sample_size", totalSampleSize)
+                << TErrorAttribute("dictionary_size", dictionarySize);
+        }
+
+        return dictionary.Slice(0, resultSize);
+    }
+
+    IDigestedCompressionDictionaryPtr CreateDigestedCompressionDictionary(
+        TRef compressionDictionary,
+        int compressionLevel) const override
+    {
+        if (compressionLevel < GetMinCompressionLevel() || compressionLevel > GetMaxCompressionLevel()) {
+            THROW_ERROR_EXCEPTION("Invalid dictionary compression level %v: expected to be in range [%v, %v]",
+                compressionLevel,
+                GetMinCompressionLevel(),
+                GetMaxCompressionLevel());
+        }
+
+        return New<TDigestedCompressionDictionary>(compressionDictionary, compressionLevel);
+    }
+
+    IDigestedDecompressionDictionaryPtr CreateDigestedDecompressionDictionary(
+        TRef compressionDictionary) const override
+    {
+        return New<TDigestedDecompressionDictionary>(compressionDictionary);
+    }
+
+    IDictionaryCompressorPtr CreateDictionaryCompressor(
+        const IDigestedCompressionDictionaryPtr& digestedCompressionDictionary) const override
+    {
+        return New<TDictionaryCompressor>(
+            StaticPointerCast<TDigestedCompressionDictionary>(digestedCompressionDictionary));
+    }
+
+    IDictionaryDecompressorPtr CreateDictionaryDecompressor(
+        const IDigestedDecompressionDictionaryPtr& digestedDecompressionDictionary) const override
+    {
+        return New<TDictionaryDecompressor>(
+            StaticPointerCast<TDigestedDecompressionDictionary>(digestedDecompressionDictionary));
+    }
+
+    TDictionaryCompressionFrameInfo GetFrameInfo(TRef input) const override
+    {
+        auto contentSize = ZSTD_getFrameContentSize(input.Begin(), input.Size());
+        if (contentSize == ZSTD_CONTENTSIZE_UNKNOWN || contentSize == ZSTD_CONTENTSIZE_ERROR) {
+            THROW_ERROR_EXCEPTION("Malformed dictionary compression frame header")
+                << TErrorAttribute("frame_size", input.Size());
+        }
+
+        return {
+            .ContentSize = static_cast<i64>(contentSize),
+        };
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TDictionaryBlockCodec
+    : public IDictionaryBlockCodec
+{
+public:
+    TDictionaryBlockCodec(
+        ECodec codecId,
+        int compressionLevel,
+        TSharedRef dictionary)
+        : CodecId_(codecId)
+        , CompressionLevel_(compressionLevel)
+        , Dictionary_(std::move(dictionary))
+    { }
+
+    TSharedRef Compress(const TSharedRef& block) override
+    {
+        return DoCompress(block);
+    }
+
+    TSharedRef Compress(const std::vector<TSharedRef>& blocks) override
+    {
+        if (blocks.size() == 1) {
+            return DoCompress(blocks.front());
+        }
+        return DoCompress(MergeRefsToRef<TDictionaryCompressedBlockTag>(blocks));
+    }
+
+    TSharedRef Decompress(const TSharedRef& block) override
+    {
+        return DoDecompress(block);
+    }
+
+    TSharedRef Decompress(const std::vector<TSharedRef>& blocks) override
+    {
+        if (blocks.size() == 1) {
+            return DoDecompress(blocks.front());
+        }
+        return DoDecompress(MergeRefsToRef<TDictionaryDecompressedBlockTag>(blocks));
+    }
+
+    ECodec GetId() const override
+    {
+        return CodecId_;
+    }
+
+    const TSharedRef& GetDictionary() const override
+    {
+        return Dictionary_;
+    }
+
+private:
+    const ECodec CodecId_;
+    const int CompressionLevel_;
+    const TSharedRef Dictionary_;
+
+    std::once_flag DigestedCompressionDictionaryFlag_;
+    TIntrusivePtr<TDigestedCompressionDictionary> DigestedCompressionDictionary_;
+
+    std::once_flag DigestedDecompressionDictionaryFlag_;
+    TIntrusivePtr<TDigestedDecompressionDictionary> DigestedDecompressionDictionary_;
+
+    const ZSTD_CDict* GetDigestedCompressionDictionary()
+    {
+        std::call_once(DigestedCompressionDictionaryFlag_, [&] {
+            DigestedCompressionDictionary_ = New<TDigestedCompressionDictionary>(Dictionary_, CompressionLevel_);
+        });
+        return DigestedCompressionDictionary_->GetUnderlying();
+    }
+
+    const ZSTD_DDict* GetDigestedDecompressionDictionary()
+    {
+        std::call_once(DigestedDecompressionDictionaryFlag_, [&] {
+            DigestedDecompressionDictionary_ = New<TDigestedDecompressionDictionary>(Dictionary_);
+        });
+        return DigestedDecompressionDictionary_->GetUnderlying();
+    }
+
+    TSharedRef DoCompress(TRef input)
+    {
+        auto cookie = GetRefCountedTypeCookie<TDictionaryCompressedBlockTag>();
+
+        // Same header as the one written by regular Zstd codecs.
+        ui64 uncompressedSize = input.Size();
+        auto bound = ZSTD_compressBound(input.Size());
+        TBlob output(cookie, sizeof(uncompressedSize) + bound, /*initializeStorage*/ false);
+        ::memcpy(output.Begin(), &uncompressedSize, sizeof(uncompressedSize));
+
+        auto* context = ZSTD_createCCtx();
+        auto contextGuard = Finally([&] {
+            ZSTD_freeCCtx(context);
+        });
+
+        auto compressedSize = ZSTD_compress_usingCDict(
+            context,
+            output.Begin() + sizeof(uncompressedSize),
+            bound,
+            input.Begin(),
+            input.Size(),
+            GetDigestedCompressionDictionary());
+        YT_LOG_FATAL_IF(ZSTD_isError(compressedSize), "Zstd dictionary compression failed (Error: %v)",
+            ZSTD_getErrorName(compressedSize));
+
+        output.Resize(sizeof(uncompressedSize) + compressedSize);
+        // Blocks are small and compress well, so do not keep the slack of the bound.
+        if (output.Capacity() >= 1.05 * output.Size()) {
+            output = TBlob(cookie, output.ToRef());
+        }
+        return TSharedRef::FromBlob(std::move(output));
+    }
+
+    TSharedRef DoDecompress(TRef input)
+    {
+        ui64 uncompressedSize;
+        if (input.Size() < sizeof(uncompressedSize)) {
+            THROW_ERROR_EXCEPTION("Malformed dictionary compressed block: block is too short")
+                << TErrorAttribute("block_size", input.Size());
+        }
+        ::memcpy(&uncompressedSize, input.Begin(), sizeof(uncompressedSize));
+        auto frame = input.Slice(sizeof(uncompressedSize), input.Size());
+
+        auto frameContentSize = ZSTD_getFrameContentSize(frame.Begin(), frame.Size());
+        if (frameContentSize != uncompressedSize) {
+            THROW_ERROR_EXCEPTION("Malformed dictionary compressed block: size mismatch")
+                << TErrorAttribute("uncompressed_size", uncompressedSize)
+                << TErrorAttribute("frame_content_size", frameContentSize);
+        }
+
+        auto output = TSharedMutableRef::Allocate<TDictionaryDecompressedBlockTag>(
+            uncompressedSize,
+            {.InitializeStorage = false});
+
+        auto* context = ZSTD_createDCtx();
+        auto contextGuard = Finally([&] {
+            ZSTD_freeDCtx(context);
+        });
+
+        auto decompressedSize = ZSTD_decompress_usingDDict(
+            context,
+            output.Begin(),
+            output.Size(),
+            frame.Begin(),
+            frame.Size(),
+            GetDigestedDecompressionDictionary());
+        if (ZSTD_isError(decompressedSize)) {
+            THROW_ERROR_EXCEPTION("Zstd dictionary decompression failed")
+                << TErrorAttribute("error", ZSTD_getErrorName(decompressedSize));
+        }
+        if (decompressedSize != uncompressedSize) {
+            THROW_ERROR_EXCEPTION("Zstd dictionary decompression failed: output size mismatch")
+                << TErrorAttribute("expected_size", uncompressedSize)
+                << TErrorAttribute("actual_size", decompressedSize);
+        }
+
+        return output;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+IDictionaryCompressionCodec* GetDictionaryCompressionCodec()
+{
+    static TZstdDictionaryCompressionCodec result;
+    return &result;
+}
+
+std::optional<int> TryGetZstdCompressionLevel(ECodec codecId)
+{
+    switch (codecId) {
+
+#define CASE(level) case PP_CONCAT(ECodec::Zstd_, level): return level;
+        PP_FOR_EACH(CASE, (1)(2)(3)(4)(5)(6)(7)(8)(9)(10)(11)(12)(13)(14)(15)(16)(17)(18)(19)(20)(21))
+#undef CASE
+
+        default:
+            return std::nullopt;
+    }
+}
+
+IDictionaryBlockCodecPtr CreateDictionaryBlockCodec(
+    ECodec codecId,
+    TSharedRef dictionary)
+{
+    auto compressionLevel = TryGetZstdCompressionLevel(codecId);
+    if (!compressionLevel) {
+        THROW_ERROR_EXCEPTION("Dictionary compression is not supported for codec %Qlv",
+            codecId);
+    }
+
+    return New<TDictionaryBlockCodec>(codecId, *compressionLevel, std::move(dictionary));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NCompression
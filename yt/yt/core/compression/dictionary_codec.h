@@ -0,0 +1,136 @@
+#pragma once
+
+#include "public.h"
+#include "codec.h"
+
+#include <library/cpp/yt/memory/ref.h>
+
+namespace NYT::NCompression {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Compression dictionary preprocessed for a particular compression level.
+//! Thread-safe; may be shared by many compressors.
+struct IDigestedCompressionDictionary
+    : public TRefCounted
+{
+    virtual i64 GetMemoryUsage() const = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(IDigestedCompressionDictionary)
+
+//! Decompression dictionary preprocessed for repeated use.
+//! Thread-safe; may be shared by many decompressors.
+struct IDigestedDecompressionDictionary
+    : public TRefCounted
+{
+    virtual i64 GetMemoryUsage() const = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(IDigestedDecompressionDictionary)
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Compresses individual (typically small) values using a fixed dictionary.
+//! Not thread-safe.
+struct IDictionaryCompressor
+    : public TRefCounted
+{
+    //! Compresses #input into a self-contained frame allocated from #pool.
+    virtual TRef Compress(TChunkedMemoryPool* pool, TRef input) = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(IDictionaryCompressor)
+
+//! Decompresses frames produced by IDictionaryCompressor with the same dictionary.
+//! Not thread-safe.
+struct IDictionaryDecompressor
+    : public TRefCounted
+{
+    //! Decompresses #input into #output, which must be exactly of frame content size
+    //! (see IDictionaryCompressionCodec::GetFrameInfo).
+    virtual void Decompress(TRef input, TMutableRef output) = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(IDictionaryDecompressor)
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TDictionaryCompressionFrameInfo
+{
+    i64 ContentSize;
+};
+
+//! A codec family whose compression ratio on small inputs is improved
+//! by a dictionary trained on a representative sample of the data.
+struct IDictionaryCompressionCodec
+{
+    virtual ~IDictionaryCompressionCodec() = default;
+
+    virtual int GetMinDictionarySize() const = 0;
+
+    virtual int GetMinCompressionLevel() const = 0;
+    virtual int GetMaxCompressionLevel() const = 0;
+    virtual int GetDefaultCompressionLevel() const = 0;
+
+    //! Trains a dictionary of at most #dictionarySize bytes from #samples.
+    //! Throws if samples are not sufficient to train a dictionary.
+    virtual TSharedRef TrainCompressionDictionary(
+        i64 dictionarySize,
+        const std::vector<TSharedRef>& samples) const = 0;
+
+    virtual IDigestedCompressionDictionaryPtr CreateDigestedCompressionDictionary(
+        TRef compressionDictionary,
+        int compressionLevel) const = 0;
+
+    virtual IDigestedDecompressionDictionaryPtr CreateDigestedDecompressionDictionary(
+        TRef compressionDictionary) const = 0;
+
+    virtual IDictionaryCompressorPtr CreateDictionaryCompressor(
+        const IDigestedCompressionDictionaryPtr& digestedCompressionDictionary) const = 0;
+
+    virtual IDictionaryDecompressorPtr CreateDictionaryDecompressor(
+        const IDigestedDecompressionDictionaryPtr& digestedDecompressionDictionary) const = 0;
+
+    //! Extracts frame info from the header of a frame produced by IDictionaryCompressor.
+    virtual TDictionaryCompressionFrameInfo GetFrameInfo(TRef input) const = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Returns the (zstd-based) dictionary compression codec.
+IDictionaryCompressionCodec* GetDictionaryCompressionCodec();
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Block codec bound to a particular compression dictionary.
+/*!
+ *  Blocks are laid out as those of regular Zstd codecs (uncompressed size followed by a zstd frame),
+ *  so a regular codec fails to decompress them with a dictionary mismatch error
+ *  instead of producing garbage.
+ *
+ *  Digested dictionaries are created on first use.
+ *
+ *  Thread affinity: any
+ */
+struct IDictionaryBlockCodec
+    : public ICodec
+    , public TRefCounted
+{
+    virtual const TSharedRef& GetDictionary() const = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(IDictionaryBlockCodec)
+
+//! Returns the compression level of #codecId if it is one of Zstd codecs.
+std::optional<int> TryGetZstdCompressionLevel(ECodec codecId);
+
+//! Creates a block codec that compresses blocks with #dictionary.
+//! #codecId must be one of Zstd codecs; its level is used for compression.
+IDictionaryBlockCodecPtr CreateDictionaryBlockCodec(
+    ECodec codecId,
+    TSharedRef dictionary);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NCompression
@@ -8,6 +8,14 @@ namespace NYT::NCompression {
 
 struct ICodec;
 
+struct IDictionaryCompressionCodec;
+
+DECLARE_REFCOUNTED_STRUCT(IDigestedCompressionDictionary)
+DECLARE_REFCOUNTED_STRUCT(IDigestedDecompressionDictionary)
+DECLARE_REFCOUNTED_STRUCT(IDictionaryCompressor)
+DECLARE_REFCOUNTED_STRUCT(IDictionaryDecompressor)
+DECLARE_REFCOUNTED_STRUCT(IDictionaryBlockCodec)
+
 DEFINE_AMBIGUOUS_ENUM_WITH_UNDERLYING_TYPE(ECodec, i8,
     ((None)                       (0))
     ((Snappy)                     (1))
@@ -0,0 +1,205 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/core/compression/codec.h>
+#include <yt/yt/core/compression/dictionary_codec.h>
+
+#include <library/cpp/yt/memory/chunked_memory_pool.h>
+
+#include <util/random/fast.h>
+
+namespace NYT::NCompression {
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TDictionaryCodecTestTag
+{ };
+
+TString GenerateValue(TFastRng64* rng)
+{
+    static const std::vector<TString> Words{
+        "user_id", "session", "timestamp", "country", "device",
+        "android", "ios", "desktop", "referrer", "campaign",
+    };
+
+    TStringBuilder builder;
+    builder.AppendChar('{');
+    for (int index = 0; index < 8; ++index) {
+        builder.AppendFormat("\"%v\":\"%v_%v\";",
+            Words[index],
+            Words[rng->Uniform(Words.size())],
+            rng->Uniform(100));
+    }
+    builder.AppendChar('}');
+    return builder.Flush();
+}
+
+std::vector<TSharedRef> GenerateSamples(int count, TFastRng64* rng)
+{
+    std::vector<TSharedRef> samples;
+    for (int index = 0; index < count; ++index) {
+        samples.push_back(TSharedRef::FromString(GenerateValue(rng)));
+    }
+    return samples;
+}
+
+TEST(TDictionaryCodecTest, RoundTrip)
+{
+    TFastRng64 rng(42);
+    auto* codec = GetDictionaryCompressionCodec();
+
+    auto dictionary = codec->TrainCompressionDictionary(4_KB, GenerateSamples(2000, &rng));
+    ASSERT_GT(dictionary.Size(), 0u);
+    ASSERT_LE(dictionary.Size(), 4_KB);
+
+    auto compressor = codec->CreateDictionaryCompressor(
+        codec->CreateDigestedCompressionDictionary(dictionary, codec->GetDefaultCompressionLevel()));
+    auto decompressor = codec->CreateDictionaryDecompressor(
+        codec->CreateDigestedDecompressionDictionary(dictionary));
+
+    TChunkedMemoryPool pool(TDictionaryCodecTestTag{});
+
+    i64 totalInputSize = 0;
+    i64 totalDictionaryCompressedSize = 0;
+    i64 totalPlainCompressedSize = 0;
+
+    for (int index = 0; index < 100; ++index) {
+        auto value = GenerateValue(&rng);
+
+        auto compressed = compressor->Compress(&pool, TRef::FromString(value));
+        auto frameInfo = codec->GetFrameInfo(compressed);
+        ASSERT_EQ(std::ssize(value), frameInfo.ContentSize);
+
+        TString decompressed;
+        decompressed.resize(frameInfo.ContentSize);
+        decompressor->Decompress(compressed, TMutableRef(decompressed.begin(), decompressed.size()));
+        EXPECT_EQ(value, decompressed);
+
+        totalInputSize += value.size();
+        totalDictionaryCompressedSize += compressed.Size();
+        totalPlainCompressedSize += GetCodec(ECodec::Zstd_3)->Compress(TSharedRef::FromString(value)).Size();
+    }
+
+    EXPECT_LT(totalDictionaryCompressedSize, totalPlainCompressedSize);
+    EXPECT_LT(totalDictionaryCompressedSize, totalInputSize);
+}
+
+TEST(TDictionaryCodecTest, EmptyInput)
+{
+    TFastRng64 rng(42);
+    auto* codec = GetDictionaryCompressionCodec();
+
+    auto dictionary = codec->TrainCompressionDictionary(4_KB, GenerateSamples(2000, &rng));
+    auto compressor = codec->CreateDictionaryCompressor(
+        codec->CreateDigestedCompressionDictionary(dictionary, codec->GetDefaultCompressionLevel()));
+    auto decompressor = codec->CreateDictionaryDecompressor(
+        codec->CreateDigestedDecompressionDictionary(dictionary));
+
+    TChunkedMemoryPool pool(TDictionaryCodecTestTag{});
+    auto compressed = compressor->Compress(&pool, TRef());
+    EXPECT_EQ(0, codec->GetFrameInfo(compressed).ContentSize);
+    decompressor->Decompress(compressed, TMutableRef());
+}
+
+TEST(TDictionaryCodecTest, TooFewSamples)
+{
+    auto* codec = GetDictionaryCompressionCodec();
+    EXPECT_THROW(
+        codec->TrainCompressionDictionary(4_KB, {TSharedRef::FromString("abc")}),
+        TErrorException);
+}
+
+TEST(TDictionaryCodecTest, InvalidCompressionLevel)
+{
+    TFastRng64 rng(42);
+    auto* codec = GetDictionaryCompressionCodec();
+
+    auto dictionary = codec->TrainCompressionDictionary(4_KB, GenerateSamples(2000, &rng));
+    EXPECT_THROW(
+        codec->CreateDigestedCompressionDictionary(dictionary, codec->GetMaxCompressionLevel() + 1),
+        TErrorException);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSharedRef GenerateBlock(int valueCount, TFastRng64* rng)
+{
+    TString block;
+    for (int index = 0; index < valueCount; ++index) {
+        block += GenerateValue(rng);
+    }
+    return TSharedRef::FromString(block);
+}
+
+TEST(TDictionaryBlockCodecTest, RoundTrip)
+{
+    TFastRng64 rng(42);
+    auto dictionary = GetDictionaryCompressionCodec()->TrainCompressionDictionary(4_KB, GenerateSamples(2000, &rng));
+    auto codec = CreateDictionaryBlockCodec(ECodec::Zstd_3, dictionary);
+    EXPECT_EQ(ECodec::Zstd_3, codec->GetId());
+    EXPECT_TRUE(TRef::AreBitwiseEqual(dictionary, codec->GetDictionary()));
+
+    i64 totalDictionaryCompressedSize = 0;
+    i64 totalPlainCompressedSize = 0;
+    for (int index = 0; index < 20; ++index) {
+        auto block = GenerateBlock(5, &rng);
+        auto compressed = codec->Compress(block);
+        EXPECT_TRUE(TRef::AreBitwiseEqual(block, codec->Decompress(compressed)));
+
+        totalDictionaryCompressedSize += compressed.Size();
+        totalPlainCompressedSize += GetCodec(ECodec::Zstd_3)->Compress(block).Size();
+    }
+
+    EXPECT_LT(totalDictionaryCompressedSize, totalPlainCompressedSize);
+}
+
+TEST(TDictionaryBlockCodecTest, VectorizedBlocks)
+{
+    TFastRng64 rng(42);
+    auto dictionary = GetDictionaryCompressionCodec()->TrainCompressionDictionary(4_KB, GenerateSamples(2000, &rng));
+    auto codec = CreateDictionaryBlockCodec(ECodec::Zstd_3, dictionary);
+
+    std::vector<TSharedRef> parts{GenerateBlock(2, &rng), TSharedRef::MakeEmpty(), GenerateBlock(3, &rng)};
+    auto merged = MergeRefsToRef<TDictionaryCodecTestTag>(parts);
+
+    auto compressed = codec->Compress(parts);
+    EXPECT_TRUE(TRef::AreBitwiseEqual(merged, codec->Decompress(compressed)));
+
+    auto middle = compressed.Size() / 2;
+    EXPECT_TRUE(TRef::AreBitwiseEqual(merged, codec->Decompress(std::vector{
+        compressed.Slice(0, middle),
+        compressed.Slice(middle, compressed.Size()),
+    })));
+
+    EXPECT_EQ(0u, codec->Decompress(codec->Compress(TSharedRef::MakeEmpty())).Size());
+}
+
+TEST(TDictionaryBlockCodecTest, RegularCodecFails)
+{
+    TFastRng64 rng(42);
+    auto dictionary = GetDictionaryCompressionCodec()->TrainCompressionDictionary(4_KB, GenerateSamples(2000, &rng));
+    auto codec = CreateDictionaryBlockCodec(ECodec::Zstd_3, dictionary);
+
+    auto compressed = codec->Compress(GenerateBlock(5, &rng));
+    EXPECT_THROW(GetCodec(ECodec::Zstd_3)->Decompress(compressed), TErrorException);
+
+    auto otherDictionary = GetDictionaryCompressionCodec()->TrainCompressionDictionary(4_KB, GenerateSamples(1000, &rng));
+    EXPECT_THROW(CreateDictionaryBlockCodec(ECodec::Zstd_3, otherDictionary)->Decompress(compressed), TErrorException);
+
+    EXPECT_THROW(codec->Decompress(GetCodec(ECodec::Lz4)->Compress(GenerateBlock(5, &rng))), TErrorException);
+}
+
+TEST(TDictionaryBlockCodecTest, ZstdOnly)
+{
+    EXPECT_EQ(1, TryGetZstdCompressionLevel(ECodec::Zstd_1));
+    EXPECT_EQ(21, TryGetZstdCompressionLevel(ECodec::Zstd_21));
+    EXPECT_FALSE(TryGetZstdCompressionLevel(ECodec::Lz4));
+    EXPECT_FALSE(TryGetZstdCompressionLevel(ECodec::None));
+
+    EXPECT_THROW(CreateDictionaryBlockCodec(ECodec::Lz4, TSharedRef::FromString("dictionary")), TErrorException);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NCompression
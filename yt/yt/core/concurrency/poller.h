@@ -23,6 +23,7 @@ DEFINE_BIT_ENUM(EPollControl,
     ((Terminate)    (0x100))    // Termination requested (for external use)
     ((Running)      (0x200))    // Operation in progress (for external use)
     ((Shutdown)     (0x400))    // Shutdown in progress  (for external use)
+    ((Receive)      (0x800))    // Data is received by the poller, see IReceivingPoller (Arm)
 );
 
 //! Poller may provide separate sets of threads for handling pollables of
@@ -110,6 +111,10 @@ struct IPoller
     virtual void Retry(const IPollablePtr& pollable, bool wakeup = true) = 0;
 
     //! Unarms the poller.
+    /*!
+     *  No events are triggered for the FD once the call returns,
+     *  though events triggered before may still be running or scheduled.
+     */
     virtual void Unarm(TFileDescriptor fd, const IPollablePtr& pollable) = 0;
 
     //! Returns the invoker capable of executing arbitrary callbacks
@@ -121,4 +126,28 @@ DEFINE_REFCOUNTED_TYPE(IPoller)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+//! Implemented by pollers that are able to receive data from sockets on behalf of pollables.
+/*!
+ *  A socket armed with EPollControl::Read | EPollControl::Receive is read by the poller
+ *  into its own buffers; the pollable gets EPollControl::Read events when data is received
+ *  (or the peer has closed the connection, or the socket has failed) and takes the data with #Receive
+ *  instead of reading the socket.
+ */
+struct IReceivingPoller
+    : public virtual TRefCounted
+{
+    //! Copies the data received from #fd into #buffer.
+    /*!
+     *  Has the semantics of a non-blocking |recv|: returns the number of bytes copied, zero if the peer has
+     *  closed the connection, or -1 with errno set to the socket error or to EAGAIN if there is no data yet.
+     *
+     *  Falls back to reading the socket directly if the poller is unable to receive data.
+     */
+    virtual ssize_t Receive(TFileDescriptor fd, const IPollablePtr& pollable, TMutableRef buffer) = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(IReceivingPoller)
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace NYT::NConcurrency
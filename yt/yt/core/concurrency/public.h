@@ -78,8 +78,15 @@ using TLease = TLeaseEntryPtr;
 
 DECLARE_REFCOUNTED_STRUCT(IPollable)
 DECLARE_REFCOUNTED_STRUCT(IPoller)
+DECLARE_REFCOUNTED_STRUCT(IReceivingPoller)
 DECLARE_REFCOUNTED_STRUCT(IThreadPoolPoller)
 
+//! Describes the API used by a poller to wait for FD readiness.
+DEFINE_ENUM(EPollerType,
+    (Epoll)     // epoll on Linux, platform-specific equivalents elsewhere
+    (Uring)     // io_uring poll requests; Linux only
+);
+
 DECLARE_REFCOUNTED_CLASS(TThread)
 
 using TThreadId = size_t;
@@ -0,0 +1,230 @@
+#include "thread_pool_poller_detail.h"
+#include "thread_pool.h"
+#include "private.h"
+
+#include <yt/yt/core/actions/invoker_util.h>
+
+namespace NYT::NConcurrency {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+bool TryAcquireEventCount(IPollable* pollable)
+{
+    auto* cookie = TPollableCookie::FromPollable(pollable);
+    YT_VERIFY(cookie);
+    YT_VERIFY(cookie->GetRefCount() > 0);
+
+    auto oldEventCount = cookie->ActiveEventCount.fetch_add(2);
+    if (oldEventCount & 1) {
+        return true;
+    }
+
+    cookie->ActiveEventCount.fetch_sub(2);
+    return false;
+}
+
+EThreadPriority PollablePriorityToThreadPriority(EPollablePriority priority)
+{
+    switch (priority) {
+        case EPollablePriority::RealTime:
+            return EThreadPriority::RealTime;
+
+        default:
+            return EThreadPriority::Normal;
+    }
+}
+
+TString PollablePriorityToPollerThreadNameSuffix(EPollablePriority priority)
+{
+    switch (priority) {
+        case EPollablePriority::RealTime:
+            return "RT";
+
+        default:
+            return "";
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TPollableCookie::TPollableCookie(TThreadPoolPollerBase* poller)
+    : Poller(poller)
+{ }
+
+TPollableCookie* TPollableCookie::FromPollable(IPollable* pollable)
+{
+    return static_cast<TPollableCookie*>(pollable->GetCookie());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TThreadPoolPollerBase::TRunEventGuard
+{
+public:
+    TRunEventGuard(IPollable* pollable, EPollControl control)
+        : Pollable_(pollable)
+        , Control_(control)
+    { }
+
+    explicit TRunEventGuard(TRunEventGuard&& other)
+        : Pollable_(std::move(other.Pollable_))
+        , Control_(std::move(other.Control_))
+    {
+        other.Pollable_ = nullptr;
+    }
+
+    TRunEventGuard(const TRunEventGuard&) = delete;
+
+    TRunEventGuard& operator=(const TRunEventGuard&) = delete;
+    TRunEventGuard& operator=(TRunEventGuard&&) = delete;
+
+    ~TRunEventGuard()
+    {
+        if (Pollable_) {
+            // This is unlikely but might happen on thread pool termination.
+            GetFinalizerInvoker()->Invoke(BIND(&Destroy, Unretained(Pollable_)));
+        }
+    }
+
+    void operator()()
+    {
+        Pollable_->OnEvent(Control_);
+        Destroy(Pollable_);
+        Pollable_ = nullptr;
+    }
+
+private:
+    IPollable* Pollable_;
+    EPollControl Control_;
+
+    static void Destroy(IPollable* pollable)
+    {
+        auto* cookie = TPollableCookie::FromPollable(pollable);
+        YT_VERIFY(cookie);
+        auto activeEventCount = cookie->ActiveEventCount.fetch_sub(2) - 2;
+        if (activeEventCount == 0) {
+            auto poller = MakeStrong(cookie->Poller);
+            poller->OnPollableShutdown(pollable);
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TThreadPoolPollerBase::TThreadPoolPollerBase(
+    int threadCount,
+    const TString& threadNamePrefix,
+    TDuration pollingPeriod)
+    : Logger(ConcurrencyLogger.WithTag("ThreadNamePrefix: %v", threadNamePrefix))
+{
+    for (auto priority : TEnumTraits<EPollablePriority>::GetDomainValues()) {
+        HandlerThreadPool_[priority] = CreateThreadPool(
+            threadCount,
+            threadNamePrefix + PollablePriorityToPollerThreadNameSuffix(priority),
+            PollablePriorityToThreadPriority(priority),
+            pollingPeriod);
+        HandlerInvoker_[priority] = HandlerThreadPool_[priority]->GetInvoker();
+    }
+}
+
+void TThreadPoolPollerBase::Reconfigure(int threadCount)
+{
+    for (auto priority : TEnumTraits<EPollablePriority>::GetDomainValues()) {
+        HandlerThreadPool_[priority]->Configure(threadCount);
+    }
+}
+
+// TODO(lukyan): Method OnShutdown in the interface and returned future are redundant.
+// Shutdown can be done by subscribing returned future or some promise can be set inside OnShutdown.
+TFuture<void> TThreadPoolPollerBase::Unregister(const IPollablePtr& pollable)
+{
+    auto* cookie = TPollableCookie::FromPollable(pollable.Get());
+
+    if (!cookie) {
+        // Pollable was not registered.
+        return VoidFuture;
+    }
+
+    DoUnregister(pollable);
+    return cookie->UnregisterPromise.ToFuture();
+}
+
+void TThreadPoolPollerBase::Retry(const IPollablePtr& pollable, bool /*wakeup*/)
+{
+    if (TryAcquireEventCount(pollable.Get())) {
+        HandlerInvoker_[pollable->GetPriority()]->Invoke(BIND(TRunEventGuard(pollable.Get(), EPollControl::Retry)));
+    }
+}
+
+IInvokerPtr TThreadPoolPollerBase::GetInvoker() const
+{
+    return HandlerInvoker_[EPollablePriority::Normal];
+}
+
+bool TThreadPoolPollerBase::DoUnregister(const IPollablePtr& pollable)
+{
+    YT_LOG_DEBUG("Requesting pollable unregistration (%v)",
+        pollable->GetLoggingTag());
+
+    auto* cookie = TPollableCookie::FromPollable(pollable.Get());
+    YT_VERIFY(cookie);
+    auto activeEventCount = cookie->ActiveEventCount.load();
+
+    while (true) {
+        // Otherwise pollable has been already unregistered.
+        if (!(activeEventCount & 1)) {
+            YT_LOG_DEBUG("Pollable is already unregistered (%v)",
+                pollable->GetLoggingTag());
+            return false;
+        }
+
+        if (cookie->ActiveEventCount.compare_exchange_weak(activeEventCount, activeEventCount & ~1)) {
+            // Poller guarantees that OnShutdown is never executed concurrently with OnEvent().
+            // Otherwise it will be removed in TRunEventGuard.
+            if (activeEventCount == 1) {
+                OnPollableShutdown(pollable.Get());
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TThreadPoolPollerBase::ScheduleEvent(IPollable* pollable, EPollControl control)
+{
+    YT_LOG_TRACE("Got pollable event (Pollable: %v, Control: %v)",
+        pollable->GetLoggingTag(),
+        control);
+
+    YT_VERIFY(pollable->GetRefCount() > 0);
+
+    if (TryAcquireEventCount(pollable)) {
+        auto priority = pollable->GetPriority();
+        Callbacks_[priority].push_back(BIND(TRunEventGuard(pollable, control)));
+    }
+}
+
+void TThreadPoolPollerBase::FlushEvents()
+{
+    for (auto priority : TEnumTraits<EPollablePriority>::GetDomainValues()) {
+        HandlerInvoker_[priority]->Invoke(Callbacks_[priority]);
+        Callbacks_[priority].clear();
+    }
+}
+
+void TThreadPoolPollerBase::OnPollableShutdown(IPollable* pollable)
+{
+    auto* cookie = TPollableCookie::FromPollable(pollable);
+    pollable->OnShutdown();
+    cookie->UnregisterPromise.Set();
+    OnPollableUnregistered(pollable);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NConcurrency
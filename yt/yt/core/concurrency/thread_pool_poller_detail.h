@@ -0,0 +1,90 @@
+#pragma once
+
+#include "thread_pool_poller.h"
+
+#include <yt/yt/core/logging/log.h>
+
+namespace NYT::NConcurrency {
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TThreadPoolPollerBase;
+
+//! Attached by a poller to every registered pollable.
+struct TPollableCookie
+    : public TRefCounted
+{
+    explicit TPollableCookie(TThreadPoolPollerBase* poller);
+
+    static TPollableCookie* FromPollable(IPollable* pollable);
+
+    TThreadPoolPollerBase* const Poller = nullptr;
+
+    // Active event count is equal to 2 * (active events) + (1 for unregister flag).
+    std::atomic<int> ActiveEventCount = 1;
+    const TPromise<void> UnregisterPromise = NewPromise<void>();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Runs pollable events in thread pools of respective priorities and implements
+//! the pollable lifecycle (events, retries and unregistration).
+/*!
+ *  Descendants wait for FD readiness in a polling thread and schedule events via #ScheduleEvent.
+ */
+class TThreadPoolPollerBase
+    : public IThreadPoolPoller
+{
+public:
+    void Reconfigure(int threadCount) override;
+
+    TFuture<void> Unregister(const IPollablePtr& pollable) override;
+
+    void Retry(const IPollablePtr& pollable, bool wakeup) override;
+
+    IInvokerPtr GetInvoker() const override;
+
+protected:
+    const NLogging::TLogger Logger;
+
+    TThreadPoolPollerBase(
+        int threadCount,
+        const TString& threadNamePrefix,
+        TDuration pollingPeriod);
+
+    //! Called when #pollable is unregistered and none of its events are running.
+    //! The pollable must be forgotten by the polling thread.
+    /*!
+     *  Thread affinity: any
+     */
+    virtual void OnPollableUnregistered(IPollable* pollable) = 0;
+
+    //! Returns |false| if the pollable has already been unregistered.
+    bool DoUnregister(const IPollablePtr& pollable);
+
+    //! Enqueues #IPollable::OnEvent unless the pollable is unregistered.
+    /*!
+     *  Thread affinity: polling thread
+     */
+    void ScheduleEvent(IPollable* pollable, EPollControl control);
+
+    //! Runs events enqueued by #ScheduleEvent.
+    /*!
+     *  Thread affinity: polling thread
+     */
+    void FlushEvents();
+
+private:
+    class TRunEventGuard;
+
+    TEnumIndexedVector<EPollablePriority, IThreadPoolPtr> HandlerThreadPool_;
+    TEnumIndexedVector<EPollablePriority, IInvokerPtr> HandlerInvoker_;
+
+    TEnumIndexedVector<EPollablePriority, std::vector<TClosure>> Callbacks_;
+
+    void OnPollableShutdown(IPollable* pollable);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NConcurrency
@@ -2,6 +2,9 @@
 
 #include <yt/yt/core/concurrency/poller.h>
 #include <yt/yt/core/concurrency/thread_pool_poller.h>
+#include <yt/yt/core/concurrency/uring_poller.h>
+
+#include <yt/yt/core/net/socket.h>
 
 #include <util/system/env.h>
 
@@ -82,18 +85,62 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////
 
+//! Signals the first read readiness event of a socket.
+class TSocketPollableMock
+    : public TPollableMock
+{
+public:
+    void OnEvent(EPollControl control) override
+    {
+        YT_VERIFY(Any(control & EPollControl::Read));
+        ++ReadEventCount_;
+        ReadPromise_.TrySet();
+    }
+
+    TFuture<void> GetReadFuture() const
+    {
+        return ReadPromise_;
+    }
+
+    int GetReadEventCount() const
+    {
+        return ReadEventCount_.load();
+    }
+
+private:
+    const TPromise<void> ReadPromise_ = NewPromise<void>();
+
+    std::atomic<int> ReadEventCount_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TThreadPoolPollerTest
-    : public ::testing::Test
+    : public ::testing::TestWithParam<EPollerType>
 {
 public:
     void SetUp() override
     {
-        Poller = CreateThreadPoolPoller(InitialThreadCount, "TestPoller");
+        switch (GetParam()) {
+            case EPollerType::Epoll:
+                Poller = CreateThreadPoolPoller(InitialThreadCount, "TestPoller");
+                break;
+            case EPollerType::Uring:
+                if (!IsUringPollerSupported()) {
+                    GTEST_SKIP() << "Uring poller is not supported";
+                }
+                Poller = CreateUringThreadPoolPoller(InitialThreadCount, "TestPoller");
+                break;
+            default:
+                YT_ABORT();
+        }
     }
 
     void TearDown() override
     {
-        Poller->Shutdown();
+        if (Poller) {
+            Poller->Shutdown();
+        }
     }
 
 protected:
@@ -102,7 +149,7 @@ protected:
     IThreadPoolPollerPtr Poller;
 };
 
-TEST_F(TThreadPoolPollerTest, SimplePollable)
+TEST_P(TThreadPoolPollerTest, SimplePollable)
 {
     auto pollable = New<TPollableMock>();
     EXPECT_TRUE(Poller->TryRegister(pollable));
@@ -117,7 +164,7 @@ TEST_F(TThreadPoolPollerTest, SimplePollable)
     ExpectSuccessfullySetFuture(AllSucceeded(futures));
 }
 
-TEST_F(TThreadPoolPollerTest, SimpleCallback)
+TEST_P(TThreadPoolPollerTest, SimpleCallback)
 {
     auto promise = NewPromise<void>();
     auto callback = BIND([=] { promise.Set(); });
@@ -127,7 +174,7 @@ TEST_F(TThreadPoolPollerTest, SimpleCallback)
     ExpectSuccessfullySetFuture(promise.ToFuture());
 }
 
-TEST_F(TThreadPoolPollerTest, SimpleReconfigure)
+TEST_P(TThreadPoolPollerTest, SimpleReconfigure)
 {
     auto pollable = New<TPollableMock>();
     EXPECT_TRUE(Poller->TryRegister(pollable));
@@ -141,7 +188,118 @@ TEST_F(TThreadPoolPollerTest, SimpleReconfigure)
     ExpectSuccessfullySetFuture(AllSucceeded(futures));
 }
 
-TEST_F(TThreadPoolPollerTest, Stress)
+#ifdef _linux_
+
+TEST_P(TThreadPoolPollerTest, EdgeTriggeredSocket)
+{
+    int fds[2];
+    YT_VERIFY(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) == 0);
+
+    auto pollable = New<TSocketPollableMock>();
+    EXPECT_TRUE(Poller->TryRegister(pollable));
+    Poller->Arm(fds[0], pollable, EPollControl::Read | EPollControl::EdgeTriggered);
+
+    char data = 'x';
+    YT_VERIFY(HandleEintr(::write, fds[1], &data, sizeof(data)) == sizeof(data));
+    ExpectSuccessfullySetFuture(pollable->GetReadFuture());
+
+    Poller->Unarm(fds[0], pollable);
+    std::vector<TFuture<void>> futures{
+        Poller->Unregister(pollable),
+        pollable->GetShutdownFuture()
+    };
+    ExpectSuccessfullySetFuture(AllSucceeded(futures));
+
+    NNet::CloseSocket(fds[0]);
+    NNet::CloseSocket(fds[1]);
+}
+
+TEST_P(TThreadPoolPollerTest, NoEventsAfterUnarm)
+{
+    int fds[2];
+    YT_VERIFY(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) == 0);
+
+    auto pollable = New<TSocketPollableMock>();
+    EXPECT_TRUE(Poller->TryRegister(pollable));
+    Poller->Arm(fds[0], pollable, EPollControl::Read | EPollControl::EdgeTriggered | EPollControl::Receive);
+    Poller->Unarm(fds[0], pollable);
+
+    char data = 'x';
+    YT_VERIFY(HandleEintr(::write, fds[1], &data, sizeof(data)) == sizeof(data));
+
+    Sleep(TDuration::MilliSeconds(300));
+    EXPECT_EQ(0, pollable->GetReadEventCount());
+
+    std::vector<TFuture<void>> futures{
+        Poller->Unregister(pollable),
+        pollable->GetShutdownFuture()
+    };
+    ExpectSuccessfullySetFuture(AllSucceeded(futures));
+
+    NNet::CloseSocket(fds[0]);
+    NNet::CloseSocket(fds[1]);
+}
+
+TEST_P(TThreadPoolPollerTest, ReceiveSocket)
+{
+    auto receivingPoller = DynamicPointerCast<IReceivingPoller>(Poller);
+    if (!receivingPoller) {
+        GTEST_SKIP() << "Poller does not receive data";
+    }
+
+    int fds[2];
+    YT_VERIFY(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) == 0);
+
+    auto pollable = New<TSocketPollableMock>();
+    EXPECT_TRUE(Poller->TryRegister(pollable));
+    Poller->Arm(fds[0], pollable, EPollControl::Read | EPollControl::EdgeTriggered | EPollControl::Receive);
+
+    TString data(50'000, 'x');
+    for (int index = 0; index < std::ssize(data); ++index) {
+        data[index] = 'a' + index % 26;
+    }
+    YT_VERIFY(HandleEintr(::write, fds[1], data.data(), data.size()) == std::ssize(data));
+    ExpectSuccessfullySetFuture(pollable->GetReadFuture());
+
+    // Take the data in portions smaller than the poller buffers.
+    TString received;
+    std::array<char, 1000> buffer;
+    while (received.size() < data.size()) {
+        auto result = receivingPoller->Receive(fds[0], pollable, TMutableRef(buffer.data(), buffer.size()));
+        if (result < 0) {
+            ASSERT_EQ(EAGAIN, errno);
+            Sleep(TDuration::MilliSeconds(10));
+            continue;
+        }
+        ASSERT_GT(result, 0);
+        received.append(buffer.data(), result);
+    }
+    EXPECT_EQ(data, received);
+
+    NNet::CloseSocket(fds[1]);
+    while (true) {
+        auto result = receivingPoller->Receive(fds[0], pollable, TMutableRef(buffer.data(), buffer.size()));
+        if (result == 0) {
+            break;
+        }
+        ASSERT_EQ(-1, result);
+        ASSERT_EQ(EAGAIN, errno);
+        Sleep(TDuration::MilliSeconds(10));
+    }
+
+    Poller->Unarm(fds[0], pollable);
+    std::vector<TFuture<void>> futures{
+        Poller->Unregister(pollable),
+        pollable->GetShutdownFuture()
+    };
+    ExpectSuccessfullySetFuture(AllSucceeded(futures));
+
+    NNet::CloseSocket(fds[0]);
+}
+
+#endif
+
+TEST_P(TThreadPoolPollerTest, Stress)
 {
     std::vector<std::thread> threads;
 
@@ -204,6 +362,13 @@ TEST_F(TThreadPoolPollerTest, Stress)
     }
 }
 
+INSTANTIATE_TEST_SUITE_P(
+    Test,
+    TThreadPoolPollerTest,
+    ::testing::Values(
+        EPollerType::Epoll,
+        EPollerType::Uring));
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace
@@ -0,0 +1,1011 @@
+#include "uring_poller.h"
+#include "thread.h"
+#include "thread_pool_poller_detail.h"
+#include "notification_handle.h"
+#include "private.h"
+
+#include <yt/yt/core/misc/collection_helpers.h>
+#include <yt/yt/core/misc/finally.h>
+#include <yt/yt/core/misc/mpsc_stack.h>
+#include <yt/yt/core/misc/proc.h>
+#include <yt/yt/core/misc/ring_queue.h>
+
+#include <library/cpp/yt/threading/spin_lock.h>
+
+#include <library/cpp/yt/small_containers/compact_vector.h>
+
+#include <util/generic/size_literals.h>
+#include <util/system/align.h>
+
+#ifdef _linux_
+    #include <liburing.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+#endif
+
+namespace NYT::NConcurrency {
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef _linux_
+
+static const auto& Logger = ConcurrencyLogger;
+
+static constexpr auto PollerThreadQuantum = TDuration::MilliSeconds(100);
+static constexpr int UringQueueSize = 1024;
+
+// Must be a power of two.
+static constexpr int ReceiveBufferCount = 512;
+static constexpr i64 ReceiveBufferSize = 16_KB;
+static constexpr int ReceiveBufferGroupId = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct TUringReceiveBufferTag
+{ };
+
+//! Low bits of io_uring user data tell the kind of the operation;
+//! the remaining bits hold the pollable pointer (if any).
+DEFINE_ENUM(EUringOperation,
+    ((Poll)       (0))
+    ((Receive)    (1))
+    ((Cancel)     (2))
+    ((Wakeup)     (3))
+);
+
+constexpr ui64 UringOperationMask = 0x3;
+
+ui64 MakeUserData(IPollable* pollable, EUringOperation operation)
+{
+    auto pointer = reinterpret_cast<ui64>(pollable);
+    YT_ASSERT((pointer & UringOperationMask) == 0);
+    return pointer | static_cast<ui64>(operation);
+}
+
+std::pair<IPollable*, EUringOperation> ParseUserData(ui64 userData)
+{
+    return {
+        reinterpret_cast<IPollable*>(userData & ~UringOperationMask),
+        static_cast<EUringOperation>(userData & UringOperationMask),
+    };
+}
+
+DEFINE_ENUM(EPollerRequestType,
+    (Register)
+    (Arm)
+    (Unarm)
+    (Unregister)
+);
+
+struct TPollerRequest
+{
+    EPollerRequestType Type;
+    IPollablePtr Pollable;
+    TFileDescriptor FD = INVALID_SOCKET;
+    EPollControl Control = EPollControl::None;
+};
+
+//! Data received into a provided buffer but not yet taken by the pollable.
+struct TReceivedChunk
+{
+    int BufferId;
+    i64 Offset = 0;
+    i64 Size;
+};
+
+struct TUringPollableCookie
+    : public TPollableCookie
+{
+    using TPollableCookie::TPollableCookie;
+
+    static TUringPollableCookie* FromPollable(IPollable* pollable)
+    {
+        return static_cast<TUringPollableCookie*>(TPollableCookie::FromPollable(pollable));
+    }
+
+    //! Toggled by #IPoller::Arm and #IPoller::Unarm in the calling thread, so no events are delivered
+    //! once #IPoller::Unarm returns even though the ring requests are cancelled by the polling thread later.
+    std::atomic<bool> EventsEnabled = false;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, ReceiveLock);
+    TRingQueue<TReceivedChunk> ReceivedChunks;
+    bool ReceivedEof = false;
+    int ReceiveError = 0;
+
+    // The fields below are only accessed from the polling thread.
+    TFileDescriptor FD = INVALID_SOCKET;
+    EPollControl Control = EPollControl::None;
+    bool Armed = false;
+    //! Readability is served by a multishot receive request rather than by a poll request.
+    bool Receiving = false;
+    //! The receive request was terminated since provided buffers have run out;
+    //! it is resubmitted once some buffers are released.
+    bool ReceiveStarved = false;
+    bool Unregistered = false;
+    //! Number of requests that have not posted their final completion yet.
+    //! The pollable is kept in the poller until all of its requests are completed
+    //! since their completions refer to it.
+    int ActivePollCount = 0;
+    int ActiveReceiveCount = 0;
+    int ActiveCancelCount = 0;
+};
+
+unsigned ToPollMask(EPollControl control)
+{
+    unsigned mask = 0;
+    if (Any(control & EPollControl::Read)) {
+        mask |= POLLIN;
+    }
+    if (Any(control & EPollControl::Write)) {
+        mask |= POLLOUT;
+    }
+    if (Any(control & EPollControl::ReadHup)) {
+        mask |= POLLRDHUP;
+    }
+    return mask;
+}
+
+EPollControl FromPollMask(unsigned mask)
+{
+    // Errors are reported as all events, just like the epoll-based poller does.
+    if (mask & (POLLERR | POLLHUP)) {
+        return EPollControl::Read | EPollControl::Write | EPollControl::ReadHup;
+    }
+
+    auto control = EPollControl::None;
+    if (mask & POLLIN) {
+        control |= EPollControl::Read;
+    }
+    if (mask & POLLOUT) {
+        control |= EPollControl::Write;
+    }
+    if (mask & POLLRDHUP) {
+        control |= EPollControl::ReadHup;
+    }
+    return control;
+}
+
+template <class F, class... Args>
+auto HandleUringEintr(F f, Args&&... args) -> decltype(f(args...))
+{
+    while (true) {
+        auto result = f(std::forward<Args>(args)...);
+        if (result != -EINTR) {
+            return result;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TUring
+    : private TNonCopyable
+{
+public:
+    TUring()
+    {
+        io_uring_params params{};
+        auto result = HandleUringEintr(io_uring_queue_init_params, UringQueueSize, &Uring_, &params);
+        if (result < 0) {
+            THROW_ERROR_EXCEPTION("Failed to initialize uring")
+                << TError::FromSystem(-result);
+        }
+
+        // Multishot poll requests first appeared in the same kernel release as resource tags.
+        constexpr auto RequiredFeatures = IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG | IORING_FEAT_RSRC_TAGS;
+        if ((params.features & RequiredFeatures) != RequiredFeatures) {
+            io_uring_queue_exit(&Uring_);
+            THROW_ERROR_EXCEPTION("Uring does not support multishot poll requests")
+                << TErrorAttribute("features", params.features);
+        }
+
+        result = io_uring_ring_dontfork(&Uring_);
+        if (result < 0) {
+            io_uring_queue_exit(&Uring_);
+            THROW_ERROR_EXCEPTION("Failed to set up uring")
+                << TError::FromSystem(-result);
+        }
+    }
+
+    ~TUring()
+    {
+        io_uring_queue_exit(&Uring_);
+    }
+
+    io_uring_sqe* GetSqe()
+    {
+        while (true) {
+            if (auto* sqe = io_uring_get_sqe(&Uring_)) {
+                return sqe;
+            }
+            // Submission queue is full, flush it.
+            Submit();
+        }
+    }
+
+    void Submit()
+    {
+        auto result = HandleUringEintr(io_uring_submit, &Uring_);
+        YT_LOG_FATAL_IF(result < 0, TError::FromSystem(-result), "Uring submit failed");
+    }
+
+    //! Submits pending requests and waits for at least one completion or until #timeout expires.
+    void SubmitAndWait(TDuration timeout)
+    {
+        __kernel_timespec timespec{
+            .tv_sec = static_cast<i64>(timeout.Seconds()),
+            .tv_nsec = static_cast<i64>(timeout.NanoSecondsOfSecond()),
+        };
+        io_uring_cqe* cqe;
+        auto result = io_uring_submit_and_wait_timeout(&Uring_, &cqe, 1, &timespec, /*sigmask*/ nullptr);
+        YT_LOG_FATAL_IF(result < 0 && result != -ETIME && result != -EINTR, TError::FromSystem(-result), "Uring wait failed");
+    }
+
+    template <class F>
+    void ForEachCqe(F&& func)
+    {
+        unsigned head;
+        unsigned count = 0;
+        io_uring_cqe* cqe;
+        io_uring_for_each_cqe(&Uring_, head, cqe) {
+            func(cqe);
+            ++count;
+        }
+        io_uring_cq_advance(&Uring_, count);
+    }
+
+    //! Returns a negative error code on failure.
+    int RegisterBufferRing(io_uring_buf_ring* ring, int entryCount, int groupId)
+    {
+        io_uring_buf_reg registration{};
+        registration.ring_addr = reinterpret_cast<ui64>(ring);
+        registration.ring_entries = entryCount;
+        registration.bgid = groupId;
+        return io_uring_register_buf_ring(&Uring_, &registration, /*flags*/ 0);
+    }
+
+private:
+    io_uring Uring_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Buffers provided to the kernel for receive requests with IOSQE_BUFFER_SELECT.
+/*!
+ *  Must outlive the uring they are registered with.
+ */
+class TReceiveBuffers
+    : private TNonCopyable
+{
+public:
+    TReceiveBuffers(int bufferCount, i64 bufferSize)
+        : BufferCount_(bufferCount)
+        , BufferSize_(bufferSize)
+        , Ring_(TSharedMutableRef::AllocatePageAligned<TUringReceiveBufferTag>(
+            AlignUp<size_t>(bufferCount * sizeof(io_uring_buf), GetPageSize())))
+        , Buffers_(TSharedMutableRef::AllocatePageAligned<TUringReceiveBufferTag>(
+            AlignUp<size_t>(bufferCount * bufferSize, GetPageSize()),
+            {.InitializeStorage = false}))
+    {
+        io_uring_buf_ring_init(GetRing());
+    }
+
+    //! Registers the buffers with #uring and provides all of them to the kernel.
+    //! Returns a negative error code on failure.
+    int Register(TUring* uring, int groupId)
+    {
+        auto result = uring->RegisterBufferRing(GetRing(), BufferCount_, groupId);
+        if (result < 0) {
+            return result;
+        }
+
+        for (int bufferId = 0; bufferId < BufferCount_; ++bufferId) {
+            Add(bufferId);
+        }
+        Commit();
+
+        return 0;
+    }
+
+    TMutableRef GetBuffer(int bufferId) const
+    {
+        return TMutableRef(Buffers_.Begin() + bufferId * BufferSize_, BufferSize_);
+    }
+
+    //! Provides the buffer to the kernel again; takes effect upon #Commit.
+    void Add(int bufferId)
+    {
+        auto buffer = GetBuffer(bufferId);
+        io_uring_buf_ring_add(
+            GetRing(),
+            buffer.Begin(),
+            buffer.Size(),
+            bufferId,
+            io_uring_buf_ring_mask(BufferCount_),
+            PendingCount_++);
+    }
+
+    //! Returns |true| if any buffers were added since the last call.
+    bool Commit()
+    {
+        if (PendingCount_ == 0) {
+            return false;
+        }
+
+        io_uring_buf_ring_advance(GetRing(), PendingCount_);
+        PendingCount_ = 0;
+        return true;
+    }
+
+private:
+    const int BufferCount_;
+    const i64 BufferSize_;
+
+    const TSharedMutableRef Ring_;
+    const TSharedMutableRef Buffers_;
+
+    int PendingCount_ = 0;
+
+    io_uring_buf_ring* GetRing() const
+    {
+        return reinterpret_cast<io_uring_buf_ring*>(Ring_.Begin());
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Checks that the kernel supports multishot receive requests with provided buffers.
+bool ProbeMultishotReceive()
+{
+    // NB: Buffers must outlive the uring.
+    TReceiveBuffers buffers(/*bufferCount*/ 1, GetPageSize());
+    TUring uring;
+
+    if (buffers.Register(&uring, ReceiveBufferGroupId) < 0) {
+        return false;
+    }
+
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) != 0) {
+        return false;
+    }
+    auto fdsGuard = Finally([&] {
+        ::close(fds[0]);
+        ::close(fds[1]);
+    });
+
+    char data = 0;
+    if (HandleEintr(::write, fds[1], &data, sizeof(data)) != sizeof(data)) {
+        return false;
+    }
+
+    auto* sqe = uring.GetSqe();
+    io_uring_prep_recv_multishot(sqe, fds[0], nullptr, 0, 0);
+    sqe->flags |= IOSQE_BUFFER_SELECT;
+    sqe->buf_group = ReceiveBufferGroupId;
+
+    uring.SubmitAndWait(TDuration::Seconds(1));
+
+    bool supported = false;
+    uring.ForEachCqe([&] (const io_uring_cqe* cqe) {
+        supported =
+            cqe->res == sizeof(data) &&
+            (cqe->flags & IORING_CQE_F_BUFFER) &&
+            (cqe->flags & IORING_CQE_F_MORE);
+    });
+    return supported;
+}
+
+bool IsUringReceiveSupported()
+{
+    static const bool supported = [] {
+        try {
+            return ProbeMultishotReceive();
+        } catch (const std::exception& ex) {
+            YT_LOG_INFO(ex, "Uring multishot receive is not supported");
+            return false;
+        }
+    }();
+    return supported;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TUringPoller
+    : public TThreadPoolPollerBase
+    , public IReceivingPoller
+    , public TThread
+{
+public:
+    TUringPoller(int threadCount, const TString& threadNamePrefix, const TDuration pollingPeriod)
+        : TThreadPoolPollerBase(threadCount, threadNamePrefix, pollingPeriod)
+        , TThread(Format("%v:%v", threadNamePrefix, "Poll"))
+    {
+        if (IsUringReceiveSupported()) {
+            ReceiveBuffers_.emplace(ReceiveBufferCount, ReceiveBufferSize);
+            auto result = ReceiveBuffers_->Register(&Uring_, ReceiveBufferGroupId);
+            if (result < 0) {
+                YT_LOG_WARNING(TError::FromSystem(-result), "Failed to register uring receive buffers");
+                ReceiveBuffers_.reset();
+            }
+        }
+    }
+
+    bool TryRegister(const IPollablePtr& pollable) override
+    {
+        if (IsStopping()) {
+            return false;
+        }
+
+        pollable->SetCookie(New<TUringPollableCookie>(this));
+        EnqueueRequest({
+            .Type = EPollerRequestType::Register,
+            .Pollable = pollable,
+        });
+
+        YT_LOG_DEBUG("Pollable registered (%v)",
+            pollable->GetLoggingTag());
+
+        return true;
+    }
+
+    void Arm(TFileDescriptor fd, const IPollablePtr& pollable, EPollControl control) override
+    {
+        YT_LOG_TRACE("Arming poller (FD: %v, Control: %v, %v)",
+            fd,
+            control,
+            pollable->GetLoggingTag());
+        EnqueueRequest({
+            .Type = EPollerRequestType::Arm,
+            .Pollable = pollable,
+            .FD = fd,
+            .Control = control,
+        });
+    }
+
+    void Unarm(TFileDescriptor fd, const IPollablePtr& pollable) override
+    {
+        YT_LOG_TRACE("Unarming poller (FD: %v)",
+            fd);
+        EnqueueRequest({
+            .Type = EPollerRequestType::Unarm,
+            .Pollable = pollable,
+            .FD = fd,
+        });
+    }
+
+    ssize_t Receive(TFileDescriptor fd, const IPollablePtr& pollable, TMutableRef buffer) override
+    {
+        if (!ReceiveBuffers_) {
+            return HandleEintr(::recv, fd, buffer.Begin(), buffer.Size(), 0);
+        }
+
+        auto* cookie = TUringPollableCookie::FromPollable(pollable.Get());
+
+        size_t bytesReceived = 0;
+        bool eof;
+        int error;
+        TCompactVector<int, 8> releasedBufferIds;
+        {
+            auto guard = Guard(cookie->ReceiveLock);
+
+            auto& chunks = cookie->ReceivedChunks;
+            while (bytesReceived < buffer.Size() && !chunks.empty()) {
+                auto& chunk = chunks.front();
+                auto bytesToCopy = std::min<size_t>(chunk.Size - chunk.Offset, buffer.Size() - bytesReceived);
+                ::memcpy(
+                    buffer.Begin() + bytesReceived,
+                    ReceiveBuffers_->GetBuffer(chunk.BufferId).Begin() + chunk.Offset,
+                    bytesToCopy);
+                bytesReceived += bytesToCopy;
+                chunk.Offset += bytesToCopy;
+                if (chunk.Offset == chunk.Size) {
+                    releasedBufferIds.push_back(chunk.BufferId);
+                    chunks.pop();
+                }
+            }
+
+            eof = cookie->ReceivedEof;
+            error = cookie->ReceiveError;
+        }
+
+        for (auto bufferId : releasedBufferIds) {
+            FreedReceiveBufferIds_.Enqueue(bufferId);
+        }
+        if (!releasedBufferIds.empty() && ReceiveStarved_.load()) {
+            RaiseWakeup();
+        }
+
+        if (bytesReceived > 0) {
+            return bytesReceived;
+        }
+        if (error != 0) {
+            errno = error;
+            return -1;
+        }
+        if (eof) {
+            return 0;
+        }
+        errno = EAGAIN;
+        return -1;
+    }
+
+    void Shutdown() override
+    {
+        TThread::Stop();
+    }
+
+private:
+    // NB: Must be destroyed after the uring.
+    std::optional<TReceiveBuffers> ReceiveBuffers_;
+
+    TUring Uring_;
+
+    TNotificationHandle WakeupHandle_;
+    std::atomic<bool> WakeupRaised_ = false;
+
+    // Requests must be handled in order, e.g. a dialer unarms a socket that is then armed by a connection.
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, RequestsLock_);
+    std::vector<TPollerRequest> Requests_;
+
+    //! Buffers released by pollables that are to be provided to the kernel again.
+    TMpscStack<int> FreedReceiveBufferIds_;
+    //! Set when some receive requests wait for buffers to be released.
+    std::atomic<bool> ReceiveStarved_ = false;
+
+    // The fields below are only accessed from the polling thread.
+    std::vector<TPollerRequest> RequestsToHandle_;
+    THashSet<IPollablePtr> Pollables_;
+    std::vector<IPollablePtr> StarvedPollables_;
+
+    void OnPollableUnregistered(IPollable* pollable) override
+    {
+        EnqueueRequest({
+            .Type = EPollerRequestType::Unregister,
+            .Pollable = pollable,
+        });
+    }
+
+    void EnqueueRequest(TPollerRequest request)
+    {
+        {
+            auto guard = Guard(RequestsLock_);
+
+            // Event delivery is toggled in the order requests are handled.
+            auto* cookie = TUringPollableCookie::FromPollable(request.Pollable.Get());
+            switch (request.Type) {
+                case EPollerRequestType::Arm:
+                    cookie->EventsEnabled.store(true);
+                    break;
+                case EPollerRequestType::Unarm:
+                    cookie->EventsEnabled.store(false);
+                    break;
+                default:
+                    break;
+            }
+
+            Requests_.push_back(std::move(request));
+        }
+
+        RaiseWakeup();
+    }
+
+    void RaiseWakeup()
+    {
+        // Coalesce wakeups until the polling thread picks up the requests.
+        if (!WakeupRaised_.exchange(true)) {
+            WakeupHandle_.Raise();
+        }
+    }
+
+    void SubmitPoll(IPollable* pollable)
+    {
+        auto* cookie = TUringPollableCookie::FromPollable(pollable);
+
+        auto mask = ToPollMask(cookie->Control);
+        if (cookie->Receiving) {
+            // Readability is reported by the receive request.
+            mask &= ~POLLIN;
+            if (mask == 0) {
+                return;
+            }
+        }
+
+        auto* sqe = Uring_.GetSqe();
+        if (Any(cookie->Control & EPollControl::EdgeTriggered)) {
+            io_uring_prep_poll_multishot(sqe, cookie->FD, mask);
+        } else {
+            io_uring_prep_poll_add(sqe, cookie->FD, mask);
+        }
+        io_uring_sqe_set_data64(sqe, MakeUserData(pollable, EUringOperation::Poll));
+
+        ++cookie->ActivePollCount;
+    }
+
+    void SubmitReceive(IPollable* pollable)
+    {
+        auto* cookie = TUringPollableCookie::FromPollable(pollable);
+
+        auto* sqe = Uring_.GetSqe();
+        io_uring_prep_recv_multishot(sqe, cookie->FD, nullptr, 0, 0);
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = ReceiveBufferGroupId;
+        io_uring_sqe_set_data64(sqe, MakeUserData(pollable, EUringOperation::Receive));
+
+        ++cookie->ActiveReceiveCount;
+    }
+
+    void CancelRequests(IPollable* pollable)
+    {
+        auto* cookie = TUringPollableCookie::FromPollable(pollable);
+
+        if (cookie->ActivePollCount > 0) {
+            auto* sqe = Uring_.GetSqe();
+            io_uring_prep_poll_remove(sqe, MakeUserData(pollable, EUringOperation::Poll));
+            io_uring_sqe_set_data64(sqe, MakeUserData(pollable, EUringOperation::Cancel));
+            ++cookie->ActiveCancelCount;
+        }
+
+        if (cookie->ActiveReceiveCount > 0) {
+            auto* sqe = Uring_.GetSqe();
+            io_uring_prep_cancel64(sqe, MakeUserData(pollable, EUringOperation::Receive), /*flags*/ 0);
+            io_uring_sqe_set_data64(sqe, MakeUserData(pollable, EUringOperation::Cancel));
+            ++cookie->ActiveCancelCount;
+        }
+
+        cookie->ReceiveStarved = false;
+    }
+
+    void SubmitWakeupPoll()
+    {
+        auto* sqe = Uring_.GetSqe();
+        io_uring_prep_poll_multishot(sqe, WakeupHandle_.GetFD(), POLLIN);
+        io_uring_sqe_set_data64(sqe, MakeUserData(nullptr, EUringOperation::Wakeup));
+    }
+
+    void MaybeErasePollable(IPollable* pollable)
+    {
+        auto* cookie = TUringPollableCookie::FromPollable(pollable);
+        if (!cookie->Unregistered ||
+            cookie->ActivePollCount > 0 ||
+            cookie->ActiveReceiveCount > 0 ||
+            cookie->ActiveCancelCount > 0)
+        {
+            return;
+        }
+
+        // Data that has not been taken by the pollable is not needed anymore.
+        if (ReceiveBuffers_) {
+            auto guard = Guard(cookie->ReceiveLock);
+            auto& chunks = cookie->ReceivedChunks;
+            while (!chunks.empty()) {
+                ReceiveBuffers_->Add(chunks.front().BufferId);
+                chunks.pop();
+            }
+        }
+
+        EraseOrCrash(Pollables_, IPollablePtr(pollable));
+    }
+
+    //! Provides released buffers to the kernel and resubmits receive requests waiting for them.
+    void ReplenishReceiveBuffers()
+    {
+        if (!ReceiveBuffers_) {
+            return;
+        }
+
+        FreedReceiveBufferIds_.DequeueAll(false, [&] (int bufferId) {
+            ReceiveBuffers_->Add(bufferId);
+        });
+
+        if (!ReceiveBuffers_->Commit() || StarvedPollables_.empty()) {
+            return;
+        }
+
+        ReceiveStarved_.store(false);
+
+        for (const auto& pollable : StarvedPollables_) {
+            auto* cookie = TUringPollableCookie::FromPollable(pollable.Get());
+            if (cookie->ReceiveStarved && cookie->ActiveReceiveCount == 0) {
+                YT_VERIFY(cookie->Armed && cookie->Receiving && !cookie->Unregistered);
+                cookie->ReceiveStarved = false;
+                SubmitReceive(pollable.Get());
+            }
+        }
+
+        StarvedPollables_.clear();
+    }
+
+    void HandleRequest(const TPollerRequest& request)
+    {
+        auto* pollable = request.Pollable.Get();
+        auto* cookie = TUringPollableCookie::FromPollable(pollable);
+
+        switch (request.Type) {
+            case EPollerRequestType::Register:
+                InsertOrCrash(Pollables_, request.Pollable);
+                break;
+
+            case EPollerRequestType::Arm: {
+                if (cookie->Unregistered) {
+                    break;
+                }
+                // When backlog is empty, edge-triggered does not need restart.
+                if (cookie->Armed &&
+                    cookie->FD == request.FD &&
+                    Any(request.Control & EPollControl::EdgeTriggered) &&
+                    Any(request.Control & EPollControl::BacklogEmpty))
+                {
+                    break;
+                }
+                if (cookie->Armed) {
+                    CancelRequests(pollable);
+                }
+                cookie->FD = request.FD;
+                cookie->Control = request.Control;
+                cookie->Receiving =
+                    ReceiveBuffers_ &&
+                    Any(request.Control & EPollControl::Receive) &&
+                    Any(request.Control & EPollControl::Read) &&
+                    Any(request.Control & EPollControl::EdgeTriggered);
+                cookie->Armed = true;
+                SubmitPoll(pollable);
+                if (cookie->Receiving) {
+                    SubmitReceive(pollable);
+                }
+                break;
+            }
+
+            case EPollerRequestType::Unarm:
+                if (cookie->Armed) {
+                    CancelRequests(pollable);
+                    cookie->Armed = false;
+                }
+                break;
+
+            case EPollerRequestType::Unregister:
+                if (cookie->Unregistered) {
+                    break;
+                }
+                cookie->Unregistered = true;
+                if (cookie->Armed) {
+                    CancelRequests(pollable);
+                    cookie->Armed = false;
+                }
+                MaybeErasePollable(pollable);
+                break;
+
+            default:
+                YT_ABORT();
+        }
+    }
+
+    void HandlePollCompletion(IPollable* pollable, const io_uring_cqe* cqe)
+    {
+        auto* cookie = TUringPollableCookie::FromPollable(pollable);
+
+        if (cqe->res > 0) {
+            // Can safely dereference pollable because it is kept in Pollables_ until all of its requests are completed.
+            if (cookie->EventsEnabled.load()) {
+                ScheduleEvent(pollable, FromPollMask(cqe->res));
+            }
+        } else if (cqe->res < 0 && cqe->res != -ECANCELED) {
+            YT_LOG_DEBUG(TError::FromSystem(-cqe->res), "Poll request failed (FD: %v, %v)",
+                cookie->FD,
+                pollable->GetLoggingTag());
+        }
+
+        if (cqe->flags & IORING_CQE_F_MORE) {
+            return;
+        }
+
+        --cookie->ActivePollCount;
+
+        // Another request is active if the pollable has been rearmed meanwhile.
+        if (cookie->Armed && cookie->ActivePollCount == 0) {
+            if (Any(cookie->Control & EPollControl::EdgeTriggered) && cqe->res >= 0) {
+                // Multishot request may be terminated by the kernel, e.g. on completion queue overflow.
+                SubmitPoll(pollable);
+            } else if (!cookie->Receiving) {
+                cookie->Armed = false;
+            }
+        }
+
+        MaybeErasePollable(pollable);
+    }
+
+    void HandleReceiveCompletion(IPollable* pollable, const io_uring_cqe* cqe)
+    {
+        auto* cookie = TUringPollableCookie::FromPollable(pollable);
+        auto result = cqe->res;
+
+        if (cqe->flags & IORING_CQE_F_BUFFER) {
+            int bufferId = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+            if (result > 0 && !cookie->Unregistered) {
+                auto guard = Guard(cookie->ReceiveLock);
+                cookie->ReceivedChunks.push({
+                    .BufferId = bufferId,
+                    .Size = result,
+                });
+            } else {
+                ReceiveBuffers_->Add(bufferId);
+            }
+        }
+
+        bool notify = false;
+        if (result > 0) {
+            notify = true;
+        } else if (result == 0) {
+            auto guard = Guard(cookie->ReceiveLock);
+            cookie->ReceivedEof = true;
+            notify = true;
+        } else if (result == -ENOBUFS) {
+            if (cookie->Armed && cookie->Receiving && !cookie->Unregistered && !cookie->ReceiveStarved) {
+                YT_LOG_TRACE("Uring receive buffers are exhausted (FD: %v, %v)",
+                    cookie->FD,
+                    pollable->GetLoggingTag());
+                cookie->ReceiveStarved = true;
+                StarvedPollables_.push_back(pollable);
+                ReceiveStarved_.store(true);
+            }
+        } else if (result != -ECANCELED) {
+            YT_LOG_DEBUG(TError::FromSystem(-result), "Receive request failed (FD: %v, %v)",
+                cookie->FD,
+                pollable->GetLoggingTag());
+            auto guard = Guard(cookie->ReceiveLock);
+            cookie->ReceiveError = -result;
+            notify = true;
+        }
+
+        if (notify && cookie->EventsEnabled.load()) {
+            ScheduleEvent(pollable, EPollControl::Read);
+        }
+
+        if (cqe->flags & IORING_CQE_F_MORE) {
+            return;
+        }
+
+        --cookie->ActiveReceiveCount;
+
+        // Multishot request may be terminated by the kernel, e.g. on completion queue overflow.
+        if (cookie->Armed && cookie->Receiving && cookie->ActiveReceiveCount == 0 && result > 0) {
+            SubmitReceive(pollable);
+        }
+
+        MaybeErasePollable(pollable);
+    }
+
+    void HandleCompletion(const io_uring_cqe* cqe)
+    {
+        auto [pollable, operation] = ParseUserData(io_uring_cqe_get_data64(cqe));
+        switch (operation) {
+            case EUringOperation::Poll:
+                HandlePollCompletion(pollable, cqe);
+                break;
+
+            case EUringOperation::Receive:
+                HandleReceiveCompletion(pollable, cqe);
+                break;
+
+            case EUringOperation::Cancel: {
+                auto* cookie = TUringPollableCookie::FromPollable(pollable);
+                --cookie->ActiveCancelCount;
+                MaybeErasePollable(pollable);
+                break;
+            }
+
+            case EUringOperation::Wakeup:
+                WakeupHandle_.Clear();
+                if (!(cqe->flags & IORING_CQE_F_MORE)) {
+                    SubmitWakeupPoll();
+                }
+                break;
+
+            default:
+                YT_ABORT();
+        }
+    }
+
+    void ThreadMain() override
+    {
+        // Hold this strongly.
+        auto this_ = MakeStrong(this);
+
+        try {
+            YT_LOG_DEBUG("Thread started (Name: %v)",
+                GetThreadName());
+
+            SubmitWakeupPoll();
+
+            while (!IsStopping()) {
+                // Reset the flag before taking requests so that requests enqueued afterwards raise a new wakeup.
+                WakeupRaised_.store(false);
+                {
+                    auto guard = Guard(RequestsLock_);
+                    std::swap(Requests_, RequestsToHandle_);
+                }
+                for (const auto& request : RequestsToHandle_) {
+                    HandleRequest(request);
+                }
+                RequestsToHandle_.clear();
+
+                ReplenishReceiveBuffers();
+
+                Uring_.SubmitAndWait(PollerThreadQuantum);
+
+                Uring_.ForEachCqe([&] (const io_uring_cqe* cqe) {
+                    HandleCompletion(cqe);
+                });
+
+                FlushEvents();
+            }
+
+            YT_LOG_DEBUG("Thread stopped (Name: %v)",
+                GetThreadName());
+        } catch (const std::exception& ex) {
+            YT_LOG_FATAL(ex, "Unhandled exception in executor thread (Name: %v)",
+                GetThreadName());
+        }
+
+        // Shutdown here.
+        for (const auto& pollable : Pollables_) {
+            DoUnregister(pollable);
+        }
+    }
+
+    void StopPrologue() override
+    {
+        WakeupHandle_.Raise();
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool IsUringPollerSupported()
+{
+    static const bool supported = [] {
+        try {
+            TUring uring;
+            return true;
+        } catch (const std::exception& ex) {
+            YT_LOG_INFO(ex, "Uring poller is not supported");
+            return false;
+        }
+    }();
+    return supported;
+}
+
+IThreadPoolPollerPtr CreateUringThreadPoolPoller(
+    int threadCount,
+    const TString& threadNamePrefix,
+    const TDuration pollingPeriod)
+{
+    auto poller = New<TUringPoller>(threadCount, threadNamePrefix, pollingPeriod);
+    poller->Start();
+    return poller;
+}
+
+#else
+
+bool IsUringPollerSupported()
+{
+    return false;
+}
+
+IThreadPoolPollerPtr CreateUringThreadPoolPoller(
+    int /*threadCount*/,
+    const TString& /*threadNamePrefix*/,
+    const TDuration /*pollingPeriod*/)
+{
+    THROW_ERROR_EXCEPTION("Uring poller is not supported on this platform");
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NConcurrency
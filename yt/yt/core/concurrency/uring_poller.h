@@ -0,0 +1,39 @@
+#pragma once
+
+#include "thread_pool_poller.h"
+
+namespace NYT::NConcurrency {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Returns |true| if io_uring is available, i.e. the platform is Linux,
+//! the kernel supports the required operations, and their use is not prohibited (e.g. by seccomp).
+bool IsUringPollerSupported();
+
+//! Creates a poller whose polling thread waits for FD readiness via io_uring
+//! instead of epoll.
+/*!
+ *  Edge-triggered arms are backed by multishot poll requests, so a pollable
+ *  is armed once and keeps receiving events without being re-armed.
+ *  Arms and unarms issued from arbitrary threads are batched and submitted by the polling thread
+ *  together with waiting for completions, i.e. in a single syscall per polling iteration.
+ *
+ *  Pollables armed with #EPollControl::Receive (together with edge-triggered #EPollControl::Read)
+ *  are read by multishot receive requests into buffers registered with the ring;
+ *  the data is then taken via #IReceivingPoller::Receive without extra syscalls.
+ *
+ *  Unarming is synchronous with respect to events: none are scheduled once #IPoller::Unarm returns,
+ *  although the ring requests themselves are cancelled by the polling thread later.
+ *
+ *  Event handling (thread pools, priorities, #IPoller::Retry) is identical to #CreateThreadPoolPoller.
+ *
+ *  Throws if io_uring cannot be initialized.
+ */
+IThreadPoolPollerPtr CreateUringThreadPoolPoller(
+    int threadCount,
+    const TString& threadNamePrefix,
+    const TDuration pollingPeriod = TDuration::MilliSeconds(10));
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NConcurrency
@@ -18,6 +18,7 @@ struct TConcurrentCache<T>::TLookupTable final
 
     const size_t Capacity;
     std::atomic<size_t> Size = 0;
+    std::atomic<i64> Weight = 0;
     TAtomicPtr<TLookupTable> Next;
 
     explicit TLookupTable(size_t capacity)
@@ -25,15 +26,21 @@ struct TConcurrentCache<T>::TLookupTable final
         , Capacity(capacity)
     { }
 
-    bool Insert(TValuePtr item)
+    bool Insert(TValuePtr item, i64 weight = 0)
     {
         auto fingerprint = THash<T>()(item.Get());
         if (THashTable::Insert(fingerprint, std::move(item))) {
             ++Size;
+            Weight += weight;
             return true;
         }
         return false;
     }
+
+    bool IsFull(size_t capacity, i64 weightLimit) const
+    {
+        return Size >= std::min(capacity, Capacity) || Weight >= weightLimit;
+    }
 };
 
 template <class T>
@@ -50,8 +57,9 @@ TConcurrentCache<T>::RenewTable(const TIntrusivePtr<TLookupTable>& head, size_t
 
     if (Head_.SwapIfCompare(head, newHead)) {
         static const auto& Logger = LockFreePtrLogger;
-        YT_LOG_DEBUG("Concurrent cache lookup table rotated (LoadFactor: %v)",
-            head->Size.load());
+        YT_LOG_DEBUG("Concurrent cache lookup table rotated (LoadFactor: %v, Weight: %v)",
+            head->Size.load(),
+            head->Weight.load());
 
         // Head_ swapped, remove third lookup table.
         head->Next.Reset();
@@ -181,7 +189,8 @@ template <class T>
 typename TConcurrentCache<T>::TLookupTable* TConcurrentCache<T>::TInserter::GetTable()
 {
     auto targetCapacity = Parent_->Capacity_.load(std::memory_order::acquire);
-    if (Primary_->Size >= std::min(targetCapacity, Primary_->Capacity)) {
+    auto weightLimit = Parent_->WeightLimit_.load(std::memory_order::acquire);
+    if (Primary_->IsFull(targetCapacity, weightLimit)) {
         Primary_ = Parent_->RenewTable(Primary_, targetCapacity);
     }
 
@@ -202,7 +211,20 @@ void TConcurrentCache<T>::SetCapacity(size_t capacity)
     Capacity_.store(capacity, std::memory_order::release);
 
     auto primary = Head_.Acquire();
-    if (primary->Size >= std::min(capacity, primary->Capacity)) {
+    if (primary->IsFull(capacity, WeightLimit_.load(std::memory_order::acquire))) {
+        RenewTable(primary, capacity);
+    }
+}
+
+template <class T>
+void TConcurrentCache<T>::SetWeightLimit(i64 weightLimit)
+{
+    YT_VERIFY(weightLimit > 0);
+    WeightLimit_.store(weightLimit, std::memory_order::release);
+
+    auto primary = Head_.Acquire();
+    auto capacity = Capacity_.load(std::memory_order::acquire);
+    if (primary->IsFull(capacity, weightLimit)) {
         RenewTable(primary, capacity);
     }
 }
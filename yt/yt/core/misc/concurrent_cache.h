@@ -91,8 +91,14 @@ public:
 
     void SetCapacity(size_t capacity);
 
+    //! Lookup table is also rotated once the total weight of items inserted into it
+    //! (as passed to TLookupTable::Insert) reaches #weightLimit.
+    //! Since two tables are alive at a time, the cache holds up to twice this weight.
+    void SetWeightLimit(i64 weightLimit);
+
 private:
     std::atomic<size_t> Capacity_;
+    std::atomic<i64> WeightLimit_ = std::numeric_limits<i64>::max();
     TAtomicPtr<TLookupTable> Head_;
 
 };
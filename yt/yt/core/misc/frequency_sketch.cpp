@@ -0,0 +1,92 @@
+#include "frequency_sketch.h"
+
+#include <library/cpp/yt/farmhash/farm_hash.h>
+
+#include <util/generic/bitops.h>
+
+namespace NYT {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr ui64 RowSeeds[TFrequencySketch::Depth] = {
+    0xc3a5c85c97cb3127ULL,
+    0xb492b66fbe98f273ULL,
+    0x9ae16a3b2f90404fULL,
+    0xcbf29ce484222325ULL,
+};
+
+// Every 4-bit counter with its lowest bit cleared.
+constexpr ui64 HalvingMask = 0x7777777777777777ULL;
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TFrequencySketch::TFrequencySketch(i64 capacity)
+    : Capacity_(std::max<i64>(capacity, 1))
+    , RowWordCount_(FastClp2(static_cast<ui64>(std::max<i64>(Capacity_ / CountersPerWord, 1))))
+    , SampleSize_(10 * Capacity_)
+    , Words_(new std::atomic<ui64>[Depth * RowWordCount_])
+{
+    for (i64 index = 0; index < Depth * RowWordCount_; ++index) {
+        Words_[index].store(0, std::memory_order::relaxed);
+    }
+}
+
+i64 TFrequencySketch::GetCapacity() const
+{
+    return Capacity_;
+}
+
+std::atomic<ui64>* TFrequencySketch::GetWord(int row, ui64 fingerprint, int* shift) const
+{
+    auto hash = FarmFingerprint(fingerprint, RowSeeds[row]);
+    auto counterIndex = hash & (RowWordCount_ * CountersPerWord - 1);
+    *shift = (counterIndex % CountersPerWord) * 4;
+    return &Words_[row * RowWordCount_ + counterIndex / CountersPerWord];
+}
+
+void TFrequencySketch::Increment(ui64 fingerprint)
+{
+    for (int row = 0; row < Depth; ++row) {
+        int shift;
+        auto* word = GetWord(row, fingerprint, &shift);
+        auto value = word->load(std::memory_order::relaxed);
+        while (((value >> shift) & 0xf) < MaxFrequency &&
+            !word->compare_exchange_weak(value, value + (1ULL << shift), std::memory_order::relaxed))
+        { }
+    }
+
+    if (EventCount_.fetch_add(1, std::memory_order::relaxed) + 1 == SampleSize_) {
+        Age();
+    }
+}
+
+int TFrequencySketch::Estimate(ui64 fingerprint) const
+{
+    int result = MaxFrequency;
+    for (int row = 0; row < Depth; ++row) {
+        int shift;
+        auto* word = GetWord(row, fingerprint, &shift);
+        result = std::min<int>(result, (word->load(std::memory_order::relaxed) >> shift) & 0xf);
+    }
+    return result;
+}
+
+void TFrequencySketch::Age()
+{
+    // Concurrent increments may be partially lost; this is fine for an estimate.
+    for (i64 index = 0; index < Depth * RowWordCount_; ++index) {
+        auto value = Words_[index].load(std::memory_order::relaxed);
+        while (!Words_[index].compare_exchange_weak(value, (value >> 1) & HalvingMask, std::memory_order::relaxed))
+        { }
+    }
+
+    EventCount_.fetch_sub(SampleSize_ / 2, std::memory_order::relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT
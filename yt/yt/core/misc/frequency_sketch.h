@@ -0,0 +1,63 @@
+#pragma once
+
+#include "public.h"
+
+#include <library/cpp/yt/memory/ref_counted.h>
+
+#include <atomic>
+#include <memory>
+
+namespace NYT {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Approximate frequency counter for a stream of fingerprints (count-min sketch).
+/*!
+ *  Keeps #Depth rows of saturating 4-bit counters. Once the number of recorded
+ *  events reaches the sample size (ten times the capacity), all counters are halved
+ *  so that the estimates reflect recent history (TinyLFU aging).
+ *
+ *  Estimates never underestimate the number of occurrences since the last aging
+ *  (modulo saturation at #MaxFrequency) and may overestimate due to collisions.
+ *
+ *  \note
+ *  Thread affinity: any
+ */
+class TFrequencySketch final
+    : public TRefCounted
+{
+public:
+    static constexpr int Depth = 4;
+    static constexpr int MaxFrequency = 15;
+
+    //! #capacity is the expected number of distinct hot items.
+    explicit TFrequencySketch(i64 capacity);
+
+    i64 GetCapacity() const;
+
+    //! Records an occurrence of #fingerprint.
+    void Increment(ui64 fingerprint);
+
+    //! Returns the estimated number of recent occurrences of #fingerprint.
+    int Estimate(ui64 fingerprint) const;
+
+private:
+    static constexpr int CountersPerWord = 16;
+
+    const i64 Capacity_;
+    const i64 RowWordCount_;
+    const i64 SampleSize_;
+
+    std::unique_ptr<std::atomic<ui64>[]> Words_;
+    std::atomic<i64> EventCount_ = 0;
+
+    std::atomic<ui64>* GetWord(int row, ui64 fingerprint, int* shift) const;
+
+    void Age();
+};
+
+DEFINE_REFCOUNTED_TYPE(TFrequencySketch)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT
@@ -26,6 +26,7 @@
     #include <sys/quota.h>
     #include <sys/types.h>
     #include <sys/sendfile.h>
+    #include <unistd.h>
 #elif defined(_freebsd_) || defined(_darwin_)
     #include <sys/param.h>
     #include <sys/mount.h>
@@ -976,6 +977,69 @@ void Splice(
 #endif
 }
 
+void CopyFileRange(
+    const TFile& source,
+    const TFile& destination,
+    i64 chunkSize,
+    std::optional<i64> size)
+{
+#ifdef _linux_
+    try {
+        int srcFd = source.GetHandle();
+        int dstFd = destination.GetHandle();
+
+        auto hasMoreData = [&] (i64 copiedSize) {
+            return !size || copiedSize < *size;
+        };
+
+        bool useSendfile = false;
+        i64 copiedSize = 0;
+        while (hasMoreData(copiedSize)) {
+            i64 currentChunkSize = 0;
+            while (currentChunkSize < chunkSize && hasMoreData(copiedSize)) {
+                auto requestSize = chunkSize - currentChunkSize;
+                if (size) {
+                    requestSize = std::min(requestSize, *size - copiedSize);
+                }
+                auto result = useSendfile
+                    ? ::sendfile(dstFd, srcFd, nullptr, requestSize)
+                    : ::copy_file_range(srcFd, nullptr, dstFd, nullptr, requestSize, 0);
+                if (result == -1) {
+                    // NB: Older kernels and some filesystems cannot copy between these files at all.
+                    if (!useSendfile && copiedSize == 0 && (errno == EXDEV || errno == EINVAL || errno == ENOSYS || errno == EOPNOTSUPP)) {
+                        useSendfile = true;
+                        continue;
+                    }
+                    THROW_ERROR_EXCEPTION("Error while doing %v",
+                        useSendfile ? "sendfile" : "copy_file_range")
+                        << TError::FromSystem();
+                }
+                if (result == 0) {
+                    if (size) {
+                        THROW_ERROR_EXCEPTION("Unexpected end of source file: %v out of %v bytes copied",
+                            copiedSize,
+                            *size);
+                    }
+                    return;
+                }
+                currentChunkSize += result;
+                copiedSize += result;
+            }
+
+            NConcurrency::Yield();
+        }
+    } catch (const std::exception& ex) {
+        THROW_ERROR_EXCEPTION("Failed to copy %v to %v via copy_file_range",
+            source.GetName(),
+            destination.GetName())
+            << ex;
+    }
+#else
+    Y_UNUSED(source, destination, chunkSize, size);
+    ThrowNotSupported();
+#endif
+}
+
 TError AttachLsofOutput(TError error, const TString& path)
 {
     auto lsofOutput = TShellCommand("lsof", {path})
@@ -196,6 +196,17 @@ void Splice(
     const TFile& destination,
     i64 chunkSize);
 
+//! Copies file chunk after chunk via copy_file_range syscall keeping the data
+//! off user space, releasing thread between chunks.
+//! Copies #size bytes (or up to the end of #source if #size is not given) starting
+//! at the current offsets of both files; throws if #source ends prematurely.
+//! Falls back to sendfile if the syscall is not supported for a given pair of files.
+void CopyFileRange(
+    const TFile& source,
+    const TFile& destination,
+    i64 chunkSize,
+    std::optional<i64> size = {});
+
 TError AttachLsofOutput(TError error, const TString& path);
 TError AttachFindOutput(TError error, const TString& path);
 
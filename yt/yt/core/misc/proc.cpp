@@ -1518,10 +1518,10 @@ TTaskDiskStatistics GetSelfThreadTaskDiskStatistics()
 
 ////////////////////////////////////////////////////////////////////////////////
 
-TFile MemfdCreate(const TString& name)
+TFile MemfdCreate(const TString& name, unsigned int flags)
 {
 #ifdef _linux_
-    int fd = memfd_create(name.c_str(), 0);
+    int fd = memfd_create(name.c_str(), flags);
     if (fd == -1) {
         THROW_ERROR_EXCEPTION("Unable to create memfd")
                 << TError::FromSystem();
@@ -1530,6 +1530,7 @@ TFile MemfdCreate(const TString& name)
     return TFile{fd};
 #else
     Y_UNUSED(name);
+    Y_UNUSED(flags);
 
     THROW_ERROR_EXCEPTION("Not implemented");
 #endif
@@ -361,7 +361,9 @@ TTaskDiskStatistics GetSelfThreadTaskDiskStatistics();
 
 ////////////////////////////////////////////////////////////////////////////////
 
-TFile MemfdCreate(const TString& name);
+//! Creates an anonymous memory-backed file; #flags are passed to |memfd_create|
+//! (e.g. |MFD_CLOEXEC| or |MFD_ALLOW_SEALING|).
+TFile MemfdCreate(const TString& name, unsigned int flags = 0);
 
 ////////////////////////////////////////////////////////////////////////////////
 
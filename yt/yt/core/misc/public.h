@@ -149,6 +149,8 @@ using IFairSchedulerPtr = TIntrusivePtr<IFairScheduler<TTask>>;
 DECLARE_REFCOUNTED_CLASS(TAdaptiveHedgingManagerConfig)
 DECLARE_REFCOUNTED_STRUCT(IHedgingManager)
 
+DECLARE_REFCOUNTED_CLASS(TFrequencySketch)
+
 ////////////////////////////////////////////////////////////////////////////////
 
 YT_DEFINE_ERROR_ENUM(
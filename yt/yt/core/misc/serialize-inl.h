@@ -376,6 +376,8 @@ TEntitySerializationKey TEntityStreamSaveContext::RegisterRefCountedEntity(const
 template <class T>
 inline TEntitySerializationKey TEntityStreamLoadContext::RegisterRawEntity(T* entity)
 {
+    YT_VERIFY(!ParentContext_);
+
     auto key = TEntitySerializationKey(std::ssize(RawPtrs_));
     RawPtrs_.push_back(entity);
     return key;
@@ -392,6 +394,10 @@ TEntitySerializationKey TEntityStreamLoadContext::RegisterRefCountedEntity(const
 template <class T>
 T* TEntityStreamLoadContext::GetRawEntity(TEntitySerializationKey key) const
 {
+    if (ParentContext_) {
+        return ParentContext_->GetRawEntity<T>(key);
+    }
+
     YT_ASSERT(key.Index >= 0);
     YT_ASSERT(key.Index < std::ssize(RawPtrs_));
     return static_cast<T*>(RawPtrs_[key.Index]);
@@ -157,9 +157,20 @@ TStreamLoadContext::TStreamLoadContext(IZeroCopyInput* input)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+TEntityStreamLoadContext::TEntityStreamLoadContext(
+    IZeroCopyInput* input,
+    const TEntityStreamLoadContext* parentContext)
+    : TStreamLoadContext(input)
+    , ParentContext_(parentContext)
+{
+    SetVersion(parentContext->GetVersion());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 TEntityStreamSaveContext::TEntityStreamSaveContext(
     IZeroCopyOutput* output,
-    TEntityStreamSaveContext* parentContext)
+    const TEntityStreamSaveContext* parentContext)
     : TStreamSaveContext(
         output,
         parentContext->GetVersion())
@@ -236,7 +236,7 @@ public:
 
     TEntityStreamSaveContext(
         IZeroCopyOutput* output,
-        TEntityStreamSaveContext* parentContext);
+        const TEntityStreamSaveContext* parentContext);
 
     TEntitySerializationKey GenerateSerializationKey();
 
@@ -263,6 +263,12 @@ class TEntityStreamLoadContext
 public:
     using TStreamLoadContext::TStreamLoadContext;
 
+    //! Constructs a context for reading a self-contained part of a stream
+    //! produced by a child save context; entity lookups are delegated to #parentContext.
+    TEntityStreamLoadContext(
+        IZeroCopyInput* input,
+        const TEntityStreamLoadContext* parentContext);
+
     template <class T>
     TEntitySerializationKey RegisterRawEntity(T* entity);
     template <class T>
@@ -274,6 +280,8 @@ public:
     TIntrusivePtr<T> GetRefCountedEntity(TEntitySerializationKey key) const;
 
 private:
+    const TEntityStreamLoadContext* const ParentContext_ = nullptr;
+
     std::vector<void*> RawPtrs_;
     std::vector<TIntrusivePtr<TRefCounted>> RefCountedPtrs_;
 };
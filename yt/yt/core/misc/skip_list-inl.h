@@ -7,6 +7,7 @@
 #include <library/cpp/yt/memory/chunked_memory_pool.h>
 
 #include <util/random/random.h>
+#include <util/system/compiler.h>
 
 #include <type_traits>
 
@@ -247,6 +248,87 @@ typename TSkipList<TKey, TComparer>::TIterator TSkipList<TKey, TComparer>::FindE
         : TIterator();
 }
 
+template <class TKey, class TComparer>
+TSkipList<TKey, TComparer>::TFinger::TFinger(const TSkipList* owner)
+    : Owner_(owner)
+{ }
+
+template <class TKey, class TComparer>
+template <class TPivot>
+typename TSkipList<TKey, TComparer>::TIterator TSkipList<TKey, TComparer>::TFinger::FindEqualTo(const TPivot& pivot)
+{
+    auto* lowerBound = DoFindGreaterThanOrEqualTo(pivot);
+    return lowerBound != Owner_->Head_ && Owner_->Comparer_(lowerBound->GetKey(), pivot) == 0
+        ? TIterator(Owner_, lowerBound)
+        : TIterator();
+}
+
+template <class TKey, class TComparer>
+template <class TPivot>
+typename TSkipList<TKey, TComparer>::TIterator TSkipList<TKey, TComparer>::TFinger::FindGreaterThanOrEqualTo(const TPivot& pivot)
+{
+    auto* lowerBound = DoFindGreaterThanOrEqualTo(pivot);
+    return lowerBound != Owner_->Head_
+        ? TIterator(Owner_, lowerBound)
+        : TIterator();
+}
+
+template <class TKey, class TComparer>
+template <class TPivot>
+const typename TSkipList<TKey, TComparer>::TNode* TSkipList<TKey, TComparer>::TFinger::DoFindGreaterThanOrEqualTo(const TPivot& pivot)
+{
+    const auto* head = Owner_->Head_;
+    const auto& comparer = Owner_->Comparer_;
+
+    // The list may have grown since the previous search.
+    int height = Owner_->Height_;
+    for (int level = Height_; level < height; ++level) {
+        Prevs_[level] = head;
+    }
+    Height_ = height;
+
+    // Predecessors stay valid for any pivot not less than the previous one.
+    // Prevs_[0] is the closest of them, so it is sufficient to check it.
+    if (Prevs_[0] != head && comparer(Prevs_[0]->GetKey(), pivot) >= 0) {
+        std::fill(Prevs_.begin(), Prevs_.begin() + height, head);
+    }
+
+    // Climb up while the pivot is beyond the next node of the current level.
+    int level = 0;
+    while (level + 1 < height) {
+        auto* next = Prevs_[level]->GetNext(level);
+        if (next == head || comparer(next->GetKey(), pivot) >= 0) {
+            break;
+        }
+        ++level;
+    }
+
+    // Descend as in a regular search, memorizing predecessors.
+    const auto* current = Prevs_[level];
+    const TNode* lastChecked = head;
+    while (true) {
+        auto* next = current->GetNext(level);
+        if (next != head && next != lastChecked) {
+            // Fetch the node following the candidate in advance: it is the next one
+            // to be examined should the candidate precede the pivot.
+            Y_PREFETCH_READ(next->GetNext(level), 3);
+        }
+        if (next != head && next != lastChecked && comparer(next->GetKey(), pivot) < 0) {
+            current = next;
+        } else {
+            Prevs_[level] = current;
+            if (level > 0) {
+                lastChecked = next;
+                --level;
+            } else {
+                return next;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 template <class TKey, class TComparer>
 int TSkipList<TKey, TComparer>::GenerateHeight()
 {
@@ -24,6 +24,8 @@ class TSkipList
 private:
     class TNode;
 
+    static const int MaxHeight = 12;
+
 public:
     TSkipList(
         TChunkedMemoryPool* pool,
@@ -92,8 +94,40 @@ public:
     template <class TPivot>
     TIterator FindLessThanOrEqualTo(const TPivot& pivot) const;
 
+    //! Accelerates a series of searches for non-decreasing pivots (finger search).
+    /*!
+     *  Each search resumes from the predecessors found by the previous one
+     *  instead of descending from the head, so looking up a sorted batch of keys
+     *  walks the list roughly once. Pivots that are not in order are handled
+     *  correctly but restart the search from the head.
+     *
+     *  Can be used from reader threads; the list must outlive the finger.
+     */
+    class TFinger
+    {
+    public:
+        explicit TFinger(const TSkipList* owner);
+
+        //! Same as TSkipList::FindEqualTo.
+        template <class TPivot>
+        TIterator FindEqualTo(const TPivot& pivot);
+
+        //! Same as TSkipList::FindGreaterThanOrEqualTo.
+        template <class TPivot>
+        TIterator FindGreaterThanOrEqualTo(const TPivot& pivot);
+
+    private:
+        const TSkipList* const Owner_;
+
+        //! For each level, the last node known to precede the previous pivot.
+        std::array<const TNode*, MaxHeight> Prevs_;
+        int Height_ = 0;
+
+        template <class TPivot>
+        const TNode* DoFindGreaterThanOrEqualTo(const TPivot& pivot);
+    };
+
 private:
-    static const int MaxHeight = 12;
     static const int InverseProbability = 4;
 
     class TNode
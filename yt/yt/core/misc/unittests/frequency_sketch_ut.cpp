@@ -0,0 +1,78 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/core/misc/frequency_sketch.h>
+
+namespace NYT {
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(TFrequencySketchTest, Simple)
+{
+    auto sketch = New<TFrequencySketch>(1024);
+
+    EXPECT_EQ(0, sketch->Estimate(42));
+
+    for (int index = 0; index < 5; ++index) {
+        sketch->Increment(42);
+    }
+    EXPECT_GE(sketch->Estimate(42), 5);
+
+    for (int index = 0; index < 100; ++index) {
+        sketch->Increment(43);
+    }
+    EXPECT_EQ(TFrequencySketch::MaxFrequency, sketch->Estimate(43));
+}
+
+TEST(TFrequencySketchTest, HotItemsDominate)
+{
+    constexpr int Capacity = 4096;
+    constexpr int HotCount = 128;
+    constexpr int ColdCount = 256;
+    auto sketch = New<TFrequencySketch>(Capacity);
+
+    // Hot items are accessed once per round, cold items are seen only once.
+    for (int round = 0; round < 4; ++round) {
+        for (ui64 hot = 0; hot < HotCount; ++hot) {
+            sketch->Increment(hot);
+        }
+        for (ui64 cold = 0; cold < ColdCount; ++cold) {
+            sketch->Increment(1'000'000 + round * ColdCount + cold);
+        }
+    }
+
+    int hotBelowThreshold = 0;
+    for (ui64 hot = 0; hot < HotCount; ++hot) {
+        hotBelowThreshold += sketch->Estimate(hot) < 2;
+    }
+    EXPECT_EQ(0, hotBelowThreshold);
+
+    int coldAboveThreshold = 0;
+    for (ui64 cold = 0; cold < ColdCount; ++cold) {
+        coldAboveThreshold += sketch->Estimate(1'000'000 + 3 * ColdCount + cold) >= 2;
+    }
+    EXPECT_LT(coldAboveThreshold, ColdCount / 10);
+}
+
+TEST(TFrequencySketchTest, Aging)
+{
+    constexpr int Capacity = 64;
+    auto sketch = New<TFrequencySketch>(Capacity);
+
+    for (int index = 0; index < 8; ++index) {
+        sketch->Increment(1);
+    }
+    EXPECT_GE(sketch->Estimate(1), 8);
+
+    // Fill up the sample to trigger halving.
+    for (int index = 8; index < 10 * Capacity; ++index) {
+        sketch->Increment(2);
+    }
+    EXPECT_EQ(4, sketch->Estimate(1));
+    EXPECT_EQ(TFrequencySketch::MaxFrequency / 2, sketch->Estimate(2));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT
@@ -5,6 +5,8 @@
 
 #include <util/folder/dirut.h>
 
+#include <util/stream/file.h>
+
 namespace NYT::NFS {
 namespace {
 
@@ -81,6 +83,49 @@ TEST(TFSTest, TestGetRelativePath)
     EXPECT_EQ(GetRelativePath(CombinePaths(NFs::CurrentWorkingDirectory(), "dir")), "dir");
 }
 
+#ifdef _linux_
+
+TEST(TFSTest, TestCopyFileRange)
+{
+    auto cwd = NFs::CurrentWorkingDirectory();
+    auto sourcePath = CombinePaths(cwd, "copy_file_range_source");
+    auto destinationPath = CombinePaths(cwd, "copy_file_range_destination");
+
+    TString data;
+    for (int index = 0; index < 10000; ++index) {
+        data += ToString(index);
+    }
+
+    {
+        TFile source(sourcePath, CreateAlways | WrOnly);
+        source.Write(data.data(), data.size());
+    }
+
+    {
+        TFile source(sourcePath, OpenExisting | RdOnly);
+        TFile destination(destinationPath, CreateAlways | WrOnly);
+        CopyFileRange(source, destination, /*chunkSize*/ 1000);
+    }
+
+    EXPECT_EQ(data, TUnbufferedFileInput(destinationPath).ReadAll());
+
+    {
+        TFile source(sourcePath, OpenExisting | RdOnly);
+        TFile destination(destinationPath, CreateAlways | WrOnly);
+        CopyFileRange(source, destination, /*chunkSize*/ 1000, /*size*/ 2500);
+        CopyFileRange(source, destination, /*chunkSize*/ 1000, /*size*/ 10);
+        EXPECT_EQ(2510, destination.GetLength());
+        EXPECT_THROW(CopyFileRange(source, destination, /*chunkSize*/ 1000, /*size*/ std::ssize(data)), TErrorException);
+    }
+
+    EXPECT_EQ(data, TUnbufferedFileInput(destinationPath).ReadAll());
+
+    Remove(sourcePath);
+    Remove(destinationPath);
+}
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace
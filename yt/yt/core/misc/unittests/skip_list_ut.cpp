@@ -2,6 +2,8 @@
 
 #include <yt/yt/core/misc/skip_list.h>
 
+#include <set>
+
 namespace NYT {
 namespace {
 
@@ -141,6 +143,55 @@ TEST_F(TSkipListTest, Random100000)
     }
 }
 
+TEST_F(TSkipListTest, Finger)
+{
+    srand(42);
+    std::set<int> set;
+    for (int i = 0; i < 10000; ++i) {
+        int value = rand() % 20000;
+        List.Insert(value);
+        set.insert(value);
+    }
+
+    auto check = [&] (auto* finger, int pivot) {
+        auto it = set.lower_bound(pivot);
+        auto listIt = finger->FindGreaterThanOrEqualTo(pivot);
+        if (it == set.end()) {
+            EXPECT_FALSE(listIt.IsValid());
+        } else {
+            ASSERT_TRUE(listIt.IsValid());
+            EXPECT_EQ(listIt.GetCurrent(), *it);
+        }
+        EXPECT_EQ(finger->FindEqualTo(pivot).IsValid(), set.contains(pivot));
+    };
+
+    {
+        decltype(List)::TFinger finger(&List);
+        for (int pivot = -1; pivot < 20001; pivot += rand() % 10) {
+            check(&finger, pivot);
+        }
+    }
+
+    {
+        // Out-of-order pivots restart the search.
+        decltype(List)::TFinger finger(&List);
+        for (int i = 0; i < 10000; ++i) {
+            check(&finger, rand() % 20002 - 1);
+        }
+    }
+
+    {
+        // Insertions between searches are observed.
+        decltype(List)::TFinger finger(&List);
+        for (int pivot = 0; pivot < 20000; pivot += 2) {
+            check(&finger, pivot);
+            int value = pivot + 1 + rand() % 100;
+            List.Insert(value);
+            set.insert(value);
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace
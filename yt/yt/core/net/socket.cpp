@@ -521,6 +521,17 @@ bool TrySetSocketInputFilter(SOCKET socket, bool drop)
 #endif
 }
 
+bool TrySetSocketZeroCopy(SOCKET socket)
+{
+#ifdef _linux_
+    int value = 1;
+    return setsockopt(socket, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value)) == 0;
+#else
+    Y_UNUSED(socket);
+    return false;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NNet
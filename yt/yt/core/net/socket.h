@@ -45,6 +45,8 @@ bool TrySetSocketKeepAlive(SOCKET socket);
 bool TrySetSocketEnableQuickAck(SOCKET socket);
 bool TrySetSocketTosLevel(SOCKET socket, int tosLevel);
 bool TrySetSocketInputFilter(SOCKET socket, bool drop);
+//! Allows sending with MSG_ZEROCOPY; fails for sockets that do not support it (e.g. Unix domain ones).
+bool TrySetSocketZeroCopy(SOCKET socket);
 
 ////////////////////////////////////////////////////////////////////////////////
 
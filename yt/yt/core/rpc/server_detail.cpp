@@ -99,6 +99,7 @@ void TServiceContextBase::Reply(const TSharedRefArray& responseMessage)
         ResponseBody_.Reset();
         ResponseAttachments_.clear();
     }
+    ResponseAttachmentChecksums_.clear();
 
     ReplyEpilogue();
 
@@ -252,6 +253,11 @@ std::vector<TSharedRef>& TServiceContextBase::ResponseAttachments()
     return ResponseAttachments_;
 }
 
+std::vector<TChecksum>& TServiceContextBase::ResponseAttachmentChecksums()
+{
+    return ResponseAttachmentChecksums_;
+}
+
 IAsyncZeroCopyOutputStreamPtr TServiceContextBase::GetResponseAttachmentsStream()
 {
     return nullptr;
@@ -638,6 +644,11 @@ std::vector<TSharedRef>& TServiceContextWrapper::ResponseAttachments()
     return UnderlyingContext_->ResponseAttachments();
 }
 
+std::vector<TChecksum>& TServiceContextWrapper::ResponseAttachmentChecksums()
+{
+    return UnderlyingContext_->ResponseAttachmentChecksums();
+}
+
 const NProto::TRequestHeader& TServiceContextWrapper::RequestHeader() const
 {
     return UnderlyingContext_->RequestHeader();
@@ -83,6 +83,7 @@ public:
     NConcurrency::IAsyncZeroCopyInputStreamPtr GetRequestAttachmentsStream() override;
 
     std::vector<TSharedRef>& ResponseAttachments() override;
+    std::vector<TChecksum>& ResponseAttachmentChecksums() override;
     NConcurrency::IAsyncZeroCopyOutputStreamPtr GetResponseAttachmentsStream() override;
 
     const NProto::TRequestHeader& RequestHeader() const override;
@@ -118,6 +119,7 @@ protected:
 
     TSharedRef ResponseBody_;
     std::vector<TSharedRef> ResponseAttachments_;
+    std::vector<TChecksum> ResponseAttachmentChecksums_;
 
     TCompactVector<TString, 4> RequestInfos_;
     TCompactVector<TString, 4> ResponseInfos_;
@@ -217,6 +219,7 @@ public:
     NConcurrency::IAsyncZeroCopyInputStreamPtr GetRequestAttachmentsStream() override;
 
     std::vector<TSharedRef>& ResponseAttachments() override;
+    std::vector<TChecksum>& ResponseAttachmentChecksums() override;
     NConcurrency::IAsyncZeroCopyOutputStreamPtr GetResponseAttachmentsStream() override;
 
     const NProto::TRequestHeader& RequestHeader() const override;
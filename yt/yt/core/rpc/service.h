@@ -178,6 +178,11 @@ struct IServiceContext
     //! Returns a vector of response attachments.
     virtual std::vector<TSharedRef>& ResponseAttachments() = 0;
 
+    //! Returns a vector of checksums of response attachments known in advance;
+    //! either empty or of the same size as #ResponseAttachments with null entries for unknown checksums.
+    //! The transport may reuse these instead of computing them.
+    virtual std::vector<TChecksum>& ResponseAttachmentChecksums() = 0;
+
     //! Returns the stream of asynchronous response attachments.
     virtual NConcurrency::IAsyncZeroCopyOutputStreamPtr GetResponseAttachmentsStream() = 0;
 
@@ -844,6 +844,18 @@ private:
             ? NBus::TSendOptions::AllParts
             : 2; // RPC header + response body
         busOptions.EnableSendCancelation = Cancelable_;
+        if (Error_.IsOK() &&
+            !ResponseAttachmentChecksums_.empty() &&
+            ResponseAttachmentChecksums_.size() == ResponseAttachments_.size())
+        {
+            // RPC header and response body come first.
+            busOptions.PartChecksums.reserve(2 + ResponseAttachmentChecksums_.size());
+            busOptions.PartChecksums.assign(2, NullChecksum);
+            busOptions.PartChecksums.insert(
+                busOptions.PartChecksums.end(),
+                ResponseAttachmentChecksums_.begin(),
+                ResponseAttachmentChecksums_.end());
+        }
 
         auto replySent = ReplyBus_->Send(responseMessage, busOptions);
         if (Cancelable_ && replySent) {
@@ -102,6 +102,8 @@ public:
     using TMessage = TResponseMessage;
 
     DEFINE_BYREF_RW_PROPERTY(std::vector<TSharedRef>, Attachments);
+    //! Checksums of #Attachments known in advance, if any (see IServiceContext::ResponseAttachmentChecksums).
+    DEFINE_BYREF_RW_PROPERTY(std::vector<TChecksum>, AttachmentChecksums);
 
     NConcurrency::IAsyncZeroCopyOutputStreamPtr GetAttachmentsStream()
     {
@@ -123,6 +125,7 @@ struct TPooledTypedResponseTraits
     {
         message->Clear();
         message->Attachments().clear();
+        message->AttachmentChecksums().clear();
     }
 };
 
@@ -304,6 +307,7 @@ protected:
     {
         TSharedRef Body;
         std::vector<TSharedRef> Attachments;
+        std::vector<TChecksum> AttachmentChecksums;
     };
 
     TSerializedResponse SerializeResponse()
@@ -348,9 +352,18 @@ protected:
 
         auto responseAttachments = CompressAttachments(Response_->Attachments(), attachmentCodecId);
 
+        // Known checksums are only valid for attachments sent as is.
+        std::vector<TChecksum> responseAttachmentChecksums;
+        if (attachmentCodecId == NCompression::ECodec::None &&
+            Response_->AttachmentChecksums().size() == responseAttachments.size())
+        {
+            responseAttachmentChecksums = std::move(Response_->AttachmentChecksums());
+        }
+
         return TSerializedResponse{
             .Body = std::move(serializedBody),
             .Attachments = std::move(responseAttachments),
+            .AttachmentChecksums = std::move(responseAttachmentChecksums),
         };
     }
 
@@ -369,6 +382,7 @@ protected:
 
             this->UnderlyingContext_->SetResponseBody(std::move(response.Body));
             this->UnderlyingContext_->ResponseAttachments() = std::move(response.Attachments);
+            this->UnderlyingContext_->ResponseAttachmentChecksums() = std::move(response.AttachmentChecksums);
         }
 
         this->UnderlyingContext_->Reply(error);
@@ -8,6 +8,7 @@ TMockServiceContext::TMockServiceContext()
 {
     ON_CALL(*this, GetRequestHeader()).WillByDefault(::testing::ReturnRef(RequestHeader_));
     ON_CALL(*this, ResponseAttachments()).WillByDefault(::testing::ReturnRef(ResponseAttachments_));
+    ON_CALL(*this, ResponseAttachmentChecksums()).WillByDefault(::testing::ReturnRef(ResponseAttachmentChecksums_));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,7 @@ class TMockServiceContext
 public:
     NProto::TRequestHeader RequestHeader_;
     std::vector<TSharedRef> ResponseAttachments_;
+    std::vector<TChecksum> ResponseAttachmentChecksums_;
 
 public:
     TMockServiceContext();
@@ -293,6 +294,13 @@ public:
         (override)
     );
 
+    MOCK_METHOD(
+        std::vector<TChecksum>&,
+        ResponseAttachmentChecksums,
+        (),
+        (override)
+    );
+
     MOCK_METHOD(
         NConcurrency::IAsyncZeroCopyOutputStreamPtr,
         GetResponseAttachmentsStream,
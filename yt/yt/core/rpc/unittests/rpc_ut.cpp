@@ -1339,5 +1339,21 @@ TEST(TCachingChannelFactoryTest, IdleChannels)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+TEST(TPooledTypedMessageTest, CleanResponse)
+{
+    TTypedServiceResponse<NMyRpc::TRspSomeCall> response;
+    response.set_b(1);
+    response.Attachments().push_back(TSharedRef::FromString("attachment"));
+    response.AttachmentChecksums().push_back(123);
+
+    // A reused response must not carry stale checksums for its new attachments.
+    TPooledTypedResponseTraits<NMyRpc::TRspSomeCall>::Clean(&response);
+    EXPECT_FALSE(response.has_b());
+    EXPECT_TRUE(response.Attachments().empty());
+    EXPECT_TRUE(response.AttachmentChecksums().empty());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace
 } // namespace NYT::NRpc
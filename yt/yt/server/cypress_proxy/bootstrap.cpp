@@ -4,6 +4,7 @@
 #include "private.h"
 #include "config.h"
 #include "object_service.h"
+#include "resolve_cache.h"
 #include "sequoia_service.h"
 
 #include <yt/yt/server/lib/admin/admin_service.h>
@@ -18,6 +19,8 @@
 #include <yt/yt/ytlib/api/native/connection.h>
 #include <yt/yt/ytlib/api/native/helpers.h>
 
+#include <yt/yt/ytlib/object_client/object_service_cache.h>
+
 #include <yt/yt/ytlib/orchid/orchid_service.h>
 
 #include <yt/yt/ytlib/program/helpers.h>
@@ -33,6 +36,8 @@
 
 #include <yt/yt/core/http/server.h>
 
+#include <yt/yt/core/misc/memory_usage_tracker.h>
+
 #include <yt/yt/core/net/local_address.h>
 
 #include <yt/yt/core/rpc/caching_channel_factory.h>
@@ -49,6 +54,7 @@ using namespace NAdmin;
 using namespace NConcurrency;
 using namespace NCoreDump;
 using namespace NMonitoring;
+using namespace NObjectClient;
 using namespace NOrchid;
 using namespace NYTree;
 
@@ -133,6 +139,16 @@ public:
         return SequoiaService_;
     }
 
+    const TSequoiaResolveCachePtr& GetResolveCache() const override
+    {
+        return ResolveCache_;
+    }
+
+    const TObjectServiceCachePtr& GetObjectServiceCache() const override
+    {
+        return ObjectServiceCache_;
+    }
+
 private:
     const TCypressProxyConfigPtr Config_;
 
@@ -141,6 +157,8 @@ private:
     NRpc::IAuthenticatorPtr NativeAuthenticator_;
 
     IYPathServicePtr SequoiaService_;
+    TSequoiaResolveCachePtr ResolveCache_;
+    TObjectServiceCachePtr ObjectServiceCache_;
 
     TActionQueuePtr ControlQueue_;
 
@@ -217,6 +235,16 @@ private:
             CoreDumper_,
             /*authenticator*/ nullptr));
 
+        ResolveCache_ = New<TSequoiaResolveCache>(Config_->ResolveCache);
+        ObjectServiceCache_ = New<TObjectServiceCache>(
+            Config_->ObjectServiceCache,
+            GetNullMemoryUsageTracker(),
+            CypressProxyLogger,
+            CypressProxyProfiler.WithPrefix("/object_service_cache"));
+        SetNodeByYPath(
+            OrchidRoot_,
+            "/object_service_cache",
+            CreateVirtualNode(ObjectServiceCache_->GetOrchidService()));
         SequoiaService_ = CreateSequoiaService(this);
         ObjectService_ = CreateObjectService(this);
         RpcServer_->RegisterService(ObjectService_->GetService());
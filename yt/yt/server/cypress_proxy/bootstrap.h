@@ -4,6 +4,8 @@
 
 #include <yt/yt/ytlib/api/native/public.h>
 
+#include <yt/yt/ytlib/object_client/public.h>
+
 #include <yt/yt/client/api/public.h>
 
 namespace NYT::NCypressProxy {
@@ -30,6 +32,10 @@ struct IBootstrap
     virtual NApi::IClientPtr GetRootClient() const = 0;
 
     virtual const NYTree::IYPathServicePtr& GetSequoiaService() const = 0;
+
+    virtual const TSequoiaResolveCachePtr& GetResolveCache() const = 0;
+
+    virtual const NObjectClient::TObjectServiceCachePtr& GetObjectServiceCache() const = 0;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2,6 +2,10 @@
 
 #include <yt/yt/ytlib/api/native/config.h>
 
+#include <yt/yt/ytlib/object_client/config.h>
+
+#include <yt/yt/core/misc/cache_config.h>
+
 namespace NYT::NCypressProxy {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +26,13 @@ void TCypressProxyConfig::Register(TRegistrar registrar)
     registrar.Parameter("dynamic_config_path", &TThis::DynamicConfigPath)
         .Default();
 
+    registrar.Parameter("resolve_cache", &TThis::ResolveCache)
+        .DefaultCtor([] {
+            return TSlruCacheConfig::CreateWithCapacity(100'000);
+        });
+    registrar.Parameter("object_service_cache", &TThis::ObjectServiceCache)
+        .DefaultNew();
+
     registrar.Postprocessor([] (TThis* config) {
         if (!config->DynamicConfigPath) {
             config->DynamicConfigPath = config->RootPath + "/@config";
@@ -35,6 +46,9 @@ void TObjectServiceDynamicConfig::Register(TRegistrar registrar)
 {
     registrar.Parameter("thread_pool_size", &TThis::ThreadPoolSize)
         .Default(1);
+
+    registrar.Parameter("enable_cache", &TThis::EnableCache)
+        .Default(false);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,8 @@
 
 #include <yt/yt/ytlib/api/native/public.h>
 
+#include <yt/yt/ytlib/object_client/public.h>
+
 #include <yt/yt/library/dynamic_config/config.h>
 
 #include <yt/yt/core/bus/tcp/config.h>
@@ -29,6 +31,12 @@ public:
     NDynamicConfig::TDynamicConfigManagerConfigPtr DynamicConfigManager;
     TString DynamicConfigPath;
 
+    //! Cache of Sequoia node paths used to route requests without a master round trip.
+    TSlruCacheConfigPtr ResolveCache;
+
+    //! Cache of master responses to reads served by object service, see #TObjectServiceDynamicConfig::EnableCache.
+    NObjectClient::TObjectServiceCacheConfigPtr ObjectServiceCache;
+
     REGISTER_YSON_STRUCT(TCypressProxyConfig);
 
     static void Register(TRegistrar registrar);
@@ -46,6 +54,14 @@ public:
     //! requests execution.
     int ThreadPoolSize;
 
+    //! Whether reads carrying caching header are served via object service cache.
+    /*!
+     *  Such reads are cached as the header instructs (expiration times, staleness bound
+     *  and refresh revision); identical reads in flight are sent to master only once.
+     *  Reads without caching header always go to master.
+     */
+    bool EnableCache;
+
     REGISTER_YSON_STRUCT(TObjectServiceDynamicConfig);
 
     static void Register(TRegistrar registrar);
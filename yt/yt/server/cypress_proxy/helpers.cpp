@@ -0,0 +1,159 @@
+#include "helpers.h"
+
+#include "config.h"
+
+#include <yt/yt/core/misc/error.h>
+#include <yt/yt/core/misc/protobuf_helpers.h>
+
+#include <yt/yt/core/ypath/tokenizer.h>
+
+#include <yt/yt_proto/yt/core/rpc/proto/rpc.pb.h>
+#include <yt/yt_proto/yt/core/ytree/proto/ypath.pb.h>
+
+namespace NYT::NCypressProxy {
+
+using namespace NYPath;
+using namespace NYTree::NProto;
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::vector<TYPath> GetPathPrefixes(const TYPath& path)
+{
+    static const auto SlashYPath = TYPath("/");
+
+    std::vector<TYPath> prefixes;
+    try {
+        TTokenizer tokenizer(path);
+        YT_VERIFY(tokenizer.Skip(ETokenType::StartOfStream));
+        if (!tokenizer.Skip(ETokenType::Slash)) {
+            return {};
+        }
+
+        TYPath currentPrefix = SlashYPath;
+        while (tokenizer.Skip(ETokenType::Slash)) {
+            if (tokenizer.GetType() != ETokenType::Literal) {
+                break;
+            }
+            currentPrefix += SlashYPath;
+            currentPrefix += tokenizer.GetLiteralValue();
+            tokenizer.Advance();
+            prefixes.push_back(currentPrefix);
+        }
+    } catch (const std::exception&) {
+        // Malformed paths are never routed via cache; the error is reported upon execution.
+        return {};
+    }
+
+    return prefixes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::vector<TMasterSubresponse> ParseMasterSubresponses(
+    const NObjectClient::NProto::TRspExecute& response,
+    TRange<TSharedRef> attachments,
+    TRange<int> subrequestIndices)
+{
+    std::vector<TMasterSubresponse> subresponses;
+    subresponses.reserve(response.subresponses_size());
+
+    int currentPartIndex = 0;
+    for (const auto& subresponseInfo : response.subresponses()) {
+        auto index = subresponseInfo.index();
+        auto partCount = subresponseInfo.part_count();
+        if (index < 0 || index >= std::ssize(subrequestIndices)) {
+            THROW_ERROR_EXCEPTION("Master returned subresponse with invalid index %v",
+                index)
+                << TErrorAttribute("subrequest_count", subrequestIndices.size());
+        }
+        if (currentPartIndex + partCount > std::ssize(attachments)) {
+            THROW_ERROR_EXCEPTION("Master returned too few attachments")
+                << TErrorAttribute("attachment_count", attachments.size());
+        }
+
+        TSharedRefArrayBuilder messageBuilder(partCount);
+        for (int partIndex = currentPartIndex; partIndex < currentPartIndex + partCount; ++partIndex) {
+            messageBuilder.Add(attachments[partIndex]);
+        }
+        currentPartIndex += partCount;
+
+        subresponses.push_back({
+            .SubrequestIndex = subrequestIndices[index],
+            .Message = messageBuilder.Finish(),
+            .Revision = subresponseInfo.revision(),
+        });
+    }
+
+    return subresponses;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ExecuteSubrequests(
+    const std::vector<bool>& predictedSequoia,
+    const TSubrequestExecutor& executeOnMaster,
+    const TSubrequestExecutor& executeInSequoia)
+{
+    int subrequestCount = std::ssize(predictedSequoia);
+    int index = 0;
+    while (index < subrequestCount) {
+        if (predictedSequoia[index]) {
+            auto mispredictedIndices = executeInSequoia({index}, /*allowRedirect*/ true);
+            if (!mispredictedIndices.empty()) {
+                executeOnMaster(mispredictedIndices, /*allowRedirect*/ false);
+            }
+            ++index;
+            continue;
+        }
+
+        std::vector<int> masterIndices;
+        while (index < subrequestCount && !predictedSequoia[index]) {
+            masterIndices.push_back(index++);
+        }
+
+        auto sequoiaIndices = executeOnMaster(masterIndices, /*allowRedirect*/ true);
+        for (auto sequoiaIndex : sequoiaIndices) {
+            executeInSequoia({sequoiaIndex}, /*allowRedirect*/ false);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<TSubrequestCachingOptions> GetSubrequestCachingOptions(
+    const NRpc::NProto::TRequestHeader& header,
+    int partCount,
+    const TObjectServiceDynamicConfigPtr& config)
+{
+    if (!config->EnableCache) {
+        return std::nullopt;
+    }
+
+    // Responses are cached by request body; requests with attachments are never cached.
+    if (partCount != 2) {
+        return std::nullopt;
+    }
+
+    const auto& ypathExt = header.GetExtension(TYPathHeaderExt::ypath_header_ext);
+    if (ypathExt.mutating()) {
+        return std::nullopt;
+    }
+
+    // NB: Only clients that have opted in for caching may get responses that are not fresh.
+    if (!header.HasExtension(TCachingHeaderExt::caching_header_ext)) {
+        return std::nullopt;
+    }
+
+    const auto& cachingHeaderExt = header.GetExtension(TCachingHeaderExt::caching_header_ext);
+    return TSubrequestCachingOptions{
+        .ExpireAfterSuccessfulUpdateTime = FromProto<TDuration>(cachingHeaderExt.expire_after_successful_update_time()),
+        .ExpireAfterFailedUpdateTime = FromProto<TDuration>(cachingHeaderExt.expire_after_failed_update_time()),
+        .SuccessStalenessBound = FromProto<TDuration>(cachingHeaderExt.success_staleness_bound()),
+        .RefreshRevision = cachingHeaderExt.refresh_revision(),
+        .DisablePerUserCache = cachingHeaderExt.disable_per_user_cache(),
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NCypressProxy
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/ytlib/object_client/proto/object_ypath.pb.h>
+
+#include <yt/yt/client/hydra/public.h>
+
+#include <yt/yt/core/rpc/public.h>
+
+#include <yt/yt/core/ypath/public.h>
+
+#include <library/cpp/yt/memory/range.h>
+#include <library/cpp/yt/memory/ref.h>
+
+namespace NYT::NCypressProxy {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Returns prefixes of #path in the same form they are stored in the resolve table,
+//! shortest first. Paths not starting with root designator as well as malformed ones
+//! yield no prefixes.
+std::vector<NYPath::TYPath> GetPathPrefixes(const NYPath::TYPath& path);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TMasterSubresponse
+{
+    //! Index of the subrequest within the batch received by Cypress proxy.
+    int SubrequestIndex;
+    TSharedRefArray Message;
+    NHydra::TRevision Revision;
+};
+
+//! Splits the response to a subbatch forwarded to master into subresponses.
+/*!
+ *  Master indexes subresponses within the subbatch it has received, i.e. the subresponse
+ *  with index |i| corresponds to the subrequest #subrequestIndices[i] of the original batch.
+ */
+std::vector<TMasterSubresponse> ParseMasterSubresponses(
+    const NObjectClient::NProto::TRspExecute& response,
+    TRange<TSharedRef> attachments,
+    TRange<int> subrequestIndices);
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Executes subrequests with given indices either on master or in Sequoia and fills their subresponses.
+/*!
+ *  Returns the indices of subrequests rejected as belonging to the other side; these ones
+ *  get no subresponses. If #allowRedirect is |false|, no subrequest may be rejected
+ *  and the rejection error is to be replied as is.
+ */
+using TSubrequestExecutor = std::function<std::vector<int>(const std::vector<int>& subrequestIndices, bool allowRedirect)>;
+
+//! Routes the subrequests of a batch between master and Sequoia.
+/*!
+ *  Subrequests are executed in batch order: each run of consecutive subrequests not predicted to
+ *  involve Sequoia is sent to master as a single subbatch, and the predicted ones are sent to Sequoia
+ *  one by one. A subrequest rejected by either side is executed on the other side right after its
+ *  run and before the subsequent subrequests; it is never redirected once again.
+ */
+void ExecuteSubrequests(
+    const std::vector<bool>& predictedSequoia,
+    const TSubrequestExecutor& executeOnMaster,
+    const TSubrequestExecutor& executeInSequoia);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TSubrequestCachingOptions
+{
+    TDuration ExpireAfterSuccessfulUpdateTime;
+    TDuration ExpireAfterFailedUpdateTime;
+    TDuration SuccessStalenessBound;
+    NHydra::TRevision RefreshRevision = NHydra::NullRevision;
+    bool DisablePerUserCache = false;
+};
+
+//! Returns the options to serve a subrequest via object service cache with
+//! or null if the subrequest is not to be cached (see #TObjectServiceDynamicConfig::EnableCache).
+std::optional<TSubrequestCachingOptions> GetSubrequestCachingOptions(
+    const NRpc::NProto::TRequestHeader& header,
+    int partCount,
+    const TObjectServiceDynamicConfigPtr& config);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NCypressProxy
@@ -3,15 +3,25 @@
 #include "bootstrap.h"
 #include "config.h"
 #include "dynamic_config_manager.h"
+#include "helpers.h"
 #include "private.h"
+#include "resolve_cache.h"
 
+#include <yt/yt/ytlib/object_client/object_service_cache.h>
 #include <yt/yt/ytlib/object_client/object_service_proxy.h>
 #include <yt/yt/ytlib/object_client/proto/object_ypath.pb.h>
 
 #include <yt/yt/core/concurrency/thread_pool.h>
 
+#include <yt/yt/core/misc/collection_helpers.h>
+
+#include <yt/yt/core/rpc/message.h>
 #include <yt/yt/core/rpc/service_detail.h>
 
+#include <yt/yt/core/ytree/ypath_client.h>
+
+#include <library/cpp/yt/memory/atomic_intrusive_ptr.h>
+
 namespace NYT::NCypressProxy {
 
 using namespace NApi;
@@ -51,6 +61,7 @@ public:
     void Reconfigure(const TObjectServiceDynamicConfigPtr& config) override
     {
         ThreadPool_->Configure(config->ThreadPoolSize);
+        DynamicConfig_.Store(config);
     }
 
     IServicePtr GetService() override
@@ -68,6 +79,13 @@ private:
     const IThreadPoolPtr ThreadPool_;
     const IInvokerPtr Invoker_;
 
+    TAtomicIntrusivePtr<TObjectServiceDynamicConfig> DynamicConfig_{New<TObjectServiceDynamicConfig>()};
+
+    TObjectServiceDynamicConfigPtr GetDynamicConfig() const
+    {
+        return DynamicConfig_.Acquire();
+    }
+
     class TExecuteSession;
     using TExecuteSessionPtr = TIntrusivePtr<TExecuteSession>;
 };
@@ -83,9 +101,11 @@ public:
     TExecuteSession(
         TObjectServicePtr owner,
         TCtxExecutePtr rpcContext,
+        TCellTag cellTag,
         TObjectServiceProxy masterProxy)
         : Owner_(std::move(owner))
         , RpcContext_(std::move(rpcContext))
+        , CellTag_(cellTag)
         , MasterProxy_(std::move(masterProxy))
     { }
 
@@ -101,29 +121,23 @@ public:
 private:
     const TObjectServicePtr Owner_;
     const TCtxExecutePtr RpcContext_;
+    const TCellTag CellTag_;
 
     TObjectServiceProxy MasterProxy_;
 
-    struct TSubrequest
-    {
-        TSharedRefArray RequestMessage;
-
-        // Whether resolve cache predicted that request affects Sequoia.
-        bool PredictedSequoia = false;
-        // Whether master said that request affects Sequoia.
-        bool ForcedSequoia = false;
-        // Whether Sequoia said that request does not affect Sequoia.
-        bool ForcedNonSequoia = false;
-    };
-    std::vector<TSubrequest> Subrequests_;
+    std::vector<TSharedRefArray> SubrequestMessages_;
 
     void GuardedRun()
     {
         ParseSubrequests();
-        PredictSequoia();
-        InvokeMasterRequests(/*firstRun*/ true);
-        InvokeSequoiaRequests();
-        InvokeMasterRequests(/*firstRun*/ false);
+        ExecuteSubrequests(
+            PredictSequoia(),
+            [&] (const std::vector<int>& subrequestIndices, bool allowRedirect) {
+                return InvokeMasterRequests(subrequestIndices, allowRedirect);
+            },
+            [&] (const std::vector<int>& subrequestIndices, bool allowRedirect) {
+                return InvokeSequoiaRequests(subrequestIndices, allowRedirect);
+            });
         Reply();
     }
 
@@ -133,54 +147,119 @@ private:
         const auto& attachments = RpcContext_->RequestAttachments();
 
         auto subrequestCount = request.part_counts_size();
-        Subrequests_.resize(subrequestCount);
+        SubrequestMessages_.resize(subrequestCount);
         int currentPartIndex = 0;
         for (int index = 0; index < subrequestCount; ++index) {
-            auto& subrequest = Subrequests_[index];
-
             auto partCount = request.part_counts(index);
             TSharedRefArrayBuilder messageBuilder(partCount);
             for (int partIndex = 0; partIndex < partCount; ++partIndex) {
                 messageBuilder.Add(attachments[currentPartIndex++]);
             }
-            subrequest.RequestMessage = messageBuilder.Finish();
+            SubrequestMessages_[index] = messageBuilder.Finish();
         }
     }
 
-    void PredictSequoia()
+    //! Returns whether resolve cache predicts each of the subrequests to involve Sequoia.
+    std::vector<bool> PredictSequoia()
     {
-        for (auto& subrequest : Subrequests_) {
-            // TODO: Do something more smart when resolve cache
-            // will be implemented.
-            subrequest.PredictedSequoia = false;
+        const auto& resolveCache = Owner_->Bootstrap_->GetResolveCache();
+        std::vector<bool> predictedSequoia(SubrequestMessages_.size());
+        for (int index = 0; index < std::ssize(SubrequestMessages_); ++index) {
+            NRpc::NProto::TRequestHeader header;
+            if (!ParseRequestHeader(SubrequestMessages_[index], &header)) {
+                // Let master report the error.
+                continue;
+            }
+
+            // NB: Sequoia service handles nothing but Create yet.
+            if (header.method() != "Create") {
+                continue;
+            }
+
+            const auto& path = GetRequestTargetYPath(header);
+            predictedSequoia[index] = static_cast<bool>(resolveCache->FindLongestPrefix(path));
         }
+        return predictedSequoia;
     }
 
-    // This function is called twice.
-    // During the first run, requests that are predicted to be non-Sequoia
-    // are sent to master.
-    // During the second run, requests that were rejected by Sequoia are
-    // send to master.
-    void InvokeMasterRequests(bool firstRun)
+    std::vector<int> InvokeMasterRequests(const std::vector<int>& subrequestIndices, bool allowRedirect)
     {
-        const auto& request = RpcContext_->Request();
+        // Subrequests served via cache get their subresponses from cache entries; only
+        // the ones whose lookups are active are sent to master (to populate the cache).
+        std::vector<int> masterSubrequestIndices;
+        std::vector<int> cachedSubrequestIndices;
+        std::vector<TFuture<TObjectServiceCacheEntryPtr>> cacheEntryFutures;
+        THashMap<int, TObjectServiceCache::TCookie> activeCookies;
+        for (auto index : subrequestIndices) {
+            auto cookie = BeginCacheLookup(index);
+            if (!cookie) {
+                masterSubrequestIndices.push_back(index);
+                continue;
+            }
 
-        auto subrequestFilter = firstRun
-            ? [] (const TSubrequest& subrequest) { return !subrequest.PredictedSequoia; }
-            : [] (const TSubrequest& subrequest) { return subrequest.ForcedNonSequoia; };
+            cachedSubrequestIndices.push_back(index);
+            cacheEntryFutures.push_back(cookie->ExpiredEntry()
+                ? MakeFuture(cookie->ExpiredEntry())
+                : cookie->GetValue());
+            if (cookie->IsActive()) {
+                masterSubrequestIndices.push_back(index);
+                EmplaceOrCrash(activeCookies, index, std::move(*cookie));
+            }
+        }
 
-        std::vector<int> subrequestIndices;
-        for (int index = 0; index < std::ssize(Subrequests_); ++index) {
-            if (subrequestFilter(Subrequests_[index])) {
-                subrequestIndices.push_back(index);
+        std::vector<int> sequoiaSubrequestIndices;
+        auto handleSubresponse = [&] (int index, const TSharedRefArray& message, NHydra::TRevision revision) {
+            if (allowRedirect &&
+                CheckSubresponseError(message, NObjectClient::EErrorCode::RequestInvolvesSequoia))
+            {
+                sequoiaSubrequestIndices.push_back(index);
+                return;
+            }
+
+            AddSubresponse(index, message, revision);
+        };
+
+        if (!masterSubrequestIndices.empty()) {
+            auto rsp = ExecuteOnMaster(masterSubrequestIndices);
+            auto subresponses = ParseMasterSubresponses(*rsp, rsp->Attachments(), masterSubrequestIndices);
+            for (const auto& subresponse : subresponses) {
+                auto it = activeCookies.find(subresponse.SubrequestIndex);
+                if (it == activeCookies.end()) {
+                    handleSubresponse(subresponse.SubrequestIndex, subresponse.Message, subresponse.Revision);
+                } else {
+                    EndCacheLookup(std::move(it->second), subresponse.Message, subresponse.Revision);
+                    activeCookies.erase(it);
+                }
             }
         }
 
-        // Fast path.
-        if (subrequestIndices.empty()) {
-            return;
+        // Master has not replied to these subrequests; neither does Cypress proxy.
+        for (auto& [index, cookie] : activeCookies) {
+            cookie.Cancel(TError("Master has not replied to subrequest"));
+        }
+
+        auto cacheEntriesOrErrors = WaitFor(AllSet(std::move(cacheEntryFutures)))
+            .ValueOrThrow();
+        for (int cacheIndex = 0; cacheIndex < std::ssize(cachedSubrequestIndices); ++cacheIndex) {
+            const auto& cacheEntryOrError = cacheEntriesOrErrors[cacheIndex];
+            if (!cacheEntryOrError.IsOK()) {
+                continue;
+            }
+
+            const auto& cacheEntry = cacheEntryOrError.Value();
+            handleSubresponse(
+                cachedSubrequestIndices[cacheIndex],
+                cacheEntry->GetResponseMessage(),
+                cacheEntry->GetRevision());
         }
 
+        return sequoiaSubrequestIndices;
+    }
+
+    TObjectServiceProxy::TRspExecutePtr ExecuteOnMaster(const std::vector<int>& subrequestIndices)
+    {
+        const auto& request = RpcContext_->Request();
+
         auto req = MasterProxy_.Execute();
 
         // Copy request.
@@ -198,12 +277,11 @@ private:
         };
         copyHeaderExtension(NObjectClient::NProto::TMulticellSyncExt::multicell_sync_ext);
 
-        // Fill request with non-Sequoia requests.
+        // Fill request with the given subrequests only.
         req->clear_part_counts();
 
         for (auto index : subrequestIndices) {
-            const auto& subrequest = Subrequests_[index];
-            const auto& requestMessage = subrequest.RequestMessage;
+            const auto& requestMessage = SubrequestMessages_[index];
             req->add_part_counts(requestMessage.size());
             req->Attachments().insert(
                 req->Attachments().end(),
@@ -211,67 +289,113 @@ private:
                 requestMessage.End());
         }
 
-        auto rsp = WaitFor(req->Invoke())
+        return WaitFor(req->Invoke())
             .ValueOrThrow();
+    }
 
-        auto& response = RpcContext_->Response();
+    std::optional<TObjectServiceCache::TCookie> BeginCacheLookup(int index)
+    {
+        const auto& requestMessage = SubrequestMessages_[index];
 
-        int currentPartIndex = 0;
-        for (const auto& subresponseInfo : rsp->subresponses()) {
-            auto partCount = subresponseInfo.part_count();
-            TSharedRefArrayBuilder subresponseMessageBuilder(partCount);
-            auto partsRange = TRange<TSharedRef>(
-                rsp->Attachments().begin() + currentPartIndex,
-                rsp->Attachments().begin() + currentPartIndex + partCount);
-            currentPartIndex += partCount;
-            for (const auto& part : partsRange) {
-                subresponseMessageBuilder.Add(part);
-            }
-            auto subresponseMessage = subresponseMessageBuilder.Finish();
-            if (CheckSubresponseError(subresponseMessage, NObjectClient::EErrorCode::RequestInvolvesSequoia)) {
-                auto index = subresponseInfo.index();
-                Subrequests_[index].ForcedSequoia = true;
+        NRpc::NProto::TRequestHeader header;
+        if (!ParseRequestHeader(requestMessage, &header)) {
+            return std::nullopt;
+        }
+
+        auto options = GetSubrequestCachingOptions(
+            header,
+            requestMessage.Size(),
+            Owner_->GetDynamicConfig());
+        if (!options) {
+            return std::nullopt;
+        }
+
+        const auto& request = RpcContext_->Request();
+        auto suppressUpstreamSync = request.suppress_upstream_sync();
+        auto suppressTransactionCoordinatorSync = request.suppress_transaction_coordinator_sync();
+        const auto& requestHeader = RpcContext_->RequestHeader();
+        if (requestHeader.HasExtension(NObjectClient::NProto::TMulticellSyncExt::multicell_sync_ext)) {
+            const auto& multicellSyncExt = requestHeader.GetExtension(NObjectClient::NProto::TMulticellSyncExt::multicell_sync_ext);
+            suppressUpstreamSync |= multicellSyncExt.suppress_upstream_sync();
+            suppressTransactionCoordinatorSync |= multicellSyncExt.suppress_transaction_coordinator_sync();
+        }
+
+        const auto& ypathExt = header.GetExtension(NYTree::NProto::TYPathHeaderExt::ypath_header_ext);
+        TObjectServiceCacheKey key(
+            CellTag_,
+            options->DisablePerUserCache ? TString() : RpcContext_->GetAuthenticationIdentity().User,
+            ypathExt.target_path(),
+            header.service(),
+            header.method(),
+            requestMessage[1],
+            suppressUpstreamSync,
+            suppressTransactionCoordinatorSync);
+
+        return Owner_->Bootstrap_->GetObjectServiceCache()->BeginLookup(
+            RpcContext_->GetRequestId(),
+            key,
+            options->ExpireAfterSuccessfulUpdateTime,
+            options->ExpireAfterFailedUpdateTime,
+            options->SuccessStalenessBound,
+            options->RefreshRevision);
+    }
+
+    void EndCacheLookup(
+        TObjectServiceCache::TCookie cookie,
+        const TSharedRefArray& responseMessage,
+        NHydra::TRevision revision)
+    {
+        NRpc::NProto::TResponseHeader responseHeader;
+        if (!TryParseResponseHeader(responseMessage, &responseHeader)) {
+            cookie.Cancel(TError(NRpc::EErrorCode::ProtocolError, "Error parsing response header"));
+            return;
+        }
+
+        auto responseError = FromProto<TError>(responseHeader.error());
+        Owner_->Bootstrap_->GetObjectServiceCache()->EndLookup(
+            RpcContext_->GetRequestId(),
+            std::move(cookie),
+            responseMessage,
+            revision,
+            responseError.IsOK());
+    }
+
+    std::vector<int> InvokeSequoiaRequests(const std::vector<int>& subrequestIndices, bool allowRedirect)
+    {
+        const auto& sequoiaService = Owner_->Bootstrap_->GetSequoiaService();
+
+        std::vector<int> cypressSubrequestIndices;
+        for (auto index : subrequestIndices) {
+            auto rspFuture = ExecuteVerb(sequoiaService, SubrequestMessages_[index]);
+            auto rsp = WaitFor(rspFuture)
+                .ValueOrThrow();
+            if (allowRedirect &&
+                CheckSubresponseError(rsp, NObjectClient::EErrorCode::RequestInvolvesCypress))
+            {
+                cypressSubrequestIndices.push_back(index);
                 continue;
             }
 
-            response.add_subresponses()->CopyFrom(subresponseInfo);
-            response.Attachments().insert(
-                response.Attachments().end(),
-                partsRange.begin(),
-                partsRange.end());
+            AddSubresponse(index, rsp, NHydra::NullRevision);
         }
+
+        return cypressSubrequestIndices;
     }
 
-    void InvokeSequoiaRequests()
+    void AddSubresponse(int index, const TSharedRefArray& message, NHydra::TRevision revision)
     {
         auto& response = RpcContext_->Response();
 
-        for (int index = 0; index < std::ssize(Subrequests_); ++index) {
-            auto& subrequest = Subrequests_[index];
-            if (subrequest.PredictedSequoia || subrequest.ForcedSequoia) {
-                const auto& sequoiaService = Owner_->Bootstrap_->GetSequoiaService();
-                auto rspFuture = ExecuteVerb(sequoiaService, subrequest.RequestMessage);
-                auto rsp = WaitFor(rspFuture)
-                    .ValueOrThrow();
-                TSharedRefArrayBuilder messageBuilder(rsp.size());
-                for (const auto& part : rsp) {
-                    messageBuilder.Add(part);
-                }
-                auto message = messageBuilder.Finish();
-                if (CheckSubresponseError(message, NObjectClient::EErrorCode::RequestInvolvesCypress)) {
-                    Subrequests_[index].ForcedNonSequoia = true;
-                    continue;
-                }
-
-                auto* subresponseInfo = response.add_subresponses();
-                subresponseInfo->set_index(index);
-                subresponseInfo->set_part_count(rsp.size());
-                response.Attachments().insert(
-                    response.Attachments().end(),
-                    rsp.Begin(),
-                    rsp.End());
-            }
+        auto* subresponseInfo = response.add_subresponses();
+        subresponseInfo->set_index(index);
+        subresponseInfo->set_part_count(message.Size());
+        if (revision != NHydra::NullRevision) {
+            subresponseInfo->set_revision(revision);
         }
+        response.Attachments().insert(
+            response.Attachments().end(),
+            message.Begin(),
+            message.End());
     }
 
     void Reply(const TError& error = {})
@@ -328,6 +452,7 @@ DEFINE_RPC_SERVICE_METHOD(TObjectService, Execute)
     auto session = New<TObjectService::TExecuteSession>(
         MakeStrong(this),
         context,
+        cellTag,
         proxy);
     session->Run();
 }
@@ -10,6 +10,9 @@ DECLARE_REFCOUNTED_STRUCT(IObjectService)
 
 DECLARE_REFCOUNTED_CLASS(TDynamicConfigManager)
 
+DECLARE_REFCOUNTED_CLASS(TSequoiaResolveCacheEntry)
+DECLARE_REFCOUNTED_CLASS(TSequoiaResolveCache)
+
 ////////////////////////////////////////////////////////////////////////////////
 
 DECLARE_REFCOUNTED_CLASS(TObjectServiceDynamicConfig)
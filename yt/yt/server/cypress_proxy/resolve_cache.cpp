@@ -0,0 +1,57 @@
+#include "resolve_cache.h"
+
+#include "helpers.h"
+#include "private.h"
+
+namespace NYT::NCypressProxy {
+
+using namespace NCypressClient;
+using namespace NYPath;
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSequoiaResolveCacheEntry::TSequoiaResolveCacheEntry(TYPath path, TNodeId nodeId)
+    : TSyncCacheValueBase(std::move(path))
+    , NodeId_(nodeId)
+{ }
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSequoiaResolveCache::TSequoiaResolveCache(TSlruCacheConfigPtr config)
+    : TSyncSlruCacheBase(
+        std::move(config),
+        CypressProxyProfiler.WithPrefix("/resolve_cache"))
+{ }
+
+TSequoiaResolveCacheEntryPtr TSequoiaResolveCache::FindLongestPrefix(const TYPath& path)
+{
+    auto prefixes = GetPathPrefixes(path);
+    for (auto it = prefixes.rbegin(); it != prefixes.rend(); ++it) {
+        if (auto entry = Find(*it)) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+void TSequoiaResolveCache::Add(const TYPath& path, TNodeId nodeId)
+{
+    TSequoiaResolveCacheEntryPtr existingEntry;
+    auto entry = New<TSequoiaResolveCacheEntry>(path, nodeId);
+    if (!TryInsert(entry, &existingEntry) && existingEntry->GetNodeId() != nodeId) {
+        // Node was recreated at the same path.
+        TryRemove(existingEntry);
+        TryInsert(entry);
+    }
+}
+
+void TSequoiaResolveCache::InvalidatePrefixes(const TYPath& path)
+{
+    for (const auto& prefix : GetPathPrefixes(path)) {
+        TryRemove(prefix);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NCypressProxy
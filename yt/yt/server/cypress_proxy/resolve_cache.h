@@ -0,0 +1,55 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/client/cypress_client/public.h>
+
+#include <yt/yt/core/misc/sync_cache.h>
+
+#include <yt/yt/core/ypath/public.h>
+
+namespace NYT::NCypressProxy {
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TSequoiaResolveCacheEntry
+    : public TSyncCacheValueBase<NYPath::TYPath, TSequoiaResolveCacheEntry>
+{
+public:
+    TSequoiaResolveCacheEntry(NYPath::TYPath path, NCypressClient::TNodeId nodeId);
+
+    DEFINE_BYVAL_RO_PROPERTY(NCypressClient::TNodeId, NodeId);
+};
+
+DEFINE_REFCOUNTED_TYPE(TSequoiaResolveCacheEntry)
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Remembers paths of Sequoia nodes resolved by this proxy.
+/*!
+ *  The cache is used as a routing hint only: requests predicted to involve Sequoia
+ *  are resolved against the resolve table once again and are sent back to master
+ *  if they turn out to involve Cypress. Stale entries are dropped on such mispredictions.
+ *
+ *  Thread affinity: any
+ */
+class TSequoiaResolveCache
+    : public TSyncSlruCacheBase<NYPath::TYPath, TSequoiaResolveCacheEntry>
+{
+public:
+    explicit TSequoiaResolveCache(TSlruCacheConfigPtr config);
+
+    //! Returns the longest cached prefix of #path (or null if none is cached).
+    TSequoiaResolveCacheEntryPtr FindLongestPrefix(const NYPath::TYPath& path);
+
+    void Add(const NYPath::TYPath& path, NCypressClient::TNodeId nodeId);
+
+    //! Drops all cached prefixes of #path.
+    void InvalidatePrefixes(const NYPath::TYPath& path);
+};
+
+DEFINE_REFCOUNTED_TYPE(TSequoiaResolveCache)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NCypressProxy
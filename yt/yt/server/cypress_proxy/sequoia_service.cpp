@@ -3,6 +3,7 @@
 #include "bootstrap.h"
 #include "path_resolver.h"
 #include "private.h"
+#include "resolve_cache.h"
 
 #include <yt/yt/ytlib/api/native/connection.h>
 
@@ -72,15 +73,20 @@ DEFINE_YPATH_SERVICE_METHOD(TSequoiaService, Create)
     WaitFor(transaction->Start(/*options*/ {}))
         .ThrowOnError();
 
+    const auto& resolveCache = Bootstrap_->GetResolveCache();
+
     auto path = GetRequestTargetYPath(context->RequestHeader());
     auto resolveResult = ResolvePath(transaction, path);
     if (std::holds_alternative<TCypressResolveResult>(resolveResult)) {
+        // Request could have been routed here by a stale cache entry.
+        resolveCache->InvalidatePrefixes(path);
         THROW_ERROR_EXCEPTION(
             NObjectClient::EErrorCode::RequestInvolvesCypress,
             "Cypress request was passed to Sequoia");
     }
     YT_VERIFY(std::holds_alternative<TSequoiaResolveResult>(resolveResult));
     auto sequoiaResolveResult = std::get<TSequoiaResolveResult>(resolveResult);
+    resolveCache->Add(sequoiaResolveResult.ResolvedPrefix, sequoiaResolveResult.ResolvedPrefixNodeId);
 
     if (request->force()) {
         THROW_ERROR_EXCEPTION("Create with \"force\" flag is not supported in Sequoia");
@@ -183,6 +189,8 @@ DEFINE_YPATH_SERVICE_METHOD(TSequoiaService, Create)
     WaitFor(transaction->Commit(commitOptions))
         .ThrowOnError();
 
+    resolveCache->Add(childPath, childNodeId);
+
     ToProto(response->mutable_node_id(), childNodeId);
     response->set_cell_tag(cellTag);
     context->Reply();
@@ -0,0 +1,355 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/server/cypress_proxy/config.h>
+#include <yt/yt/server/cypress_proxy/helpers.h>
+
+#include <yt/yt/ytlib/object_client/config.h>
+#include <yt/yt/ytlib/object_client/object_service_cache.h>
+
+#include <yt/yt/core/misc/memory_usage_tracker.h>
+
+#include <yt/yt_proto/yt/core/ytree/proto/ypath.pb.h>
+
+namespace NYT::NCypressProxy {
+namespace {
+
+using namespace NObjectClient;
+using namespace NYPath;
+using namespace NYTree::NProto;
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(TGetPathPrefixesTest, Simple)
+{
+    EXPECT_EQ(
+        (std::vector<TYPath>{"//a", "//a/b", "//a/b/c"}),
+        GetPathPrefixes("//a/b/c"));
+    EXPECT_EQ(
+        (std::vector<TYPath>{"//a"}),
+        GetPathPrefixes("//a"));
+    EXPECT_EQ(
+        (std::vector<TYPath>{}),
+        GetPathPrefixes("/"));
+}
+
+TEST(TGetPathPrefixesTest, StopsAtNonLiteral)
+{
+    EXPECT_EQ(
+        (std::vector<TYPath>{"//a", "//a/b"}),
+        GetPathPrefixes("//a/b/@attr"));
+    EXPECT_EQ(
+        (std::vector<TYPath>{"//a"}),
+        GetPathPrefixes("//a&/b"));
+}
+
+TEST(TGetPathPrefixesTest, NotRooted)
+{
+    EXPECT_TRUE(GetPathPrefixes("").empty());
+    EXPECT_TRUE(GetPathPrefixes("a/b").empty());
+    EXPECT_TRUE(GetPathPrefixes("#1-2-3-4/a").empty());
+}
+
+TEST(TGetPathPrefixesTest, Malformed)
+{
+    EXPECT_TRUE(GetPathPrefixes("//a/b\\").empty());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSharedRef MakePart(TStringBuf data)
+{
+    return TSharedRef::FromString(TString(data));
+}
+
+void AddSubresponse(NProto::TRspExecute* response, int index, int partCount, NHydra::TRevision revision)
+{
+    auto* subresponse = response->add_subresponses();
+    subresponse->set_index(index);
+    subresponse->set_part_count(partCount);
+    subresponse->set_revision(revision);
+}
+
+TEST(TParseMasterSubresponsesTest, IndexesAreMappedToOriginalBatch)
+{
+    // Subrequests 0 and 2 of the original batch have been routed elsewhere.
+    std::vector<int> subrequestIndices{1, 3, 4};
+
+    // Master may reply to the subbatch out of order and omit some subresponses.
+    NProto::TRspExecute response;
+    AddSubresponse(&response, /*index*/ 2, /*partCount*/ 2, /*revision*/ 20);
+    AddSubresponse(&response, /*index*/ 0, /*partCount*/ 1, /*revision*/ 10);
+    std::vector<TSharedRef> attachments{MakePart("a"), MakePart("b"), MakePart("c")};
+
+    auto subresponses = ParseMasterSubresponses(response, attachments, subrequestIndices);
+    ASSERT_EQ(2, std::ssize(subresponses));
+
+    EXPECT_EQ(4, subresponses[0].SubrequestIndex);
+    EXPECT_EQ(20u, subresponses[0].Revision);
+    ASSERT_EQ(2u, subresponses[0].Message.Size());
+    EXPECT_EQ("a", subresponses[0].Message[0].ToStringBuf());
+    EXPECT_EQ("b", subresponses[0].Message[1].ToStringBuf());
+
+    EXPECT_EQ(1, subresponses[1].SubrequestIndex);
+    EXPECT_EQ(10u, subresponses[1].Revision);
+    ASSERT_EQ(1u, subresponses[1].Message.Size());
+    EXPECT_EQ("c", subresponses[1].Message[0].ToStringBuf());
+}
+
+TEST(TParseMasterSubresponsesTest, InvalidIndex)
+{
+    std::vector<int> subrequestIndices{1, 3};
+
+    NProto::TRspExecute response;
+    AddSubresponse(&response, /*index*/ 2, /*partCount*/ 1, /*revision*/ 0);
+    std::vector<TSharedRef> attachments{MakePart("a")};
+
+    EXPECT_THROW_WITH_SUBSTRING(
+        ParseMasterSubresponses(response, attachments, subrequestIndices),
+        "invalid index");
+}
+
+TEST(TParseMasterSubresponsesTest, MissingAttachments)
+{
+    std::vector<int> subrequestIndices{0};
+
+    NProto::TRspExecute response;
+    AddSubresponse(&response, /*index*/ 0, /*partCount*/ 2, /*revision*/ 0);
+    std::vector<TSharedRef> attachments{MakePart("a")};
+
+    EXPECT_THROW_WITH_SUBSTRING(
+        ParseMasterSubresponses(response, attachments, subrequestIndices),
+        "too few attachments");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TExecuteSubrequestsTest
+    : public ::testing::Test
+{
+protected:
+    //! Subrequests to be rejected by master (resp. Sequoia) when redirects are allowed.
+    THashSet<int> SequoiaSubrequestIndices_;
+    THashSet<int> CypressSubrequestIndices_;
+
+    //! Subbatches in order of execution, e.g. "M[0,1]" or "S[2]".
+    std::vector<TString> Log_;
+    //! Indices of subrequests that got subresponses, in order.
+    std::vector<int> RepliedIndices_;
+
+    void Execute(const std::vector<bool>& predictedSequoia)
+    {
+        ExecuteSubrequests(
+            predictedSequoia,
+            [&] (const std::vector<int>& subrequestIndices, bool allowRedirect) {
+                return Invoke("M", SequoiaSubrequestIndices_, subrequestIndices, allowRedirect);
+            },
+            [&] (const std::vector<int>& subrequestIndices, bool allowRedirect) {
+                return Invoke("S", CypressSubrequestIndices_, subrequestIndices, allowRedirect);
+            });
+    }
+
+private:
+    std::vector<int> Invoke(
+        TStringBuf destination,
+        const THashSet<int>& rejectedIndices,
+        const std::vector<int>& subrequestIndices,
+        bool allowRedirect)
+    {
+        Log_.push_back(Format("%v%v", destination, subrequestIndices));
+
+        std::vector<int> redirectedIndices;
+        for (auto index : subrequestIndices) {
+            if (allowRedirect && rejectedIndices.contains(index)) {
+                redirectedIndices.push_back(index);
+            } else {
+                RepliedIndices_.push_back(index);
+            }
+        }
+        return redirectedIndices;
+    }
+};
+
+TEST_F(TExecuteSubrequestsTest, MasterOnly)
+{
+    Execute({false, false, false});
+
+    EXPECT_EQ((std::vector<TString>{"M[0, 1, 2]"}), Log_);
+    EXPECT_EQ((std::vector<int>{0, 1, 2}), RepliedIndices_);
+}
+
+TEST_F(TExecuteSubrequestsTest, BatchOrderIsPreserved)
+{
+    Execute({false, false, true, false, true, true});
+
+    EXPECT_EQ((std::vector<TString>{"M[0, 1]", "S[2]", "M[3]", "S[4]", "S[5]"}), Log_);
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5}), RepliedIndices_);
+}
+
+TEST_F(TExecuteSubrequestsTest, MispredictionFallsBackToMaster)
+{
+    CypressSubrequestIndices_ = {1};
+
+    Execute({false, true, true, false});
+
+    EXPECT_EQ((std::vector<TString>{"M[0]", "S[1]", "M[1]", "S[2]", "M[3]"}), Log_);
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), RepliedIndices_);
+}
+
+TEST_F(TExecuteSubrequestsTest, MasterRedirectsToSequoia)
+{
+    SequoiaSubrequestIndices_ = {1};
+
+    Execute({false, false, false, true});
+
+    EXPECT_EQ((std::vector<TString>{"M[0, 1, 2]", "S[1]", "S[3]"}), Log_);
+    EXPECT_EQ((std::vector<int>{0, 2, 1, 3}), RepliedIndices_);
+}
+
+TEST_F(TExecuteSubrequestsTest, NoRedirectLoop)
+{
+    // Both sides consider subrequests to belong to the other one.
+    SequoiaSubrequestIndices_ = {0, 1};
+    CypressSubrequestIndices_ = {0, 1};
+
+    Execute({true, false});
+
+    EXPECT_EQ((std::vector<TString>{"S[0]", "M[0]", "M[1]", "S[1]"}), Log_);
+    EXPECT_EQ((std::vector<int>{0, 1}), RepliedIndices_);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TSubrequestCachingTest
+    : public ::testing::Test
+{
+protected:
+    const TObjectServiceDynamicConfigPtr Config_ = New<TObjectServiceDynamicConfig>();
+
+    void SetUp() override
+    {
+        Config_->EnableCache = true;
+    }
+
+    static NRpc::NProto::TRequestHeader MakeHeader(
+        const TString& method,
+        const TYPath& path,
+        bool mutating = false)
+    {
+        NRpc::NProto::TRequestHeader header;
+        header.set_service("Node");
+        header.set_method(method);
+        auto* ypathExt = header.MutableExtension(TYPathHeaderExt::ypath_header_ext);
+        ypathExt->set_target_path(path);
+        ypathExt->set_mutating(mutating);
+        return header;
+    }
+
+    static NRpc::NProto::TRequestHeader MakeCachingHeader(
+        const TString& method,
+        const TYPath& path,
+        bool mutating = false)
+    {
+        auto header = MakeHeader(method, path, mutating);
+        auto* cachingHeaderExt = header.MutableExtension(TCachingHeaderExt::caching_header_ext);
+        cachingHeaderExt->set_expire_after_successful_update_time(ToProto<i64>(TDuration::Seconds(10)));
+        cachingHeaderExt->set_expire_after_failed_update_time(ToProto<i64>(TDuration::Seconds(20)));
+        cachingHeaderExt->set_success_staleness_bound(ToProto<i64>(TDuration::Seconds(30)));
+        cachingHeaderExt->set_refresh_revision(100);
+        cachingHeaderExt->set_disable_per_user_cache(true);
+        return header;
+    }
+
+    std::optional<TSubrequestCachingOptions> GetOptions(
+        const NRpc::NProto::TRequestHeader& header,
+        int partCount = 2)
+    {
+        return GetSubrequestCachingOptions(header, partCount, Config_);
+    }
+};
+
+TEST_F(TSubrequestCachingTest, CachingHeader)
+{
+    auto options = GetOptions(MakeCachingHeader("Get", "//t/@schema"));
+    ASSERT_TRUE(options);
+    EXPECT_EQ(TDuration::Seconds(10), options->ExpireAfterSuccessfulUpdateTime);
+    EXPECT_EQ(TDuration::Seconds(20), options->ExpireAfterFailedUpdateTime);
+    EXPECT_EQ(TDuration::Seconds(30), options->SuccessStalenessBound);
+    EXPECT_EQ(100u, options->RefreshRevision);
+    EXPECT_TRUE(options->DisablePerUserCache);
+}
+
+TEST_F(TSubrequestCachingTest, NoCachingHeader)
+{
+    // Reads not opted in for caching must observe preceding writes.
+    EXPECT_FALSE(GetOptions(MakeHeader("Get", "//t/@schema")));
+    EXPECT_FALSE(GetOptions(MakeHeader("Get", "//t/@revision")));
+}
+
+TEST_F(TSubrequestCachingTest, NotCached)
+{
+    EXPECT_FALSE(GetOptions(MakeCachingHeader("Get", "//t/@schema"), /*partCount*/ 3));
+    EXPECT_FALSE(GetOptions(MakeCachingHeader("Set", "//t/@schema", /*mutating*/ true)));
+
+    Config_->EnableCache = false;
+    EXPECT_FALSE(GetOptions(MakeCachingHeader("Get", "//t/@schema")));
+}
+
+TEST(TObjectServiceCacheTest, IdenticalReadsAreCoalesced)
+{
+    auto cache = New<TObjectServiceCache>(
+        New<TObjectServiceCacheConfig>(),
+        GetNullMemoryUsageTracker(),
+        NLogging::TLogger("Test"),
+        NProfiling::TProfiler());
+
+    TObjectServiceCacheKey key(
+        /*cellTag*/ TCellTag(1),
+        /*user*/ "user",
+        /*path*/ "//t/@schema",
+        /*service*/ "Node",
+        /*method*/ "Get",
+        /*requestBody*/ MakePart("body"),
+        /*suppressUpstreamSync*/ false,
+        /*suppressTransactionCoordinatorSync*/ false);
+
+    auto lookup = [&] (NHydra::TRevision refreshRevision = NHydra::NullRevision) {
+        return cache->BeginLookup(
+            NRpc::TRequestId::Create(),
+            key,
+            /*expireAfterSuccessfulUpdateTime*/ TDuration::Hours(1),
+            /*expireAfterFailedUpdateTime*/ TDuration::Hours(1),
+            /*successStalenessBound*/ TDuration::Zero(),
+            refreshRevision);
+    };
+
+    auto firstCookie = lookup();
+    ASSERT_TRUE(firstCookie.IsActive());
+
+    // The second read waits for the first one rather than going to master.
+    auto secondCookie = lookup();
+    EXPECT_FALSE(secondCookie.IsActive());
+    auto valueFuture = secondCookie.GetValue();
+    EXPECT_FALSE(valueFuture.IsSet());
+
+    auto responseMessage = TSharedRefArray(MakePart("response"));
+    cache->EndLookup(
+        NRpc::TRequestId::Create(),
+        std::move(firstCookie),
+        responseMessage,
+        /*revision*/ 10,
+        /*success*/ true);
+
+    ASSERT_TRUE(valueFuture.IsSet());
+    const auto& entry = valueFuture.Get().ValueOrThrow();
+    EXPECT_EQ(10u, entry->GetRevision());
+    EXPECT_EQ("response", entry->GetResponseMessage()[0].ToStringBuf());
+
+    // Subsequent reads are served from cache until the entry is older than the refresh revision.
+    EXPECT_FALSE(lookup(/*refreshRevision*/ 5).IsActive());
+    EXPECT_TRUE(lookup(/*refreshRevision*/ 10).IsActive());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NCypressProxy
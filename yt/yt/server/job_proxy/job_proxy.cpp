@@ -58,6 +58,8 @@
 
 #include <yt/yt/client/table_client/column_rename_descriptor.h>
 
+#include <yt/yt/core/bus/shm/server.h>
+
 #include <yt/yt/core/bus/tcp/client.h>
 #include <yt/yt/core/bus/tcp/server.h>
 
@@ -525,6 +527,12 @@ void TJobProxy::DoRun()
         YT_LOG_ERROR_UNLESS(error.IsOK(), error, "Error stopping RPC server");
     }
 
+    if (ShmRpcServer_) {
+        auto error = WaitFor(ShmRpcServer_->Stop()
+            .WithTimeout(RpcServerShutdownTimeout));
+        YT_LOG_ERROR_UNLESS(error.IsOK(), error, "Error stopping shared memory RPC server");
+    }
+
     FillJobResult(&result);
     FillStderrResult(&result);
     ReportResult(
@@ -657,6 +665,12 @@ TJobResult TJobProxy::RunJob()
         RpcServer_->RegisterService(CreateJobProberService(this, GetControlInvoker()));
         RpcServer_->Start();
 
+        if (Config_->ShmBusServer) {
+            ShmRpcServer_ = NRpc::NBus::CreateBusServer(CreateShmBusServer(Config_->ShmBusServer));
+            ShmRpcServer_->RegisterService(CreateJobProberService(this, GetControlInvoker()));
+            ShmRpcServer_->Start();
+        }
+
         if (TvmBridge_) {
             YT_LOG_DEBUG("Ensuring destination service id (ServiceId: %v)", TvmBridge_->GetSelfTvmId());
 
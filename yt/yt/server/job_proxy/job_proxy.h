@@ -125,6 +125,8 @@ private:
     NNodeTrackerClient::TNodeDescriptor LocalDescriptor_;
 
     NRpc::IServerPtr RpcServer_;
+    //! Serves job probing over a shared memory bus, if enabled.
+    NRpc::IServerPtr ShmRpcServer_;
 
     std::unique_ptr<NExecNode::TSupervisorServiceProxy> SupervisorProxy_;
 
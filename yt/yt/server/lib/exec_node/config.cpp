@@ -510,6 +510,9 @@ void TExecNodeConfig::Register(TRegistrar registrar)
     registrar.Parameter("job_proxy_send_heartbeat_before_abort", &TThis::JobProxySendHeartbeatBeforeAbort)
         .Default(false);
 
+    registrar.Parameter("use_shm_bus_for_job_proxy", &TThis::UseShmBusForJobProxy)
+        .Default(false);
+
     registrar.Parameter("test_root_fs", &TThis::TestRootFS)
         .Default(false);
 
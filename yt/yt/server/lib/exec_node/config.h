@@ -439,6 +439,10 @@ public:
 
     bool JobProxySendHeartbeatBeforeAbort;
 
+    //! If set, exec node probes its job proxies over a shared memory bus
+    //! instead of a Unix domain socket.
+    bool UseShmBusForJobProxy;
+
     //! This is a special testing option.
     //! Instead of actually setting root fs, it just provides special environment variable.
     bool TestRootFS;
@@ -10,6 +10,7 @@
 #include <yt/yt/server/lib/hydra_common/changelog.h>
 #include <yt/yt/server/lib/hydra_common/config.h>
 #include <yt/yt/server/lib/hydra_common/local_snapshot_store.h>
+#include <yt/yt/server/lib/hydra_common/recovery_helpers.h>
 #include <yt/yt/server/lib/hydra_common/snapshot.h>
 
 #include <yt/yt/ytlib/election/cell_manager.h>
@@ -119,43 +120,12 @@ void TRecoveryBase::RecoverToVersion(TVersion targetVersion)
 
         YT_VERIFY(snapshotId != InvalidSegmentId);
 
-        auto createAndOpenReaderOrThrow = [&] {
-            auto reader = SnapshotStore_->CreateReader(snapshotId);
-            WaitFor(reader->Open())
-                .ThrowOnError();
-            return reader;
-        };
-
-        ISnapshotReaderPtr snapshotReader;
-        try {
-            snapshotReader = createAndOpenReaderOrThrow();
-        } catch (const TErrorException& ex) {
-            if (ex.Error().FindMatching(EErrorCode::NoSuchSnapshot)) {
-                if (auto legacySnapshotStore = DynamicPointerCast<ILegacySnapshotStore>(SnapshotStore_)) {
-                    YT_LOG_INFO(ex, "Snapshot is missing; attempting to download (SnapshotId: %v)",
-                        snapshotId);
-                    WaitFor(DownloadSnapshot(
-                        Config_,
-                        epochContext->CellManager,
-                        std::move(legacySnapshotStore),
-                        snapshotId,
-                        Logger))
-                        .ThrowOnError();
-                    snapshotReader = createAndOpenReaderOrThrow();
-                } else {
-                    // Snapshot downloading is not supported by remote snapshot store in old Hydra.
-                    YT_LOG_INFO(ex, "Snapshot is missing, and downloading is not supported (SnapshotId: %v)", snapshotId);
-                    throw;
-                }
-            } else {
-                YT_LOG_INFO(ex, "Failed to open snapshot (SnapshotId: %v)", snapshotId);
-                throw;
-            }
-        } catch (const std::exception& ex) {
-            YT_LOG_INFO(ex, "Failed to open snapshot (SnapshotId: %v)", snapshotId);
-            throw;
+        if (!IsLeader() && Options_.WriteChangelogsAtFollowers && Config_->MaxConcurrentChangelogPrefetches > 0) {
+            StartChangelogPrefetch(snapshotId, targetVersion.SegmentId);
         }
 
+        auto snapshotReader = OpenSnapshotReaderOrThrow(snapshotId);
+
         auto meta = snapshotReader->GetParams().Meta;
         auto randomSeed = meta.random_seed();
         auto sequenceNumber = meta.sequence_number();
@@ -195,6 +165,8 @@ void TRecoveryBase::RecoverToVersion(TVersion targetVersion)
     IChangelogPtr targetChangelog;
     int changelogId = initialChangelogId;
     while (changelogId <= targetVersion.SegmentId) {
+        WaitForChangelogPrefetch(changelogId);
+
         YT_LOG_INFO("Opening changelog (ChangelogId: %v)",
             changelogId);
 
@@ -248,10 +220,137 @@ void TRecoveryBase::RecoverToVersion(TVersion targetVersion)
     DecoratedAutomaton_->SetLoggedVersion(targetVersion);
 }
 
-void TRecoveryBase::SyncChangelog(IChangelogPtr changelog, int changelogId)
+ISnapshotReaderPtr TRecoveryBase::OpenSnapshotReaderOrThrow(int snapshotId)
+{
+    VERIFY_THREAD_AFFINITY(AutomatonThread);
+
+    auto createAndOpenReaderOrThrow = [&] {
+        auto reader = SnapshotStore_->CreateReader(snapshotId);
+        WaitFor(reader->Open())
+            .ThrowOnError();
+        return reader;
+    };
+
+    try {
+        return createAndOpenReaderOrThrow();
+    } catch (const TErrorException& ex) {
+        if (ex.Error().FindMatching(EErrorCode::NoSuchSnapshot)) {
+            if (auto legacySnapshotStore = DynamicPointerCast<ILegacySnapshotStore>(SnapshotStore_)) {
+                YT_LOG_INFO(ex, "Snapshot is missing; attempting to download (SnapshotId: %v)",
+                    snapshotId);
+                WaitFor(DownloadSnapshot(
+                    Config_,
+                    EpochContext_->CellManager,
+                    std::move(legacySnapshotStore),
+                    snapshotId,
+                    Logger))
+                    .ThrowOnError();
+                return createAndOpenReaderOrThrow();
+            } else {
+                // Snapshot downloading is not supported by remote snapshot store in old Hydra.
+                YT_LOG_INFO(ex, "Snapshot is missing, and downloading is not supported (SnapshotId: %v)", snapshotId);
+                throw;
+            }
+        } else {
+            YT_LOG_INFO(ex, "Failed to open snapshot (SnapshotId: %v)", snapshotId);
+            throw;
+        }
+    } catch (const std::exception& ex) {
+        YT_LOG_INFO(ex, "Failed to open snapshot (SnapshotId: %v)", snapshotId);
+        throw;
+    }
+}
+
+void TRecoveryBase::StartChangelogPrefetch(int firstChangelogId, int lastChangelogId)
+{
+    VERIFY_THREAD_AFFINITY(AutomatonThread);
+
+    if (firstChangelogId > lastChangelogId) {
+        return;
+    }
+
+    YT_LOG_INFO("Starting changelog prefetch (ChangelogIds: %v-%v)",
+        firstChangelogId,
+        lastChangelogId);
+
+    // NB: The automaton thread is busy loading the snapshot, hence prefetching runs elsewhere.
+    auto invoker = EpochContext_->CancelableContext->CreateInvoker(GetHydraIOInvoker());
+    ChangelogPrefetcher_ = New<TChangelogPrefetcher>(
+        firstChangelogId,
+        lastChangelogId,
+        Config_->MaxConcurrentChangelogPrefetches,
+        BIND([this, this_ = MakeStrong(this), epochContext = MakeStrong(EpochContext_)] (int changelogId) {
+            PrefetchChangelog(changelogId);
+        })
+            .AsyncVia(invoker),
+        invoker);
+    ChangelogPrefetcher_->Start();
+}
+
+void TRecoveryBase::PrefetchChangelog(int changelogId)
+{
+    VERIFY_THREAD_AFFINITY_ANY();
+
+    auto syncRecordCount = GetChangelogSyncRecordCount(
+        changelogId,
+        LookupLeaderChangelogRecordCount(changelogId));
+
+    auto changelog = WaitFor(ChangelogStore_->TryOpenChangelog(changelogId))
+        .ValueOrThrow();
+    if (!changelog) {
+        changelog = WaitFor(ChangelogStore_->CreateChangelog(changelogId, /*meta*/ {}))
+            .ValueOrThrow();
+    }
+
+    // NB: Truncation, if needed, is left to #SyncChangelog.
+    if (changelog->GetRecordCount() >= syncRecordCount) {
+        return;
+    }
+
+    WaitFor(DownloadChangelog(
+        Config_,
+        EpochContext_->CellManager,
+        ChangelogStore_,
+        changelogId,
+        syncRecordCount))
+        .ThrowOnError();
+
+    YT_LOG_INFO("Changelog prefetched (ChangelogId: %v, RecordCount: %v)",
+        changelogId,
+        syncRecordCount);
+}
+
+void TRecoveryBase::WaitForChangelogPrefetch(int changelogId)
 {
     VERIFY_THREAD_AFFINITY(AutomatonThread);
 
+    if (!ChangelogPrefetcher_) {
+        return;
+    }
+
+    auto future = ChangelogPrefetcher_->ExtractPrefetchResult(changelogId);
+    if (!future) {
+        return;
+    }
+
+    // NB: Failed prefetch is not fatal as the changelog is synced anyway.
+    auto error = WaitFor(future);
+    YT_LOG_WARNING_UNLESS(error.IsOK(), error, "Error prefetching changelog (ChangelogId: %v)",
+        changelogId);
+}
+
+int TRecoveryBase::GetChangelogSyncRecordCount(int changelogId, int remoteRecordCount) const
+{
+    // NB: Don't download records past the sync point since they are expected to be postponed.
+    return changelogId == SyncVersion_.SegmentId
+        ? SyncVersion_.RecordId
+        : remoteRecordCount;
+}
+
+int TRecoveryBase::LookupLeaderChangelogRecordCount(int changelogId)
+{
+    VERIFY_THREAD_AFFINITY_ANY();
+
     auto channel = EpochContext_->CellManager->GetPeerChannel(EpochContext_->LeaderId);
     YT_VERIFY(channel);
 
@@ -264,14 +363,16 @@ void TRecoveryBase::SyncChangelog(IChangelogPtr changelog, int changelogId)
     auto rspOrError = WaitFor(req->Invoke());
     THROW_ERROR_EXCEPTION_IF_FAILED(rspOrError, "Error getting changelog %v info from leader",
         changelogId);
-    const auto& rsp = rspOrError.Value();
+    return rspOrError.Value()->record_count();
+}
 
-    int remoteRecordCount = rsp->record_count();
+void TRecoveryBase::SyncChangelog(IChangelogPtr changelog, int changelogId)
+{
+    VERIFY_THREAD_AFFINITY(AutomatonThread);
+
+    int remoteRecordCount = LookupLeaderChangelogRecordCount(changelogId);
     int localRecordCount = changelog->GetRecordCount();
-    // NB: Don't download records past the sync point since they are expected to be postponed.
-    int syncRecordCount = changelogId == SyncVersion_.SegmentId
-        ? SyncVersion_.RecordId
-        : remoteRecordCount;
+    int syncRecordCount = GetChangelogSyncRecordCount(changelogId, remoteRecordCount);
 
     YT_LOG_INFO("Syncing changelog %v: local %v, remote %v, sync %v",
         changelogId,
@@ -60,6 +60,23 @@ protected:
     DECLARE_THREAD_AFFINITY_SLOT(AutomatonThread);
 
 private:
+    //! Prefetches changelogs that are yet to be replayed; null if prefetching is off.
+    TChangelogPrefetcherPtr ChangelogPrefetcher_;
+
+    //! Opens the local snapshot reader, downloading the snapshot from other peers
+    //! if it is missing.
+    ISnapshotReaderPtr OpenSnapshotReaderOrThrow(int snapshotId);
+
+    //! Starts downloading missing records of changelogs in a given range in background
+    //! so that this overlaps with downloading and loading the snapshot.
+    void StartChangelogPrefetch(int firstChangelogId, int lastChangelogId);
+    void PrefetchChangelog(int changelogId);
+    void WaitForChangelogPrefetch(int changelogId);
+
+    //! Returns the number of records a given changelog is to have after being synced with the leader.
+    int GetChangelogSyncRecordCount(int changelogId, int remoteRecordCount) const;
+    int LookupLeaderChangelogRecordCount(int changelogId);
+
     //! Synchronizes the changelog at follower with the leader, i.e.
     //! downloads missing records or truncates redundant ones.
     void SyncChangelog(IChangelogPtr changelog, int changelogId);
@@ -4,13 +4,17 @@
 #include "snapshot_service_proxy.h"
 
 #include <yt/yt/server/lib/hydra_common/config.h>
+#include <yt/yt/server/lib/hydra_common/format.h>
 #include <yt/yt/server/lib/hydra_common/local_snapshot_store.h>
+#include <yt/yt/server/lib/hydra_common/recovery_helpers.h>
 #include <yt/yt/server/lib/hydra_common/snapshot.h>
 
 #include <yt/yt/ytlib/election/cell_manager.h>
 
 #include <yt/yt/core/concurrency/scheduler.h>
 
+#include <deque>
+
 namespace NYT::NHydra {
 
 using namespace NElection;
@@ -49,34 +53,88 @@ void DoDownloadSnapshot(
         TSnapshotServiceProxy proxy(cellManager->GetPeerChannel(params.PeerId));
         proxy.SetDefaultTimeout(config->SnapshotDownloadRpcTimeout);
 
-        i64 downloadedLength = 0;
-        while (downloadedLength < params.CompressedLength) {
+        auto requestBlock = [&] (i64 offset, i64 length) {
             auto req = proxy.ReadSnapshot();
             req->set_snapshot_id(snapshotId);
-            req->set_offset(downloadedLength);
-            i64 desiredBlockSize = std::min(
-                config->SnapshotDownloadBlockSize,
-                params.CompressedLength - downloadedLength);
-            req->set_length(desiredBlockSize);
+            req->set_offset(offset);
+            req->set_length(length);
+            return req->Invoke();
+        };
+
+        // Keep several blocks in flight so that the transfer of the next ones
+        // overlaps with writing and verifying the ones already received.
+        int windowBlockCount = std::max<i64>(config->SnapshotDownloadWindowSize / config->SnapshotDownloadBlockSize, 1);
+
+        struct TInFlightBlock
+        {
+            i64 Offset;
+            i64 Length;
+            TFuture<TSnapshotServiceProxy::TRspReadSnapshotPtr> AsyncRsp;
+        };
+        std::deque<TInFlightBlock> inFlightBlocks;
+
+        i64 requestedLength = 0;
+        auto requestMoreBlocks = [&] {
+            while (std::ssize(inFlightBlocks) < windowBlockCount && requestedLength < params.CompressedLength) {
+                i64 length = std::min(
+                    config->SnapshotDownloadBlockSize,
+                    params.CompressedLength - requestedLength);
+                inFlightBlocks.push_back({requestedLength, length, requestBlock(requestedLength, length)});
+                requestedLength += length;
+            }
+        };
+
+        TSnapshotChecksumVerifier checksumVerifier;
 
-            auto rspOrError = WaitFor(req->Invoke());
+        i64 downloadedLength = 0;
+        requestMoreBlocks();
+        while (!inFlightBlocks.empty()) {
+            auto inFlightBlock = std::move(inFlightBlocks.front());
+            inFlightBlocks.pop_front();
+
+            auto rspOrError = WaitFor(inFlightBlock.AsyncRsp);
             THROW_ERROR_EXCEPTION_IF_FAILED(rspOrError, "Error downloading snapshot");
-            const auto& rsp = rspOrError.Value();
 
-            const auto& attachments = rsp->Attachments();
-            YT_VERIFY(attachments.size() == 1);
+            requestMoreBlocks();
+
+            auto rsp = rspOrError.Value();
+            while (true) {
+                const auto& attachments = rsp->Attachments();
+                YT_VERIFY(attachments.size() == 1);
 
-            const auto& block = attachments[0];
-            YT_LOG_DEBUG("Snapshot block received (Offset: %v, Size: %v)",
-                downloadedLength,
-                block.Size());
+                const auto& block = attachments[0];
+                YT_LOG_DEBUG("Snapshot block received (Offset: %v, Size: %v)",
+                    downloadedLength,
+                    block.Size());
 
-            WaitFor(writer->Write(block))
-                .ThrowOnError();
+                if (block.Empty()) {
+                    THROW_ERROR_EXCEPTION("Peer %v returned an empty snapshot block at offset %v",
+                        params.PeerId,
+                        downloadedLength);
+                }
 
-            downloadedLength += block.Size();
+                checksumVerifier.Append(block);
+
+                WaitFor(writer->Write(block))
+                    .ThrowOnError();
+
+                downloadedLength += block.Size();
+
+                // Short reads are possible; fetch the rest of the block before moving on.
+                i64 blockEndOffset = inFlightBlock.Offset + inFlightBlock.Length;
+                if (downloadedLength == blockEndOffset) {
+                    break;
+                }
+                YT_VERIFY(downloadedLength < blockEndOffset);
+
+                auto remainingRspOrError = WaitFor(requestBlock(downloadedLength, blockEndOffset - downloadedLength));
+                THROW_ERROR_EXCEPTION_IF_FAILED(remainingRspOrError, "Error downloading snapshot");
+                rsp = remainingRspOrError.Value();
+            }
         }
 
+        checksumVerifier.Verify();
+
         WaitFor(writer->Close())
             .ThrowOnError();
 
@@ -2,6 +2,7 @@
 
 #include "public.h"
 
+#include <yt/yt/core/actions/callback.h>
 #include <yt/yt/core/actions/future.h>
 
 #include <yt/yt/core/concurrency/public.h>
@@ -10,6 +11,11 @@ namespace NYT::NHydra {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+//! Opens the snapshot with a given id for reading.
+using TSnapshotReaderFactory = TCallback<NConcurrency::IAsyncZeroCopyInputStreamPtr(int snapshotId)>;
+
+////////////////////////////////////////////////////////////////////////////////
+
 //! An abstract automaton replicated via Hydra.
 struct IAutomaton
     : public virtual TRefCounted
@@ -18,10 +24,31 @@ struct IAutomaton
     //! the asynchronous phase. Returns an async flag indicating completion of the latter.
     virtual TFuture<void> SaveSnapshot(NConcurrency::IAsyncOutputStreamPtr writer) = 0;
 
+    //! Returns |true| if the automaton is able to save delta snapshots.
+    virtual bool SupportsDeltaSnapshots() = 0;
+
+    //! Same as #SaveSnapshot but only saves the changes made since the state was captured
+    //! for the snapshot #baseSnapshotId (see #OnSnapshotCaptured).
+    virtual TFuture<void> SaveDeltaSnapshot(
+        NConcurrency::IAsyncOutputStreamPtr writer,
+        int baseSnapshotId) = 0;
+
+    //! Called in the automaton thread once the state has been captured for a snapshot
+    //! (i.e. the synchronous phase of #SaveSnapshot is over); starts tracking changes
+    //! for the next delta snapshot.
+    virtual void OnSnapshotCaptured() = 0;
+
     //! Synchronously loads a snapshot.
     //! It is guaranteed that the instance is cleared (via #Clear) prior to this call.
+    /*!
+     *  Delta snapshots are loaded on top of their base ones, which are opened
+     *  via the factory installed with #SetSnapshotReaderFactory.
+     */
     virtual void LoadSnapshot(NConcurrency::IAsyncZeroCopyInputStreamPtr reader) = 0;
 
+    //! Sets the factory used to open base snapshots while loading delta ones.
+    virtual void SetSnapshotReaderFactory(TSnapshotReaderFactory factory) = 0;
+
     //! Synchronously prepares an automaton state for further mutation processing
     //! in a determenistic way.
     //! During automaton preparation hydra context is set while mutation context is not.
@@ -31,6 +31,10 @@ static const size_t SnapshotLoadBufferSize = 64_KB;
 static const size_t SnapshotSaveBufferSize = 64_KB;
 static const size_t SnapshotPrefetchWindowSize = 64_MB;
 
+//! Written in place of the part count to denote a delta snapshot;
+//! followed by the id of the base snapshot.
+static constexpr i32 DeltaSnapshotMarker = -1;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TCompositeAutomatonPart::TCompositeAutomatonPart(TTestingTag)
@@ -139,6 +143,14 @@ void TCompositeAutomatonPart::OnBeforeSnapshotLoaded()
 void TCompositeAutomatonPart::OnAfterSnapshotLoaded()
 { }
 
+bool TCompositeAutomatonPart::SupportsDeltaSnapshots()
+{
+    return false;
+}
+
+void TCompositeAutomatonPart::OnSnapshotCaptured()
+{ }
+
 bool TCompositeAutomatonPart::IsLeader() const
 {
     return HydraManager_->IsLeader();
@@ -300,6 +312,36 @@ void TCompositeAutomaton::RegisterMethod(
 
 TFuture<void> TCompositeAutomaton::SaveSnapshot(IAsyncOutputStreamPtr writer)
 {
+    return SaveSnapshotParts(std::move(writer), InvalidSegmentId);
+}
+
+bool TCompositeAutomaton::SupportsDeltaSnapshots()
+{
+    auto parts = GetParts();
+    return std::all_of(
+        parts.begin(),
+        parts.end(),
+        [] (const auto& part) { return part->SupportsDeltaSnapshots(); });
+}
+
+TFuture<void> TCompositeAutomaton::SaveDeltaSnapshot(IAsyncOutputStreamPtr writer, int baseSnapshotId)
+{
+    YT_VERIFY(baseSnapshotId != InvalidSegmentId);
+
+    return SaveSnapshotParts(std::move(writer), baseSnapshotId);
+}
+
+void TCompositeAutomaton::OnSnapshotCaptured()
+{
+    for (const auto& part : GetParts()) {
+        part->OnSnapshotCaptured();
+    }
+}
+
+TFuture<void> TCompositeAutomaton::SaveSnapshotParts(IAsyncOutputStreamPtr writer, int baseSnapshotId)
+{
+    bool delta = baseSnapshotId != InvalidSegmentId;
+
     DoSaveSnapshot(
         writer,
         // NB: Do not yield in sync part.
@@ -307,6 +349,12 @@ TFuture<void> TCompositeAutomaton::SaveSnapshot(IAsyncOutputStreamPtr writer)
         [&] (TSaveContext& context) {
             using NYT::Save;
 
+            if (delta) {
+                Save<i32>(context, DeltaSnapshotMarker);
+                Save<i32>(context, baseSnapshotId);
+                context.SetDeltaSnapshot(true);
+            }
+
             int partCount = SyncSavers_.size() + AsyncSavers_.size();
             Save<i32>(context, partCount);
 
@@ -358,6 +406,7 @@ TFuture<void> TCompositeAutomaton::SaveSnapshot(IAsyncOutputStreamPtr writer)
                 // NB: Can yield in async part.
                 EWaitForStrategy::WaitFor,
                 [&] (TSaveContext& context) {
+                    context.SetDeltaSnapshot(delta);
                     for (int index = 0; index < std::ssize(asyncSavers); ++index) {
                         WritePartHeader(context, asyncSavers[index]);
                         asyncCallbacks[index](context);
@@ -373,54 +422,12 @@ void TCompositeAutomaton::LoadSnapshot(IAsyncZeroCopyInputStreamPtr reader)
     DoLoadSnapshot(
         reader,
         [&] (TLoadContext& context) {
-            using NYT::Load;
-
             auto parts = GetParts();
             for (const auto& part : parts) {
                 part->OnBeforeSnapshotLoaded();
             }
 
-            int partCount = LoadSuspended<i32>(context);
-            SERIALIZATION_DUMP_WRITE(context, "parts[%v]", partCount);
-            SERIALIZATION_DUMP_INDENT(context) {
-                for (int partIndex = 0; partIndex < partCount; ++partIndex) {
-                    auto name = LoadSuspended<TString>(context);
-                    int version = LoadSuspended<i32>(context);
-                    SERIALIZATION_DUMP_WRITE(context, "%v@%v =>", name, version);
-
-                    SERIALIZATION_DUMP_INDENT(context) {
-                        auto readPart = [&] (auto func) {
-                            auto offsetBefore = context.GetOffset();
-                            func();
-                            context.SkipToCheckpoint();
-                            auto offsetAfter = context.GetOffset();
-                            return offsetAfter - offsetBefore;
-                        };
-
-                        auto it = PartNameToLoaderDescriptor_.find(name);
-                        if (it == PartNameToLoaderDescriptor_.end()) {
-                            SERIALIZATION_DUMP_WRITE(context, "<skipped>");
-                            YT_LOG_INFO("Started skipping unknown automaton part (Name: %v, Version: %v)",
-                                name,
-                                version);
-                            auto size = readPart([] { });
-                            YT_LOG_INFO("Finished skipping unknown automaton part (Name: %v, Size: %v)",
-                                name,
-                                size);
-                        } else {
-                            YT_LOG_INFO("Started loading automaton part (Name: %v, Version: %v)",
-                                name,
-                                version);
-                            context.SetVersion(version);
-                            const auto& descriptor = it->second;
-                            auto size = readPart([&] { descriptor.Callback(context); });
-                            YT_LOG_INFO("Finished loading automaton part (Name: %v, Size: %v)",
-                                name,
-                                size);
-                        }
-                    }
-                }
-            }
+            LoadSnapshotParts(context);
 
             if (context.GetEnableTotalWriteCountReport()) {
                 context.Dumper().ReportWriteCount();
@@ -428,6 +435,81 @@ void TCompositeAutomaton::LoadSnapshot(IAsyncZeroCopyInputStreamPtr reader)
         });
 }
 
+void TCompositeAutomaton::SetSnapshotReaderFactory(TSnapshotReaderFactory factory)
+{
+    SnapshotReaderFactory_ = std::move(factory);
+}
+
+void TCompositeAutomaton::LoadSnapshotParts(TLoadContext& context)
+{
+    using NYT::Load;
+
+    int partCount = LoadSuspended<i32>(context);
+    if (partCount == DeltaSnapshotMarker) {
+        int baseSnapshotId = LoadSuspended<i32>(context);
+        SERIALIZATION_DUMP_WRITE(context, "base %v", baseSnapshotId);
+
+        if (!SnapshotReaderFactory_) {
+            THROW_ERROR_EXCEPTION("Cannot load delta snapshot since its base snapshot %v cannot be opened",
+                baseSnapshotId);
+        }
+
+        YT_LOG_INFO("Started loading base snapshot (BaseSnapshotId: %v)",
+            baseSnapshotId);
+        DoLoadSnapshot(
+            SnapshotReaderFactory_(baseSnapshotId),
+            [&] (TLoadContext& baseContext) {
+                LoadSnapshotParts(baseContext);
+            });
+        YT_LOG_INFO("Finished loading base snapshot (BaseSnapshotId: %v)",
+            baseSnapshotId);
+
+        context.SetDeltaSnapshot(true);
+        partCount = LoadSuspended<i32>(context);
+    }
+
+    SERIALIZATION_DUMP_WRITE(context, "parts[%v]", partCount);
+    SERIALIZATION_DUMP_INDENT(context) {
+        for (int partIndex = 0; partIndex < partCount; ++partIndex) {
+            auto name = LoadSuspended<TString>(context);
+            int version = LoadSuspended<i32>(context);
+            SERIALIZATION_DUMP_WRITE(context, "%v@%v =>", name, version);
+
+            SERIALIZATION_DUMP_INDENT(context) {
+                auto readPart = [&] (auto func) {
+                    auto offsetBefore = context.GetOffset();
+                    func();
+                    context.SkipToCheckpoint();
+                    auto offsetAfter = context.GetOffset();
+                    return offsetAfter - offsetBefore;
+                };
+
+                auto it = PartNameToLoaderDescriptor_.find(name);
+                if (it == PartNameToLoaderDescriptor_.end()) {
+                    SERIALIZATION_DUMP_WRITE(context, "<skipped>");
+                    YT_LOG_INFO("Started skipping unknown automaton part (Name: %v, Version: %v)",
+                        name,
+                        version);
+                    auto size = readPart([] { });
+                    YT_LOG_INFO("Finished skipping unknown automaton part (Name: %v, Size: %v)",
+                        name,
+                        size);
+                } else {
+                    YT_LOG_INFO("Started loading automaton part (Name: %v, Version: %v)",
+                        name,
+                        version);
+                    context.SetVersion(version);
+                    const auto& descriptor = it->second;
+                    auto size = readPart([&] { descriptor.Callback(context); });
+                    YT_LOG_INFO("Finished loading automaton part (Name: %v, Size: %v)",
+                        name,
+                        size);
+                }
+            }
+        }
+    }
+}
+
 void TCompositeAutomaton::PrepareState()
 {
     for (const auto& part : GetParts()) {
@@ -95,6 +95,11 @@ protected:
     virtual void OnBeforeSnapshotLoaded();
     virtual void OnAfterSnapshotLoaded();
 
+    //! Parts supporting delta snapshots must track their changes (e.g. via #TEntityMap::MarkDirty)
+    //! and save and load only those when the context is marked as delta.
+    virtual bool SupportsDeltaSnapshots();
+    virtual void OnSnapshotCaptured();
+
     virtual void OnStartLeading();
     virtual void OnLeaderRecoveryComplete();
     virtual void OnLeaderActive();
@@ -135,7 +140,13 @@ public:
     void SetSnapshotValidationOptions(const TSnapshotValidationOptions& options) override;
 
     TFuture<void> SaveSnapshot(NConcurrency::IAsyncOutputStreamPtr writer) override;
+    bool SupportsDeltaSnapshots() override;
+    TFuture<void> SaveDeltaSnapshot(
+        NConcurrency::IAsyncOutputStreamPtr writer,
+        int baseSnapshotId) override;
+    void OnSnapshotCaptured() override;
     void LoadSnapshot(NConcurrency::IAsyncZeroCopyInputStreamPtr reader) override;
+    void SetSnapshotReaderFactory(TSnapshotReaderFactory factory) override;
     void PrepareState() override;
 
     void ApplyMutation(TMutationContext* context) override;
@@ -242,9 +253,16 @@ private:
 
     EFinalRecoveryAction FinalRecoveryAction_ = EFinalRecoveryAction::None;
 
+    TSnapshotReaderFactory SnapshotReaderFactory_;
+
     NProfiling::TEventTimer MutationWaitTimer_;
 
 private:
+    TFuture<void> SaveSnapshotParts(
+        NConcurrency::IAsyncOutputStreamPtr writer,
+        int baseSnapshotId);
+    void LoadSnapshotParts(TLoadContext& context);
+
     void DoSaveSnapshot(
         NConcurrency::IAsyncOutputStreamPtr writer,
         NConcurrency::EWaitForStrategy strategy,
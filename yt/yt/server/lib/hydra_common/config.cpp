@@ -315,6 +315,9 @@ void TDistributedHydraManagerConfig::Register(TRegistrar registrar)
     registrar.Parameter("max_changelog_bytes_per_request", &TThis::MaxChangelogBytesPerRequest)
         .GreaterThan(0)
         .Default(128_MB);
+    registrar.Parameter("max_concurrent_changelog_prefetches", &TThis::MaxConcurrentChangelogPrefetches)
+        .GreaterThanOrEqual(0)
+        .Default(0);
 
     registrar.Parameter("snapshot_download_rpc_timeout", &TThis::SnapshotDownloadRpcTimeout)
         .Default(TDuration::Seconds(10));
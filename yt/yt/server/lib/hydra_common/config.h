@@ -283,6 +283,12 @@ public:
     //! Maximum number of records to read from a changelog at once.
     int MaxChangelogRecordsPerRequest;
 
+    //! Maximum number of changelogs downloaded concurrently during follower recovery.
+    //! These downloads proceed while the snapshot is being downloaded and loaded.
+    //! Zero disables changelog prefetching.
+    // NB: only used by Hydra.
+    int MaxConcurrentChangelogPrefetches;
+
     //! Generic timeout for RPC calls during snapshot download.
     // COMPAT(shakurov): no longer used in Hydra2.
     TDuration SnapshotDownloadRpcTimeout;
@@ -300,7 +306,7 @@ public:
     TDuration SnapshotDownloadStreamingStallTimeout;
 
     //! Streaming sliding window size for snapshot download.
-    // NB: only used by Hydra2.
+    //! In Hydra, bounds the total size of snapshot blocks requested concurrently.
     ssize_t SnapshotDownloadWindowSize;
 
     //! Compression codec for snapshot download.
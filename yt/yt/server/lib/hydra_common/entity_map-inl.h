@@ -10,6 +10,10 @@
 
 #include <library/cpp/yt/memory/chunked_output_stream.h>
 
+#include <util/stream/mem.h>
+
+#include <deque>
+
 namespace NYT::NHydra {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +21,9 @@ namespace NYT::NHydra {
 struct TEntityMapSaveBufferTag
 { };
 
+struct TEntityMapLoadBufferTag
+{ };
+
 ////////////////////////////////////////////////////////////////////////////////
 
 template <class TValue>
@@ -29,6 +36,17 @@ std::unique_ptr<TValue> TDefaultEntityMapTraits<TValue>::Create(const TEntityKey
     }
 }
 
+template <class TValue>
+void TDefaultEntityMapTraits<TValue>::Reset(TValue* value, const TEntityKey<TValue>& key) const
+{
+    // NB: #Create always constructs exactly TValue, hence its storage may be reused.
+    if constexpr (std::is_polymorphic_v<TValue>) {
+        YT_VERIFY(typeid(*value) == typeid(TValue));
+    }
+    value->~TValue();
+    new (value) TValue(key);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 inline TEntityDynamicDataBase* TEntityBase::GetDynamicData() const
@@ -199,6 +217,10 @@ TValue* TEntityMap<TValue, TTraits>::Insert(const TKey& key, std::unique_ptr<TVa
     YT_VERIFY(this->Map_.emplace(key, value).second);
     value->SetDynamicData(AllocateDynamicData());
 
+    if (DirtyTrackingEnabled_) {
+        DirtyKeys_.insert(key);
+    }
+
     return value;
 }
 
@@ -224,6 +246,7 @@ bool TEntityMap<TValue, TTraits>::TryRemove(const TKey& key)
     FreeDynamicData(value->GetDynamicData());
     delete value;
     this->Map_.erase(it);
+    DirtyKeys_.erase(key);
     return true;
 }
 
@@ -238,6 +261,7 @@ std::unique_ptr<TValue> TEntityMap<TValue, TTraits>::Release(const TKey& key)
     FreeDynamicData(value->GetDynamicData());
     value->SetDynamicData(nullptr);
     this->Map_.erase(it);
+    DirtyKeys_.erase(key);
     return std::unique_ptr<TValue>(value);
 }
 
@@ -259,6 +283,40 @@ void TEntityMap<TValue, TTraits>::DoClear()
     this->Map_.clear();
     DynamicDataPool_.Clear();
     FirstSpareDynamicData_ = nullptr;
+    DirtyKeys_.clear();
+}
+
+template <class TValue, class TTraits>
+void TEntityMap<TValue, TTraits>::EnableDirtyTracking()
+{
+    VERIFY_THREAD_AFFINITY(this->UserThread);
+
+    DirtyTrackingEnabled_ = true;
+}
+
+template <class TValue, class TTraits>
+bool TEntityMap<TValue, TTraits>::IsDirtyTrackingEnabled() const
+{
+    return DirtyTrackingEnabled_;
+}
+
+template <class TValue, class TTraits>
+void TEntityMap<TValue, TTraits>::MarkDirty(const TKey& key)
+{
+    VERIFY_THREAD_AFFINITY(this->UserThread);
+
+    if (DirtyTrackingEnabled_) {
+        YT_ASSERT(this->Map_.contains(key));
+        DirtyKeys_.insert(key);
+    }
+}
+
+template <class TValue, class TTraits>
+void TEntityMap<TValue, TTraits>::ResetDirty()
+{
+    VERIFY_THREAD_AFFINITY(this->UserThread);
+
+    DirtyKeys_.clear();
 }
 
 template <class TValue, class TTraits>
@@ -323,6 +381,24 @@ void TEntityMap<TValue, TTraits>::SaveKeys(TContext& context) const
         Save(context, it->first);
         it->second->GetDynamicData()->SerializationKey = context.GenerateSerializationKey();
     }
+
+    if (context.GetDeltaSnapshot()) {
+        YT_VERIFY(DirtyTrackingEnabled_);
+
+        // All keys are saved above since unchanged entities may still be referenced;
+        // values are only saved for the dirty ones.
+        std::vector<int> dirtyIndexes;
+        std::vector<typename TMapType::const_iterator> dirtyIterators;
+        for (int index = 0; index < std::ssize(SaveIterators_); ++index) {
+            const auto& it = SaveIterators_[index];
+            if (DirtyKeys_.contains(it->first)) {
+                dirtyIndexes.push_back(index);
+                dirtyIterators.push_back(it);
+            }
+        }
+        Save(context, dirtyIndexes);
+        SaveIterators_ = std::move(dirtyIterators);
+    }
 }
 
 template <class TValue, class TTraits>
@@ -340,20 +416,17 @@ template <class TContext>
 void TEntityMap<TValue, TTraits>::SaveValuesParallel(TContext& context) const
 {
     auto backgroundInvoker = context.GetBackgroundInvoker();
-    if (!backgroundInvoker) {
-        SaveValues(context);
-        return;
-    }
+    int parallelism = std::max(context.GetBackgroundParallelism(), 1);
 
     int batchSize = EstimateParallelSaveBatchSize(context);
 
     std::vector<std::vector<TSharedRef>> batchResults;
-    std::vector<TCallback<TFuture<void>()>> batchExecutors;
+    std::vector<TExtendedCallback<void()>> batchSavers;
     int entityStartIndex = 0;
     while (entityStartIndex < std::ssize(SaveIterators_)) {
         int entityEndIndex = std::min<int>(entityStartIndex + batchSize, std::ssize(SaveIterators_));
-        int batchIndex = std::ssize(batchExecutors);
-        batchExecutors.push_back(BIND([this, &context, &batchResults, entityStartIndex, entityEndIndex, batchIndex] {
+        int batchIndex = std::ssize(batchSavers);
+        batchSavers.push_back(BIND([this, &context, &batchResults, entityStartIndex, entityEndIndex, batchIndex] {
             TChunkedOutputStream batchOutput(GetRefCountedTypeCookie<TEntityMapSaveBufferTag>());
             TContext batchContext(&batchOutput, &context);
             for (int index = entityStartIndex; index < entityEndIndex; ++index) {
@@ -361,11 +434,11 @@ void TEntityMap<TValue, TTraits>::SaveValuesParallel(TContext& context) const
             }
             batchContext.Finish();
             batchResults[batchIndex] = batchOutput.Finish();
-        }).AsyncVia(backgroundInvoker));
+        }));
         entityStartIndex = entityEndIndex;
     }
 
-    int batchCount = std::ssize(batchExecutors);
+    int batchCount = std::ssize(batchSavers);
 
     batchResults.resize(batchCount);
     std::vector<TFuture<void>> batchFutures(batchCount);
@@ -374,9 +447,15 @@ void TEntityMap<TValue, TTraits>::SaveValuesParallel(TContext& context) const
     int batchesRunning = 0;
 
     auto startMoreBatches = [&] {
-        while (batchIndexToStart < batchCount && batchesRunning < context.GetBackgroundParallelism()) {
+        while (batchIndexToStart < batchCount && batchesRunning < parallelism) {
             YT_VERIFY(!batchFutures[batchIndexToStart]);
-            batchFutures[batchIndexToStart] = batchExecutors[batchIndexToStart]();
+            const auto& batchSaver = batchSavers[batchIndexToStart];
+            if (backgroundInvoker) {
+                batchFutures[batchIndexToStart] = batchSaver.AsyncVia(backgroundInvoker).Run();
+            } else {
+                batchSaver();
+                batchFutures[batchIndexToStart] = VoidFuture;
+            }
             ++batchesRunning;
             ++batchIndexToStart;
         }
@@ -392,6 +471,12 @@ void TEntityMap<TValue, TTraits>::SaveValuesParallel(TContext& context) const
             .ThrowOnError();
         --batchesRunning;
         auto batchResult = std::move(batchResults[batchIndexToWaitFor]);
+        auto batchEntityCount = std::min<int>(batchSize, std::ssize(SaveIterators_) - batchIndexToWaitFor * batchSize);
+        i64 batchByteSize = GetByteSize(batchResult);
+        // Each batch is prefixed with its header so that the loader can
+        // locate and decode batches independently, see #LoadValuesParallel.
+        TSizeSerializer::Save(context, batchEntityCount);
+        Save(context, batchByteSize);
         for (const auto& chunk : batchResult) {
             context.GetOutput()->Write(chunk.Begin(), chunk.Size());
         }
@@ -404,7 +489,6 @@ void TEntityMap<TValue, TTraits>::SaveValuesParallel(TContext& context) const
     } while (waitForBatch());
 
     SaveIterators_.clear();
-
 }
 
 template <class TValue, class TTraits>
@@ -428,7 +512,9 @@ int TEntityMap<TValue, TTraits>::EstimateParallelSaveBatchSize(TContext& context
 
     int batchSize = index;
     // Make sure we actually save values in parallel; this is important for test coverage.
-    batchSize = std::min(batchSize, static_cast<int>(std::ssize(SaveIterators_) / context.GetBackgroundParallelism()));
+    if (auto parallelism = context.GetBackgroundParallelism(); parallelism > 0) {
+        batchSize = std::min(batchSize, static_cast<int>(std::ssize(SaveIterators_) / parallelism));
+    }
     // The above could have decreased the size down to zero; fix it.
     batchSize = std::max(batchSize, 1);
     return batchSize;
@@ -440,6 +526,11 @@ void TEntityMap<TValue, TTraits>::LoadKeys(TContext& context)
 {
     VERIFY_THREAD_AFFINITY(this->UserThread);
 
+    if (context.GetDeltaSnapshot()) {
+        LoadDeltaKeys(context);
+        return;
+    }
+
     Clear();
 
     size_t size = TSizeSerializer::LoadSuspended(context);
@@ -470,6 +561,88 @@ void TEntityMap<TValue, TTraits>::LoadKeys(TContext& context)
     }
 }
 
+template <class TValue, class TTraits>
+template <class TContext>
+void TEntityMap<TValue, TTraits>::LoadDeltaKeys(TContext& context)
+{
+    size_t size = TSizeSerializer::LoadSuspended(context);
+
+    SERIALIZATION_DUMP_WRITE(context, "keys[%v]", size);
+
+    // Entities are kept in place so that references from unchanged ones stay valid.
+    std::vector<TKey> keys;
+    keys.reserve(size);
+    std::vector<TValue*> values;
+    values.reserve(size);
+    THashSet<TKey, TEntityHash<TValue>> keySet;
+    keySet.reserve(size);
+
+    SERIALIZATION_DUMP_INDENT(context) {
+        for (size_t index = 0; index < size; ++index) {
+            auto key = LoadSuspended<TKey>(context);
+            keys.push_back(key);
+            keySet.insert(key);
+
+            auto* value = this->Find(key);
+            if (!value) {
+                auto valueHolder = Traits_.Create(key);
+                value = valueHolder.release();
+                value->SetDynamicData(AllocateDynamicData());
+                YT_VERIFY(this->Map_.emplace(key, value).second);
+            }
+            values.push_back(value);
+
+            auto serializationKey = context.RegisterRawEntity(value);
+
+            SERIALIZATION_DUMP_WRITE(context, "%v aka %v", key, serializationKey.Index);
+        }
+    }
+
+    std::vector<TKey> removedKeys;
+    for (const auto& [key, value] : this->Map_) {
+        if (!keySet.contains(key)) {
+            removedKeys.push_back(key);
+        }
+    }
+    for (const auto& key : removedKeys) {
+        YT_VERIFY(TryRemove(key));
+    }
+
+    auto dirtyIndexes = Load<std::vector<int>>(context);
+
+    SERIALIZATION_DUMP_WRITE(context, "dirty[%v]", dirtyIndexes.size());
+
+    LoadKeys_.clear();
+    LoadKeys_.reserve(dirtyIndexes.size());
+    LoadValues_.clear();
+    LoadValues_.reserve(dirtyIndexes.size());
+
+    for (auto index : dirtyIndexes) {
+        if (index < 0 || index >= std::ssize(values)) {
+            THROW_ERROR_EXCEPTION("Invalid dirty entity index in delta snapshot")
+                << TErrorAttribute("index", index)
+                << TErrorAttribute("entity_count", values.size());
+        }
+
+        const auto& key = keys[index];
+        auto* value = values[index];
+        // Reset the entity to its freshly created state before loading it anew.
+        // The entity stays at its address since unchanged entities may refer to it.
+        if constexpr (requires { Traits_.Reset(value, key); }) {
+            FreeDynamicData(value->GetDynamicData());
+            Traits_.Reset(value, key);
+            value->SetDynamicData(AllocateDynamicData());
+        } else {
+            THROW_ERROR_EXCEPTION("Entities of this type cannot be loaded from delta snapshots");
+        }
+
+        LoadKeys_.push_back(key);
+        LoadValues_.push_back(value);
+    }
+
+    DirtyKeys_.clear();
+}
+
 template <class TValue, class TTraits>
 template <class TContext>
 void TEntityMap<TValue, TTraits>::LoadValues(TContext& context)
@@ -493,6 +666,104 @@ void TEntityMap<TValue, TTraits>::LoadValues(TContext& context)
     LoadValues_.clear();
 }
 
+template <class TValue, class TTraits>
+template <class TContext>
+void TEntityMap<TValue, TTraits>::LoadValuesParallel(TContext& context)
+{
+    VERIFY_THREAD_AFFINITY(this->UserThread);
+
+    YT_VERIFY(LoadKeys_.size() == LoadValues_.size());
+
+    SERIALIZATION_DUMP_WRITE(context, "values[%v]", LoadKeys_.size());
+
+    // Dumping is only possible when values are decoded sequentially in the root context.
+    auto backgroundInvoker = context.Dumper().IsEnabled()
+        ? nullptr
+        : context.GetBackgroundInvoker();
+    int parallelism = context.GetBackgroundParallelism();
+
+    std::vector<TFuture<void>> batchFutures;
+    // NB: Deque keeps references to its elements valid upon insertions.
+    std::deque<std::vector<TClosure>> batchFixups;
+
+    int batchIndexToWaitFor = 0;
+    auto waitForBatch = [&] {
+        batchFutures[batchIndexToWaitFor++]
+            .Get()
+            .ThrowOnError();
+    };
+
+    int entityStartIndex = 0;
+    SERIALIZATION_DUMP_INDENT(context) {
+        while (entityStartIndex < std::ssize(LoadValues_)) {
+            int batchEntityCount = TSizeSerializer::LoadSuspended(context);
+            auto batchByteSize = Load<i64>(context);
+
+            int entityEndIndex = entityStartIndex + batchEntityCount;
+            if (batchEntityCount <= 0 || entityEndIndex > std::ssize(LoadValues_)) {
+                THROW_ERROR_EXCEPTION("Invalid entity batch in snapshot")
+                    << TErrorAttribute("entity_start_index", entityStartIndex)
+                    << TErrorAttribute("batch_entity_count", batchEntityCount)
+                    << TErrorAttribute("entity_count", LoadValues_.size());
+            }
+
+            if (!backgroundInvoker) {
+                for (int index = entityStartIndex; index < entityEndIndex; ++index) {
+                    SERIALIZATION_DUMP_WRITE(context, "%v =>", LoadKeys_[index]);
+                    SERIALIZATION_DUMP_INDENT(context) {
+                        Load(context, *LoadValues_[index]);
+                    }
+                }
+                entityStartIndex = entityEndIndex;
+                continue;
+            }
+
+            auto batchData = TSharedMutableRef::Allocate<TEntityMapLoadBufferTag>(
+                batchByteSize,
+                {.InitializeStorage = false});
+            if (context.GetInput()->Load(batchData.Begin(), batchData.Size()) != batchData.Size()) {
+                THROW_ERROR_EXCEPTION("Unexpected end of snapshot while reading entity batch")
+                    << TErrorAttribute("entity_start_index", entityStartIndex)
+                    << TErrorAttribute("batch_byte_size", batchByteSize);
+            }
+
+            // Bound the amount of buffered snapshot data.
+            while (std::ssize(batchFutures) - batchIndexToWaitFor >= parallelism) {
+                waitForBatch();
+            }
+
+            auto* fixups = &batchFixups.emplace_back();
+            batchFutures.push_back(
+                BIND([this, &context, batchData = std::move(batchData), entityStartIndex, entityEndIndex, fixups] {
+                    TMemoryInput batchInput(batchData.Begin(), batchData.Size());
+                    TContext batchContext(&batchInput, &context);
+                    for (int index = entityStartIndex; index < entityEndIndex; ++index) {
+                        Load(batchContext, *LoadValues_[index]);
+                    }
+                    *fixups = batchContext.ExtractFixups();
+                })
+                    .AsyncVia(backgroundInvoker)
+                    .Run());
+
+            entityStartIndex = entityEndIndex;
+        }
+    }
+
+    while (batchIndexToWaitFor < std::ssize(batchFutures)) {
+        waitForBatch();
+    }
+
+    // Fixups are run in entity order to keep the resulting state deterministic.
+    for (const auto& fixups : batchFixups) {
+        for (const auto& fixup : fixups) {
+            fixup();
+        }
+    }
+
+    LoadKeys_.clear();
+    LoadValues_.clear();
+}
+
 template <class TValue, class TTraits>
 auto TEntityMap<TValue, TTraits>::AllocateDynamicData() -> TDynamicData*
 {
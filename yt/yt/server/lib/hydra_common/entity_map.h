@@ -17,6 +17,13 @@ template <class TValue>
 struct TDefaultEntityMapTraits
 {
     std::unique_ptr<TValue> Create(const TEntityKey<TValue>& key) const;
+
+    //! Brings #value previously returned by #Create for #key back to its freshly created state.
+    /*!
+     *  Used for reloading entities from delta snapshots; traits lacking this method
+     *  make their entity maps unable to load delta snapshots.
+     */
+    void Reset(TValue* value, const TEntityKey<TValue>& key) const;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -140,12 +147,31 @@ public:
 
     void Clear();
 
+    //! Makes the map track entities changed since the last #ResetDirty call;
+    //! these are the only ones saved into delta snapshots.
+    /*!
+     *  Insertions and removals are tracked automatically; the owner must
+     *  call #MarkDirty upon each modification of an entity. Values must be
+     *  constructible from their keys to be reloaded in place.
+     */
+    void EnableDirtyTracking();
+    bool IsDirtyTrackingEnabled() const;
+
+    void MarkDirty(const TKey& key);
+    void ResetDirty();
+
     template <class TContext>
     void SaveKeys(TContext& context) const;
 
     template <class TContext>
     void SaveValues(TContext& context) const;
 
+    //! Saves values in independently decodable batches, each prefixed with
+    //! its entity count and byte size; batches are serialized in background
+    //! threads when the context provides them.
+    /*!
+     *  Must be paired with #LoadValuesParallel.
+     */
     template <class TContext>
     void SaveValuesParallel(TContext& context) const;
 
@@ -155,6 +181,15 @@ public:
     template <class TContext>
     void LoadValues(TContext& context);
 
+    //! Loads values written by #SaveValuesParallel.
+    /*!
+     *  Batches are decoded in background threads (when the context provides them)
+     *  via child contexts; fixups registered by values are then run in the calling
+     *  thread in entity order.
+     */
+    template <class TContext>
+    void LoadValuesParallel(TContext& context);
+
 private:
     using TMapType = typename TReadOnlyEntityMap<TValue>::TMapType;
 
@@ -169,6 +204,11 @@ private:
     std::vector<TValue*> LoadValues_;
     mutable std::vector<typename TMapType::const_iterator> SaveIterators_;
 
+    bool DirtyTrackingEnabled_ = false;
+    THashSet<TKey, TEntityHash<TValue>> DirtyKeys_;
+
+    template <class TContext>
+    void LoadDeltaKeys(TContext& context);
 
     template <class TContext>
     int EstimateParallelSaveBatchSize(TContext& context) const;
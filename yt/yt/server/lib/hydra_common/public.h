@@ -48,6 +48,7 @@ DECLARE_REFCOUNTED_STRUCT(ISnapshotStore)
 
 DECLARE_REFCOUNTED_CLASS(TSnapshotStoreThunk)
 DECLARE_REFCOUNTED_CLASS(TChangelogStoreFactoryThunk)
+DECLARE_REFCOUNTED_CLASS(TChangelogPrefetcher)
 
 DECLARE_REFCOUNTED_STRUCT(ILocalHydraJanitor)
 
@@ -0,0 +1,116 @@
+#include "recovery_helpers.h"
+
+#include <yt/yt/core/concurrency/scheduler.h>
+
+#include <yt/yt/core/misc/collection_helpers.h>
+#include <yt/yt/core/misc/serialize.h>
+
+namespace NYT::NHydra {
+
+using namespace NConcurrency;
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TSnapshotChecksumVerifier::Append(TRef block)
+{
+    if (Offset_ < std::ssize(HeaderBuffer_)) {
+        auto size = std::min<i64>(std::ssize(HeaderBuffer_) - Offset_, block.Size());
+        ::memcpy(HeaderBuffer_.data() + Offset_, block.Begin(), size);
+        Offset_ += size;
+        block = block.Slice(size, block.Size());
+        if (Offset_ == std::ssize(HeaderBuffer_)) {
+            OnHeaderReceived();
+        }
+    }
+
+    if (Offset_ < BodyOffset_) {
+        auto size = std::min<i64>(BodyOffset_ - Offset_, block.Size());
+        Offset_ += size;
+        block = block.Slice(size, block.Size());
+    }
+
+    Checksum_ = GetChecksum(block, Checksum_);
+    Offset_ += block.Size();
+}
+
+void TSnapshotChecksumVerifier::Verify() const
+{
+    if (Offset_ < BodyOffset_) {
+        THROW_ERROR_EXCEPTION("Downloaded snapshot is truncated")
+            << TErrorAttribute("size", Offset_);
+    }
+    if (Checksum_ != Header_.Checksum) {
+        THROW_ERROR_EXCEPTION("Downloaded snapshot checksum mismatch")
+            << TErrorAttribute("expected_checksum", Header_.Checksum)
+            << TErrorAttribute("actual_checksum", Checksum_);
+    }
+}
+
+void TSnapshotChecksumVerifier::OnHeaderReceived()
+{
+    ::memcpy(&Header_, HeaderBuffer_.data(), sizeof(Header_));
+    if (Header_.Signature != TSnapshotHeader::ExpectedSignature) {
+        THROW_ERROR_EXCEPTION("Downloaded snapshot has invalid signature")
+            << TErrorAttribute("expected_signature", TSnapshotHeader::ExpectedSignature)
+            << TErrorAttribute("actual_signature", Header_.Signature);
+    }
+    BodyOffset_ =
+        sizeof(TSnapshotHeader) +
+        Header_.MetaSize +
+        AlignUpSpace<i64>(Header_.MetaSize, SerializationAlignment);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TChangelogPrefetcher::TChangelogPrefetcher(
+    int firstChangelogId,
+    int lastChangelogId,
+    int maxConcurrentPrefetches,
+    TPrefetchCallback prefetchChangelog,
+    IInvokerPtr invoker)
+    : FirstChangelogId_(firstChangelogId)
+    , MaxConcurrentPrefetches_(maxConcurrentPrefetches)
+    , PrefetchChangelog_(std::move(prefetchChangelog))
+    , Invoker_(std::move(invoker))
+{
+    YT_VERIFY(MaxConcurrentPrefetches_ > 0);
+
+    for (int changelogId = firstChangelogId; changelogId <= lastChangelogId; ++changelogId) {
+        auto promise = NewPromise<void>();
+        EmplaceOrCrash(Futures_, changelogId, promise.ToFuture());
+        Promises_.push_back(std::move(promise));
+    }
+}
+
+void TChangelogPrefetcher::Start()
+{
+    Invoker_->Invoke(BIND(&TChangelogPrefetcher::DoPrefetch, MakeStrong(this)));
+}
+
+TFuture<void> TChangelogPrefetcher::ExtractPrefetchResult(int changelogId)
+{
+    auto it = Futures_.find(changelogId);
+    if (it == Futures_.end()) {
+        return {};
+    }
+
+    auto future = std::move(it->second);
+    Futures_.erase(it);
+    return future;
+}
+
+void TChangelogPrefetcher::DoPrefetch()
+{
+    for (int index = 0; index < std::ssize(Promises_); ++index) {
+        if (index >= MaxConcurrentPrefetches_) {
+            // NB: Errors are handled by the consumer.
+            Y_UNUSED(WaitFor(Promises_[index - MaxConcurrentPrefetches_].ToFuture()));
+        }
+
+        Promises_[index].SetFrom(PrefetchChangelog_(FirstChangelogId_ + index));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NHydra
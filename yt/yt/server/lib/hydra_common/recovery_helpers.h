@@ -0,0 +1,89 @@
+#pragma once
+
+#include "public.h"
+#include "format.h"
+
+#include <yt/yt/core/actions/future.h>
+
+#include <yt/yt/core/misc/checksum.h>
+
+#include <library/cpp/yt/memory/ref.h>
+
+namespace NYT::NHydra {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Verifies the checksum of a raw snapshot file while its blocks are being downloaded,
+//! sparing an extra pass over the file.
+/*!
+ *  The header is validated as soon as it is received, even if it spans several blocks.
+ */
+class TSnapshotChecksumVerifier
+{
+public:
+    //! Consumes the next block of the file. Throws if the header is malformed.
+    void Append(TRef block);
+
+    //! Throws if the file is truncated or its checksum does not match the header.
+    void Verify() const;
+
+private:
+    std::array<char, sizeof(TSnapshotHeader)> HeaderBuffer_;
+    TSnapshotHeader Header_;
+    // NB: Unknown until the header is received.
+    i64 BodyOffset_ = std::numeric_limits<i64>::max();
+    i64 Offset_ = 0;
+    TChecksum Checksum_ = 0;
+
+    void OnHeaderReceived();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Prefetches a contiguous range of changelogs in background while
+//! a snapshot is being downloaded and loaded, and hands the results over
+//! to the replay loop.
+/*!
+ *  At most #maxConcurrentPrefetches changelogs are prefetched at a time;
+ *  a failed prefetch does not prevent subsequent ones.
+ *
+ *  \note
+ *  Thread affinity: #ExtractPrefetchResult must only be called from a single thread.
+ */
+class TChangelogPrefetcher
+    : public TRefCounted
+{
+public:
+    using TPrefetchCallback = TCallback<TFuture<void>(int changelogId)>;
+
+    TChangelogPrefetcher(
+        int firstChangelogId,
+        int lastChangelogId,
+        int maxConcurrentPrefetches,
+        TPrefetchCallback prefetchChangelog,
+        IInvokerPtr invoker);
+
+    //! Starts prefetching in #invoker.
+    void Start();
+
+    //! Returns the result of prefetching a given changelog and forgets it.
+    //! Returns null future if the changelog is not being prefetched.
+    TFuture<void> ExtractPrefetchResult(int changelogId);
+
+private:
+    const int FirstChangelogId_;
+    const int MaxConcurrentPrefetches_;
+    const TPrefetchCallback PrefetchChangelog_;
+    const IInvokerPtr Invoker_;
+
+    std::vector<TPromise<void>> Promises_;
+    THashMap<int, TFuture<void>> Futures_;
+
+    void DoPrefetch();
+};
+
+DEFINE_REFCOUNTED_TYPE(TChangelogPrefetcher)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NHydra
@@ -30,8 +30,10 @@ TSaveContext::TSaveContext(
     const TSaveContext* parentContext)
     : TEntityStreamSaveContext(
         output,
-        parentContext->GetVersion())
-{ }
+        parentContext)
+{
+    SetDeltaSnapshot(parentContext->GetDeltaSnapshot());
+}
 
 void TSaveContext::MakeCheckpoint()
 {
@@ -51,22 +53,62 @@ int TSaveContext::GetBackgroundParallelism() const
 
 ////////////////////////////////////////////////////////////////////////////////
 
-TLoadContext::TLoadContext(ICheckpointableInputStream* input)
+TLoadContext::TLoadContext(
+    ICheckpointableInputStream* input,
+    IThreadPoolPtr backgroundThreadPool)
     : TEntityStreamLoadContext(input)
     , CheckpointableInput_(input)
+    , BackgroundThreadPool_(std::move(backgroundThreadPool))
 { }
 
+TLoadContext::TLoadContext(
+    IZeroCopyInput* input,
+    const TLoadContext* parentContext)
+    : TEntityStreamLoadContext(
+        input,
+        parentContext)
+    , Child_(true)
+{
+    SetDeltaSnapshot(parentContext->GetDeltaSnapshot());
+}
+
 void TLoadContext::SkipToCheckpoint()
 {
+    YT_VERIFY(CheckpointableInput_);
     Input_.ClearBuffer();
     CheckpointableInput_->SkipToCheckpoint();
 }
 
 i64 TLoadContext::GetOffset() const
 {
+    YT_VERIFY(CheckpointableInput_);
     return CheckpointableInput_->GetOffset();
 }
 
+IInvokerPtr TLoadContext::GetBackgroundInvoker() const
+{
+    return BackgroundThreadPool_ ? BackgroundThreadPool_->GetInvoker() : nullptr;
+}
+
+int TLoadContext::GetBackgroundParallelism() const
+{
+    return BackgroundThreadPool_ ? BackgroundThreadPool_->GetThreadCount() : 0;
+}
+
+void TLoadContext::RegisterFixup(TClosure callback)
+{
+    if (Child_) {
+        Fixups_.push_back(std::move(callback));
+    } else {
+        callback();
+    }
+}
+
+std::vector<TClosure> TLoadContext::ExtractFixups()
+{
+    return std::move(Fixups_);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 #pragma pack(push, 4)
@@ -11,6 +11,8 @@
 
 #include <yt/yt/core/concurrency/public.h>
 
+#include <yt/yt/core/actions/callback.h>
+
 #include <library/cpp/yt/memory/ref.h>
 
 namespace NYT::NHydra {
@@ -20,6 +22,10 @@ namespace NYT::NHydra {
 class TSaveContext
     : public TEntityStreamSaveContext
 {
+public:
+    //! Indicates that only entities changed since the base snapshot are to be saved.
+    DEFINE_BYVAL_RW_PROPERTY(bool, DeltaSnapshot, false);
+
 public:
     explicit TSaveContext(
         ICheckpointableOutputStream* output,
@@ -48,15 +54,41 @@ class TLoadContext
 public:
     DEFINE_BYVAL_RW_PROPERTY(i64, LowerWriteCountDumpLimit);
     DEFINE_BYVAL_RW_PROPERTY(i64, UpperWriteCountDumpLimit);
+    //! Indicates that the state is being loaded on top of the base snapshot.
+    DEFINE_BYVAL_RW_PROPERTY(bool, DeltaSnapshot, false);
 
 public:
-    explicit TLoadContext(ICheckpointableInputStream* input);
+    explicit TLoadContext(
+        ICheckpointableInputStream* input,
+        NConcurrency::IThreadPoolPtr backgroundThreadPool = nullptr);
+
+    TLoadContext(
+        IZeroCopyInput* input,
+        const TLoadContext* parentContext);
 
     void SkipToCheckpoint();
     i64 GetOffset() const;
 
+    IInvokerPtr GetBackgroundInvoker() const;
+    int GetBackgroundParallelism() const;
+
+    //! Schedules #callback to be run in the loading thread.
+    /*!
+     *  For the root context, #callback is invoked immediately.
+     *  Child contexts (see #TEntityMap::LoadValuesParallel) collect callbacks
+     *  and the entity map runs them after all batches are decoded, in entity order.
+     *  This is the place for state that cannot be touched from a background thread
+     *  (e.g. thread-local pool allocations or global registries).
+     */
+    void RegisterFixup(TClosure callback);
+    std::vector<TClosure> ExtractFixups();
+
 private:
-    ICheckpointableInputStream* const CheckpointableInput_;
+    ICheckpointableInputStream* const CheckpointableInput_ = nullptr;
+    const NConcurrency::IThreadPoolPtr BackgroundThreadPool_;
+    const bool Child_ = false;
+
+    std::vector<TClosure> Fixups_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
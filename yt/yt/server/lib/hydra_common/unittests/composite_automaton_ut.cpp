@@ -0,0 +1,365 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/server/lib/hydra_common/composite_automaton.h>
+#include <yt/yt/server/lib/hydra_common/entity_map.h>
+#include <yt/yt/server/lib/hydra_common/serialize.h>
+
+#include <yt/yt/server/lib/hydra_common/mock/simple_hydra_manager_mock.h>
+
+#include <yt/yt/core/concurrency/action_queue.h>
+#include <yt/yt/core/concurrency/async_stream.h>
+
+#include <yt/yt/core/misc/collection_helpers.h>
+
+#include <util/stream/str.h>
+
+namespace NYT::NHydra {
+namespace {
+
+using namespace NConcurrency;
+
+////////////////////////////////////////////////////////////////////////////////
+
+DECLARE_ENTITY_TYPE(TTestEntity, int, ::THash<int>)
+
+class TTestEntity
+    : public TEntityBase
+{
+public:
+    const int Key;
+    int Value = 0;
+
+    explicit TTestEntity(int key)
+        : Key(key)
+    { }
+
+    void Save(TSaveContext& context) const
+    {
+        NYT::Save(context, Value);
+    }
+
+    void Load(TLoadContext& context)
+    {
+        NYT::Load(context, Value);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TTestAutomaton
+    : public TCompositeAutomaton
+{
+public:
+    TTestAutomaton()
+        : TCompositeAutomaton(
+            /*asyncSnapshotInvoker*/ nullptr,
+            /*cellId*/ {})
+    { }
+
+    TReign GetCurrentReign() override
+    {
+        return 0;
+    }
+
+    EFinalRecoveryAction GetActionToRecoverFromReign(TReign /*reign*/) override
+    {
+        return EFinalRecoveryAction::None;
+    }
+
+protected:
+    std::unique_ptr<TSaveContext> CreateSaveContext(
+        ICheckpointableOutputStream* output) override
+    {
+        return std::make_unique<TSaveContext>(output);
+    }
+
+    std::unique_ptr<TLoadContext> CreateLoadContext(
+        ICheckpointableInputStream* input) override
+    {
+        auto context = std::make_unique<TLoadContext>(input);
+        SetupLoadContext(context.get());
+        return context;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TTestAutomatonPart
+    : public TCompositeAutomatonPart
+{
+public:
+    TTestAutomatonPart(
+        ISimpleHydraManagerPtr hydraManager,
+        TCompositeAutomatonPtr automaton,
+        IInvokerPtr automatonInvoker)
+        : TCompositeAutomatonPart(
+            std::move(hydraManager),
+            std::move(automaton),
+            std::move(automatonInvoker))
+    {
+        Entities_.EnableDirtyTracking();
+
+        RegisterLoader(
+            "TestPart.Keys",
+            BIND(&TTestAutomatonPart::LoadKeys, Unretained(this)));
+        RegisterLoader(
+            "TestPart.Values",
+            BIND(&TTestAutomatonPart::LoadValues, Unretained(this)));
+
+        RegisterSaver(
+            ESyncSerializationPriority::Keys,
+            "TestPart.Keys",
+            BIND(&TTestAutomatonPart::SaveKeys, Unretained(this)));
+        RegisterSaver(
+            ESyncSerializationPriority::Values,
+            "TestPart.Values",
+            BIND(&TTestAutomatonPart::SaveValues, Unretained(this)));
+    }
+
+    void SetValue(int key, int value)
+    {
+        if (auto* entity = Entities_.Find(key)) {
+            entity->Value = value;
+            Entities_.MarkDirty(key);
+        } else {
+            Entities_.Insert(key, std::make_unique<TTestEntity>(key))->Value = value;
+        }
+    }
+
+    void RemoveValue(int key)
+    {
+        Entities_.Remove(key);
+    }
+
+    THashMap<int, int> GetValues() const
+    {
+        THashMap<int, int> values;
+        for (auto [key, entity] : Entities_) {
+            values[key] = entity->Value;
+        }
+        return values;
+    }
+
+    bool SupportsDeltaSnapshots() override
+    {
+        return true;
+    }
+
+    void OnSnapshotCaptured() override
+    {
+        Entities_.ResetDirty();
+    }
+
+    void Clear() override
+    {
+        TCompositeAutomatonPart::Clear();
+
+        Entities_.Clear();
+    }
+
+private:
+    TEntityMap<TTestEntity> Entities_;
+
+    void SaveKeys(TSaveContext& context) const
+    {
+        Entities_.SaveKeys(context);
+    }
+
+    void SaveValues(TSaveContext& context) const
+    {
+        Entities_.SaveValues(context);
+    }
+
+    void LoadKeys(TLoadContext& context)
+    {
+        Entities_.LoadKeys(context);
+    }
+
+    void LoadValues(TLoadContext& context)
+    {
+        Entities_.LoadValues(context);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TSharedRefInputStream
+    : public IAsyncZeroCopyInputStream
+{
+public:
+    explicit TSharedRefInputStream(TSharedRef data)
+        : Data_(std::move(data))
+    { }
+
+    TFuture<TSharedRef> Read() override
+    {
+        return MakeFuture(std::exchange(Data_, TSharedRef()));
+    }
+
+private:
+    TSharedRef Data_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TCompositeAutomatonDeltaSnapshotTest
+    : public ::testing::Test
+{
+protected:
+    const TActionQueuePtr AutomatonQueue_ = New<TActionQueue>("Automaton");
+
+    TIntrusivePtr<TTestAutomaton> Automaton_;
+    TSimpleHydraManagerMockPtr HydraManager_;
+    TIntrusivePtr<TTestAutomatonPart> Part_;
+
+    //! Snapshots by id, as seen by the reader factory.
+    THashMap<int, TSharedRef> Snapshots_;
+
+    void SetUp() override
+    {
+        // NB: Entity maps are bound to the thread they are first accessed from.
+        RunInAutomatonThread([&] {
+            Automaton_ = New<TTestAutomaton>();
+            HydraManager_ = New<TSimpleHydraManagerMock>(
+                Automaton_,
+                AutomatonQueue_->GetInvoker(),
+                /*reign*/ 0);
+            Part_ = New<TTestAutomatonPart>(
+                HydraManager_,
+                Automaton_,
+                AutomatonQueue_->GetInvoker());
+        });
+
+        Automaton_->SetSnapshotReaderFactory(BIND([this] (int snapshotId) -> IAsyncZeroCopyInputStreamPtr {
+            return New<TSharedRefInputStream>(GetOrCrash(Snapshots_, snapshotId));
+        }));
+    }
+
+    void TearDown() override
+    {
+        RunInAutomatonThread([&] {
+            Part_.Reset();
+            HydraManager_.Reset();
+            Automaton_.Reset();
+        });
+        AutomatonQueue_->Shutdown();
+    }
+
+    template <class TCallback>
+    void RunInAutomatonThread(TCallback callback)
+    {
+        BIND(std::move(callback))
+            .AsyncVia(AutomatonQueue_->GetInvoker())
+            .Run()
+            .Get()
+            .ThrowOnError();
+    }
+
+    //! Mimics the decorated automaton: the snapshot is saved and then the state is marked captured.
+    void BuildSnapshot(int snapshotId, std::optional<int> baseSnapshotId)
+    {
+        RunInAutomatonThread([&] {
+            TString data;
+            TStringOutput output(data);
+            auto writer = CreateAsyncAdapter(&output);
+            auto future = baseSnapshotId
+                ? Automaton_->SaveDeltaSnapshot(writer, *baseSnapshotId)
+                : Automaton_->SaveSnapshot(writer);
+            future.Get().ThrowOnError();
+            Automaton_->OnSnapshotCaptured();
+            EmplaceOrCrash(Snapshots_, snapshotId, TSharedRef::FromString(std::move(data)));
+        });
+    }
+
+    void Recover(int snapshotId)
+    {
+        RunInAutomatonThread([&] {
+            Automaton_->Clear();
+            Automaton_->LoadSnapshot(New<TSharedRefInputStream>(GetOrCrash(Snapshots_, snapshotId)));
+            Automaton_->PrepareState();
+        });
+    }
+
+    THashMap<int, int> GetValues()
+    {
+        return BIND(&TTestAutomatonPart::GetValues, Part_)
+            .AsyncVia(AutomatonQueue_->GetInvoker())
+            .Run()
+            .Get()
+            .ValueOrThrow();
+    }
+};
+
+TEST_F(TCompositeAutomatonDeltaSnapshotTest, RecoverFromDeltaChain)
+{
+    EXPECT_TRUE(Automaton_->SupportsDeltaSnapshots());
+
+    RunInAutomatonThread([&] {
+        for (int key = 0; key < 100; ++key) {
+            Part_->SetValue(key, key);
+        }
+    });
+    BuildSnapshot(/*snapshotId*/ 1, /*baseSnapshotId*/ std::nullopt);
+
+    RunInAutomatonThread([&] {
+        Part_->SetValue(10, 1000);
+        Part_->RemoveValue(20);
+        Part_->SetValue(200, 200);
+    });
+    BuildSnapshot(/*snapshotId*/ 2, /*baseSnapshotId*/ 1);
+    EXPECT_LT(Snapshots_[2].Size(), Snapshots_[1].Size());
+
+    RunInAutomatonThread([&] {
+        Part_->SetValue(11, 1100);
+        Part_->RemoveValue(200);
+        Part_->SetValue(20, 2000);
+    });
+    BuildSnapshot(/*snapshotId*/ 3, /*baseSnapshotId*/ 2);
+
+    auto expectedValues = GetValues();
+    EXPECT_EQ(100, std::ssize(expectedValues));
+
+    // Loading the last delta pulls in the whole chain.
+    Recover(/*snapshotId*/ 3);
+    EXPECT_EQ(expectedValues, GetValues());
+
+    // Changes made after recovery go to the next delta on top of the recovered state.
+    RunInAutomatonThread([&] {
+        Part_->SetValue(12, 1200);
+    });
+    expectedValues[12] = 1200;
+    BuildSnapshot(/*snapshotId*/ 4, /*baseSnapshotId*/ 3);
+
+    Recover(/*snapshotId*/ 4);
+    EXPECT_EQ(expectedValues, GetValues());
+}
+
+TEST_F(TCompositeAutomatonDeltaSnapshotTest, RecoverFromIntermediateSnapshot)
+{
+    RunInAutomatonThread([&] {
+        Part_->SetValue(1, 1);
+        Part_->SetValue(2, 2);
+    });
+    BuildSnapshot(/*snapshotId*/ 1, /*baseSnapshotId*/ std::nullopt);
+
+    RunInAutomatonThread([&] {
+        Part_->SetValue(1, 10);
+    });
+    BuildSnapshot(/*snapshotId*/ 2, /*baseSnapshotId*/ 1);
+
+    RunInAutomatonThread([&] {
+        Part_->SetValue(2, 20);
+    });
+    BuildSnapshot(/*snapshotId*/ 3, /*baseSnapshotId*/ 2);
+
+    Recover(/*snapshotId*/ 2);
+    EXPECT_EQ((THashMap<int, int>{{1, 10}, {2, 2}}), GetValues());
+
+    Recover(/*snapshotId*/ 1);
+    EXPECT_EQ((THashMap<int, int>{{1, 1}, {2, 2}}), GetValues());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NHydra
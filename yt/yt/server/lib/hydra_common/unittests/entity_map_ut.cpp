@@ -0,0 +1,283 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/server/lib/hydra_common/checkpointable_stream.h>
+#include <yt/yt/server/lib/hydra_common/entity_map.h>
+#include <yt/yt/server/lib/hydra_common/serialize.h>
+
+#include <yt/yt/core/concurrency/thread_pool.h>
+
+#include <util/stream/str.h>
+
+namespace NYT::NHydra {
+namespace {
+
+using namespace NConcurrency;
+
+////////////////////////////////////////////////////////////////////////////////
+
+DECLARE_ENTITY_TYPE(TTestEntity, int, ::THash<int>)
+
+std::vector<int> FixupOrder;
+
+class TTestEntity
+    : public TEntityBase
+{
+public:
+    const int Key;
+    int Value = 0;
+    TTestEntity* Peer = nullptr;
+
+    explicit TTestEntity(int key)
+        : Key(key)
+    { }
+
+    void Save(TSaveContext& context) const
+    {
+        using NYT::Save;
+        Save(context, Value);
+        Save(context, Peer->GetDynamicData()->SerializationKey);
+    }
+
+    void Load(TLoadContext& context)
+    {
+        using NYT::Load;
+        Load(context, Value);
+        Peer = context.GetRawEntity<TTestEntity>(Load<TEntitySerializationKey>(context));
+        context.RegisterFixup(BIND([key = Key] {
+            FixupOrder.push_back(key);
+        }));
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TEntityMapParallelTest
+    : public ::testing::TestWithParam<int>
+{ };
+
+TEST_P(TEntityMapParallelTest, SaveLoad)
+{
+    constexpr int EntityCount = 1000;
+
+    auto threadCount = GetParam();
+    auto threadPool = threadCount > 0
+        ? CreateThreadPool(threadCount, "EntityMap")
+        : nullptr;
+
+    TEntityMap<TTestEntity> map;
+    std::vector<TTestEntity*> entities;
+    for (int key = 0; key < EntityCount; ++key) {
+        entities.push_back(map.Insert(key, std::make_unique<TTestEntity>(key)));
+        entities.back()->Value = key * key;
+    }
+    for (int key = 0; key < EntityCount; ++key) {
+        entities[key]->Peer = entities[(key + 1) % EntityCount];
+    }
+
+    TStringStream stream;
+    {
+        auto output = CreateBufferedCheckpointableOutputStream(&stream);
+        TSaveContext context(output.get(), /*version*/ 0, threadPool);
+        map.SaveKeys(context);
+        map.SaveValuesParallel(context);
+        context.Finish();
+        output->Flush();
+    }
+
+    FixupOrder.clear();
+
+    TEntityMap<TTestEntity> loadedMap;
+    {
+        TStringInput input(stream.Str());
+        auto checkpointableInput = CreateCheckpointableInputStream(&input);
+        TLoadContext context(checkpointableInput.get(), threadPool);
+        loadedMap.LoadKeys(context);
+        loadedMap.LoadValuesParallel(context);
+    }
+
+    ASSERT_EQ(EntityCount, loadedMap.GetSize());
+    for (int key = 0; key < EntityCount; ++key) {
+        auto* entity = loadedMap.Get(key);
+        EXPECT_EQ(key * key, entity->Value);
+        EXPECT_EQ(loadedMap.Get((key + 1) % EntityCount), entity->Peer);
+    }
+
+    ASSERT_EQ(EntityCount, std::ssize(FixupOrder));
+    for (int key = 0; key < EntityCount; ++key) {
+        EXPECT_EQ(key, FixupOrder[key]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TEntityMapParallelTest,
+    TEntityMapParallelTest,
+    ::testing::Values(0, 1, 4));
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <class TTraits>
+TString SaveMap(const TEntityMap<TTestEntity, TTraits>& map, bool delta)
+{
+    TStringStream stream;
+    auto output = CreateBufferedCheckpointableOutputStream(&stream);
+    TSaveContext context(output.get(), /*version*/ 0);
+    context.SetDeltaSnapshot(delta);
+    map.SaveKeys(context);
+    map.SaveValues(context);
+    context.Finish();
+    output->Flush();
+    return stream.Str();
+}
+
+template <class TTraits>
+void LoadMap(TEntityMap<TTestEntity, TTraits>* map, const TString& data, bool delta)
+{
+    TStringInput input(data);
+    auto checkpointableInput = CreateCheckpointableInputStream(&input);
+    TLoadContext context(checkpointableInput.get());
+    context.SetDeltaSnapshot(delta);
+    map->LoadKeys(context);
+    map->LoadValues(context);
+}
+
+TEST(TEntityMapTest, DeltaSaveLoad)
+{
+    constexpr int EntityCount = 10;
+
+    TEntityMap<TTestEntity> map;
+    map.EnableDirtyTracking();
+    for (int key = 0; key < EntityCount; ++key) {
+        map.Insert(key, std::make_unique<TTestEntity>(key))->Value = key;
+    }
+    for (int key = 0; key < EntityCount; ++key) {
+        map.Get(key)->Peer = map.Get((key + 1) % EntityCount);
+    }
+
+    auto fullSnapshot = SaveMap(map, /*delta*/ false);
+    map.ResetDirty();
+
+    map.Get(3)->Value = 42;
+    map.MarkDirty(3);
+
+    map.Remove(5);
+    map.Get(4)->Peer = map.Get(6);
+    map.MarkDirty(4);
+
+    auto* inserted = map.Insert(EntityCount, std::make_unique<TTestEntity>(EntityCount));
+    inserted->Value = 100;
+    inserted->Peer = map.Get(0);
+    map.Get(9)->Peer = inserted;
+    map.MarkDirty(9);
+
+    auto deltaSnapshot = SaveMap(map, /*delta*/ true);
+    EXPECT_LT(deltaSnapshot.size(), fullSnapshot.size());
+
+    TEntityMap<TTestEntity> loadedMap;
+    loadedMap.EnableDirtyTracking();
+    LoadMap(&loadedMap, fullSnapshot, /*delta*/ false);
+    auto* unchanged = loadedMap.Get(0);
+    LoadMap(&loadedMap, deltaSnapshot, /*delta*/ true);
+
+    ASSERT_EQ(map.GetSize(), loadedMap.GetSize());
+    EXPECT_FALSE(loadedMap.Contains(5));
+    // Unchanged entities are kept in place.
+    EXPECT_EQ(unchanged, loadedMap.Get(0));
+    for (auto [key, entity] : map) {
+        auto* loadedEntity = loadedMap.Get(key);
+        EXPECT_EQ(entity->Value, loadedEntity->Value);
+        EXPECT_EQ(entity->Peer->Key, loadedEntity->Peer->Key);
+        EXPECT_EQ(loadedMap.Get(entity->Peer->Key), loadedEntity->Peer);
+    }
+}
+
+struct TCreateOnlyTestEntityTraits
+{
+    std::unique_ptr<TTestEntity> Create(int key) const
+    {
+        return std::make_unique<TTestEntity>(key);
+    }
+};
+
+struct TResettingTestEntityTraits
+{
+    std::vector<int>* ResetKeys;
+
+    std::unique_ptr<TTestEntity> Create(int key) const
+    {
+        return std::make_unique<TTestEntity>(key);
+    }
+
+    void Reset(TTestEntity* value, int key) const
+    {
+        ResetKeys->push_back(key);
+        value->~TTestEntity();
+        new (value) TTestEntity(key);
+    }
+};
+
+template <class TTraits>
+void FillCyclicMap(TEntityMap<TTestEntity, TTraits>* map, int entityCount)
+{
+    for (int key = 0; key < entityCount; ++key) {
+        map->Insert(key, std::make_unique<TTestEntity>(key))->Value = key;
+    }
+    for (int key = 0; key < entityCount; ++key) {
+        map->Get(key)->Peer = map->Get((key + 1) % entityCount);
+    }
+}
+
+TEST(TEntityMapTest, DeltaLoadResetsThroughTraits)
+{
+    std::vector<int> resetKeys;
+    TResettingTestEntityTraits traits{.ResetKeys = &resetKeys};
+
+    TEntityMap<TTestEntity, TResettingTestEntityTraits> map(traits);
+    map.EnableDirtyTracking();
+    FillCyclicMap(&map, /*entityCount*/ 4);
+
+    auto fullSnapshot = SaveMap(map, /*delta*/ false);
+    map.ResetDirty();
+
+    map.Get(2)->Value = 42;
+    map.MarkDirty(2);
+    auto deltaSnapshot = SaveMap(map, /*delta*/ true);
+
+    TEntityMap<TTestEntity, TResettingTestEntityTraits> loadedMap(traits);
+    LoadMap(&loadedMap, fullSnapshot, /*delta*/ false);
+    auto* dirty = loadedMap.Get(2);
+    LoadMap(&loadedMap, deltaSnapshot, /*delta*/ true);
+
+    EXPECT_EQ(std::vector<int>{2}, resetKeys);
+    // Reset entities stay in place since unchanged ones may refer to them.
+    EXPECT_EQ(dirty, loadedMap.Get(2));
+    EXPECT_EQ(dirty, loadedMap.Get(1)->Peer);
+    EXPECT_EQ(42, dirty->Value);
+    EXPECT_EQ(loadedMap.Get(3), dirty->Peer);
+}
+
+TEST(TEntityMapTest, DeltaLoadRequiresResettableTraits)
+{
+    TEntityMap<TTestEntity, TCreateOnlyTestEntityTraits> map;
+    map.EnableDirtyTracking();
+    FillCyclicMap(&map, /*entityCount*/ 4);
+
+    auto fullSnapshot = SaveMap(map, /*delta*/ false);
+    map.ResetDirty();
+
+    // Deltas without dirty entities need no reset.
+    auto cleanDeltaSnapshot = SaveMap(map, /*delta*/ true);
+    map.MarkDirty(1);
+    auto dirtyDeltaSnapshot = SaveMap(map, /*delta*/ true);
+
+    TEntityMap<TTestEntity, TCreateOnlyTestEntityTraits> loadedMap;
+    LoadMap(&loadedMap, fullSnapshot, /*delta*/ false);
+    EXPECT_NO_THROW(LoadMap(&loadedMap, cleanDeltaSnapshot, /*delta*/ true));
+    EXPECT_THROW_WITH_SUBSTRING(
+        LoadMap(&loadedMap, dirtyDeltaSnapshot, /*delta*/ true),
+        "cannot be loaded from delta snapshots");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NHydra
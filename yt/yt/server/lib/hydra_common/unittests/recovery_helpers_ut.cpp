@@ -0,0 +1,237 @@
+#include <yt/yt/server/lib/hydra_common/recovery_helpers.h>
+
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/core/concurrency/action_queue.h>
+
+#include <yt/yt/core/misc/serialize.h>
+
+namespace NYT::NHydra {
+namespace {
+
+using namespace NConcurrency;
+
+////////////////////////////////////////////////////////////////////////////////
+
+TString MakeSnapshotFile(TStringBuf meta, TStringBuf body)
+{
+    TSnapshotHeader header{};
+    header.Signature = TSnapshotHeader::ExpectedSignature;
+    header.SnapshotId = 1;
+    header.CompressedLength = body.size();
+    header.UncompressedLength = body.size();
+    header.Checksum = GetChecksum(TRef::FromStringBuf(body));
+    header.MetaSize = meta.size();
+
+    TString file;
+    file.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.append(meta);
+    file.append(AlignUpSpace<size_t>(meta.size(), SerializationAlignment), '\0');
+    file.append(body);
+    return file;
+}
+
+void AppendInBlocks(TSnapshotChecksumVerifier* verifier, TStringBuf file, i64 blockSize)
+{
+    for (i64 offset = 0; offset < std::ssize(file); offset += blockSize) {
+        verifier->Append(TRef::FromStringBuf(file.SubStr(offset, blockSize)));
+    }
+}
+
+TEST(TSnapshotChecksumVerifierTest, AcceptsAnySplit)
+{
+    auto file = MakeSnapshotFile("meta", "snapshot body");
+    for (i64 blockSize = 1; blockSize <= std::ssize(file); ++blockSize) {
+        TSnapshotChecksumVerifier verifier;
+        AppendInBlocks(&verifier, file, blockSize);
+        EXPECT_NO_THROW(verifier.Verify());
+    }
+}
+
+TEST(TSnapshotChecksumVerifierTest, HeaderSplitAcrossBlocks)
+{
+    auto file = MakeSnapshotFile("meta", "snapshot body");
+    for (i64 splitOffset = 1; splitOffset < static_cast<i64>(sizeof(TSnapshotHeader)); ++splitOffset) {
+        TSnapshotChecksumVerifier verifier;
+        verifier.Append(TRef::FromStringBuf(TStringBuf(file).SubStr(0, splitOffset)));
+        verifier.Append(TRef::FromStringBuf(TStringBuf(file).SubStr(splitOffset)));
+        EXPECT_NO_THROW(verifier.Verify());
+    }
+}
+
+TEST(TSnapshotChecksumVerifierTest, Truncated)
+{
+    auto file = MakeSnapshotFile("meta", "snapshot body");
+
+    {
+        TSnapshotChecksumVerifier verifier;
+        AppendInBlocks(&verifier, TStringBuf(file).SubStr(0, sizeof(TSnapshotHeader) - 1), 7);
+        EXPECT_THROW_WITH_SUBSTRING(verifier.Verify(), "truncated");
+    }
+
+    {
+        TSnapshotChecksumVerifier verifier;
+        AppendInBlocks(&verifier, TStringBuf(file).SubStr(0, sizeof(TSnapshotHeader) + 2), 7);
+        EXPECT_THROW_WITH_SUBSTRING(verifier.Verify(), "truncated");
+    }
+
+    {
+        TSnapshotChecksumVerifier verifier;
+        AppendInBlocks(&verifier, TStringBuf(file).SubStr(0, file.size() - 3), 7);
+        EXPECT_THROW_WITH_SUBSTRING(verifier.Verify(), "checksum mismatch");
+    }
+}
+
+TEST(TSnapshotChecksumVerifierTest, BadSignature)
+{
+    auto file = MakeSnapshotFile("meta", "snapshot body");
+    file[0] ^= 1;
+
+    TSnapshotChecksumVerifier verifier;
+    // The header is only complete with the second block.
+    verifier.Append(TRef::FromStringBuf(TStringBuf(file).SubStr(0, 5)));
+    EXPECT_THROW_WITH_SUBSTRING(
+        verifier.Append(TRef::FromStringBuf(TStringBuf(file).SubStr(5))),
+        "invalid signature");
+}
+
+TEST(TSnapshotChecksumVerifierTest, ChecksumMismatch)
+{
+    auto file = MakeSnapshotFile("meta", "snapshot body");
+    file[file.size() - 1] ^= 1;
+
+    TSnapshotChecksumVerifier verifier;
+    AppendInBlocks(&verifier, file, 16);
+    EXPECT_THROW_WITH_SUBSTRING(verifier.Verify(), "checksum mismatch");
+}
+
+TEST(TSnapshotChecksumVerifierTest, MetaIsNotChecksummed)
+{
+    auto file = MakeSnapshotFile("meta", "snapshot body");
+    file[sizeof(TSnapshotHeader)] ^= 1;
+
+    TSnapshotChecksumVerifier verifier;
+    AppendInBlocks(&verifier, file, 16);
+    EXPECT_NO_THROW(verifier.Verify());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TChangelogPrefetcherTest
+    : public ::testing::Test
+{
+protected:
+    static constexpr int FirstChangelogId = 10;
+    static constexpr int LastChangelogId = 13;
+
+    const TActionQueuePtr ActionQueue_ = New<TActionQueue>("Prefetch");
+
+    std::vector<TPromise<void>> Promises_;
+    std::atomic<int> StartedCount_ = 0;
+
+    void SetUp() override
+    {
+        for (int changelogId = FirstChangelogId; changelogId <= LastChangelogId; ++changelogId) {
+            Promises_.push_back(NewPromise<void>());
+        }
+    }
+
+    void TearDown() override
+    {
+        // NB: All prefetches are complete by now; let the prefetcher finish before the fixture dies.
+        Drain();
+    }
+
+    TChangelogPrefetcherPtr CreatePrefetcher(int maxConcurrentPrefetches)
+    {
+        return New<TChangelogPrefetcher>(
+            FirstChangelogId,
+            LastChangelogId,
+            maxConcurrentPrefetches,
+            BIND([this] (int changelogId) {
+                ++StartedCount_;
+                return Promises_[changelogId - FirstChangelogId].ToFuture();
+            }),
+            ActionQueue_->GetInvoker());
+    }
+
+    //! Waits until the prefetcher blocks waiting for a prefetch to complete.
+    void Drain()
+    {
+        WaitFor(BIND([] { })
+            .AsyncVia(ActionQueue_->GetInvoker())
+            .Run())
+            .ThrowOnError();
+    }
+};
+
+TEST_F(TChangelogPrefetcherTest, HandsOverResults)
+{
+    auto prefetcher = CreatePrefetcher(/*maxConcurrentPrefetches*/ 4);
+    prefetcher->Start();
+    Drain();
+    EXPECT_EQ(4, StartedCount_.load());
+
+    EXPECT_FALSE(prefetcher->ExtractPrefetchResult(FirstChangelogId - 1));
+    EXPECT_FALSE(prefetcher->ExtractPrefetchResult(LastChangelogId + 1));
+
+    auto future = prefetcher->ExtractPrefetchResult(FirstChangelogId);
+    ASSERT_TRUE(future);
+    EXPECT_FALSE(future.IsSet());
+    Promises_[0].Set();
+    EXPECT_TRUE(future.Get().IsOK());
+
+    // Each result is handed over once.
+    EXPECT_FALSE(prefetcher->ExtractPrefetchResult(FirstChangelogId));
+
+    for (int index = 1; index < std::ssize(Promises_); ++index) {
+        Promises_[index].Set();
+    }
+}
+
+TEST_F(TChangelogPrefetcherTest, BoundsConcurrency)
+{
+    auto prefetcher = CreatePrefetcher(/*maxConcurrentPrefetches*/ 2);
+    prefetcher->Start();
+    Drain();
+    EXPECT_EQ(2, StartedCount_.load());
+
+    // Completing a later prefetch does not free a slot.
+    Promises_[1].Set();
+    Drain();
+    EXPECT_EQ(2, StartedCount_.load());
+
+    Promises_[0].Set();
+    Drain();
+    EXPECT_EQ(4, StartedCount_.load());
+
+    Promises_[2].Set();
+    Promises_[3].Set();
+    for (int changelogId = FirstChangelogId; changelogId <= LastChangelogId; ++changelogId) {
+        EXPECT_TRUE(prefetcher->ExtractPrefetchResult(changelogId).Get().IsOK());
+    }
+}
+
+TEST_F(TChangelogPrefetcherTest, FailureDoesNotStopPrefetching)
+{
+    auto prefetcher = CreatePrefetcher(/*maxConcurrentPrefetches*/ 1);
+    prefetcher->Start();
+    Drain();
+    EXPECT_EQ(1, StartedCount_.load());
+
+    Promises_[0].Set(TError("Download failed"));
+    Drain();
+    EXPECT_EQ(2, StartedCount_.load());
+
+    EXPECT_FALSE(prefetcher->ExtractPrefetchResult(FirstChangelogId).Get().IsOK());
+
+    for (int index = 1; index < std::ssize(Promises_); ++index) {
+        Promises_[index].Set();
+    }
+    EXPECT_TRUE(prefetcher->ExtractPrefetchResult(LastChangelogId).Get().IsOK());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NHydra
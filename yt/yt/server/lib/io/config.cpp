@@ -163,4 +163,108 @@ void TGentleLoaderConfig::Register(TRegistrar registrar)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void TReadaheadConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("enable", &TThis::Enable)
+        .Default(false);
+    registrar.Parameter("sequential_read_threshold", &TThis::SequentialReadThreshold)
+        .GreaterThanOrEqual(1)
+        .Default(2);
+    registrar.Parameter("min_readahead_size", &TThis::MinReadaheadSize)
+        .GreaterThan(0)
+        .Default(1_MB);
+    registrar.Parameter("max_readahead_size", &TThis::MaxReadaheadSize)
+        .GreaterThan(0)
+        .Default(16_MB);
+    registrar.Parameter("memory_limit", &TThis::MemoryLimit)
+        .GreaterThanOrEqual(0)
+        .Default(256_MB);
+    registrar.Parameter("max_stream_count", &TThis::MaxStreamCount)
+        .GreaterThan(0)
+        .Default(1024);
+    registrar.Parameter("workload_categories", &TThis::WorkloadCategories)
+        .Default(THashSet<EWorkloadCategory>{
+            EWorkloadCategory::SystemArtifactCacheDownload,
+            EWorkloadCategory::SystemRepair,
+            EWorkloadCategory::SystemReincarnation,
+            EWorkloadCategory::SystemReplication,
+            EWorkloadCategory::SystemMerge,
+            EWorkloadCategory::SystemTabletCompaction,
+            EWorkloadCategory::SystemTabletPartitioning,
+            EWorkloadCategory::SystemTabletPreload,
+            EWorkloadCategory::UserBatch,
+        });
+
+    registrar.Postprocessor([] (TThis* config) {
+        if (config->MinReadaheadSize > config->MaxReadaheadSize) {
+            THROW_ERROR_EXCEPTION("\"min_readahead_size\" must not exceed \"max_readahead_size\"")
+                << TErrorAttribute("min_readahead_size", config->MinReadaheadSize)
+                << TErrorAttribute("max_readahead_size", config->MaxReadaheadSize);
+        }
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TDiskSchedulerConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("enable", &TThis::Enable)
+        .Default(false);
+    registrar.Parameter("interactive_categories", &TThis::InteractiveCategories)
+        .Default(THashSet<EWorkloadCategory>{
+            EWorkloadCategory::SystemTabletLogging,
+            EWorkloadCategory::SystemTabletRecovery,
+            EWorkloadCategory::UserDynamicStoreRead,
+            EWorkloadCategory::UserInteractive,
+            EWorkloadCategory::UserRealtime,
+        });
+    registrar.Parameter("background_categories", &TThis::BackgroundCategories)
+        .Default(THashSet<EWorkloadCategory>{
+            EWorkloadCategory::Idle,
+            EWorkloadCategory::SystemMerge,
+            EWorkloadCategory::SystemTabletCompaction,
+            EWorkloadCategory::SystemTabletPartitioning,
+        });
+    registrar.Parameter("interactive_latency_target", &TThis::InteractiveLatencyTarget)
+        .Default(TDuration::MilliSeconds(20));
+    registrar.Parameter("min_in_flight_request_count", &TThis::MinInFlightRequestCount)
+        .GreaterThan(0)
+        .Default(2);
+    registrar.Parameter("max_in_flight_request_count", &TThis::MaxInFlightRequestCount)
+        .GreaterThan(0)
+        .Default(64);
+    registrar.Parameter("adjustment_period", &TThis::AdjustmentPeriod)
+        .Default(TDuration::MilliSeconds(100));
+    registrar.Parameter("in_flight_limit_decrease_factor", &TThis::InFlightLimitDecreaseFactor)
+        .GreaterThan(0)
+        .LessThan(1)
+        .Default(0.5);
+    registrar.Parameter("batch_weight", &TThis::BatchWeight)
+        .GreaterThan(0)
+        .Default(4);
+    registrar.Parameter("background_weight", &TThis::BackgroundWeight)
+        .GreaterThan(0)
+        .Default(1);
+    registrar.Parameter("batch_deadline", &TThis::BatchDeadline)
+        .Default(TDuration::Seconds(1));
+    registrar.Parameter("background_deadline", &TThis::BackgroundDeadline)
+        .Default(TDuration::Seconds(10));
+
+    registrar.Postprocessor([] (TThis* config) {
+        if (config->MinInFlightRequestCount > config->MaxInFlightRequestCount) {
+            THROW_ERROR_EXCEPTION("\"min_in_flight_request_count\" must not exceed \"max_in_flight_request_count\"")
+                << TErrorAttribute("min_in_flight_request_count", config->MinInFlightRequestCount)
+                << TErrorAttribute("max_in_flight_request_count", config->MaxInFlightRequestCount);
+        }
+        for (auto category : config->InteractiveCategories) {
+            if (config->BackgroundCategories.contains(category)) {
+                THROW_ERROR_EXCEPTION("Workload category %Qlv cannot be both interactive and background",
+                    category);
+            }
+        }
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace NYT::NIO
@@ -178,4 +178,78 @@ DEFINE_REFCOUNTED_TYPE(TGentleLoaderConfig)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+//! Controls readahead for sequential reads, see #CreateReadaheadIOEngine.
+struct TReadaheadConfig
+    : public NYTree::TYsonStruct
+{
+    bool Enable;
+
+    //! Number of consecutive adjacent reads of a file after which it is considered to be read sequentially.
+    int SequentialReadThreshold;
+
+    //! Initial readahead window size; doubles with every sequential read up to the maximum.
+    i64 MinReadaheadSize;
+    i64 MaxReadaheadSize;
+
+    //! Total size of readahead windows kept in memory; least recently used windows are dropped beyond it.
+    i64 MemoryLimit;
+
+    //! Number of files tracked by the sequential access detector.
+    int MaxStreamCount;
+
+    //! Workload categories whose reads may issue readahead.
+    //! Reads of other categories are never enlarged but may still be served from existing windows.
+    THashSet<EWorkloadCategory> WorkloadCategories;
+
+    REGISTER_YSON_STRUCT(TReadaheadConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TReadaheadConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Controls disk request scheduling, see #CreateSchedulingIOEngine.
+struct TDiskSchedulerConfig
+    : public NYTree::TYsonStruct
+{
+    bool Enable;
+
+    //! Workload categories whose requests bypass the queues and are subject to the latency target.
+    THashSet<EWorkloadCategory> InteractiveCategories;
+    //! Workload categories whose requests are served with the lowest share.
+    //! Requests of categories not listed here nor above are considered batch ones.
+    THashSet<EWorkloadCategory> BackgroundCategories;
+
+    //! Interactive request latency the in-flight limit is adjusted for.
+    TDuration InteractiveLatencyTarget;
+
+    //! Bounds of the number of non-interactive requests passed to the disk at once.
+    int MinInFlightRequestCount;
+    int MaxInFlightRequestCount;
+
+    //! The in-flight limit is adjusted at most once per this period: it is multiplied
+    //! by |in_flight_limit_decrease_factor| if interactive latency exceeds the target
+    //! and is incremented by one otherwise.
+    TDuration AdjustmentPeriod;
+    double InFlightLimitDecreaseFactor;
+
+    //! Shares of the in-flight limit (measured in bytes) given to batch and background requests.
+    double BatchWeight;
+    double BackgroundWeight;
+
+    //! Queued requests waiting for longer than these are admitted ahead of the shares.
+    TDuration BatchDeadline;
+    TDuration BackgroundDeadline;
+
+    REGISTER_YSON_STRUCT(TDiskSchedulerConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TDiskSchedulerConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace NYT::NIO
@@ -2,6 +2,8 @@
 #include "io_engine_base.h"
 #include "io_engine_uring.h"
 #include "io_request_slicer.h"
+#include "readahead_io_engine.h"
+#include "scheduling_io_engine.h"
 #include "private.h"
 
 #include <yt/yt/core/concurrency/action_queue.h>
@@ -706,7 +708,9 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////
 
-IIOEnginePtr CreateIOEngine(
+namespace {
+
+IIOEnginePtr DoCreateIOEngine(
     EIOEngineType engineType,
     NYTree::INodePtr ioConfig,
     TString locationId,
@@ -745,6 +749,34 @@ IIOEnginePtr CreateIOEngine(
     }
 }
 
+} // namespace
+
+IIOEnginePtr CreateIOEngine(
+    EIOEngineType engineType,
+    NYTree::INodePtr ioConfig,
+    TString locationId,
+    TProfiler profiler,
+    NLogging::TLogger logger)
+{
+    auto engine = DoCreateIOEngine(
+        engineType,
+        ioConfig,
+        std::move(locationId),
+        profiler,
+        logger);
+    // NB: Readahead goes on top so that prefetching is scheduled along with the reads it is issued for.
+    engine = CreateSchedulingIOEngine(
+        std::move(engine),
+        ioConfig,
+        profiler,
+        logger);
+    return CreateReadaheadIOEngine(
+        std::move(engine),
+        std::move(ioConfig),
+        std::move(profiler),
+        std::move(logger));
+}
+
 std::vector<EIOEngineType> GetSupportedIOEngineTypes()
 {
     std::vector<EIOEngineType> result;
@@ -56,6 +56,11 @@ void TIOEngineConfigBase::Register(TRegistrar registrar)
 
     registrar.Parameter("use_direct_io_for_reads", &TThis::UseDirectIOForReads)
         .Default(EDirectIOPolicy::Never);
+
+    registrar.Parameter("readahead", &TThis::Readahead)
+        .DefaultNew();
+    registrar.Parameter("disk_scheduler", &TThis::DiskScheduler)
+        .DefaultNew();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -414,6 +419,7 @@ void TIOEngineBase::InitProfilerSensors()
         sensors.TotalTimeCounter = profiler.TimeCounter("/total_time");
         sensors.Counter = profiler.Counter("/request_count");
         sensors.InflightCounter = TInflightCounter::Create(profiler, "/inflight_count");
+        sensors.LatencyHistogram = profiler.Histogram("/latency", TDuration::MicroSeconds(10), TDuration::Seconds(10));
         return sensors;
     };
 
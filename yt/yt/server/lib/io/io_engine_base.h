@@ -1,6 +1,7 @@
 #pragma once
 
 #include "io_engine.h"
+#include "config.h"
 
 #include <yt/yt/core/ytree/yson_struct.h>
 
@@ -51,6 +52,9 @@ public:
 
     EDirectIOPolicy UseDirectIOForReads;
 
+    TReadaheadConfigPtr Readahead;
+    TDiskSchedulerConfigPtr DiskScheduler;
+
     REGISTER_YSON_STRUCT(TIOEngineConfigBase);
 
     static void Register(TRegistrar registrar);
@@ -97,6 +101,9 @@ struct TIOEngineSensors final
 
         // Currently executing requests count.
         TInflightCounter InflightCounter;
+
+        // Submit-to-complete time of a single kernel request (only tracked by uring engines).
+        NProfiling::TEventTimer LatencyHistogram;
     };
 
     NProfiling::TCounter WrittenBytesCounter;
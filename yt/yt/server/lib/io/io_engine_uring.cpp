@@ -8,11 +8,14 @@
 #include <yt/yt/core/concurrency/delayed_executor.h>
 #include <yt/yt/core/concurrency/moody_camel_concurrent_queue.h>
 #include <yt/yt/core/concurrency/notification_handle.h>
+#include <yt/yt/core/concurrency/thread_affinity.h>
 
 #include <yt/yt/core/misc/mpsc_fair_share_queue.h>
 
 #include <library/cpp/yt/containers/intrusive_linked_list.h>
 
+#include <library/cpp/yt/threading/spin_lock.h>
+
 #include <util/generic/size_literals.h>
 #include <util/generic/xrange.h>
 
@@ -35,6 +38,10 @@ static const auto& Logger = IOLogger;
 static constexpr int UringEngineNotificationCount = 2;
 static constexpr int MaxUringConcurrentRequestsPerThread = 128;
 static constexpr int MaxUringThreadCount = 16;
+static constexpr int MaxUringRegisteredBufferCount = 1024;
+static constexpr int MaxUringCompletionBatchSize = 64;
+
+static constexpr auto FixedFileSweepPeriod = TDuration::Seconds(1);
 
 // See SetRequestUserData/GetRequestUserData.
 static constexpr int MaxSubrequestCount = 1 << 16;
@@ -83,6 +90,17 @@ public:
     double UserInteractiveRequestWeight;
     double UserRealtimeRequestWeight;
 
+    //! Number of page-aligned buffers shared by all the urings of the engine and registered in each of them;
+    //! zero disables registered buffers.
+    //! Reads fitting into a buffer land right in it which spares the kernel from pinning user pages
+    //! for each request; the buffer returns to the engine once the caller releases the data read.
+    //! Ordinary buffers are used when all the registered ones are taken.
+    int RegisteredBufferCount;
+    i64 RegisteredBufferSize;
+
+    //! Number of file slots registered in each uring; zero disables fixed files.
+    int FixedFileCount;
+
     REGISTER_YSON_STRUCT(TUringIOEngineConfig);
 
     static void Register(TRegistrar registrar)
@@ -117,6 +135,26 @@ public:
         registrar.Parameter("user_realtime_request_weight", &TThis::UserRealtimeRequestWeight)
             .GreaterThanOrEqual(1)
             .Default(200);
+
+        registrar.Parameter("registered_buffer_count", &TThis::RegisteredBufferCount)
+            .GreaterThanOrEqual(0)
+            .LessThanOrEqual(MaxUringRegisteredBufferCount)
+            .Default(0);
+        registrar.Parameter("registered_buffer_size", &TThis::RegisteredBufferSize)
+            .GreaterThan(0)
+            .Default(64_KB);
+
+        registrar.Parameter("fixed_file_count", &TThis::FixedFileCount)
+            .GreaterThanOrEqual(0)
+            .Default(0);
+
+        registrar.Postprocessor([] (TThis* config) {
+            if (config->RegisteredBufferSize % DefaultPageSize != 0) {
+                THROW_ERROR_EXCEPTION("\"registered_buffer_size\" must be a multiple of %v",
+                    DefaultPageSize)
+                    << TErrorAttribute("registered_buffer_size", config->RegisteredBufferSize);
+            }
+        });
     }
 };
 
@@ -152,6 +190,19 @@ public:
         return result == 0 ? TError() : TError::FromSystem(-result);
     }
 
+    TError TryRegisterFilesSparse(int count)
+    {
+        int result = HandleUringEintr(io_uring_register_files_sparse, &Uring_, count);
+        return result == 0 ? TError() : TError::FromSystem(-result);
+    }
+
+    //! Replaces the file registered at #index; -1 #fd unregisters it.
+    TError TryUpdateRegisteredFile(int index, int fd)
+    {
+        int result = HandleUringEintr(io_uring_register_files_update, &Uring_, index, &fd, 1);
+        return result >= 0 ? TError() : TError::FromSystem(-result);
+    }
+
     io_uring_cqe* WaitCqe()
     {
         io_uring_cqe* cqe;
@@ -161,13 +212,31 @@ public:
         return cqe;
     }
 
-    io_uring_cqe* PeekCqe()
+    //! Returns null if no completion arrives within #timeout.
+    io_uring_cqe* WaitCqe(TDuration timeout)
     {
         io_uring_cqe* cqe;
-        bool result = ValidateUringNonBlockingResult(
-            HandleUringEintr(io_uring_peek_cqe, &Uring_, &cqe),
-            TStringBuf("io_uring_peek_cqe"));
-        return result ? cqe : nullptr;
+        auto timeoutSpec = __kernel_timespec{
+            .tv_sec = static_cast<long long>(timeout.Seconds()),
+            .tv_nsec = static_cast<long long>(timeout.NanoSecondsOfSecond()),
+        };
+        auto result = HandleUringEintr(io_uring_wait_cqe_timeout, &Uring_, &cqe, &timeoutSpec);
+        if (result == -ETIME) {
+            return nullptr;
+        }
+        CheckUringResult(result, TStringBuf("io_uring_wait_cqe_timeout"));
+        return cqe;
+    }
+
+    //! Fills #cqes with the available completions without consuming them, see #CqAdvance.
+    int PeekBatchCqe(TMutableRange<io_uring_cqe*> cqes)
+    {
+        return io_uring_peek_batch_cqe(&Uring_, cqes.Begin(), cqes.Size());
+    }
+
+    void CqAdvance(int count)
+    {
+        io_uring_cq_advance(&Uring_, count);
     }
 
     int GetSQSpaceLeft()
@@ -180,11 +249,6 @@ public:
         return io_uring_get_sqe(&Uring_);
     }
 
-    void CqeSeen(io_uring_cqe* cqe)
-    {
-        io_uring_cqe_seen(&Uring_, cqe);
-    }
-
     int Submit()
     {
         int count = 0;
@@ -218,17 +282,123 @@ private:
         YT_LOG_FATAL_IF(result < 0, TError::FromSystem(-result), "Uring %Qv call failed",
             callName);
     }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+DECLARE_REFCOUNTED_CLASS(TRegisteredBufferArena)
 
-    static bool ValidateUringNonBlockingResult(int result, TStringBuf callName)
+//! Page-aligned buffers of equal size registered in every uring of an engine.
+/*!
+ *  Read buffers are allocated here and handed over to the caller as is; a buffer
+ *  returns to the arena once the last reference to it is gone.
+ *
+ *  Thread affinity: any
+ */
+class TRegisteredBufferArena
+    : public TRefCounted
+{
+public:
+    TRegisteredBufferArena(int bufferCount, i64 bufferSize)
+        : BufferSize_(bufferSize)
+        , Arena_(TSharedMutableRef::AllocatePageAligned(
+            bufferCount * bufferSize,
+            {.InitializeStorage = false},
+            GetRefCountedTypeCookie<TRegisteredBufferTag>()))
+    {
+        FreeBufferIndexes_.reserve(bufferCount);
+        for (int index = bufferCount - 1; index >= 0; --index) {
+            FreeBufferIndexes_.push_back(index);
+        }
+    }
+
+    std::vector<iovec> GetIovs() const
     {
-        if (result == -EAGAIN) {
-            return false;
+        std::vector<iovec> iovs;
+        iovs.reserve(Arena_.Size() / BufferSize_);
+        for (auto* begin = Arena_.Begin(); begin < Arena_.End(); begin += BufferSize_) {
+            iovs.push_back({
+                .iov_base = begin,
+                .iov_len = static_cast<size_t>(BufferSize_),
+            });
         }
-        CheckUringResult(result, callName);
-        return true;
+        return iovs;
+    }
+
+    //! Returns null if #size does not fit into a buffer or all the buffers are taken.
+    TSharedMutableRef TryAllocate(i64 size)
+    {
+        if (size > BufferSize_) {
+            return {};
+        }
+
+        int index;
+        {
+            auto guard = Guard(Lock_);
+            if (FreeBufferIndexes_.empty()) {
+                return {};
+            }
+            index = FreeBufferIndexes_.back();
+            FreeBufferIndexes_.pop_back();
+        }
+
+        auto* begin = Arena_.Begin() + index * BufferSize_;
+        return TSharedMutableRef(begin, size, New<TBufferHolder>(MakeStrong(this), index));
+    }
+
+    //! Returns the index of the buffer #ref lies within or -1 if there is none.
+    int FindBufferIndex(TRef ref) const
+    {
+        if (ref.Empty() || ref.Begin() < Arena_.Begin() || ref.End() > Arena_.End()) {
+            return -1;
+        }
+
+        auto index = (ref.Begin() - Arena_.Begin()) / BufferSize_;
+        if (ref.End() > Arena_.Begin() + (index + 1) * BufferSize_) {
+            return -1;
+        }
+        return index;
+    }
+
+private:
+    struct TRegisteredBufferTag
+    { };
+
+    //! Returns the buffer to the arena once the data read is gone.
+    class TBufferHolder
+        : public TSharedRangeHolder
+    {
+    public:
+        TBufferHolder(TRegisteredBufferArenaPtr arena, int index)
+            : Arena_(std::move(arena))
+            , Index_(index)
+        { }
+
+        ~TBufferHolder()
+        {
+            Arena_->Release(Index_);
+        }
+
+    private:
+        const TRegisteredBufferArenaPtr Arena_;
+        const int Index_;
+    };
+
+    const i64 BufferSize_;
+    const TSharedMutableRef Arena_;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, Lock_);
+    std::vector<int> FreeBufferIndexes_;
+
+    void Release(int index)
+    {
+        auto guard = Guard(Lock_);
+        FreeBufferIndexes_.push_back(index);
     }
 };
 
+DEFINE_REFCOUNTED_TYPE(TRegisteredBufferArena)
+
 ////////////////////////////////////////////////////////////////////////////////
 
 using TUringIovBuffer = std::array<iovec, MaxIovCountPerRequest>;
@@ -246,8 +416,18 @@ struct TUringRequest
     EUringRequestType Type;
     std::optional<TRequestStatsGuard> RequestTimeGuard_;
 
+    //! Receives the submit-to-complete time of kernel requests, see #SetRequestUserData.
+    const NProfiling::TEventTimer* LatencyHistogram = nullptr;
+    NProfiling::TCpuInstant SubmitInstant = 0;
+
     virtual ~TUringRequest();
 
+    //! Returns the submission instant of the (only) kernel request in flight for #subrequestIndex.
+    virtual NProfiling::TCpuInstant* GetSubmitInstant(int /*subrequestIndex*/)
+    {
+        return &SubmitInstant;
+    }
+
     void StartTimeTracker(const TIOEngineSensors::TRequestSensors& sensors)
     {
         RequestTimeGuard_.emplace(sensors);
@@ -324,6 +504,7 @@ struct TFlushFileUringRequest
     : public TUringRequestBase<void>
 {
     IIOEngine::TFlushFileRequest FlushFileRequest;
+    bool FixedFile = false;
 };
 
 struct TAllocateUringRequest
@@ -338,6 +519,8 @@ struct TWriteUringRequest
     IIOEngine::TWriteRequest WriteRequest;
     int CurrentWriteSubrequestIndex = 0;
     TUringIovBuffer* WriteIovBuffer = nullptr;
+    //! Whether the kernel request in flight refers to the file registered in the uring.
+    bool FixedFile = false;
     i64 WrittenBytes = 0;
 
     int FinishedSubrequestCount = 0;
@@ -351,6 +534,8 @@ struct TReadUringRequest
     {
         iovec Iov;
         TMutableRef Buffer;
+        bool FixedFile = false;
+        NProfiling::TCpuInstant SubmitInstant = 0;
     };
 
     std::vector<IIOEngine::TReadRequest> ReadSubrequests;
@@ -364,6 +549,11 @@ struct TReadUringRequest
     explicit TReadUringRequest(IReadRequestCombinerPtr combiner)
         : ReadRequestCombiner(std::move(combiner))
     { }
+
+    NProfiling::TCpuInstant* GetSubmitInstant(int subrequestIndex) override
+    {
+        return &ReadSubrequestStates[subrequestIndex].SubmitInstant;
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -385,6 +575,10 @@ struct TUringConfigProvider final
     const std::optional<i64> SimulatedMaxBytesPerWrite;
     const int MaxBytesPerRead;
     const int MaxBytesPerWrite;
+    // NB: These cannot be changed dynamically.
+    const int RegisteredBufferCount;
+    const i64 RegisteredBufferSize;
+    const int FixedFileCount;
 
     YT_DECLARE_ATOMIC_FIELD(int, UringThreadCount)
     YT_DECLARE_ATOMIC_FIELD(int, MaxConcurrentRequestsPerThread)
@@ -400,6 +594,9 @@ struct TUringConfigProvider final
         , SimulatedMaxBytesPerWrite(config->SimulatedMaxBytesPerWrite)
         , MaxBytesPerRead(config->MaxBytesPerRead)
         , MaxBytesPerWrite(config->MaxBytesPerWrite)
+        , RegisteredBufferCount(config->RegisteredBufferCount)
+        , RegisteredBufferSize(config->RegisteredBufferSize)
+        , FixedFileCount(config->FixedFileCount)
     {
         Update(config);
     }
@@ -445,23 +642,78 @@ class TUringThread
     : public TThread
 {
 public:
-    TUringThread(IUringThreadPool* threadPool, TUringConfigProviderPtr config, int index, TIOEngineSensorsPtr sensors)
+    TUringThread(
+        IUringThreadPool* threadPool,
+        TUringConfigProviderPtr config,
+        int index,
+        TRegisteredBufferArenaPtr registeredBufferArena,
+        TIOEngineSensorsPtr sensors)
         : TThread(Format("%v:%v", threadPool->Name(), index))
         , ThreadPool_(threadPool)
         , Config_(std::move(config))
         , ThreadIndex_(index)
+        , RegisteredBufferArena_(std::move(registeredBufferArena))
         , Uring_(MaxUringConcurrentRequestsPerThread + UringEngineNotificationCount)
         , AllIovBuffers_(MaxUringConcurrentRequestsPerThread + UringEngineNotificationCount)
         , Sensors_(std::move(sensors))
     {
         InitIovBuffers();
+        InitRegisteredBuffers();
+        InitFixedFiles();
         Start();
     }
 
+    //! Unregisters the file of #handle in the uring and keeps it from being registered again.
+    /*!
+     *  Registration holds a reference to the file, so this must be done before the descriptor
+     *  is closed for the file (along with its locks) to be released right away.
+     *
+     *  The returned future is set once no kernel request refers to the registered file;
+     *  the requests that are yet to be submitted use the descriptor.
+     *
+     *  Thread affinity: any
+     */
+    TFuture<void> UnregisterFile(const TIOEngineHandlePtr& handle)
+    {
+        if (!FixedFilesEnabled_) {
+            return VoidFuture;
+        }
+
+        auto guard = Guard(FixedFilesLock_);
+
+        auto it = FindFixedFile(handle);
+        if (it == FixedFiles_.end()) {
+            // NB: Requests still queued must not register the file.
+            EmplaceOrCrash(FixedFiles_, handle.Get(), TFixedFile{
+                .Handle = handle,
+                .Closing = true,
+            });
+            return VoidFuture;
+        }
+
+        auto& file = it->second;
+        file.Closing = true;
+        if (file.Index < 0) {
+            return VoidFuture;
+        }
+
+        // NB: The slot may only be released once the requests referring to it are submitted.
+        if (file.InFlightCount > 0) {
+            if (!file.UnregisteredPromise) {
+                file.UnregisteredPromise = NewPromise<void>();
+            }
+            return file.UnregisteredPromise.ToFuture();
+        }
+
+        TryUnregisterFixedFile(&file);
+        return VoidFuture;
+    }
+
 private:
     IUringThreadPool* const ThreadPool_;
     const TUringConfigProviderPtr Config_;
     const int ThreadIndex_;
+    const TRegisteredBufferArenaPtr RegisteredBufferArena_;
 
     TUring Uring_;
 
@@ -482,8 +734,32 @@ private:
     std::array<ui64, UringEngineNotificationCount> NotificationReadBuffer_;
     std::array<iovec, UringEngineNotificationCount> NotificationIov_;
 
-    const TIOEngineSensorsPtr Sensors_;
+    bool RegisteredBuffersEnabled_ = false;
 
+    struct TFixedFile
+    {
+        //! Tells whether the key of #FixedFiles_ still refers to this handle, the memory may be reused.
+        TWeakPtr<TIOEngineHandle> Handle;
+        //! The slot the file is registered at or -1 if it is not registered.
+        int Index = -1;
+        //! Number of kernel requests (including the ones yet to be submitted) referring to #Index.
+        int InFlightCount = 0;
+        //! Set once the file is being closed; it is never registered again then.
+        bool Closing = false;
+        //! Set when #Index is released after the file has started closing, see #UnregisterFile.
+        TPromise<void> UnregisteredPromise;
+    };
+
+    using TFixedFileMap = THashMap<TIOEngineHandle*, TFixedFile>;
+
+    bool FixedFilesEnabled_ = false;
+    //! Fixed files may be unregistered by any thread, see #UnregisterFile.
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, FixedFilesLock_);
+    TFixedFileMap FixedFiles_;
+    std::vector<int> FreeFixedFileIndexes_;
+    NProfiling::TCpuInstant NextFixedFileSweepInstant_ = 0;
+
+    const TIOEngineSensorsPtr Sensors_;
 
     void InitIovBuffers()
     {
@@ -493,6 +769,42 @@ private:
         }
     }
 
+    void InitRegisteredBuffers()
+    {
+        if (!RegisteredBufferArena_) {
+            return;
+        }
+
+        if (auto error = Uring_.TryRegisterBuffers(RegisteredBufferArena_->GetIovs()); !error.IsOK()) {
+            YT_LOG_WARNING(error, "Failed to register uring buffers, falling back to ordinary ones (BufferCount: %v, BufferSize: %v)",
+                Config_->RegisteredBufferCount,
+                Config_->RegisteredBufferSize);
+            return;
+        }
+
+        RegisteredBuffersEnabled_ = true;
+    }
+
+    void InitFixedFiles()
+    {
+        auto fileCount = Config_->FixedFileCount;
+        if (fileCount == 0) {
+            return;
+        }
+
+        if (auto error = Uring_.TryRegisterFilesSparse(fileCount); !error.IsOK()) {
+            YT_LOG_WARNING(error, "Failed to register uring files, falling back to ordinary ones (FileCount: %v)",
+                fileCount);
+            return;
+        }
+
+        FixedFilesEnabled_ = true;
+        FreeFixedFileIndexes_.reserve(fileCount);
+        for (int index = fileCount - 1; index >= 0; --index) {
+            FreeFixedFileIndexes_.push_back(index);
+        }
+    }
+
     void StopPrologue() override
     {
         StopNotificationHandle_.Raise();
@@ -525,21 +837,23 @@ private:
 
     void ThreadMainStep()
     {
-        io_uring_cqe* cqe = GetCqe(true);
-        while (cqe) {
-            auto* userData = io_uring_cqe_get_data(cqe);
-            if (userData == reinterpret_cast<void*>(StopNotificationUserData)) {
-                YT_VERIFY(cqe->res == sizeof(ui64));
-                HandleStop();
-            } else if (userData == reinterpret_cast<void*>(RequestNotificationUserData)) {
-                YT_VERIFY(cqe->res == sizeof(ui64));
-                YT_VERIFY(RequestNotificationReadArmed_);
-                RequestNotificationReadArmed_ = false;
-            } else {
-                HandleCompletion(&*cqe);
-            }
+        bool hasFixedFiles;
+        {
+            auto guard = Guard(FixedFilesLock_);
+            hasFixedFiles = !FixedFiles_.empty();
+        }
+
+        // NB: Wake up periodically to release the files that are no longer used.
+        auto* cqe = hasFixedFiles
+            ? Uring_.WaitCqe(FixedFileSweepPeriod)
+            : Uring_.WaitCqe();
+        if (cqe) {
+            HandleCqes();
+        }
 
-            cqe = GetCqe(false);
+        if (FixedFilesEnabled_ && GetCpuInstant() >= NextFixedFileSweepInstant_) {
+            auto guard = Guard(FixedFilesLock_);
+            SweepFixedFiles();
         }
 
         while (UndersubmittedRequests_.GetSize() > 0 && CanHandleMoreSubmissions()) {
@@ -671,12 +985,23 @@ private:
                 subrequestState.Iov.iov_base,
                 subrequestState.Iov.iov_len);
 
-            io_uring_prep_readv(
-                sqe,
-                *subrequest.Handle,
-                &subrequestState.Iov,
-                1,
-                subrequest.Offset);
+            if (auto bufferIndex = FindRegisteredBufferIndex(buffer); bufferIndex >= 0) {
+                io_uring_prep_read_fixed(
+                    sqe,
+                    *subrequest.Handle,
+                    subrequestState.Iov.iov_base,
+                    subrequestState.Iov.iov_len,
+                    subrequest.Offset,
+                    bufferIndex);
+            } else {
+                io_uring_prep_readv(
+                    sqe,
+                    *subrequest.Handle,
+                    &subrequestState.Iov,
+                    1,
+                    subrequest.Offset);
+            }
+            subrequestState.FixedFile = SetFile(sqe, subrequest.Handle);
 
             SetRequestUserData(sqe, request, Sensors_->ReadSensors, subrequestIndex);
         }
@@ -704,6 +1029,7 @@ private:
             request->WrittenBytes,
             offset,
             flags);
+        request->FixedFile = SetFile(sqe, request->WriteRequest.Handle);
 
         SetRequestUserData(sqe, request, Sensors_->DataSyncSensors);
         return true;
@@ -769,12 +1095,28 @@ private:
                 }));
 
         auto* sqe = AllocateSqe();
-        io_uring_prep_writev(
-            sqe,
-            *request->WriteRequest.Handle,
-            &request->WriteIovBuffer->front(),
-            iovCount,
-            request->WriteRequest.Offset);
+        const auto& firstIov = request->WriteIovBuffer->front();
+        auto bufferIndex = iovCount == 1
+            ? FindRegisteredBufferIndex(TRef(firstIov.iov_base, firstIov.iov_len))
+            : -1;
+        if (bufferIndex >= 0) {
+            // E.g. the data read by this engine is written back.
+            io_uring_prep_write_fixed(
+                sqe,
+                *request->WriteRequest.Handle,
+                firstIov.iov_base,
+                firstIov.iov_len,
+                request->WriteRequest.Offset,
+                bufferIndex);
+        } else {
+            io_uring_prep_writev(
+                sqe,
+                *request->WriteRequest.Handle,
+                &request->WriteIovBuffer->front(),
+                iovCount,
+                request->WriteRequest.Offset);
+        }
+        request->FixedFile = SetFile(sqe, request->WriteRequest.Handle);
 
         SetRequestUserData(sqe, request, Sensors_->WriteSensors);
     }
@@ -803,13 +1145,15 @@ private:
 
         auto* sqe = AllocateSqe();
         io_uring_prep_fsync(sqe, *request->FlushFileRequest.Handle, GetSyncFlags(request->FlushFileRequest.Mode));
+        request->FixedFile = SetFile(sqe, request->FlushFileRequest.Handle);
         SetRequestUserData(sqe, request, Sensors_->SyncSensors);
     }
 
-    void HandleCompletion(const io_uring_cqe* cqe)
+    void HandleCompletion(const io_uring_cqe* cqe, TCpuInstant now)
     {
-        auto [request, _] = GetRequestUserData<TUringRequest>(cqe);
+        auto [request, subrequestIndex] = GetRequestUserData<TUringRequest>(cqe);
         request->StopTimeTracker();
+        request->LatencyHistogram->Record(CpuDurationToDuration(now - *request->GetSubmitInstant(subrequestIndex)));
         switch (request->Type) {
             case EUringRequestType::Read:
                 HandleReadCompletion(cqe);
@@ -837,6 +1181,10 @@ private:
         auto& subrequest = request->ReadSubrequests[subrequestIndex];
         auto& subrequestState = request->ReadSubrequestStates[subrequestIndex];
 
+        if (std::exchange(subrequestState.FixedFile, false)) {
+            ReleaseFixedFile(subrequest.Handle);
+        }
+
         if (cqe->res == 0 && subrequestState.Buffer.Size() > 0) {
             auto error = request->ReadRequestCombiner->CheckEof(subrequestState.Buffer);
             if (!error.IsOK()) {
@@ -891,6 +1239,10 @@ private:
         YT_LOG_TRACE("Handling write completion (Request: %p)",
             request);
 
+        if (std::exchange(request->FixedFile, false)) {
+            ReleaseFixedFile(request->WriteRequest.Handle);
+        }
+
         if (cqe->res < 0) {
             request->TrySetFailed(cqe);
             DisposeRequest(request);
@@ -936,6 +1288,10 @@ private:
         YT_LOG_TRACE("Handling sync completion (Request: %p)",
             request);
 
+        if (std::exchange(request->FixedFile, false)) {
+            ReleaseFixedFile(request->FlushFileRequest.Handle);
+        }
+
         request->TrySetFinished(cqe);
         DisposeRequest(request);
     }
@@ -1007,13 +1363,32 @@ private:
         }
     }
 
-    io_uring_cqe* GetCqe(bool wait)
+    void HandleCqes()
     {
-        io_uring_cqe* cqe = wait ? Uring_.WaitCqe() : Uring_.PeekCqe();
-        if (cqe == nullptr) {
-            YT_VERIFY(!wait);
-            return nullptr;
+        std::array<io_uring_cqe*, MaxUringCompletionBatchSize> cqes;
+        while (true) {
+            int count = Uring_.PeekBatchCqe(TMutableRange<io_uring_cqe*>(cqes));
+            if (count == 0) {
+                break;
+            }
+
+            auto now = GetCpuInstant();
+            for (int index = 0; index < count; ++index) {
+                HandleCqe(cqes[index], now);
+            }
+
+            // NB: Completions are only consumed once handled so that the kernel does not overwrite them.
+            Uring_.CqAdvance(count);
         }
+    }
+
+    void HandleCqe(const io_uring_cqe* cqe, TCpuInstant now)
+    {
+        // NB: Old kernels report wait timeouts via a dedicated completion, see io_uring_wait_cqe_timeout.
+        if (cqe->user_data == LIBURING_UDATA_TIMEOUT) {
+            return;
+        }
+
         auto userData = reinterpret_cast<intptr_t>(io_uring_cqe_get_data(cqe));
         if (userData != StopNotificationUserData && userData != RequestNotificationUserData) {
             --PendingSubmissionsCount_;
@@ -1022,8 +1397,166 @@ private:
         YT_LOG_TRACE("CQE received (PendingRequestCount: %v)",
             PendingSubmissionsCount_);
 
-        Uring_.CqeSeen(cqe);
-        return cqe;
+        if (userData == StopNotificationUserData) {
+            YT_VERIFY(cqe->res == sizeof(ui64));
+            HandleStop();
+        } else if (userData == RequestNotificationUserData) {
+            YT_VERIFY(cqe->res == sizeof(ui64));
+            YT_VERIFY(RequestNotificationReadArmed_);
+            RequestNotificationReadArmed_ = false;
+        } else {
+            HandleCompletion(cqe, now);
+        }
+    }
+
+    int FindRegisteredBufferIndex(TRef buffer) const
+    {
+        return RegisteredBuffersEnabled_
+            ? RegisteredBufferArena_->FindBufferIndex(buffer)
+            : -1;
+    }
+
+    //! Makes #sqe refer to the file registered in the uring if possible.
+    /*!
+     *  Returns |true| if so; the file must be released with #ReleaseFixedFile
+     *  once the request completes.
+     */
+    bool SetFile(io_uring_sqe* sqe, const TIOEngineHandlePtr& handle)
+    {
+        if (!FixedFilesEnabled_ || !handle->IsOpen()) {
+            return false;
+        }
+
+        auto index = AcquireFixedFileIndex(handle);
+        if (index < 0) {
+            return false;
+        }
+
+        sqe->fd = index;
+        sqe->flags |= IOSQE_FIXED_FILE;
+        return true;
+    }
+
+    int AcquireFixedFileIndex(const TIOEngineHandlePtr& handle)
+    {
+        auto guard = Guard(FixedFilesLock_);
+
+        if (auto it = FindFixedFile(handle); it != FixedFiles_.end()) {
+            auto& file = it->second;
+            if (file.Closing) {
+                return -1;
+            }
+            ++file.InFlightCount;
+            return file.Index;
+        }
+
+        if (FreeFixedFileIndexes_.empty()) {
+            SweepFixedFiles();
+            if (FreeFixedFileIndexes_.empty()) {
+                return -1;
+            }
+        }
+
+        auto index = FreeFixedFileIndexes_.back();
+        if (auto error = Uring_.TryUpdateRegisteredFile(index, *handle); !error.IsOK()) {
+            YT_LOG_DEBUG(error, "Failed to register file in uring (FD: %v)",
+                static_cast<FHANDLE>(*handle));
+            return -1;
+        }
+
+        FreeFixedFileIndexes_.pop_back();
+        EmplaceOrCrash(FixedFiles_, handle.Get(), TFixedFile{
+            .Handle = handle,
+            .Index = index,
+            .InFlightCount = 1,
+        });
+        return index;
+    }
+
+    void ReleaseFixedFile(const TIOEngineHandlePtr& handle)
+    {
+        TPromise<void> unregisteredPromise;
+        {
+            auto guard = Guard(FixedFilesLock_);
+
+            auto& file = GetOrCrash(FixedFiles_, handle.Get());
+            YT_VERIFY(file.InFlightCount > 0);
+            if (--file.InFlightCount > 0 || !file.Closing) {
+                return;
+            }
+
+            TryUnregisterFixedFile(&file);
+            unregisteredPromise = std::move(file.UnregisteredPromise);
+        }
+
+        // NB: The file is being closed, see #UnregisterFile.
+        if (unregisteredPromise) {
+            unregisteredPromise.Set();
+        }
+    }
+
+    //! Looks #handle up dropping the entry left by a dead handle at the same address.
+    TFixedFileMap::iterator FindFixedFile(const TIOEngineHandlePtr& handle)
+    {
+        VERIFY_SPINLOCK_AFFINITY(FixedFilesLock_);
+
+        auto it = FixedFiles_.find(handle.Get());
+        if (it == FixedFiles_.end() || it->second.Handle.Lock() == handle) {
+            return it;
+        }
+
+        // NB: Dead handles are never referred to by requests.
+        auto& file = it->second;
+        YT_VERIFY(file.InFlightCount == 0);
+        if (file.Index >= 0) {
+            // NB: The slot is lost if this fails; it must not be given to the new handle anyway.
+            TryUnregisterFixedFile(&file);
+        }
+        FixedFiles_.erase(it);
+        return FixedFiles_.end();
+    }
+
+    //! Unregisters the files whose handles are gone.
+    /*!
+     *  Registration holds a reference to the file, so this must be done promptly
+     *  for the space of removed files to be reclaimed.
+     */
+    void SweepFixedFiles()
+    {
+        VERIFY_SPINLOCK_AFFINITY(FixedFilesLock_);
+
+        NextFixedFileSweepInstant_ = GetCpuInstant() + DurationToCpuDuration(FixedFileSweepPeriod);
+
+        for (auto it = FixedFiles_.begin(); it != FixedFiles_.end(); ) {
+            auto current = it++;
+            auto& file = current->second;
+            if (file.InFlightCount > 0) {
+                continue;
+            }
+            // NB: Retry the failed unregistrations of closed files as well.
+            if (file.Index >= 0 && (file.Closing || file.Handle.IsExpired())) {
+                TryUnregisterFixedFile(&file);
+            }
+            if (file.Index < 0 && file.Handle.IsExpired()) {
+                FixedFiles_.erase(current);
+            }
+        }
+    }
+
+    void TryUnregisterFixedFile(TFixedFile* file)
+    {
+        VERIFY_SPINLOCK_AFFINITY(FixedFilesLock_);
+        YT_VERIFY(file->InFlightCount == 0);
+
+        auto index = file->Index;
+        if (auto error = Uring_.TryUpdateRegisteredFile(index, -1); !error.IsOK()) {
+            YT_LOG_WARNING(error, "Failed to unregister file in uring (Index: %v)",
+                index);
+            return;
+        }
+
+        FreeFixedFileIndexes_.push_back(index);
+        file->Index = -1;
     }
 
     io_uring_sqe* AllocateNonRequestSqe()
@@ -1062,6 +1595,8 @@ private:
         int subrequestIndex = 0)
     {
         request->StartTimeTracker(sensors);
+        request->LatencyHistogram = &sensors.LatencyHistogram;
+        *request->GetSubmitInstant(subrequestIndex) = GetCpuInstant();
 
         auto userData = reinterpret_cast<void*>(
             reinterpret_cast<uintptr_t>(request) |
@@ -1404,10 +1939,12 @@ public:
         TString threadNamePrefix,
         TString locationId,
         TUringIOEngineConfigPtr config,
+        TRegisteredBufferArenaPtr registeredBufferArena,
         TIOEngineSensorsPtr sensors,
         IInvokerPtr reconfigureInvoker)
         : Config_(New<TUringConfigProvider>(config))
         , ThreadNamePrefix_(std::move(threadNamePrefix))
+        , RegisteredBufferArena_(std::move(registeredBufferArena))
         , Sensors_(std::move(sensors))
         , ReconfigureInvoker_(std::move(reconfigureInvoker))
         , RequestQueue_(New<TQueue>(locationId, Config_))
@@ -1479,6 +2016,19 @@ public:
         ReconfigureQueueIfNeeded(result);
     }
 
+    //! Unregisters the file of #handle in all the urings, see #TUringThread::UnregisterFile.
+    TFuture<void> UnregisterFile(const TIOEngineHandlePtr& handle)
+    {
+        VERIFY_INVOKER_AFFINITY(ReconfigureInvoker_);
+
+        std::vector<TFuture<void>> futures;
+        futures.reserve(Threads_.size());
+        for (const auto& thread : Threads_) {
+            futures.push_back(thread->UnregisterFile(handle));
+        }
+        return AllSucceeded(std::move(futures));
+    }
+
     void ReconfigureQueueIfNeeded(EQueueSubmitResult result)
     {
         if (Y_LIKELY(result != EQueueSubmitResult::NeedReconfigure)) {
@@ -1493,6 +2043,7 @@ public:
 private:
     const TUringConfigProviderPtr Config_;
     const TString ThreadNamePrefix_;
+    const TRegisteredBufferArenaPtr RegisteredBufferArena_;
     const TIOEngineSensorsPtr Sensors_;
     const IInvokerPtr ReconfigureInvoker_;
 
@@ -1528,7 +2079,7 @@ private:
 
         while (std::ssize(Threads_) < newThreadCount) {
             auto threadIndex = Threads_.size();
-            auto thread = New<TUringThread>(this, Config_, threadIndex, Sensors_);
+            auto thread = New<TUringThread>(this, Config_, threadIndex, RegisteredBufferArena_, Sensors_);
             Threads_.push_back(std::move(thread));
         }
 
@@ -1573,10 +2124,14 @@ public:
         , StaticConfig_(std::move(config))
         , Config_(New<TUringConfigProvider>(StaticConfig_))
         , ReconfigureInvoker_(CreateSerializedInvoker(GetAuxPoolInvoker()))
+        , RegisteredBufferArena_(StaticConfig_->RegisteredBufferCount > 0
+            ? New<TRegisteredBufferArena>(StaticConfig_->RegisteredBufferCount, StaticConfig_->RegisteredBufferSize)
+            : nullptr)
         , ThreadPool_(New<TUringThreadPool>(
             Format("%v:%v", TRequestQueue::GetThreadPoolName(), LocationId_),
             LocationId_,
             StaticConfig_,
+            RegisteredBufferArena_,
             Sensors_,
             ReconfigureInvoker_))
     { }
@@ -1601,9 +2156,14 @@ public:
                 MaxSubrequestCount));
         }
 
+        TReadBufferAllocator allocator;
+        if (RegisteredBufferArena_) {
+            allocator = BIND(&TRegisteredBufferArena::TryAllocate, RegisteredBufferArena_);
+        }
+
         auto readRequestCombiner = useDedicatedAllocations
-            ? CreateDummyReadRequestCombiner()
-            : CreateReadRequestCombiner();
+            ? CreateDummyReadRequestCombiner(std::move(allocator))
+            : CreateReadRequestCombiner(std::move(allocator));
 
         auto combinedRequests = readRequestCombiner->Combine(
             std::move(requests),
@@ -1654,6 +2214,26 @@ public:
         return SubmitRequest<void>(std::move(uringRequest), category, { });
     }
 
+    TFuture<void> Close(
+        TCloseRequest request,
+        EWorkloadCategory category) override
+    {
+        if (StaticConfig_->FixedFileCount == 0) {
+            return TIOEngineBase::Close(std::move(request), category);
+        }
+
+        // NB: Otherwise the file would stay open (and locked) after the descriptor is closed
+        // until the next sweep, e.g. preventing the file from being reopened and locked again.
+        // The descriptor is only closed once the submitted requests no longer refer to the registered file.
+        auto handle = request.Handle;
+        return BIND(&TUringThreadPool::UnregisterFile, ThreadPool_, std::move(handle))
+            .AsyncVia(ReconfigureInvoker_)
+            .Run()
+            .Apply(BIND([this_ = MakeStrong(this), request = std::move(request), category] () mutable {
+                return this_->TIOEngineBase::Close(std::move(request), category);
+            }));
+    }
+
     virtual TFuture<void> FlushFileRange(
         TFlushFileRangeRequest /*request*/,
         EWorkloadCategory /*category*/,
@@ -1667,6 +2247,7 @@ private:
     const TConfigPtr StaticConfig_;
     const TUringConfigProviderPtr Config_;
     const IInvokerPtr ReconfigureInvoker_;
+    const TRegisteredBufferArenaPtr RegisteredBufferArena_;
     TUringThreadPoolPtr ThreadPool_;
 
     template <typename TUringResponse, typename TUringRequest>
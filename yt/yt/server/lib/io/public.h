@@ -28,6 +28,8 @@ DECLARE_REFCOUNTED_CLASS(TChunkFileWriter)
 DECLARE_REFCOUNTED_CLASS(TIOTrackerConfig)
 DECLARE_REFCOUNTED_STRUCT(TCongestionDetectorConfig)
 DECLARE_REFCOUNTED_STRUCT(TGentleLoaderConfig)
+DECLARE_REFCOUNTED_STRUCT(TReadaheadConfig)
+DECLARE_REFCOUNTED_STRUCT(TDiskSchedulerConfig)
 
 DECLARE_REFCOUNTED_STRUCT(IIOTracker)
 
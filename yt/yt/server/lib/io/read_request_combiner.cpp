@@ -36,12 +36,29 @@ bool TryCollapseRequest(TIORequest* collapsed, const TIORequest& current)
     return true;
 }
 
+TSharedMutableRef AllocateBuffer(
+    const TReadBufferAllocator& allocator,
+    i64 size,
+    TRefCountedTypeCookie tagCookie)
+{
+    if (allocator) {
+        if (auto buffer = allocator(size)) {
+            return buffer;
+        }
+    }
+    return TSharedMutableRef::AllocatePageAligned(size, {.InitializeStorage = false}, tagCookie);
+}
+
 } // namespace
 
 class TReadRequestCombiner
     : public IReadRequestCombiner
 {
 public:
+    explicit TReadRequestCombiner(TReadBufferAllocator allocator)
+        : Allocator_(std::move(allocator))
+    { }
+
     std::vector<IReadRequestCombiner::TCombinedRequest> Combine(
         std::vector<IIOEngine::TReadRequest> requests,
         i64 pageSize,
@@ -104,7 +121,7 @@ public:
         results.reserve(ioRequests.size());
 
         {
-            auto buffer = TSharedMutableRef::AllocatePageAligned(totalSize, {.InitializeStorage = false}, tagCookie);
+            auto buffer = AllocateBuffer(Allocator_, totalSize, tagCookie);
 
             OutputRefs_.resize(ioRequests.size());
 
@@ -189,12 +206,14 @@ public:
     }
 
 private:
+    const TReadBufferAllocator Allocator_;
+
     std::vector<TSharedRef> OutputRefs_;
 };
 
-IReadRequestCombinerPtr CreateReadRequestCombiner()
+IReadRequestCombinerPtr CreateReadRequestCombiner(TReadBufferAllocator allocator)
 {
-    return New<TReadRequestCombiner>();
+    return New<TReadRequestCombiner>(std::move(allocator));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -203,6 +222,10 @@ class TDummyReadRequestCombiner
     : public IReadRequestCombiner
 {
 public:
+    explicit TDummyReadRequestCombiner(TReadBufferAllocator allocator)
+        : Allocator_(std::move(allocator))
+    { }
+
     std::vector<TCombinedRequest> Combine(
         std::vector<IIOEngine::TReadRequest> requests,
         i64 pageSize,
@@ -229,10 +252,7 @@ public:
                 offsetDiff = AlignRequest(&resultRequest.ReadRequest, pageSize);
             }
 
-            auto buffer = TSharedMutableRef::AllocatePageAligned(
-                resultRequest.ReadRequest.Size,
-                {.InitializeStorage = false},
-                tagCookie);
+            auto buffer = AllocateBuffer(Allocator_, resultRequest.ReadRequest.Size, tagCookie);
 
             resultRequest.ResultBuffer = buffer;
             OutputRefs_.push_back(buffer.Slice(offsetDiff, offsetDiff + requests[index].Size));
@@ -269,12 +289,14 @@ public:
     }
 
 private:
+    const TReadBufferAllocator Allocator_;
+
     std::vector<TSharedRef> OutputRefs_;
 };
 
-IReadRequestCombinerPtr CreateDummyReadRequestCombiner()
+IReadRequestCombinerPtr CreateDummyReadRequestCombiner(TReadBufferAllocator allocator)
 {
-    return New<TDummyReadRequestCombiner>();
+    return New<TDummyReadRequestCombiner>(std::move(allocator));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
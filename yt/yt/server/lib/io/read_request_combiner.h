@@ -31,9 +31,12 @@ DEFINE_REFCOUNTED_TYPE(IReadRequestCombiner)
 
 ////////////////////////////////////////////////////////////////////////////////
 
-IReadRequestCombinerPtr CreateReadRequestCombiner();
+//! Allocates a page-aligned buffer of a given size; may return null to fall back to an ordinary allocation.
+using TReadBufferAllocator = TCallback<TSharedMutableRef(i64 size)>;
 
-IReadRequestCombinerPtr CreateDummyReadRequestCombiner();
+IReadRequestCombinerPtr CreateReadRequestCombiner(TReadBufferAllocator allocator = {});
+
+IReadRequestCombinerPtr CreateDummyReadRequestCombiner(TReadBufferAllocator allocator = {});
 
 ////////////////////////////////////////////////////////////////////////////////
 
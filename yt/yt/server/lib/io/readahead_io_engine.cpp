@@ -0,0 +1,669 @@
+#include "readahead_io_engine.h"
+
+#include "config.h"
+#include "io_engine_base.h"
+
+#include <yt/yt/core/concurrency/thread_affinity.h>
+
+#include <yt/yt/core/misc/atomic_object.h>
+#include <yt/yt/core/misc/collection_helpers.h>
+
+#include <library/cpp/yt/threading/spin_lock.h>
+
+#include <deque>
+#include <list>
+
+namespace NYT::NIO {
+
+using namespace NProfiling;
+using namespace NYTree;
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TReadaheadBufferTag
+{ };
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TReadaheadIOEngine
+    : public IIOEngine
+{
+public:
+    TReadaheadIOEngine(
+        IIOEnginePtr underlying,
+        TIntrusivePtr<TIOEngineConfigBase> config,
+        TProfiler profiler,
+        NLogging::TLogger logger)
+        : Underlying_(std::move(underlying))
+        , StaticConfig_(std::move(config))
+        , Logger(std::move(logger))
+        , Config_(StaticConfig_->Readahead)
+        , ReadaheadBytesCounter_(profiler.Counter("/readahead/read_bytes"))
+        , HitBytesCounter_(profiler.Counter("/readahead/hit_bytes"))
+    {
+        profiler.AddFuncGauge("/readahead/window_bytes", MakeStrong(this), [this] {
+            return WindowBytes_.load(std::memory_order::relaxed);
+        });
+    }
+
+    TFuture<TReadResponse> Read(
+        std::vector<TReadRequest> requests,
+        EWorkloadCategory category,
+        TRefCountedTypeCookie tagCookie,
+        TSessionId sessionId,
+        bool useDedicatedAllocations) override
+    {
+        auto config = Config_.Load();
+        if (!config->Enable) {
+            return Underlying_->Read(std::move(requests), category, tagCookie, sessionId, useDedicatedAllocations);
+        }
+
+        // NB: Reads of other categories may still use the windows that are already there.
+        bool allowReadahead = config->WorkloadCategories.contains(category);
+
+        // Requests served from readahead windows, either existing or planned just now.
+        std::vector<TFuture<TSharedRef>> windowBuffers(requests.size());
+        std::vector<TWindowPlan> plans;
+        std::vector<TIOEngineHandlePtr> handlesToMeasure;
+        {
+            auto guard = Guard(Lock_);
+            for (int index = 0; index < std::ssize(requests); ++index) {
+                const auto& request = requests[index];
+                if (request.Size <= 0) {
+                    continue;
+                }
+                // NB: Reads that may not issue readahead do not affect sequential access detection either.
+                auto* stream = allowReadahead
+                    ? GetOrCreateStream(request.Handle, config)
+                    : FindStream(request.Handle);
+                if (!stream) {
+                    continue;
+                }
+                windowBuffers[index] = ProcessRequest(
+                    stream,
+                    request,
+                    allowReadahead,
+                    tagCookie,
+                    config,
+                    &plans,
+                    &handlesToMeasure);
+            }
+        }
+
+        for (const auto& handle : handlesToMeasure) {
+            MeasureFileLength(handle);
+        }
+
+        // Readahead is merely an optimization: should a window fail to be read
+        // (e.g. the file has been truncated meanwhile), the request is served on its own.
+        for (int index = 0; index < std::ssize(requests); ++index) {
+            if (windowBuffers[index]) {
+                windowBuffers[index] = windowBuffers[index].Apply(BIND([
+                    underlying = Underlying_,
+                    request = requests[index],
+                    category,
+                    tagCookie,
+                    sessionId,
+                    useDedicatedAllocations
+                ] (const TErrorOr<TSharedRef>& bufferOrError) {
+                    if (bufferOrError.IsOK()) {
+                        return MakeFuture(bufferOrError.Value());
+                    }
+                    return underlying->Read({request}, category, tagCookie, sessionId, useDedicatedAllocations)
+                        .Apply(BIND([] (const TReadResponse& response) {
+                            YT_VERIFY(response.OutputBuffers.size() == 1);
+                            return response.OutputBuffers[0];
+                        }));
+                }));
+            }
+        }
+
+        std::vector<TFuture<TReadResponse>> windowResponses;
+        for (auto& plan : plans) {
+            auto response = Underlying_->Read(
+                {{plan.Handle, plan.Offset, plan.Size}},
+                category,
+                GetRefCountedTypeCookie<TReadaheadBufferTag>(),
+                sessionId);
+            plan.Promise.SetFrom(response.Apply(BIND([] (const TReadResponse& response) {
+                YT_VERIFY(response.OutputBuffers.size() == 1);
+                return response.OutputBuffers[0];
+            })));
+            if (plan.ServesRequest) {
+                windowResponses.push_back(std::move(response));
+            }
+            ReadaheadBytesCounter_.Increment(plan.Size);
+        }
+
+        std::vector<TReadRequest> underlyingRequests;
+        std::vector<int> underlyingRequestIndexes;
+        for (int index = 0; index < std::ssize(requests); ++index) {
+            if (!windowBuffers[index]) {
+                underlyingRequests.push_back(std::move(requests[index]));
+                underlyingRequestIndexes.push_back(index);
+            }
+        }
+
+        if (underlyingRequests.size() == requests.size()) {
+            return Underlying_->Read(std::move(underlyingRequests), category, tagCookie, sessionId, useDedicatedAllocations);
+        }
+
+        auto bufferFutures = std::move(windowBuffers);
+        auto responseFutures = std::move(windowResponses);
+        if (!underlyingRequests.empty()) {
+            auto response = Underlying_->Read(std::move(underlyingRequests), category, tagCookie, sessionId, useDedicatedAllocations);
+            for (int index = 0; index < std::ssize(underlyingRequestIndexes); ++index) {
+                bufferFutures[underlyingRequestIndexes[index]] = response.Apply(BIND([index] (const TReadResponse& response) {
+                    return response.OutputBuffers[index];
+                }));
+            }
+            responseFutures.push_back(std::move(response));
+        }
+
+        return AllSucceeded(std::move(bufferFutures))
+            .Apply(BIND([responseFutures = std::move(responseFutures)] (std::vector<TSharedRef> buffers) {
+                TReadResponse result{
+                    .OutputBuffers = std::move(buffers),
+                };
+                // NB: All the responses are set since the buffers are derived from them;
+                // failed window reads have been replaced with fallback ones.
+                for (const auto& future : responseFutures) {
+                    const auto& responseOrError = *future.TryGet();
+                    if (!responseOrError.IsOK()) {
+                        continue;
+                    }
+                    const auto& response = responseOrError.Value();
+                    result.PaddedBytes += response.PaddedBytes;
+                    result.IORequests += response.IORequests;
+                }
+                return result;
+            }));
+    }
+
+    TFuture<void> Write(
+        TWriteRequest request,
+        EWorkloadCategory category,
+        TSessionId sessionId) override
+    {
+        DropStream(request.Handle);
+        return Underlying_->Write(std::move(request), category, sessionId);
+    }
+
+    TFuture<void> FlushFile(
+        TFlushFileRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->FlushFile(std::move(request), category);
+    }
+
+    TFuture<void> FlushFileRange(
+        TFlushFileRangeRequest request,
+        EWorkloadCategory category,
+        TSessionId sessionId) override
+    {
+        return Underlying_->FlushFileRange(std::move(request), category, sessionId);
+    }
+
+    TFuture<void> FlushDirectory(
+        TFlushDirectoryRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->FlushDirectory(std::move(request), category);
+    }
+
+    TFuture<TIOEngineHandlePtr> Open(
+        TOpenRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->Open(std::move(request), category);
+    }
+
+    TFuture<void> Close(
+        TCloseRequest request,
+        EWorkloadCategory category) override
+    {
+        DropStream(request.Handle);
+        return Underlying_->Close(std::move(request), category);
+    }
+
+    TFuture<void> Allocate(
+        TAllocateRequest request,
+        EWorkloadCategory category) override
+    {
+        DropStream(request.Handle);
+        return Underlying_->Allocate(std::move(request), category);
+    }
+
+    TFuture<void> Lock(
+        TLockRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->Lock(std::move(request), category);
+    }
+
+    TFuture<void> Resize(
+        TResizeRequest request,
+        EWorkloadCategory category) override
+    {
+        DropStream(request.Handle);
+        return Underlying_->Resize(std::move(request), category);
+    }
+
+    bool IsSick() const override
+    {
+        return Underlying_->IsSick();
+    }
+
+    void Reconfigure(const INodePtr& dynamicIOConfig) override
+    {
+        Underlying_->Reconfigure(dynamicIOConfig);
+
+        auto config = UpdateYsonStruct(StaticConfig_, dynamicIOConfig)->Readahead;
+        Config_.Store(config);
+
+        if (!config->Enable) {
+            auto guard = Guard(Lock_);
+            while (!Lru_.empty()) {
+                EraseStream(Lru_.back());
+            }
+        }
+    }
+
+    const IInvokerPtr& GetAuxPoolInvoker() override
+    {
+        return Underlying_->GetAuxPoolInvoker();
+    }
+
+    i64 GetTotalReadBytes() const override
+    {
+        return Underlying_->GetTotalReadBytes();
+    }
+
+    i64 GetTotalWrittenBytes() const override
+    {
+        return Underlying_->GetTotalWrittenBytes();
+    }
+
+    EDirectIOPolicy UseDirectIOForReads() const override
+    {
+        return Underlying_->UseDirectIOForReads();
+    }
+
+private:
+    struct TWindow
+    {
+        i64 Offset;
+        i64 Size;
+        TFuture<TSharedRef> Data;
+    };
+
+    struct TStream
+    {
+        //! Keeps the handle memory (and thus the key of #Streams_) from being reused.
+        TWeakPtr<TIOEngineHandle> Handle;
+        //! File length as of the last measurement; windows never extend beyond it.
+        std::optional<i64> FileLength;
+
+        i64 NextOffset = -1;
+        int SequentialReadCount = 0;
+        i64 ReadaheadSize = 0;
+
+        std::deque<TWindow> Windows;
+
+        std::list<TIOEngineHandle*>::iterator LruIterator;
+    };
+
+    struct TWindowPlan
+    {
+        TIOEngineHandlePtr Handle;
+        i64 Offset;
+        i64 Size;
+        TPromise<TSharedRef> Promise;
+        //! Whether the window is read on behalf of the current request rather than in background.
+        bool ServesRequest;
+    };
+
+    //! No more windows are requested in background once that many are pending consumption.
+    static constexpr int MaxWindowsPerStream = 2;
+
+    const IIOEnginePtr Underlying_;
+    const TIntrusivePtr<TIOEngineConfigBase> StaticConfig_;
+    const NLogging::TLogger Logger;
+
+    TAtomicObject<TReadaheadConfigPtr> Config_;
+
+    TCounter ReadaheadBytesCounter_;
+    TCounter HitBytesCounter_;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, Lock_);
+    THashMap<TIOEngineHandle*, TStream> Streams_;
+    //! Most recently used streams go first.
+    std::list<TIOEngineHandle*> Lru_;
+    std::atomic<i64> WindowBytes_ = 0;
+
+
+    TStream* GetOrCreateStream(const TIOEngineHandlePtr& handle, const TReadaheadConfigPtr& config)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        auto* key = handle.Get();
+        if (auto it = Streams_.find(key); it != Streams_.end()) {
+            auto* stream = &it->second;
+            Lru_.splice(Lru_.begin(), Lru_, stream->LruIterator);
+            return stream;
+        }
+
+        while (std::ssize(Streams_) >= config->MaxStreamCount) {
+            EraseStream(Lru_.back());
+        }
+
+        Lru_.push_front(key);
+        auto* stream = &Streams_[key];
+        stream->Handle = handle;
+        stream->ReadaheadSize = config->MinReadaheadSize;
+        stream->LruIterator = Lru_.begin();
+        return stream;
+    }
+
+    TStream* FindStream(const TIOEngineHandlePtr& handle)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        auto it = Streams_.find(handle.Get());
+        return it == Streams_.end() ? nullptr : &it->second;
+    }
+
+    //! Returns the future buffer if the request is served from a window and null otherwise.
+    TFuture<TSharedRef> ProcessRequest(
+        TStream* stream,
+        const TReadRequest& request,
+        bool allowReadahead,
+        TRefCountedTypeCookie tagCookie,
+        const TReadaheadConfigPtr& config,
+        std::vector<TWindowPlan>* plans,
+        std::vector<TIOEngineHandlePtr>* handlesToMeasure)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        auto requestEnd = request.Offset + request.Size;
+
+        auto findWindow = [&] {
+            return std::find_if(stream->Windows.begin(), stream->Windows.end(), [&] (const TWindow& window) {
+                return window.Offset <= request.Offset && requestEnd <= window.Offset + window.Size;
+            });
+        };
+
+        if (!allowReadahead) {
+            auto windowIt = findWindow();
+            if (windowIt == stream->Windows.end()) {
+                return {};
+            }
+            HitBytesCounter_.Increment(request.Size);
+            return SliceWindow(*windowIt, request, tagCookie);
+        }
+
+        // Forget the windows that have been consumed already.
+        while (!stream->Windows.empty() && stream->Windows.front().Offset + stream->Windows.front().Size <= request.Offset) {
+            PopWindow(stream);
+        }
+
+        // Small forward gaps (e.g. skipped blocks) do not break sequential access.
+        bool sequential =
+            stream->NextOffset >= 0 &&
+            request.Offset >= stream->NextOffset &&
+            request.Offset <= stream->NextOffset + config->MinReadaheadSize;
+        stream->NextOffset = requestEnd;
+
+        if (auto windowIt = findWindow(); windowIt != stream->Windows.end()) {
+            ++stream->SequentialReadCount;
+            HitBytesCounter_.Increment(request.Size);
+
+            auto buffer = SliceWindow(*windowIt, request, tagCookie);
+
+            // Request the next window in background once the last one is half consumed.
+            const auto& lastWindow = stream->Windows.back();
+            if (std::ssize(stream->Windows) < MaxWindowsPerStream &&
+                requestEnd > lastWindow.Offset + lastWindow.Size / 2)
+            {
+                auto offset = lastWindow.Offset + lastWindow.Size;
+                if (auto window = TryPlanWindow(stream, request.Handle, offset, /*minSize*/ 0, config, handlesToMeasure)) {
+                    plans->push_back({
+                        .Handle = request.Handle,
+                        .Offset = offset,
+                        .Size = window->Size,
+                        .Promise = std::move(window->Promise),
+                        .ServesRequest = false,
+                    });
+                }
+            }
+
+            return buffer;
+        }
+
+        if (sequential) {
+            ++stream->SequentialReadCount;
+        } else {
+            stream->SequentialReadCount = 1;
+            stream->ReadaheadSize = config->MinReadaheadSize;
+            while (!stream->Windows.empty()) {
+                PopWindow(stream);
+            }
+        }
+
+        if (stream->SequentialReadCount < config->SequentialReadThreshold) {
+            // Make sure the file length is known by the time readahead kicks in.
+            if (stream->SequentialReadCount + 1 == config->SequentialReadThreshold && !stream->FileLength) {
+                handlesToMeasure->push_back(request.Handle);
+            }
+            return {};
+        }
+
+        auto window = TryPlanWindow(stream, request.Handle, request.Offset, request.Size, config, handlesToMeasure);
+        if (!window) {
+            return {};
+        }
+
+        auto buffer = SliceWindow(stream->Windows.back(), request, tagCookie);
+        plans->push_back({
+            .Handle = request.Handle,
+            .Offset = request.Offset,
+            .Size = window->Size,
+            .Promise = std::move(window->Promise),
+            .ServesRequest = true,
+        });
+        return buffer;
+    }
+
+    struct TPlannedWindow
+    {
+        i64 Size;
+        TPromise<TSharedRef> Promise;
+    };
+
+    //! Appends a new window starting at #offset to the stream unless it would be
+    //! no larger than #minSize or would not fit into the memory limit.
+    std::optional<TPlannedWindow> TryPlanWindow(
+        TStream* stream,
+        const TIOEngineHandlePtr& handle,
+        i64 offset,
+        i64 minSize,
+        const TReadaheadConfigPtr& config,
+        std::vector<TIOEngineHandlePtr>* handlesToMeasure)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        auto readaheadSize = std::clamp(stream->ReadaheadSize, config->MinReadaheadSize, config->MaxReadaheadSize);
+        auto desiredEnd = offset + std::max(minSize, readaheadSize);
+        if (!stream->FileLength || *stream->FileLength < desiredEnd) {
+            // The file may have grown since it was measured.
+            handlesToMeasure->push_back(handle);
+        }
+
+        auto size = std::min(desiredEnd, stream->FileLength.value_or(0)) - offset;
+        if (size <= minSize) {
+            return std::nullopt;
+        }
+
+        if (!ReserveWindowMemory(stream, size, config)) {
+            return std::nullopt;
+        }
+
+        auto promise = NewPromise<TSharedRef>();
+        auto future = promise.ToFuture();
+        stream->Windows.push_back({
+            .Offset = offset,
+            .Size = size,
+            .Data = future,
+        });
+        WindowBytes_ += size;
+        stream->ReadaheadSize = std::min(readaheadSize * 2, config->MaxReadaheadSize);
+
+        future.Subscribe(BIND(
+            &TReadaheadIOEngine::OnWindowRead,
+            MakeWeak(this),
+            handle.Get(),
+            future));
+
+        return TPlannedWindow{
+            .Size = size,
+            .Promise = std::move(promise),
+        };
+    }
+
+    bool ReserveWindowMemory(const TStream* stream, i64 size, const TReadaheadConfigPtr& config)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        // Drop the windows of the least recently used streams.
+        auto it = Lru_.end();
+        while (WindowBytes_.load() + size > config->MemoryLimit && it != Lru_.begin()) {
+            --it;
+            auto* victim = &GetOrCrash(Streams_, *it);
+            if (victim != stream) {
+                while (!victim->Windows.empty()) {
+                    PopWindow(victim);
+                }
+            }
+        }
+
+        return WindowBytes_.load() + size <= config->MemoryLimit;
+    }
+
+    static TFuture<TSharedRef> SliceWindow(
+        const TWindow& window,
+        const TReadRequest& request,
+        TRefCountedTypeCookie tagCookie)
+    {
+        // NB: Copy the data out to avoid pinning the whole window by a (possibly cached) block.
+        return window.Data.Apply(BIND([
+            offset = request.Offset - window.Offset,
+            size = request.Size,
+            tagCookie
+        ] (const TSharedRef& data) -> TSharedRef {
+            auto buffer = TSharedMutableRef::Allocate(size, {.InitializeStorage = false}, tagCookie);
+            ::memcpy(buffer.Begin(), data.Begin() + offset, size);
+            return buffer;
+        }));
+    }
+
+    void PopWindow(TStream* stream)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        WindowBytes_ -= stream->Windows.front().Size;
+        stream->Windows.pop_front();
+    }
+
+    void EraseStream(TIOEngineHandle* key)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        auto it = Streams_.find(key);
+        YT_VERIFY(it != Streams_.end());
+        auto* stream = &it->second;
+        while (!stream->Windows.empty()) {
+            PopWindow(stream);
+        }
+        Lru_.erase(stream->LruIterator);
+        Streams_.erase(it);
+    }
+
+    void DropStream(const TIOEngineHandlePtr& handle)
+    {
+        if (!Config_.Load()->Enable) {
+            return;
+        }
+
+        auto guard = Guard(Lock_);
+        if (Streams_.contains(handle.Get())) {
+            EraseStream(handle.Get());
+        }
+    }
+
+    void MeasureFileLength(const TIOEngineHandlePtr& handle)
+    {
+        auto length = handle->GetLength();
+        if (length < 0) {
+            YT_LOG_DEBUG("Failed to get file length for readahead");
+            return;
+        }
+
+        auto guard = Guard(Lock_);
+        if (auto it = Streams_.find(handle.Get()); it != Streams_.end()) {
+            it->second.FileLength = length;
+        }
+    }
+
+    void OnWindowRead(TIOEngineHandle* key, const TFuture<TSharedRef>& future, const TErrorOr<TSharedRef>& dataOrError)
+    {
+        if (dataOrError.IsOK()) {
+            return;
+        }
+
+        YT_LOG_DEBUG(dataOrError, "Readahead failed");
+
+        // Let further requests go to the underlying engine; the file length is to be measured anew.
+        auto guard = Guard(Lock_);
+        auto it = Streams_.find(key);
+        if (it == Streams_.end()) {
+            return;
+        }
+
+        auto* stream = &it->second;
+        stream->FileLength.reset();
+
+        auto& windows = stream->Windows;
+        auto windowIt = std::find_if(windows.begin(), windows.end(), [&] (const TWindow& window) {
+            return window.Data == future;
+        });
+        if (windowIt != windows.end()) {
+            WindowBytes_ -= windowIt->Size;
+            windows.erase(windowIt);
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+IIOEnginePtr CreateReadaheadIOEngine(
+    IIOEnginePtr underlying,
+    INodePtr ioConfig,
+    TProfiler profiler,
+    NLogging::TLogger logger)
+{
+    auto config = New<TIOEngineConfigBase>();
+    config->SetDefaults();
+    if (ioConfig) {
+        config->Load(ioConfig);
+    }
+
+    return New<TReadaheadIOEngine>(
+        std::move(underlying),
+        std::move(config),
+        std::move(profiler),
+        std::move(logger));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NIO
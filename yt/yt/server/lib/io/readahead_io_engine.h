@@ -0,0 +1,30 @@
+#pragma once
+
+#include "io_engine.h"
+
+namespace NYT::NIO {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Wraps #underlying with a sequential access detector issuing readahead.
+/*!
+ *  Once a file handle has been read sequentially for a while, reads are enlarged
+ *  into readahead windows growing from |min_readahead_size| up to |max_readahead_size|;
+ *  consecutive reads are then served from these windows and the next window
+ *  is requested in background once the current one is half consumed.
+ *
+ *  Only reads of the configured workload categories may issue readahead;
+ *  reads of other (e.g. interactive) categories are never enlarged and so never wait for extra IO.
+ *
+ *  Readahead is configured via the |readahead| section of IO engine config (see #TReadaheadConfig)
+ *  and is disabled by default.
+ */
+IIOEnginePtr CreateReadaheadIOEngine(
+    IIOEnginePtr underlying,
+    NYTree::INodePtr ioConfig,
+    NProfiling::TProfiler profiler = {},
+    NLogging::TLogger logger = {});
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NIO
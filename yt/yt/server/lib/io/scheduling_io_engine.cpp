@@ -0,0 +1,452 @@
+#include "scheduling_io_engine.h"
+
+#include "config.h"
+#include "io_engine_base.h"
+
+#include <yt/yt/core/concurrency/thread_affinity.h>
+
+#include <yt/yt/core/misc/atomic_object.h>
+
+#include <library/cpp/yt/threading/spin_lock.h>
+
+#include <deque>
+
+namespace NYT::NIO {
+
+using namespace NProfiling;
+using namespace NYTree;
+
+////////////////////////////////////////////////////////////////////////////////
+
+DEFINE_ENUM(EDiskRequestClass,
+    (Interactive)
+    (Batch)
+    (Background)
+);
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TSchedulingIOEngine
+    : public IIOEngine
+{
+public:
+    TSchedulingIOEngine(
+        IIOEnginePtr underlying,
+        TIntrusivePtr<TIOEngineConfigBase> config,
+        TProfiler profiler,
+        NLogging::TLogger logger)
+        : Underlying_(std::move(underlying))
+        , StaticConfig_(std::move(config))
+        , Logger(std::move(logger))
+        , Config_(StaticConfig_->DiskScheduler)
+        , InFlightLimit_(StaticConfig_->DiskScheduler->MaxInFlightRequestCount)
+    {
+        for (auto requestClass : TEnumTraits<EDiskRequestClass>::GetDomainValues()) {
+            auto classProfiler = profiler.WithTag("class", FormatEnum(requestClass));
+            auto& classState = Classes_[requestClass];
+            classState.LatencyTimer = classProfiler.Timer("/disk_scheduler/latency");
+            if (requestClass == EDiskRequestClass::Interactive) {
+                continue;
+            }
+            classState.WaitTimer = classProfiler.Timer("/disk_scheduler/wait_time");
+            classState.PromotedRequestCounter = classProfiler.Counter("/disk_scheduler/promoted_request_count");
+            classProfiler.AddFuncGauge("/disk_scheduler/queue_size", MakeStrong(this), [this, requestClass] {
+                auto guard = Guard(Lock_);
+                return Classes_[requestClass].Queue.size();
+            });
+        }
+
+        profiler.AddFuncGauge("/disk_scheduler/in_flight_request_count", MakeStrong(this), [this] {
+            auto guard = Guard(Lock_);
+            return InFlightCount_;
+        });
+        profiler.AddFuncGauge("/disk_scheduler/in_flight_limit", MakeStrong(this), [this] {
+            auto guard = Guard(Lock_);
+            return InFlightLimit_;
+        });
+    }
+
+    TFuture<TReadResponse> Read(
+        std::vector<TReadRequest> requests,
+        EWorkloadCategory category,
+        TRefCountedTypeCookie tagCookie,
+        TSessionId sessionId,
+        bool useDedicatedAllocations) override
+    {
+        i64 cost = 0;
+        for (const auto& request : requests) {
+            cost += request.Size;
+        }
+
+        return Schedule<TReadResponse>(
+            category,
+            cost,
+            BIND([=, this, this_ = MakeStrong(this), requests = std::move(requests)] () mutable {
+                return Underlying_->Read(std::move(requests), category, tagCookie, sessionId, useDedicatedAllocations);
+            }));
+    }
+
+    TFuture<void> Write(
+        TWriteRequest request,
+        EWorkloadCategory category,
+        TSessionId sessionId) override
+    {
+        auto cost = GetByteSize(request.Buffers);
+
+        return Schedule<void>(
+            category,
+            cost,
+            BIND([=, this, this_ = MakeStrong(this), request = std::move(request)] () mutable {
+                return Underlying_->Write(std::move(request), category, sessionId);
+            }));
+    }
+
+    TFuture<void> FlushFile(
+        TFlushFileRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->FlushFile(std::move(request), category);
+    }
+
+    TFuture<void> FlushFileRange(
+        TFlushFileRangeRequest request,
+        EWorkloadCategory category,
+        TSessionId sessionId) override
+    {
+        return Underlying_->FlushFileRange(std::move(request), category, sessionId);
+    }
+
+    TFuture<void> FlushDirectory(
+        TFlushDirectoryRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->FlushDirectory(std::move(request), category);
+    }
+
+    TFuture<TIOEngineHandlePtr> Open(
+        TOpenRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->Open(std::move(request), category);
+    }
+
+    TFuture<void> Close(
+        TCloseRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->Close(std::move(request), category);
+    }
+
+    TFuture<void> Allocate(
+        TAllocateRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->Allocate(std::move(request), category);
+    }
+
+    TFuture<void> Lock(
+        TLockRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->Lock(std::move(request), category);
+    }
+
+    TFuture<void> Resize(
+        TResizeRequest request,
+        EWorkloadCategory category) override
+    {
+        return Underlying_->Resize(std::move(request), category);
+    }
+
+    bool IsSick() const override
+    {
+        return Underlying_->IsSick();
+    }
+
+    void Reconfigure(const INodePtr& dynamicIOConfig) override
+    {
+        Underlying_->Reconfigure(dynamicIOConfig);
+
+        auto config = UpdateYsonStruct(StaticConfig_, dynamicIOConfig)->DiskScheduler;
+        Config_.Store(config);
+
+        std::vector<TClosure> requestsToStart;
+        {
+            auto guard = Guard(Lock_);
+            InFlightLimit_ = std::clamp<double>(InFlightLimit_, config->MinInFlightRequestCount, config->MaxInFlightRequestCount);
+            // NB: Once disabled, all the queued requests are started at once.
+            requestsToStart = DispatchRequests(config, GetInstant());
+        }
+
+        StartRequests(std::move(requestsToStart));
+    }
+
+    const IInvokerPtr& GetAuxPoolInvoker() override
+    {
+        return Underlying_->GetAuxPoolInvoker();
+    }
+
+    i64 GetTotalReadBytes() const override
+    {
+        return Underlying_->GetTotalReadBytes();
+    }
+
+    i64 GetTotalWrittenBytes() const override
+    {
+        return Underlying_->GetTotalWrittenBytes();
+    }
+
+    EDirectIOPolicy UseDirectIOForReads() const override
+    {
+        return Underlying_->UseDirectIOForReads();
+    }
+
+private:
+    struct TQueuedRequest
+    {
+        TClosure Start;
+        i64 Cost;
+        TInstant EnqueueInstant;
+    };
+
+    struct TClassState
+    {
+        std::deque<TQueuedRequest> Queue;
+        //! Cost of the requests admitted so far divided by the class weight.
+        double VirtualTime = 0;
+
+        TEventTimer LatencyTimer;
+        TEventTimer WaitTimer;
+        TCounter PromotedRequestCounter;
+    };
+
+    //! Smoothing factor of interactive latency moving average.
+    static constexpr double LatencySmoothingFactor = 0.2;
+
+    const IIOEnginePtr Underlying_;
+    const TIntrusivePtr<TIOEngineConfigBase> StaticConfig_;
+    const NLogging::TLogger Logger;
+
+    TAtomicObject<TDiskSchedulerConfigPtr> Config_;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, Lock_);
+    TEnumIndexedVector<EDiskRequestClass, TClassState> Classes_;
+    int InFlightCount_ = 0;
+    double InFlightLimit_;
+    double InteractiveLatencyEwma_ = 0;
+    bool InteractiveRequestFinished_ = false;
+    TInstant LastAdjustmentInstant_;
+
+
+    static EDiskRequestClass GetRequestClass(const TDiskSchedulerConfigPtr& config, EWorkloadCategory category)
+    {
+        if (config->InteractiveCategories.contains(category)) {
+            return EDiskRequestClass::Interactive;
+        }
+        if (config->BackgroundCategories.contains(category)) {
+            return EDiskRequestClass::Background;
+        }
+        return EDiskRequestClass::Batch;
+    }
+
+    template <class T>
+    TFuture<T> Schedule(
+        EWorkloadCategory category,
+        i64 cost,
+        TCallback<TFuture<T>()> invoker)
+    {
+        auto config = Config_.Load();
+        if (!config->Enable) {
+            return invoker();
+        }
+
+        auto requestClass = GetRequestClass(config, category);
+        if (requestClass == EDiskRequestClass::Interactive) {
+            return InvokeUnderlying(requestClass, invoker);
+        }
+
+        auto promise = NewPromise<T>();
+        auto start = BIND([=, this, this_ = MakeStrong(this), invoker = std::move(invoker)] {
+            promise.SetFrom(InvokeUnderlying(requestClass, invoker));
+        });
+
+        std::vector<TClosure> requestsToStart;
+        {
+            auto guard = Guard(Lock_);
+
+            auto now = GetInstant();
+            auto& classState = Classes_[requestClass];
+            if (classState.Queue.empty()) {
+                // Do not let a class that has been idle for a while monopolize the disk.
+                for (const auto& otherClassState : Classes_) {
+                    if (!otherClassState.Queue.empty()) {
+                        classState.VirtualTime = std::max(classState.VirtualTime, otherClassState.VirtualTime);
+                    }
+                }
+            }
+            classState.Queue.push_back({
+                .Start = std::move(start),
+                .Cost = cost,
+                .EnqueueInstant = now,
+            });
+
+            requestsToStart = DispatchRequests(config, now);
+        }
+
+        StartRequests(std::move(requestsToStart));
+
+        return promise.ToFuture();
+    }
+
+    template <class T>
+    TFuture<T> InvokeUnderlying(EDiskRequestClass requestClass, const TCallback<TFuture<T>()>& invoker)
+    {
+        auto startInstant = GetInstant();
+
+        TFuture<T> future;
+        try {
+            future = invoker();
+        } catch (const std::exception& ex) {
+            future = MakeFuture<T>(TError(ex));
+        }
+
+        future.AsVoid().Subscribe(BIND(
+            &TSchedulingIOEngine::OnRequestFinished,
+            MakeWeak(this),
+            requestClass,
+            startInstant));
+
+        return future;
+    }
+
+    void OnRequestFinished(EDiskRequestClass requestClass, TInstant startInstant, const TError& /*error*/)
+    {
+        auto now = GetInstant();
+        auto latency = now - startInstant;
+        Classes_[requestClass].LatencyTimer.Record(latency);
+
+        auto config = Config_.Load();
+
+        std::vector<TClosure> requestsToStart;
+        {
+            auto guard = Guard(Lock_);
+
+            if (requestClass == EDiskRequestClass::Interactive) {
+                InteractiveLatencyEwma_ += (latency.SecondsFloat() - InteractiveLatencyEwma_) * LatencySmoothingFactor;
+                InteractiveRequestFinished_ = true;
+            } else {
+                --InFlightCount_;
+            }
+
+            MaybeAdjustInFlightLimit(config, now);
+
+            requestsToStart = DispatchRequests(config, now);
+        }
+
+        StartRequests(std::move(requestsToStart));
+    }
+
+    void MaybeAdjustInFlightLimit(const TDiskSchedulerConfigPtr& config, TInstant now)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        if (now - LastAdjustmentInstant_ < config->AdjustmentPeriod) {
+            return;
+        }
+        LastAdjustmentInstant_ = now;
+
+        // NB: With no interactive load there is no latency to protect.
+        if (InteractiveRequestFinished_ && InteractiveLatencyEwma_ > config->InteractiveLatencyTarget.SecondsFloat()) {
+            InFlightLimit_ *= config->InFlightLimitDecreaseFactor;
+        } else {
+            InFlightLimit_ += 1;
+        }
+        InFlightLimit_ = std::clamp<double>(InFlightLimit_, config->MinInFlightRequestCount, config->MaxInFlightRequestCount);
+        InteractiveRequestFinished_ = false;
+    }
+
+    std::vector<TClosure> DispatchRequests(const TDiskSchedulerConfigPtr& config, TInstant now)
+    {
+        VERIFY_SPINLOCK_AFFINITY(Lock_);
+
+        auto getDeadline = [&] (EDiskRequestClass requestClass) {
+            return requestClass == EDiskRequestClass::Batch ? config->BatchDeadline : config->BackgroundDeadline;
+        };
+        auto getWeight = [&] (EDiskRequestClass requestClass) {
+            return requestClass == EDiskRequestClass::Batch ? config->BatchWeight : config->BackgroundWeight;
+        };
+
+        std::vector<TClosure> requestsToStart;
+        while (!config->Enable || InFlightCount_ < static_cast<int>(InFlightLimit_)) {
+            std::optional<EDiskRequestClass> overdueClass;
+            std::optional<EDiskRequestClass> fairClass;
+            for (auto requestClass : {EDiskRequestClass::Batch, EDiskRequestClass::Background}) {
+                const auto& classState = Classes_[requestClass];
+                if (classState.Queue.empty()) {
+                    continue;
+                }
+                auto enqueueInstant = classState.Queue.front().EnqueueInstant;
+                if (now - enqueueInstant > getDeadline(requestClass) &&
+                    (!overdueClass || enqueueInstant < Classes_[*overdueClass].Queue.front().EnqueueInstant))
+                {
+                    overdueClass = requestClass;
+                }
+                if (!fairClass || classState.VirtualTime < Classes_[*fairClass].VirtualTime) {
+                    fairClass = requestClass;
+                }
+            }
+
+            if (!fairClass) {
+                break;
+            }
+
+            auto requestClass = overdueClass.value_or(*fairClass);
+            auto& classState = Classes_[requestClass];
+            auto request = std::move(classState.Queue.front());
+            classState.Queue.pop_front();
+
+            if (overdueClass) {
+                classState.PromotedRequestCounter.Increment();
+            }
+            classState.WaitTimer.Record(now - request.EnqueueInstant);
+            classState.VirtualTime += std::max<i64>(request.Cost, 1) / getWeight(requestClass);
+
+            ++InFlightCount_;
+            requestsToStart.push_back(std::move(request.Start));
+        }
+
+        return requestsToStart;
+    }
+
+    static void StartRequests(std::vector<TClosure> requests)
+    {
+        for (const auto& request : requests) {
+            request();
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+IIOEnginePtr CreateSchedulingIOEngine(
+    IIOEnginePtr underlying,
+    INodePtr ioConfig,
+    TProfiler profiler,
+    NLogging::TLogger logger)
+{
+    auto config = New<TIOEngineConfigBase>();
+    config->SetDefaults();
+    if (ioConfig) {
+        config->Load(ioConfig);
+    }
+
+    return New<TSchedulingIOEngine>(
+        std::move(underlying),
+        std::move(config),
+        std::move(profiler),
+        std::move(logger));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NIO
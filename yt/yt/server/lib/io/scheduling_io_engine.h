@@ -0,0 +1,31 @@
+#pragma once
+
+#include "io_engine.h"
+
+namespace NYT::NIO {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Wraps #underlying with a disk request scheduler distinguishing three request classes.
+/*!
+ *  Interactive requests are passed to #underlying right away; their latency
+ *  is measured and drives the limit of non-interactive requests in flight,
+ *  which is shrunk multiplicatively while the latency exceeds the target and
+ *  grows additively otherwise.
+ *
+ *  Batch and background requests are queued and admitted within the limit
+ *  sharing it (by bytes) according to the class weights; a request waiting for longer
+ *  than its class deadline is admitted ahead of the shares.
+ *
+ *  Scheduling is configured via the |disk_scheduler| section of IO engine config
+ *  (see #TDiskSchedulerConfig) and is disabled by default.
+ */
+IIOEnginePtr CreateSchedulingIOEngine(
+    IIOEnginePtr underlying,
+    NYTree::INodePtr ioConfig,
+    NProfiling::TProfiler profiler = {},
+    NLogging::TLogger logger = {});
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NIO
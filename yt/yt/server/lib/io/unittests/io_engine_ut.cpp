@@ -424,6 +424,171 @@ TEST_P(TIOEngineTest, DirectIOAligned)
     });
 }
 
+const char ReadaheadConfig[] =
+    "{"
+    "    readahead = {"
+    "        enable = %true;"
+    "        min_readahead_size = 64;"
+    "        max_readahead_size = 1024;"
+    "        memory_limit = 4096;"
+    "        workload_categories = [user_batch];"
+    "    };"
+    "}";
+
+TEST_P(TIOEngineTest, SequentialReadahead)
+{
+    auto engine = CreateIOEngine();
+    engine->Reconfigure(NYTree::ConvertTo<NYTree::INodePtr>(NYson::TYsonString(TString(ReadaheadConfig))));
+
+    auto fileName = GenerateRandomFileName("IOEngine");
+    TTempFile tempFile(fileName);
+
+    constexpr auto S = 64_KB + 7;
+    auto data = GenerateRandomBlob(S);
+
+    WriteFile(fileName, data);
+
+    auto file = engine->Open({fileName, RdOnly})
+        .Get()
+        .ValueOrThrow();
+
+    auto read = [&] (std::vector<IIOEngine::TReadRequest> requests, EWorkloadCategory category) {
+        for (auto& request : requests) {
+            request.Handle = file;
+        }
+        auto result = engine->Read(requests, category, {}, {}, UseDedicatedAllocations())
+            .Get()
+            .ValueOrThrow();
+
+        ASSERT_EQ(requests.size(), result.OutputBuffers.size());
+        for (int index = 0; index < std::ssize(requests); ++index) {
+            const auto& request = requests[index];
+            EXPECT_TRUE(TRef::AreBitwiseEqual(
+                result.OutputBuffers[index],
+                data.Slice(request.Offset, request.Offset + request.Size)));
+        }
+    };
+
+    // Sequential reads with small gaps running up to the very end of the file.
+    for (i64 offset = 0; offset < S; offset += 40) {
+        read({{.Offset = offset, .Size = std::min<i64>(30, S - offset)}}, EWorkloadCategory::UserBatch);
+    }
+
+    // Interactive reads interleaved with sequential ones.
+    for (i64 offset = 0; offset + 100 < S; offset += 100) {
+        read({{.Offset = offset, .Size = 100}}, EWorkloadCategory::UserBatch);
+        read({{.Offset = offset + 50, .Size = 50}}, EWorkloadCategory::UserInteractive);
+        read({{.Offset = S - offset - 10, .Size = 10}}, EWorkloadCategory::UserInteractive);
+    }
+
+    // Several requests at once.
+    for (i64 offset = 0; offset + 300 < S; offset += 300) {
+        read({
+            {.Offset = offset, .Size = 100},
+            {.Offset = offset + 100, .Size = 100},
+            {.Offset = S - offset - 100, .Size = 100},
+            {.Offset = offset + 200, .Size = 0},
+            {.Offset = offset + 200, .Size = 100},
+        }, EWorkloadCategory::UserBatch);
+    }
+}
+
+TEST_P(TIOEngineTest, ReadaheadFailure)
+{
+    auto engine = CreateIOEngine();
+    engine->Reconfigure(NYTree::ConvertTo<NYTree::INodePtr>(NYson::TYsonString(TString(ReadaheadConfig))));
+
+    auto fileName = GenerateRandomFileName("IOEngine");
+    TTempFile tempFile(fileName);
+
+    constexpr auto S = 16_KB;
+    auto data = GenerateRandomBlob(S);
+
+    WriteFile(fileName, data);
+
+    auto file = engine->Open({fileName, RdOnly})
+        .Get()
+        .ValueOrThrow();
+
+    auto read = [&] (i64 offset, i64 size) {
+        auto result = engine->Read({{file, offset, size}}, EWorkloadCategory::UserBatch, {}, {}, UseDedicatedAllocations())
+            .Get()
+            .ValueOrThrow();
+        ASSERT_EQ(1u, result.OutputBuffers.size());
+        EXPECT_TRUE(TRef::AreBitwiseEqual(
+            result.OutputBuffers[0],
+            data.Slice(offset, offset + size)));
+    };
+
+    // Get the reads served from readahead windows.
+    i64 offset = 0;
+    for (; offset < 4_KB; offset += 100) {
+        read(offset, 100);
+    }
+
+    // Windows still rely on the original file length and run past the end of the truncated file;
+    // requests must be served regardless.
+    constexpr auto TruncatedSize = 8_KB + 50;
+    TFile(fileName, OpenExisting | WrOnly).Resize(TruncatedSize);
+    for (; offset + 100 <= TruncatedSize; offset += 100) {
+        read(offset, 100);
+    }
+}
+
+TEST_P(TIOEngineTest, DiskScheduler)
+{
+    auto engine = CreateIOEngine();
+    engine->Reconfigure(NYTree::ConvertTo<NYTree::INodePtr>(NYson::TYsonString(TString(
+        "{"
+        "    disk_scheduler = {"
+        "        enable = %true;"
+        "        min_in_flight_request_count = 1;"
+        "        max_in_flight_request_count = 2;"
+        "        batch_deadline = 1;"
+        "    };"
+        "}"))));
+
+    auto fileName = GenerateRandomFileName("IOEngine");
+    TTempFile tempFile(fileName);
+
+    constexpr auto S = 64_KB;
+    auto data = GenerateRandomBlob(S);
+
+    WriteFile(fileName, data);
+
+    auto file = engine->Open({fileName, RdOnly})
+        .Get()
+        .ValueOrThrow();
+
+    constexpr i64 Size = 1_KB;
+    std::vector<TFuture<IIOEngine::TReadResponse>> futures;
+    std::vector<i64> offsets;
+    for (i64 offset = 0; offset < S; offset += Size) {
+        for (auto category : {EWorkloadCategory::UserBatch, EWorkloadCategory::SystemTabletCompaction, EWorkloadCategory::UserInteractive}) {
+            futures.push_back(engine->Read({{file, offset, Size}}, category, {}, {}, UseDedicatedAllocations()));
+            offsets.push_back(offset);
+        }
+    }
+
+    // Disabling the scheduler must release all the queued requests.
+    engine->Reconfigure(NYTree::ConvertTo<NYTree::INodePtr>(NYson::TYsonString(TString(
+        "{"
+        "    disk_scheduler = {"
+        "        enable = %false;"
+        "    };"
+        "}"))));
+
+    for (int index = 0; index < std::ssize(futures); ++index) {
+        auto result = futures[index]
+            .Get()
+            .ValueOrThrow();
+        ASSERT_EQ(1u, result.OutputBuffers.size());
+        EXPECT_TRUE(TRef::AreBitwiseEqual(
+            result.OutputBuffers[0],
+            data.Slice(offsets[index], offsets[index] + Size)));
+    }
+}
+
 const char DefaultConfig[] =
     "{"
     "}";
@@ -435,6 +600,14 @@ const char CustomConfig[] =
     "    large_unaligned_direct_io_read_size = 16384;"
     "}";
 
+const char RegisteredResourcesConfig[] =
+    "{"
+    "    uring_thread_count = 2;"
+    "    registered_buffer_count = 4;"
+    "    registered_buffer_size = 8192;"
+    "    fixed_file_count = 16;"
+    "}";
+
 bool AllocatorBehaviourCollocate(false);
 bool AllocatorBehaviourSeparate(true);
 
@@ -453,10 +626,12 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(EIOEngineType::Uring, DefaultConfig, AllocatorBehaviourCollocate),
         std::make_tuple(EIOEngineType::Uring, CustomConfig, AllocatorBehaviourCollocate),
         std::make_tuple(EIOEngineType::Uring, DefaultConfig, AllocatorBehaviourSeparate),
+        std::make_tuple(EIOEngineType::Uring, RegisteredResourcesConfig, AllocatorBehaviourCollocate),
 
         std::make_tuple(EIOEngineType::FairShareUring, DefaultConfig, AllocatorBehaviourCollocate),
         std::make_tuple(EIOEngineType::FairShareUring, CustomConfig, AllocatorBehaviourCollocate),
-        std::make_tuple(EIOEngineType::FairShareUring, DefaultConfig, AllocatorBehaviourSeparate)
+        std::make_tuple(EIOEngineType::FairShareUring, DefaultConfig, AllocatorBehaviourSeparate),
+        std::make_tuple(EIOEngineType::FairShareUring, RegisteredResourcesConfig, AllocatorBehaviourCollocate)
     )
 );
 
@@ -522,6 +697,119 @@ TEST_P(TIOEngineTest, Lock)
         .ThrowOnError();
 }
 
+TEST_P(TIOEngineTest, LockReleasedOnClose)
+{
+    auto engine = CreateIOEngine();
+
+    auto fileName = GenerateRandomFileName("IOEngine");
+    TTempFile tempFile(fileName);
+
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        auto handle = engine->Open({fileName, RdWr | OpenAlways})
+            .Get()
+            .ValueOrThrow();
+
+        engine->Lock({
+            .Handle = handle,
+            .Mode = ELockFileMode::Exclusive,
+            .Nonblocking = true,
+        })
+            .Get()
+            .ThrowOnError();
+
+        // Let the engine (possibly) register the file.
+        engine->Write({handle, 0, {GenerateRandomBlob(4_KB)}})
+            .Get()
+            .ThrowOnError();
+
+        // NB: The handle is still referenced here; closing must release the file nevertheless.
+        engine->Close({.Handle = handle})
+            .Get()
+            .ThrowOnError();
+    }
+}
+
+TEST_P(TIOEngineTest, LockReleasedOnCloseWithReadsInFlight)
+{
+    auto engine = CreateIOEngine();
+
+    auto fileName = GenerateRandomFileName("IOEngine");
+    TTempFile tempFile(fileName);
+
+    auto data = GenerateRandomBlob(64_KB);
+    WriteFile(fileName, data);
+
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        auto handle = engine->Open({fileName, RdOnly})
+            .Get()
+            .ValueOrThrow();
+
+        engine->Lock({
+            .Handle = handle,
+            .Mode = ELockFileMode::Exclusive,
+            .Nonblocking = true,
+        })
+            .Get()
+            .ThrowOnError();
+
+        std::vector<TFuture<IIOEngine::TReadResponse>> reads;
+        for (int index = 0; index < 16; ++index) {
+            reads.push_back(engine->Read({{handle, index * 4_KB, 4_KB}}, EWorkloadCategory::Idle, {}, {}, UseDedicatedAllocations()));
+        }
+
+        // NB: Reads still queued must not register the file again once it is being closed.
+        auto closeFuture = engine->Close({.Handle = handle});
+        AllSet(reads)
+            .Get()
+            .ThrowOnError();
+        closeFuture
+            .Get()
+            .ThrowOnError();
+    }
+
+    auto handle = engine->Open({fileName, RdOnly})
+        .Get()
+        .ValueOrThrow();
+    engine->Lock({
+        .Handle = handle,
+        .Mode = ELockFileMode::Exclusive,
+        .Nonblocking = true,
+    })
+        .Get()
+        .ThrowOnError();
+}
+
+TEST_P(TIOEngineTest, HoldManyReadBuffers)
+{
+    auto engine = CreateIOEngine();
+
+    auto fileName = GenerateRandomFileName("IOEngine");
+    TTempFile tempFile(fileName);
+
+    auto data = GenerateRandomBlob(64_KB);
+    WriteFile(fileName, data);
+
+    auto handle = engine->Open({fileName, RdOnly})
+        .Get()
+        .ValueOrThrow();
+
+    // NB: More buffers than registered ones are held at once.
+    for (int iteration = 0; iteration < 2; ++iteration) {
+        std::vector<TSharedRef> buffers;
+        for (int index = 0; index < 16; ++index) {
+            auto response = engine->Read({{handle, index * 4_KB, 4_KB}}, EWorkloadCategory::Idle, {}, {}, UseDedicatedAllocations())
+                .Get()
+                .ValueOrThrow();
+            ASSERT_EQ(1u, response.OutputBuffers.size());
+            buffers.push_back(std::move(response.OutputBuffers[0]));
+        }
+
+        for (int index = 0; index < 16; ++index) {
+            EXPECT_TRUE(TRef::AreBitwiseEqual(buffers[index], data.Slice(index * 4_KB, (index + 1) * 4_KB)));
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace
@@ -312,6 +312,55 @@ TEST_F(TDummyReadRequestCombinerTest, CombineEOFMultiHandles)
     EXPECT_FALSE( combiner->CheckEof(SliceTail(combineResult[2].ResultBuffer, 4000)).IsOK() );
 }
 
+TEST_F(TReadRequestCombinerTest, CustomAllocator)
+{
+    auto arena = TSharedMutableRef::AllocatePageAligned(16384);
+    auto combiner = CreateReadRequestCombiner(BIND([&] (i64 size) {
+        EXPECT_LE(size, std::ssize(arena));
+        return arena.Slice(0, size);
+    }));
+
+    auto combineResult = combiner->Combine(
+        {
+            { .Handle = TestHandles[0], .Offset = 1024, .Size = 512 },
+            { .Handle = TestHandles[1], .Offset = 0, .Size = 1024 },
+        },
+        PageSize,
+        GetRefCountedTypeCookie<IIOEngine::TDefaultReadTag>());
+
+    for (const auto& request : combineResult) {
+        EXPECT_GE(request.ResultBuffer.Begin(), arena.Begin());
+        EXPECT_LE(request.ResultBuffer.End(), arena.End());
+    }
+
+    for (const auto& buffer : combiner->ReleaseOutputBuffers()) {
+        EXPECT_GE(buffer.Begin(), arena.Begin());
+        EXPECT_LE(buffer.End(), arena.End());
+    }
+}
+
+TEST_F(TDummyReadRequestCombinerTest, CustomAllocatorFallback)
+{
+    std::vector<i64> requestedSizes;
+    auto combiner = CreateDummyReadRequestCombiner(BIND([&] (i64 size) {
+        requestedSizes.push_back(size);
+        return TSharedMutableRef();
+    }));
+
+    auto combineResult = combiner->Combine(
+        {
+            { .Handle = TestHandles[0], .Offset = 1024, .Size = 512 },
+            { .Handle = TestHandlesDirect[0], .Offset = 3000, .Size = 150 },
+        },
+        PageSize,
+        GetRefCountedTypeCookie<IIOEngine::TDefaultReadTag>());
+
+    EXPECT_EQ(requestedSizes, (std::vector<i64>{512, 4096}));
+    for (const auto& request : combineResult) {
+        EXPECT_EQ(std::ssize(request.ResultBuffer), request.ReadRequest.Size);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace
@@ -103,6 +103,9 @@ void TJobProxyConfig::Register(TRegistrar registrar)
     registrar.Parameter("gpu_devices", &TThis::GpuDevices)
         .Default();
 
+    registrar.Parameter("shm_bus_server", &TThis::ShmBusServer)
+        .Default();
+
     registrar.Parameter("supervisor_connection", &TThis::SupervisorConnection);
 
     registrar.Parameter("supervisor_rpc_timeout", &TThis::SupervisorRpcTimeout)
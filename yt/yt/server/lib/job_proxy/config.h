@@ -14,6 +14,8 @@
 
 #include <yt/yt/client/file_client/config.h>
 
+#include <yt/yt/core/bus/shm/config.h>
+
 #include <yt/yt/core/bus/tcp/config.h>
 
 #include <yt/yt/core/concurrency/public.h>
@@ -165,6 +167,10 @@ public:
     //! Path to write stderr (for testing purposes).
     std::optional<TString> StderrPath;
 
+    //! If set, job probing is additionally served over a shared memory bus
+    //! accepting connections at this socket.
+    NBus::TShmBusServerConfigPtr ShmBusServer;
+
     NBus::TBusClientConfigPtr SupervisorConnection;
     TDuration SupervisorRpcTimeout;
 
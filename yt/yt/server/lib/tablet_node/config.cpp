@@ -14,6 +14,8 @@
 
 #include <yt/yt/core/concurrency/config.h>
 
+#include <yt/yt/core/misc/frequency_sketch.h>
+
 namespace NYT::NTabletNode {
 
 using namespace NYTree;
@@ -216,6 +218,8 @@ void TCustomTableMountConfig::Register(TRegistrar registrar)
 
     registrar.Parameter("enable_lookup_hash_table", &TThis::EnableLookupHashTable)
         .Default(false);
+    registrar.Parameter("enable_columnar_in_memory_format", &TThis::EnableColumnarInMemoryFormat)
+        .Default(false);
 
     registrar.Parameter("lookup_cache_rows_per_tablet", &TThis::LookupCacheRowsPerTablet)
         .Default(0);
@@ -225,6 +229,12 @@ void TCustomTableMountConfig::Register(TRegistrar registrar)
         .LessThanOrEqual(1);
     registrar.Parameter("enable_lookup_cache_by_default", &TThis::EnableLookupCacheByDefault)
         .Default(false);
+    registrar.Parameter("lookup_cache_admission_frequency", &TThis::LookupCacheAdmissionFrequency)
+        .Default(0)
+        .InRange(0, TFrequencySketch::MaxFrequency);
+    registrar.Parameter("lookup_cache_max_data_size", &TThis::LookupCacheMaxDataSize)
+        .Default()
+        .GreaterThan(0);
 
     registrar.Parameter("row_count_to_keep", &TThis::RowCountToKeep)
         .Default(0);
@@ -298,6 +308,9 @@ void TCustomTableMountConfig::Register(TRegistrar registrar)
     registrar.Parameter("enable_hash_chunk_index_for_lookup", &TThis::EnableHashChunkIndexForLookup)
         .Default(false);
 
+    registrar.Parameter("enable_key_filter_for_lookup", &TThis::EnableKeyFilterForLookup)
+        .Default(false);
+
     registrar.Parameter("lookup_rpc_multiplexing_parallelism", &TThis::LookupRpcMultiplexingParallelism)
         .Default(1)
         .InRange(1, 16);
@@ -379,6 +392,9 @@ void TTableMountConfig::Register(TRegistrar registrar)
         if (config->EnableLookupHashTable && config->InMemoryMode != NTabletClient::EInMemoryMode::Uncompressed) {
             THROW_ERROR_EXCEPTION("\"enable_lookup_hash_table\" can only be true if \"in_memory_mode\" is \"uncompressed\"");
         }
+        if (config->EnableColumnarInMemoryFormat && config->InMemoryMode != NTabletClient::EInMemoryMode::Uncompressed) {
+            THROW_ERROR_EXCEPTION("\"enable_columnar_in_memory_format\" can only be true if \"in_memory_mode\" is \"uncompressed\"");
+        }
     });
 }
 
@@ -188,9 +188,19 @@ public:
 
     bool EnableLookupHashTable;
 
+    //! If set, uncompressed in-memory chunks in horizontal versioned formats are
+    //! re-encoded into the columnar format upon preload.
+    bool EnableColumnarInMemoryFormat;
+
     i64 LookupCacheRowsPerTablet;
     double LookupCacheRowsRatio;
     bool EnableLookupCacheByDefault;
+    //! Rows missed in lookup cache are only inserted if they were looked up
+    //! at least this many times recently (as estimated by a frequency sketch).
+    //! Zero disables admission control.
+    int LookupCacheAdmissionFrequency;
+    //! Bounds the memory occupied by lookup cache rows of a tablet.
+    std::optional<i64> LookupCacheMaxDataSize;
 
     i64 RowCountToKeep;
 
@@ -231,6 +241,8 @@ public:
 
     bool EnableHashChunkIndexForLookup;
 
+    bool EnableKeyFilterForLookup;
+
     int LookupRpcMultiplexingParallelism;
 
     bool EnableNewScanReaderForLookup;
@@ -184,6 +184,7 @@ private:
             EPacketFlags::None,
             /*generateChecksums*/ false,
             /*checksummedPartCount*/ 0,
+            /*partChecksums*/ {},
             /*packetId*/ {},
             message))
         {
@@ -80,17 +80,39 @@ EMasterReign TSaveContext::GetVersion()
 
 TLoadContext::TLoadContext(
     TBootstrap* bootstrap,
-    ICheckpointableInputStream* input)
-    : NHydra::TLoadContext(input)
+    ICheckpointableInputStream* input,
+    NConcurrency::IThreadPoolPtr backgroundThreadPool)
+    : NHydra::TLoadContext(
+        input,
+        std::move(backgroundThreadPool))
     , Bootstrap_(bootstrap)
 { }
 
+TLoadContext::TLoadContext(
+    IZeroCopyInput* input,
+    const TLoadContext* parentContext)
+    : NHydra::TLoadContext(input, parentContext)
+    , Bootstrap_(parentContext->GetBootstrap())
+    , ParentContext_(parentContext)
+{ }
+
 TObject* TLoadContext::GetWeakGhostObject(TObjectId id) const
 {
+    if (ParentContext_) {
+        return GetOrCrash(ParentContext_->WeakGhostObjects_, id);
+    }
+
     const auto& objectManager = Bootstrap_->GetObjectManager();
     return objectManager->GetWeakGhostObject(id);
 }
 
+void TLoadContext::RegisterWeakGhostObjects(THashMap<TObjectId, TObject*> weakGhostObjects)
+{
+    YT_VERIFY(!ParentContext_);
+
+    WeakGhostObjects_ = std::move(weakGhostObjects);
+}
+
 template <>
 const TSecurityTagsRegistryPtr& TLoadContext::GetInternRegistry() const
 {
@@ -100,6 +122,8 @@ const TSecurityTagsRegistryPtr& TLoadContext::GetInternRegistry() const
 
 TEntitySerializationKey TLoadContext::RegisterInternedYsonString(NYson::TYsonString str)
 {
+    YT_VERIFY(!ParentContext_);
+
     auto key = static_cast<int>(InternedYsonStrings_.size());
     InternedYsonStrings_.push_back(std::move(str));
     return TEntitySerializationKey(key);
@@ -107,9 +131,12 @@ TEntitySerializationKey TLoadContext::RegisterInternedYsonString(NYson::TYsonStr
 
 NYson::TYsonString TLoadContext::GetInternedYsonString(TEntitySerializationKey key)
 {
+    const auto& internedYsonStrings = ParentContext_
+        ? ParentContext_->InternedYsonStrings_
+        : InternedYsonStrings_;
     YT_ASSERT(key.Index >= 0);
-    YT_ASSERT(key.Index < static_cast<int>(InternedYsonStrings_.size()));
-    return InternedYsonStrings_[key.Index];
+    YT_ASSERT(key.Index < static_cast<int>(internedYsonStrings.size()));
+    return internedYsonStrings[key.Index];
 }
 
 EMasterReign TLoadContext::GetVersion()
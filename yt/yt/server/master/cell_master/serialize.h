@@ -127,6 +127,7 @@ DEFINE_ENUM(EMasterReign,
     ((HistoricallyNonVital)                                         (2312))  // gritukan
     ((DeprecateCypressListNodes)                                    (2313))  // kvk1920
     ((ConfigurableCollocationSizeLimit)                             (2314))  // akozhikhov
+    ((ParallelSnapshotLoading)                                      (2315))
 );
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -165,10 +166,22 @@ public:
 public:
     TLoadContext(
         TBootstrap* bootstrap,
-        NHydra::ICheckpointableInputStream* input);
+        NHydra::ICheckpointableInputStream* input,
+        NConcurrency::IThreadPoolPtr backgroundThreadPool = nullptr);
 
+    TLoadContext(
+        IZeroCopyInput* input,
+        const TLoadContext* parentContext);
+
+    //! Resolves a weak ghost object. Child contexts (which may run in background
+    //! threads) resolve via the map registered in the root context and never
+    //! touch the garbage collector.
     NObjectServer::TObject* GetWeakGhostObject(NObjectServer::TObjectId id) const;
 
+    //! Captures weak ghost objects loaded by the garbage collector.
+    //! Must be called on the root context before any child context is spawned.
+    void RegisterWeakGhostObjects(THashMap<NObjectServer::TObjectId, NObjectServer::TObject*> weakGhostObjects);
+
     template <class T>
     const TInternRegistryPtr<T>& GetInternRegistry() const;
 
@@ -178,7 +191,10 @@ public:
     EMasterReign GetVersion();
 
 private:
+    const TLoadContext* const ParentContext_ = nullptr;
+
     std::vector<NYson::TYsonString> InternedYsonStrings_;
+    THashMap<NObjectServer::TObjectId, NObjectServer::TObject*> WeakGhostObjects_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
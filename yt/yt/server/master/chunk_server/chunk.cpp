@@ -234,7 +234,11 @@ void TChunk::Load(NCellMaster::TLoadContext& context)
     ExpirationTime_ = Load<TInstant>(context);
 
     if (Load<bool>(context)) {
-        MutableReplicasData()->Load(context);
+        if (IsErasure()) {
+            LoadReplicasData<TErasureChunkReplicasData>(context);
+        } else {
+            LoadReplicasData<TRegularChunkReplicasData>(context);
+        }
     }
 
     auto exportCounter = Load<ui8>(context);
@@ -264,6 +268,19 @@ void TChunk::Load(NCellMaster::TLoadContext& context)
     }
 }
 
+template <class TData>
+void TChunk::LoadReplicasData(TLoadContext& context)
+{
+    // NB: Replicas data is pool-allocated and thus must be instantiated in the automaton thread
+    // while chunks may be loaded in background ones.
+    TData replicasData;
+    replicasData.Initialize();
+    replicasData.Load(context);
+    context.RegisterFixup(BIND([this, replicasData = std::move(replicasData)] {
+        *static_cast<TData*>(MutableReplicasData()) = replicasData;
+    }));
+}
+
 void TChunk::AddParent(TChunkTree* parent)
 {
     ++Parents_[parent];
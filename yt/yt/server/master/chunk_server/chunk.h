@@ -478,6 +478,9 @@ private:
     const TReplicasDataBase& ReplicasData() const;
     TReplicasDataBase* MutableReplicasData();
 
+    template <class TData>
+    void LoadReplicasData(NCellMaster::TLoadContext& context);
+
     void UpdateAggregatedRequisitionIndex(
         TChunkRequisitionRegistry* registry,
         const NObjectServer::IObjectManagerPtr& objectManager);
@@ -4216,8 +4216,13 @@ private:
     {
         using NYT::Load;
 
-        ChunkMap_.LoadValues(context);
-        ChunkListMap_.LoadValues(context);
+        if (context.GetVersion() >= EMasterReign::ParallelSnapshotLoading) {
+            ChunkMap_.LoadValuesParallel(context);
+            ChunkListMap_.LoadValuesParallel(context);
+        } else {
+            ChunkMap_.LoadValues(context);
+            ChunkListMap_.LoadValues(context);
+        }
         MediumMap_.LoadValues(context);
 
         // COMPAT(kvk1920): move to OnAfterSnapshotLoaded
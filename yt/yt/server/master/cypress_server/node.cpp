@@ -52,12 +52,16 @@ TCypressNode::~TCypressNode() = default;
 
 TInstant TCypressNode::GetTouchTime(bool branchIsOk) const
 {
+    NObjectServer::NDetail::AssertPersistentStateRead();
+
     YT_VERIFY(branchIsOk || IsTrunk());
     return TouchTime_;
 }
 
 void TCypressNode::SetTouchTime(TInstant touchTime, bool branchIsOk)
 {
+    NObjectServer::NDetail::AssertAutomatonThreadAffinity();
+
     YT_VERIFY(branchIsOk || IsTrunk());
     TouchTime_ = touchTime;
 }
@@ -74,11 +78,15 @@ void TCypressNode::SetModified(EModificationType modificationType)
 
 TCypressNode* TCypressNode::GetParent() const
 {
+    NObjectServer::NDetail::AssertPersistentStateRead();
+
     return Parent_;
 }
 
 void TCypressNode::SetParent(TCypressNode* parent)
 {
+    NObjectServer::NDetail::AssertAutomatonThreadAffinity();
+
     if (Parent_ == parent)
         return;
 
@@ -102,21 +110,29 @@ void TCypressNode::ResetParent()
 
 TCypressNode* TCypressNode::GetOriginator() const
 {
+    NObjectServer::NDetail::AssertPersistentStateRead();
+
     return Originator_;
 }
 
 void TCypressNode::SetOriginator(TCypressNode* originator)
 {
+    NObjectServer::NDetail::AssertAutomatonThreadAffinity();
+
     Originator_ = originator;
 }
 
 const TCypressNodeLockingState& TCypressNode::LockingState() const
 {
+    NObjectServer::NDetail::AssertPersistentStateRead();
+
     return LockingState_ ? *LockingState_ : TCypressNodeLockingState::Empty;
 }
 
 TCypressNodeLockingState* TCypressNode::MutableLockingState()
 {
+    NObjectServer::NDetail::AssertAutomatonThreadAffinity();
+
     if (!LockingState_) {
         LockingState_ = std::make_unique<TCypressNodeLockingState>();
     }
@@ -125,16 +141,22 @@ TCypressNodeLockingState* TCypressNode::MutableLockingState()
 
 bool TCypressNode::HasLockingState() const
 {
+    NObjectServer::NDetail::AssertPersistentStateRead();
+
     return LockingState_.operator bool();
 }
 
 void TCypressNode::ResetLockingState()
 {
+    NObjectServer::NDetail::AssertAutomatonThreadAffinity();
+
     LockingState_.reset();
 }
 
 void TCypressNode::ResetLockingStateIfEmpty()
 {
+    NObjectServer::NDetail::AssertAutomatonThreadAffinity();
+
     if (LockingState_ && LockingState_->IsEmpty()) {
         LockingState_.reset();
     }
@@ -180,12 +202,16 @@ TTabletResources TCypressNode::GetTabletResourceUsage() const
 
 NHydra::TRevision TCypressNode::GetNativeContentRevision() const
 {
+    NObjectServer::NDetail::AssertPersistentStateRead();
+
     YT_VERIFY(IsForeign());
     return NativeContentRevision_;
 }
 
 void TCypressNode::SetNativeContentRevision(NHydra::TRevision revision)
 {
+    NObjectServer::NDetail::AssertAutomatonThreadAffinity();
+
     YT_VERIFY(IsForeign());
     NativeContentRevision_ = revision;
 }
@@ -197,6 +223,8 @@ bool TCypressNode::IsBeingCreated() const
 
 bool TCypressNode::CanCacheResolve() const
 {
+    NObjectServer::NDetail::AssertPersistentStateRead();
+
     if (!TrunkNode_->LockingState().TransactionToExclusiveLocks.empty()) {
         return false;
     }
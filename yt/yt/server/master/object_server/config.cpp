@@ -82,9 +82,20 @@ void TDynamicObjectServiceConfig::Register(TRegistrar registrar)
 
     registrar.Parameter("local_read_executor_quantum_duration", &TThis::LocalReadExecutorQuantumDuration)
         .Default(TDuration::MilliSeconds(10));
+    registrar.Parameter("local_read_phase_duration", &TThis::LocalReadPhaseDuration)
+        .Default(TDuration::Zero());
 
     registrar.Parameter("process_sessions_period", &TThis::ProcessSessionsPeriod)
         .Default(TDuration::MilliSeconds(10));
+
+    registrar.Postprocessor([] (TThis* config) {
+        // Otherwise reads may take over the automaton thread leaving no time for mutations.
+        if (config->LocalReadPhaseDuration > config->ProcessSessionsPeriod) {
+            THROW_ERROR_EXCEPTION("\"local_read_phase_duration\" must not exceed \"process_sessions_period\"")
+                << TErrorAttribute("local_read_phase_duration", config->LocalReadPhaseDuration)
+                << TErrorAttribute("process_sessions_period", config->ProcessSessionsPeriod);
+        }
+    });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -133,6 +133,16 @@ public:
 
     TDuration LocalReadExecutorQuantumDuration;
 
+    //! Local read quanta are run back to back (picking up newly arrived sessions in between)
+    //! until the total duration of reads within a single session processing round reaches this value.
+    //! Increasing it gives reads a larger share of the automaton thread time.
+    //! Zero (the default) runs exactly one quantum per round.
+    /*!
+     *  Must not exceed #ProcessSessionsPeriod. The phase may still overrun this value by up to
+     *  #LocalReadExecutorQuantumDuration since a started quantum is never interrupted.
+     */
+    TDuration LocalReadPhaseDuration;
+
     TDuration ProcessSessionsPeriod;
 
     REGISTER_YSON_STRUCT(TDynamicObjectServiceConfig);
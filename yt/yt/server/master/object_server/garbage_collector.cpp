@@ -128,6 +128,10 @@ void TGarbageCollector::LoadKeys(NCellMaster::TLoadContext& context)
             YT_VERIFY(WeakGhosts_.emplace(objectId, objectHolder.release()).second);
         }
     }
+
+    // Entity values may be decoded in background threads; let them resolve
+    // weak ghosts without touching the automaton-bound map.
+    context.RegisterWeakGhostObjects(WeakGhosts_);
 }
 
 void TGarbageCollector::LoadValues(NCellMaster::TLoadContext& context)
@@ -84,4 +84,28 @@ void ValidateFolderId(const TString& folderId)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+TLocalReadPhaseStatistics RunLocalReadPhase(
+    TDuration phaseDuration,
+    const std::function<void()>& runQuantum,
+    const std::function<bool()>& hasPendingReads)
+{
+    auto startTime = GetCpuInstant();
+    auto deadlineTime = startTime + DurationToCpuDuration(phaseDuration);
+
+    TLocalReadPhaseStatistics statistics;
+    while (true) {
+        runQuantum();
+        ++statistics.QuantumCount;
+
+        if (GetCpuInstant() >= deadlineTime || !hasPendingReads()) {
+            break;
+        }
+    }
+
+    statistics.Duration = CpuDurationToDuration(GetCpuInstant() - startTime);
+    return statistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace NYT::NObjectServer
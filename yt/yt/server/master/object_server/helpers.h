@@ -8,6 +8,8 @@
 
 #include <yt/yt/client/object_client/public.h>
 
+#include <functional>
+
 namespace NYT::NObjectServer {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -40,4 +42,23 @@ void ValidateFolderId(const TString& folderId);
 
 ////////////////////////////////////////////////////////////////////////////////
 
+struct TLocalReadPhaseStatistics
+{
+    int QuantumCount = 0;
+    TDuration Duration;
+};
+
+//! Runs local read quanta back to back via #runQuantum.
+/*!
+ *  At least one quantum is run. The next one is only started if the phase has lasted
+ *  less than #phaseDuration so far and #hasPendingReads returns |true|; the latter is invoked
+ *  between quanta and may pick up newly arrived reads.
+ */
+TLocalReadPhaseStatistics RunLocalReadPhase(
+    TDuration phaseDuration,
+    const std::function<void()>& runQuantum,
+    const std::function<bool()>& hasPendingReads);
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace NYT::NObjectServer
@@ -263,6 +263,9 @@ private:
     TMpscStack<TExecuteSessionInfo> FinishedSessionInfos_;
 
     TStickyUserErrorCache StickyUserErrorCache_;
+
+    NProfiling::TEventTimer LocalReadPhaseTimer_ = ObjectServerProfiler.Timer("/local_read_phase_time");
+    NProfiling::TSummary LocalReadPhaseQuantumCountSummary_ = ObjectServerProfiler.Summary("/local_read_phase_quantum_count");
     std::atomic<bool> EnableTwoLevelCache_ = false;
     std::atomic<bool> EnableLocalReadExecutor_ = true;
     std::atomic<TDuration> ScheduleReplyRetryBackoff_ = TDuration::MilliSeconds(100);
@@ -279,6 +282,8 @@ private:
     void EnqueueFinishedSession(TExecuteSessionInfo sessionInfo);
 
     void ProcessSessions();
+    void ProcessReadySessions();
+    void RunLocalReadQuantum(TDuration quantumDuration);
     void FinishSession(const TExecuteSessionInfo& sessionInfo);
 
     void OnUserCharged(TUser* user, const TUserWorkload& workload);
@@ -2239,6 +2244,38 @@ void TObjectService::ProcessSessions()
         FinishSession(sessionInfo);
     });
 
+    ProcessReadySessions();
+
+    while (!AutomatonSessionScheduler_->IsEmpty() && GetCpuInstant() < deadlineTime) {
+        auto session = AutomatonSessionScheduler_->Dequeue();
+        TCurrentTraceContextGuard guard(session->GetTraceContext());
+
+        session->RunAutomatonSlow();
+    }
+
+    // NB: Local read executor cannot be turned off in runtime since some requests can be already in it.
+    if (Config_->EnableLocalReadExecutor) {
+        const auto& dynamicConfig = GetDynamicConfig();
+        auto statistics = RunLocalReadPhase(
+            dynamicConfig->LocalReadPhaseDuration,
+            [&] {
+                RunLocalReadQuantum(dynamicConfig->LocalReadExecutorQuantumDuration);
+            },
+            [&] {
+                // Sessions that became ready during the quantum need not wait for the next round.
+                ProcessReadySessions();
+                return !LocalReadSessionScheduler_->IsEmpty();
+            });
+
+        LocalReadPhaseTimer_.Record(statistics.Duration);
+        LocalReadPhaseQuantumCountSummary_.Record(statistics.QuantumCount);
+    }
+}
+
+void TObjectService::ProcessReadySessions()
+{
+    VERIFY_THREAD_AFFINITY(AutomatonThread);
+
     ReadySessions_.DequeueAll(false, [&] (TExecuteSessionPtr& session) {
         TCurrentTraceContextGuard guard(session->GetTraceContext());
 
@@ -2254,32 +2291,27 @@ void TObjectService::ProcessSessions()
             LocalReadSessionScheduler_->Enqueue(session, userName);
         }
     });
+}
 
-    while (!AutomatonSessionScheduler_->IsEmpty() && GetCpuInstant() < deadlineTime) {
-        auto session = AutomatonSessionScheduler_->Dequeue();
-        TCurrentTraceContextGuard guard(session->GetTraceContext());
-
-        session->RunAutomatonSlow();
-    }
-
-    // NB: Local read executor cannot be turned off in runtime since some requests can be already in it.
-    if (Config_->EnableLocalReadExecutor) {
-        auto quantumDuration = GetDynamicConfig()->LocalReadExecutorQuantumDuration;
-
-        TAutomatonBlockGuard guard(Bootstrap_->GetHydraFacade());
-        auto readFuture = LocalReadExecutor_->Run(quantumDuration);
+void TObjectService::RunLocalReadQuantum(TDuration quantumDuration)
+{
+    VERIFY_THREAD_AFFINITY(AutomatonThread);
 
-        if (Config_->EnableLocalReadBusyWait) {
-            // Busy wait is intended here to account local read time
-            // into automaton thread CPU usage.
-            while (!readFuture.IsSet())
-            { }
-        }
+    // Reads observe the state pinned at the current automaton version
+    // since no mutations are applied while the automaton is blocked.
+    TAutomatonBlockGuard guard(Bootstrap_->GetHydraFacade());
+    auto readFuture = LocalReadExecutor_->Run(quantumDuration);
 
-        readFuture
-            .Get()
-            .ThrowOnError();
+    if (Config_->EnableLocalReadBusyWait) {
+        // Busy wait is intended here to account local read time
+        // into automaton thread CPU usage.
+        while (!readFuture.IsSet())
+        { }
     }
+
+    readFuture
+        .Get()
+        .ThrowOnError();
 }
 
 void TObjectService::FinishSession(const TExecuteSessionInfo& sessionInfo)
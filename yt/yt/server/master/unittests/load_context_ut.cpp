@@ -0,0 +1,53 @@
+#include "chunk_helpers.h"
+
+#include <yt/yt/server/master/cell_master/serialize.h>
+
+#include <yt/yt/server/lib/hydra_common/checkpointable_stream.h>
+
+#include <yt/yt/core/concurrency/thread_pool.h>
+
+#include <util/stream/mem.h>
+
+namespace NYT::NCellMaster {
+namespace {
+
+using namespace NChunkServer;
+using namespace NChunkServer::NTesting;
+using namespace NConcurrency;
+using namespace NHydra;
+using namespace NObjectServer;
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TLoadContextTest
+    : public TChunkGeneratorBase
+{ };
+
+TEST_F(TLoadContextTest, ChildResolvesWeakGhostsInBackground)
+{
+    auto* ghost = CreateChunk(1, 1, 1, 1);
+
+    TMemoryInput rawInput;
+    auto input = CreateCheckpointableInputStream(&rawInput);
+    TLoadContext context(/*bootstrap*/ nullptr, input.get());
+    context.RegisterWeakGhostObjects({{ghost->GetId(), ghost}});
+
+    auto threadPool = CreateThreadPool(1, "LoadContextTest");
+    auto resolved = WaitFor(BIND([&] {
+            TMemoryInput batchInput;
+            TLoadContext batchContext(&batchInput, &context);
+            return batchContext.GetWeakGhostObject(ghost->GetId());
+        })
+        .AsyncVia(threadPool->GetInvoker())
+        .Run())
+        .ValueOrThrow();
+
+    EXPECT_EQ(ghost, resolved);
+
+    threadPool->Shutdown();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NCellMaster
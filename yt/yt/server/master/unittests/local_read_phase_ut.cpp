@@ -0,0 +1,105 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/server/master/object_server/config.h>
+#include <yt/yt/server/master/object_server/helpers.h>
+
+#include <yt/yt/core/ytree/convert.h>
+
+namespace NYT::NObjectServer {
+namespace {
+
+using namespace NYTree;
+using namespace NYson;
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(TLocalReadPhaseTest, SingleQuantumWithoutPendingReads)
+{
+    int quantumCount = 0;
+    int pendingCheckCount = 0;
+    auto statistics = RunLocalReadPhase(
+        TDuration::Seconds(10),
+        [&] { ++quantumCount; },
+        [&] {
+            ++pendingCheckCount;
+            return false;
+        });
+
+    EXPECT_EQ(1, quantumCount);
+    EXPECT_EQ(1, pendingCheckCount);
+    EXPECT_EQ(1, statistics.QuantumCount);
+}
+
+TEST(TLocalReadPhaseTest, QuantaRunWhileReadsPending)
+{
+    int pendingReadCount = 5;
+    int quantumCount = 0;
+    auto statistics = RunLocalReadPhase(
+        TDuration::Seconds(10),
+        [&] {
+            ++quantumCount;
+            --pendingReadCount;
+        },
+        [&] { return pendingReadCount > 0; });
+
+    EXPECT_EQ(5, quantumCount);
+    EXPECT_EQ(5, statistics.QuantumCount);
+    EXPECT_LT(statistics.Duration, TDuration::Seconds(10));
+}
+
+TEST(TLocalReadPhaseTest, PhaseDurationBound)
+{
+    auto quantumDuration = TDuration::MilliSeconds(10);
+    auto phaseDuration = TDuration::MilliSeconds(50);
+
+    int quantumCount = 0;
+    auto statistics = RunLocalReadPhase(
+        phaseDuration,
+        [&] {
+            ++quantumCount;
+            Sleep(quantumDuration);
+        },
+        [] { return true; });
+
+    EXPECT_EQ(quantumCount, statistics.QuantumCount);
+    EXPECT_GE(statistics.QuantumCount, 2);
+    EXPECT_LE(statistics.QuantumCount, 5);
+    EXPECT_GE(statistics.Duration, phaseDuration);
+    // A started quantum is not interrupted, so the phase may overrun by one quantum (plus scheduling noise).
+    EXPECT_LT(statistics.Duration, phaseDuration + quantumDuration + TDuration::Seconds(1));
+}
+
+TEST(TLocalReadPhaseTest, ZeroPhaseDurationRunsSingleQuantum)
+{
+    int quantumCount = 0;
+    auto statistics = RunLocalReadPhase(
+        TDuration::Zero(),
+        [&] { ++quantumCount; },
+        [] { return true; });
+
+    EXPECT_EQ(1, quantumCount);
+    EXPECT_EQ(1, statistics.QuantumCount);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(TLocalReadPhaseTest, DefaultPhaseIsSingleQuantum)
+{
+    auto config = New<TDynamicObjectServiceConfig>();
+    EXPECT_EQ(TDuration::Zero(), config->LocalReadPhaseDuration);
+}
+
+TEST(TLocalReadPhaseTest, PhaseDurationIsBoundedByProcessSessionsPeriod)
+{
+    EXPECT_NO_THROW(ConvertTo<TDynamicObjectServiceConfigPtr>(TYsonString(TStringBuf(
+        "{local_read_phase_duration=20;process_sessions_period=20}"))));
+    EXPECT_THROW_WITH_SUBSTRING(
+        ConvertTo<TDynamicObjectServiceConfigPtr>(TYsonString(TStringBuf(
+            "{local_read_phase_duration=30;process_sessions_period=20}"))),
+        "must not exceed");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NObjectServer
@@ -36,6 +36,7 @@
 #include <yt/yt/server/node/data_node/ytree_integration.h>
 #include <yt/yt/server/node/data_node/chunk_meta_manager.h>
 #include <yt/yt/server/node/data_node/skynet_http_handler.h>
+#include <yt/yt/server/node/data_node/ssd_block_cache.h>
 
 #include <yt/yt/server/node/exec_node/bootstrap.h>
 #include <yt/yt/server/node/exec_node/job_environment.h>
@@ -133,6 +134,8 @@
 
 #include <yt/yt/ytlib/program/helpers.h>
 
+#include <yt/yt/ytlib/tablet_client/row_comparer_generator.h>
+
 #include <yt/yt/client/misc/workload.h>
 
 #include <yt/yt/client/node_tracker_client/node_directory.h>
@@ -531,6 +534,11 @@ public:
         return VersionedChunkMetaManager_;
     }
 
+    const NTabletClient::IRowComparerProviderPtr& GetRowComparerProvider() const override
+    {
+        return RowComparerProvider_;
+    }
+
     const NYTree::IMapNodePtr& GetOrchidRoot() const override
     {
         return OrchidRoot_;
@@ -717,6 +725,8 @@ private:
     IChunkMetaManagerPtr ChunkMetaManager_;
     IVersionedChunkMetaManagerPtr VersionedChunkMetaManager_;
 
+    NTabletClient::IRowComparerProviderPtr RowComparerProvider_;
+
     IChunkRegistryPtr ChunkRegistry_;
     IBlobReaderCachePtr BlobReaderCache_;
 
@@ -849,12 +859,19 @@ private:
 
         NodeMemoryReferenceTracker_ = CreateNodeMemoryReferenceTracker(MemoryUsageTracker_);
 
-        BlockCache_ = ClientBlockCache_ = CreateClientBlockCache(
+        ClientBlockCache_ = CreateClientBlockCache(
             Config_->DataNode->BlockCache,
             EBlockType::UncompressedData | EBlockType::CompressedData,
             MemoryUsageTracker_->WithCategory(EMemoryCategory::BlockCache),
             NodeMemoryReferenceTracker_,
             DataNodeProfiler.WithPrefix("/block_cache"));
+        if (Config_->DataNode->SsdBlockCache->Enable) {
+            ClientBlockCache_ = CreateSsdBlockCache(
+                Config_->DataNode->SsdBlockCache,
+                ClientBlockCache_,
+                DataNodeProfiler.WithPrefix("/ssd_block_cache"));
+        }
+        BlockCache_ = ClientBlockCache_;
 
         BusServer_ = CreateBusServer(Config_->BusServer);
 
@@ -911,6 +928,12 @@ private:
             Config_->TabletNode->VersionedChunkMetaCache,
             GetMemoryUsageTracker()->WithCategory(EMemoryCategory::VersionedChunkMeta));
 
+        // Shared by tablet and data nodes: tablets with identical key schemas reuse compiled comparers.
+        RowComparerProvider_ = NTabletClient::CreateRowComparerProvider(
+            Config_->TabletNode->ColumnEvaluatorCache->CGCache,
+            NRpc::TDispatcher::Get()->GetHeavyInvoker(),
+            ClusterNodeProfiler.WithPrefix("/row_comparer_cache"));
+
         NetworkStatistics_ = std::make_unique<TNetworkStatistics>(Config_->DataNode);
 
         NodeResourceManager_ = New<TNodeResourceManager>(this);
@@ -1610,6 +1633,11 @@ const IVersionedChunkMetaManagerPtr& TBootstrapBase::GetVersionedChunkMetaManage
     return Bootstrap_->GetVersionedChunkMetaManager();
 }
 
+const NTabletClient::IRowComparerProviderPtr& TBootstrapBase::GetRowComparerProvider() const
+{
+    return Bootstrap_->GetRowComparerProvider();
+}
+
 const IMapNodePtr& TBootstrapBase::GetOrchidRoot() const
 {
     return Bootstrap_->GetOrchidRoot();
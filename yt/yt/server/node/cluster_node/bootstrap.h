@@ -40,6 +40,8 @@
 
 #include <yt/yt/ytlib/object_client/public.h>
 
+#include <yt/yt/ytlib/tablet_client/public.h>
+
 #include <yt/yt/library/coredumper/public.h>
 
 #include <yt/yt/core/actions/signal.h>
@@ -131,6 +133,7 @@ struct IBootstrapBase
     virtual const NDataNode::IChunkMetaManagerPtr& GetChunkMetaManager() const = 0;
     virtual const NTabletNode::IVersionedChunkMetaManagerPtr& GetVersionedChunkMetaManager() const = 0;
     virtual const NDataNode::TChunkReaderSweeperPtr& GetChunkReaderSweeper() const = 0;
+    virtual const NTabletClient::IRowComparerProviderPtr& GetRowComparerProvider() const = 0;
 
     // Orchid.
     virtual const NYTree::IMapNodePtr& GetOrchidRoot() const = 0;
@@ -273,6 +276,7 @@ public:
     const NDataNode::IChunkMetaManagerPtr& GetChunkMetaManager() const override;
     const NTabletNode::IVersionedChunkMetaManagerPtr& GetVersionedChunkMetaManager() const override;
     const NDataNode::TChunkReaderSweeperPtr& GetChunkReaderSweeper() const override;
+    const NTabletClient::IRowComparerProviderPtr& GetRowComparerProvider() const override;
 
     const NYTree::IMapNodePtr& GetOrchidRoot() const override;
 
@@ -331,7 +331,10 @@ void TBlobChunkBase::OnBlocksExtLoaded(
             const auto& blockCache = session->Options.BlockCache;
 
             auto blockId = TBlockId(Id_, entry.BlockIndex);
-            entry.Cookie = blockCache->GetBlockCookie(blockId, EBlockType::CompressedData);
+            entry.Cookie = blockCache->GetBlockCookie(
+                blockId,
+                EBlockType::CompressedData,
+                session->Options.WorkloadDescriptor);
 
             // Note that if the same block (currently not present in cache) is requested multiple times,
             // first occurrence getc Cached = false and is fetched from disk, while the rest gets
@@ -340,12 +343,22 @@ void TBlobChunkBase::OnBlocksExtLoaded(
             if (!entry.Cookie->IsActive()) {
                 entry.Cached = true;
                 session->Futures.push_back(entry.Cookie->GetBlockFuture().Apply(
-                    BIND([session, entryIndex] (const TCachedBlock& cachedBlock) {
-                        auto block = cachedBlock.Block;
+                    BIND([=, this, this_ = MakeStrong(this)] (const TErrorOr<TCachedBlock>& cachedBlockOrError) {
+                        if (!cachedBlockOrError.IsOK()) {
+                            // Block cache failures are treated as misses.
+                            YT_LOG_DEBUG(cachedBlockOrError, "Error getting block from cache, reading it from location (BlockId: %v:%v, LocationId: %v)",
+                                Id_,
+                                session->Entries[entryIndex].BlockIndex,
+                                Location_->GetId());
+                            return ReadBlockBypassingCache(session, entryIndex);
+                        }
+
+                        auto block = cachedBlockOrError.Value().Block;
                         session->Options.ChunkReaderStatistics->DataBytesReadFromCache.fetch_add(
                             block.Size(),
                             std::memory_order::relaxed);
                         session->Entries[entryIndex].Block = std::move(block);
+                        return VoidFuture;
                     })));
                 continue;
             }
@@ -539,6 +552,35 @@ void TBlobChunkBase::DoReadBlockSet(const TReadBlockSetSessionPtr& session)
     }
 }
 
+TFuture<void> TBlobChunkBase::ReadBlockBypassingCache(
+    const TReadBlockSetSessionPtr& session,
+    int entryIndex)
+{
+    VERIFY_THREAD_AFFINITY_ANY();
+
+    const auto& entry = session->Entries[entryIndex];
+    auto blockIndex = entry.BlockIndex;
+
+    const auto& outThrottler = Location_->GetOutThrottler(session->Options.WorkloadDescriptor);
+    return outThrottler->Throttle(entry.EndOffset - entry.BeginOffset)
+        .Apply(BIND([=, this, this_ = MakeStrong(this)] {
+            return GetReader()->ReadBlocks(
+                session->Options,
+                blockIndex,
+                /*blockCount*/ 1,
+                session->BlocksExt);
+        }).AsyncVia(session->Invoker))
+        .Apply(BIND([=, this, this_ = MakeStrong(this)] (const std::vector<TBlock>& blocks) {
+            YT_VERIFY(blocks.size() == 1);
+            const auto& block = blocks[0];
+            session->Entries[entryIndex].Block = block;
+            session->Options.BlockCache->PutBlock(
+                TBlockId(Id_, blockIndex),
+                EBlockType::CompressedData,
+                block);
+        }));
+}
+
 void TBlobChunkBase::OnBlocksRead(
     const TReadBlockSetSessionPtr& session,
     int firstBlockIndex,
@@ -130,6 +130,10 @@ private:
         int beginEntryIndex,
         int endEntryIndex,
         const TErrorOr<std::vector<NChunkClient::TBlock>>& blocksOrError);
+    //! Reads a single block from the location after a block cache failure.
+    TFuture<void> ReadBlockBypassingCache(
+        const TReadBlockSetSessionPtr& session,
+        int entryIndex);
 
     //! Returns `true` if chunk was writen with `sync_on_close` option.
     //! Default value is `true`.
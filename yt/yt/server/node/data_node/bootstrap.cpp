@@ -26,8 +26,6 @@
 #include <yt/yt/server/node/cluster_node/config.h>
 #include <yt/yt/server/node/cluster_node/dynamic_config_manager.h>
 
-#include <yt/yt/ytlib/tablet_client/row_comparer_generator.h>
-
 #include <yt/yt/ytlib/misc/memory_usage_tracker.h>
 
 #include <yt/yt/library/containers/disk_manager/disk_info_provider.h>
@@ -227,8 +225,6 @@ public:
 
         TableSchemaCache_ = New<TTableSchemaCache>(GetConfig()->DataNode->TableSchemaCache);
 
-        RowComparerProvider_ = NTabletClient::CreateRowComparerProvider(GetConfig()->TabletNode->ColumnEvaluatorCache->CGCache);
-
         GetRpcServer()->RegisterService(CreateDataNodeService(GetConfig()->DataNode, this));
 
         auto jobsProfiler = DataNodeProfiler.WithPrefix("/master_jobs");
@@ -420,11 +416,6 @@ public:
         return TableSchemaCache_;
     }
 
-    const NTabletClient::IRowComparerProviderPtr& GetRowComparerProvider() const override
-    {
-        return RowComparerProvider_;
-    }
-
     const IIOThroughputMeterPtr& GetIOThroughputMeter() const override
     {
         return IOThroughputMeter_;
@@ -464,8 +455,6 @@ private:
 
     TTableSchemaCachePtr TableSchemaCache_;
 
-    NTabletClient::IRowComparerProviderPtr RowComparerProvider_;
-
     NHttp::IServerPtr SkynetHttpServer_;
 
     IIOThroughputMeterPtr IOThroughputMeter_;
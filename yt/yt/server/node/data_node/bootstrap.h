@@ -50,7 +50,6 @@ struct IBootstrap
 
     // Caches.
     virtual const TTableSchemaCachePtr& GetTableSchemaCache() const = 0;
-    virtual const NTabletClient::IRowComparerProviderPtr& GetRowComparerProvider() const = 0;
 
     virtual const IIOThroughputMeterPtr& GetIOThroughputMeter() const = 0;
 
@@ -60,6 +60,15 @@ void TP2PConfig::Register(TRegistrar registrar)
     registrar.Parameter("block_redistribution_ticks", &TThis::BlockRedistributionTicks)
         .Default(3000);
 
+    registrar.Parameter("enable_tree_distribution", &TThis::EnableTreeDistribution)
+        .Default(false);
+    registrar.Parameter("tree_fanout", &TThis::TreeFanout)
+        .GreaterThan(0)
+        .Default(4);
+    registrar.Parameter("max_tree_node_count", &TThis::MaxTreeNodeCount)
+        .GreaterThan(0)
+        .Default(256);
+
     registrar.Parameter("node_tag_filter", &TThis::NodeTagFilter)
         .Default(MakeBooleanFormula("!CLOUD"));
 
@@ -285,6 +294,16 @@ void TMultiplexedChangelogConfig::Register(TRegistrar registrar)
         .Default(TDuration::Minutes(1));
     registrar.Parameter("big_record_threshold", &TThis::BigRecordThreshold)
         .Default();
+    registrar.Parameter("enable_group_commit", &TThis::EnableGroupCommit)
+        .Default(false);
+    registrar.Parameter("group_commit_window", &TThis::GroupCommitWindow)
+        .Default(TDuration::MilliSeconds(2));
+    registrar.Parameter("max_group_commit_record_count", &TThis::MaxGroupCommitRecordCount)
+        .GreaterThan(0)
+        .Default(10000);
+    registrar.Parameter("max_group_commit_data_size", &TThis::MaxGroupCommitDataSize)
+        .GreaterThan(0)
+        .Default(16_MB);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -563,6 +582,26 @@ void TChunkRepairJobDynamicConfig::Register(TRegistrar registrar)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void TChunkReplicationJobDynamicConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("window_size", &TThis::WindowSize)
+        .GreaterThan(0)
+        .Default(16_MB);
+
+    registrar.Parameter("max_read_ahead_window_count", &TThis::MaxReadAheadWindowCount)
+        .GreaterThanOrEqual(0)
+        .Default(1);
+
+    registrar.Parameter("enable_local_copy", &TThis::EnableLocalCopy)
+        .Default(false);
+
+    registrar.Parameter("local_copy_chunk_size", &TThis::LocalCopyChunkSize)
+        .GreaterThan(0)
+        .Default(16_MB);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void TJournalManagerConfig::Register(TRegistrar registrar)
 {
     registrar.Parameter("multiplexed_changelog", &TThis::MultiplexedChangelog)
@@ -583,6 +622,51 @@ void TJournalManagerConfig::Register(TRegistrar registrar)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void TSsdBlockCacheConfig::Register(TRegistrar registrar)
+{
+    registrar.Parameter("enable", &TThis::Enable)
+        .Default(false);
+    registrar.Parameter("path", &TThis::Path)
+        .Default();
+    registrar.Parameter("capacity", &TThis::Capacity)
+        .GreaterThanOrEqual(0)
+        .Default(0);
+    registrar.Parameter("io_engine_type", &TThis::IOEngineType)
+        .Default(NIO::EIOEngineType::ThreadPool);
+    registrar.Parameter("io_config", &TThis::IOConfig)
+        .Optional();
+    registrar.Parameter("use_direct_io", &TThis::UseDirectIO)
+        .Default(true);
+    registrar.Parameter("max_block_size", &TThis::MaxBlockSize)
+        .GreaterThan(0)
+        .Default(16_MB);
+    registrar.Parameter("max_pending_write_size", &TThis::MaxPendingWriteSize)
+        .GreaterThanOrEqual(0)
+        .Default(256_MB);
+    registrar.Parameter("index_flush_write_size", &TThis::IndexFlushWriteSize)
+        .GreaterThan(0)
+        .Default(1_GB);
+
+    registrar.Postprocessor([] (TThis* config) {
+        if (!config->Enable) {
+            return;
+        }
+        if (config->Path.empty()) {
+            THROW_ERROR_EXCEPTION("\"path\" must be set when SSD block cache is enabled");
+        }
+        if (config->Capacity == 0) {
+            THROW_ERROR_EXCEPTION("\"capacity\" must be positive when SSD block cache is enabled");
+        }
+        if (config->MaxBlockSize > config->IndexFlushWriteSize) {
+            THROW_ERROR_EXCEPTION("\"max_block_size\" cannot exceed \"index_flush_write_size\"")
+                << TErrorAttribute("max_block_size", config->MaxBlockSize)
+                << TErrorAttribute("index_flush_write_size", config->IndexFlushWriteSize);
+        }
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void TDataNodeConfig::Register(TRegistrar registrar)
 {
     registrar.Parameter("lease_transaction_timeout", &TThis::LeaseTransactionTimeout)
@@ -621,6 +705,8 @@ void TDataNodeConfig::Register(TRegistrar registrar)
         .DefaultNew();
     registrar.Parameter("block_cache", &TThis::BlockCache)
         .DefaultNew();
+    registrar.Parameter("ssd_block_cache", &TThis::SsdBlockCache)
+        .DefaultNew();
     registrar.Parameter("blob_reader_cache", &TThis::BlobReaderCache)
         .DefaultNew();
     registrar.Parameter("changelog_reader_cache", &TThis::ChangelogReaderCache)
@@ -901,6 +987,9 @@ void TDataNodeDynamicConfig::Register(TRegistrar registrar)
     registrar.Parameter("chunk_repair_job", &TThis::ChunkRepairJob)
         .DefaultNew();
 
+    registrar.Parameter("chunk_replication_job", &TThis::ChunkReplicationJob)
+        .DefaultNew();
+
     registrar.Parameter("store_location_config_per_medium", &TThis::StoreLocationConfigPerMedium)
         .Default();
 
@@ -64,6 +64,15 @@ public:
     int HotBlockReplicaCount;
     int BlockRedistributionTicks;
 
+    //! If set, hot blocks are distributed along a per-chunk fan-out tree of eligible nodes:
+    //! the node holding a hot chunk seeds the first tree level and every node
+    //! receiving new blocks forwards them to its own children.
+    bool EnableTreeDistribution;
+    //! Number of children of every tree node.
+    int TreeFanout;
+    //! Maximum number of nodes in a distribution tree of a single chunk.
+    int MaxTreeNodeCount;
+
     TBooleanFormula NodeTagFilter;
 
     REGISTER_YSON_STRUCT(TP2PConfig);
@@ -270,6 +279,19 @@ public:
     //! Records bigger than BigRecordThreshold are not multiplexed.
     std::optional<i64> BigRecordThreshold;
 
+    //! If set, appends of all journal chunks of the location are gathered into batches,
+    //! each written to the multiplexed changelog and flushed at once.
+    bool EnableGroupCommit;
+
+    //! Maximum time a batch is being gathered for since its first append.
+    TDuration GroupCommitWindow;
+
+    //! A batch is committed right away once it has this many records...
+    int MaxGroupCommitRecordCount;
+
+    //! ...or this many bytes.
+    i64 MaxGroupCommitDataSize;
+
     REGISTER_YSON_STRUCT(TMultiplexedChangelogConfig);
 
     static void Register(TRegistrar registrar);
@@ -654,6 +676,34 @@ DEFINE_REFCOUNTED_TYPE(TChunkRepairJobDynamicConfig)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class TChunkReplicationJobDynamicConfig
+    : public NYTree::TYsonStruct
+{
+public:
+    //! Blocks are read from disk and sent to targets in windows of (about) this size.
+    i64 WindowSize;
+
+    //! Number of windows read ahead of the one being sent; bounds the memory
+    //! of a job to about |(max_read_ahead_window_count + 1) * window_size|.
+    int MaxReadAheadWindowCount;
+
+    //! If set, blob chunks replicated to another location of the same node
+    //! are copied file to file via copy_file_range instead of being sent over network.
+    bool EnableLocalCopy;
+
+    //! Granularity of local copying: data is throttled, copied and verified in chunks
+    //! of this size and the thread is released between them.
+    i64 LocalCopyChunkSize;
+
+    REGISTER_YSON_STRUCT(TChunkReplicationJobDynamicConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TChunkReplicationJobDynamicConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TJournalManagerConfig
     : public virtual NYTree::TYsonStruct
 {
@@ -678,6 +728,50 @@ DEFINE_REFCOUNTED_TYPE(TJournalManagerConfig)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+//! Persistent second-tier block cache backed by a local SSD/NVMe file.
+//! Blocks evicted from the in-memory block cache are admitted here.
+class TSsdBlockCacheConfig
+    : public NYTree::TYsonStruct
+{
+public:
+    bool Enable;
+
+    //! Directory holding the cache data file and its index.
+    TString Path;
+
+    //! Size of the cache data file.
+    i64 Capacity;
+
+    //! IO Engine type.
+    NIO::EIOEngineType IOEngineType;
+
+    //! IO Engine config.
+    NYTree::INodePtr IOConfig;
+
+    //! Whether to bypass the page cache for the data file.
+    bool UseDirectIO;
+
+    //! Blocks larger than this are never admitted.
+    i64 MaxBlockSize;
+
+    //! Evicted blocks are dropped (rather than admitted) when this many bytes
+    //! are already waiting to be written.
+    i64 MaxPendingWriteSize;
+
+    //! The on-disk index is rewritten each time this many bytes are written to the data file.
+    //! Entries in the region that could have been overwritten since the last index flush
+    //! are discarded on restart.
+    i64 IndexFlushWriteSize;
+
+    REGISTER_YSON_STRUCT(TSsdBlockCacheConfig);
+
+    static void Register(TRegistrar registrar);
+};
+
+DEFINE_REFCOUNTED_TYPE(TSsdBlockCacheConfig)
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TDataNodeConfig
     : public TJournalManagerConfig
 {
@@ -727,6 +821,9 @@ public:
     //! Cache for all types of blocks.
     NChunkClient::TBlockCacheConfigPtr BlockCache;
 
+    //! Second-tier cache for blocks evicted from #BlockCache.
+    TSsdBlockCacheConfigPtr SsdBlockCache;
+
     //! Opened blob chunks cache.
     TSlruCacheConfigPtr BlobReaderCache;
 
@@ -956,6 +1053,8 @@ public:
 
     TChunkRepairJobDynamicConfigPtr ChunkRepairJob;
 
+    TChunkReplicationJobDynamicConfigPtr ChunkReplicationJob;
+
     TLocationHealthCheckerDynamicConfigPtr LocationHealthChecker;
 
     THashMap<TString, TStoreLocationDynamicConfigPtr> StoreLocationConfigPerMedium;
@@ -536,6 +536,7 @@ private:
         ValidateOnline();
 
         const auto& blockCache = Bootstrap_->GetP2PBlockCache();
+        const auto& p2pSnooper = Bootstrap_->GetP2PSnooper();
 
         auto blocks = GetRpcAttachedBlocks(request, true /* validateChecksums */);
         if (std::ssize(blocks) != request->block_indexes_size()) {
@@ -568,11 +569,27 @@ private:
                 chunkBlocks.push_back(blocks[j + k]);
             }
 
-            blockCache->HoldBlocks(
+            auto newBlockPositions = blockCache->HoldBlocks(
                 chunkId,
                 blockIndexes,
                 chunkBlocks);
 
+            if (!newBlockPositions.empty()) {
+                std::vector<int> newBlockIndexes;
+                std::vector<NChunkClient::TBlock> newBlocks;
+                newBlockIndexes.reserve(newBlockPositions.size());
+                newBlocks.reserve(newBlockPositions.size());
+                for (auto position : newBlockPositions) {
+                    newBlockIndexes.push_back(blockIndexes[position]);
+                    newBlocks.push_back(chunkBlocks[position]);
+                }
+
+                p2pSnooper->OnBlocksReceived(
+                    chunkId,
+                    newBlockIndexes,
+                    newBlocks);
+            }
+
             j += blockCount;
         }
 
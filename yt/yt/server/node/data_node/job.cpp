@@ -2,6 +2,7 @@
 
 #include "bootstrap.h"
 #include "private.h"
+#include "blob_chunk.h"
 #include "chunk.h"
 #include "chunk_store.h"
 #include "config.h"
@@ -9,6 +10,8 @@
 #include "journal_dispatcher.h"
 #include "location.h"
 #include "master_connector.h"
+#include "replication_helpers.h"
+#include "session.h"
 
 #include <yt/yt/server/lib/chunk_server/proto/job.pb.h>
 
@@ -37,6 +40,7 @@
 #include <yt/yt/ytlib/chunk_client/erasure_adaptive_repair.h>
 #include <yt/yt/ytlib/chunk_client/erasure_repair.h>
 #include <yt/yt/ytlib/chunk_client/erasure_part_writer.h>
+#include <yt/yt/ytlib/chunk_client/format.h>
 #include <yt/yt/ytlib/chunk_client/helpers.h>
 #include <yt/yt/ytlib/chunk_client/replication_reader.h>
 #include <yt/yt/ytlib/chunk_client/replication_writer.h>
@@ -89,10 +93,13 @@
 
 #include <yt/yt/core/logging/log.h>
 
+#include <yt/yt/core/misc/fs.h>
 #include <yt/yt/core/misc/protobuf_helpers.h>
 
 #include <util/generic/algorithm.h>
 
+#include <deque>
+
 namespace NYT::NDataNode {
 
 using namespace NApi;
@@ -471,6 +478,12 @@ private:
 
         auto chunk = GetLocalChunkOrThrow(ChunkId_, sourceMediumIndex);
 
+        auto dynamicConfig = GetDynamicConfig();
+        if (dynamicConfig->EnableLocalCopy && IsLocalReplication(chunk, targetReplicas)) {
+            CopyChunkLocally(chunk, sessionId, workloadDescriptor, dynamicConfig);
+            return;
+        }
+
         TChunkReadOptions chunkReadOptions;
         chunkReadOptions.WorkloadDescriptor = workloadDescriptor;
         chunkReadOptions.BlockCache = Bootstrap_->GetBlockCache();
@@ -510,15 +523,38 @@ private:
             YT_LOG_DEBUG("Writer opened");
         }
 
+        // Blocks are read in windows of bounded size; up to |MaxReadAheadWindowCount| windows
+        // are being read while the current one is being sent.
+        struct TWindow
+        {
+            int BlockCount;
+            TFuture<std::vector<TBlock>> AsyncBlocks;
+        };
+        std::deque<TWindow> windows;
+
         int currentBlockIndex = 0;
+        int nextWindowBlockIndex = 0;
         int blockCount = GetBlockCount(ChunkId_, *meta);
+        auto blockSizes = GetBlockSizes(ChunkId_, *meta);
         while (currentBlockIndex < blockCount) {
-            auto asyncReadBlocks = chunk->ReadBlockRange(
-                currentBlockIndex,
-                blockCount - currentBlockIndex,
-                chunkReadOptions);
+            while (nextWindowBlockIndex < blockCount && std::ssize(windows) <= dynamicConfig->MaxReadAheadWindowCount) {
+                int windowBlockCount = blockSizes
+                    ? GetReplicationWindowBlockCount(*blockSizes, nextWindowBlockIndex, dynamicConfig->WindowSize)
+                    : blockCount - nextWindowBlockIndex;
+                windows.push_back({
+                    .BlockCount = windowBlockCount,
+                    .AsyncBlocks = chunk->ReadBlockRange(
+                        nextWindowBlockIndex,
+                        windowBlockCount,
+                        chunkReadOptions),
+                });
+                nextWindowBlockIndex += windowBlockCount;
+            }
+
+            auto window = std::move(windows.front());
+            windows.pop_front();
 
-            auto readBlocks = WaitFor(asyncReadBlocks)
+            auto readBlocks = WaitFor(window.AsyncBlocks)
                 .ValueOrThrow();
 
             i64 totalBlockSize = 0;
@@ -553,6 +589,12 @@ private:
                 writeBlocks.push_back(block);
             }
 
+            if (writeBlocks.empty()) {
+                THROW_ERROR_EXCEPTION("Failed to read block %v of chunk %v",
+                    currentBlockIndex,
+                    ChunkId_);
+            }
+
             YT_LOG_DEBUG("Enqueuing blocks for replication (Blocks: %v-%v)",
                 currentBlockIndex,
                 currentBlockIndex + static_cast<int>(writeBlocks.size()) - 1);
@@ -564,6 +606,13 @@ private:
             }
 
             currentBlockIndex += writeBlocks.size();
+
+            // Read may return fewer blocks than requested (e.g. for journal chunks);
+            // windows read ahead are not adjacent to the current one then.
+            if (std::ssize(writeBlocks) < window.BlockCount) {
+                windows.clear();
+                nextWindowBlockIndex = currentBlockIndex;
+            }
         }
 
         YT_LOG_DEBUG("All blocks are enqueued for replication");
@@ -604,6 +653,134 @@ private:
                 YT_ABORT();
         }
     }
+
+    //! Returns block sizes if they are known from the meta (that is, for blob chunks).
+    static std::optional<std::vector<i64>> GetBlockSizes(TChunkId chunkId, const TChunkMeta& meta)
+    {
+        switch (TypeFromId(DecodeChunkId(chunkId).Id)) {
+            case EObjectType::Chunk:
+            case EObjectType::ErasureChunk: {
+                auto blocksExt = GetProtoExtension<NChunkClient::NProto::TBlocksExt>(meta.extensions());
+                std::vector<i64> blockSizes;
+                blockSizes.reserve(blocksExt.blocks_size());
+                for (const auto& block : blocksExt.blocks()) {
+                    blockSizes.push_back(block.size());
+                }
+                return blockSizes;
+            }
+
+            default:
+                return std::nullopt;
+        }
+    }
+
+    bool IsLocalReplication(const IChunkPtr& chunk, const TChunkReplicaWithMediumList& targetReplicas) const
+    {
+        if (targetReplicas.size() != 1 || targetReplicas[0].GetNodeId() != Bootstrap_->GetNodeId()) {
+            return false;
+        }
+
+        auto chunkType = TypeFromId(DecodeChunkId(chunk->GetId()).Id);
+        return chunkType == EObjectType::Chunk || chunkType == EObjectType::ErasureChunk;
+    }
+
+    //! Replicates a blob chunk to another location of this node by copying its files
+    //! within the kernel rather than sending its blocks through the network stack.
+    //! The copy is charged to the same throttlers as the network path and the copied blocks
+    //! are verified against the checksums from the chunk meta.
+    void CopyChunkLocally(
+        const IChunkPtr& chunk,
+        TSessionId sessionId,
+        const TWorkloadDescriptor& workloadDescriptor,
+        const TChunkReplicationJobDynamicConfigPtr& dynamicConfig)
+    {
+        const auto& chunkStore = Bootstrap_->GetChunkStore();
+
+        TSessionOptions sessionOptions;
+        sessionOptions.WorkloadDescriptor = workloadDescriptor;
+        auto [location, lockedChunkGuard] = chunkStore->AcquireNewChunkLocation(sessionId, sessionOptions);
+
+        auto readGuard = TChunkReadGuard::Acquire(chunk);
+
+        TChunkReadOptions chunkReadOptions;
+        chunkReadOptions.WorkloadDescriptor = workloadDescriptor;
+        chunkReadOptions.ChunkReaderStatistics = New<TChunkReaderStatistics>();
+        auto meta = WaitFor(chunk->ReadMeta(chunkReadOptions))
+            .ValueOrThrow();
+        auto blocksExt = New<NIO::TBlocksExt>(GetProtoExtension<NChunkClient::NProto::TBlocksExt>(meta->extensions()));
+
+        TChunkDataCopyOptions copyOptions{
+            .WindowSize = dynamicConfig->LocalCopyChunkSize,
+            .Throttlers = {
+                Bootstrap_->GetOutThrottler(workloadDescriptor),
+                Bootstrap_->GetInThrottler(workloadDescriptor),
+                chunk->GetLocation()->GetOutThrottler(workloadDescriptor),
+                location->GetInThrottler(workloadDescriptor),
+            },
+        };
+
+        auto sourceFileName = chunk->GetLocation()->GetChunkPath(ChunkId_);
+        auto targetFileName = location->GetChunkPath(ChunkId_);
+
+        YT_LOG_INFO("Copying chunk to local location (SourceLocationId: %v, TargetLocationId: %v)",
+            chunk->GetLocation()->GetId(),
+            location->GetId());
+
+        // NB: Copying is blocking; keep it off the job threads.
+        const auto& targetLocation = location;
+        WaitFor(BIND([=, this, this_ = MakeStrong(this), copyOptions = std::move(copyOptions)] {
+            auto copyFile = [&] (const TString& from, const TString& to, bool dataFile) {
+                TFile source(from, OpenExisting | RdOnly | Seq | CloseOnExec);
+                TFile target(to + NFS::TempFileSuffix, CreateAlways | RdWr | Seq | CloseOnExec);
+                if (dataFile) {
+                    CopyChunkDataFile(source, target, *blocksExt, copyOptions);
+                } else {
+                    NFS::CopyFileRange(source, target, copyOptions.WindowSize);
+                }
+                target.FlushData();
+                target.Close();
+            };
+
+            try {
+                copyFile(sourceFileName, targetFileName, /*dataFile*/ true);
+                copyFile(sourceFileName + ChunkMetaSuffix, targetFileName + ChunkMetaSuffix, /*dataFile*/ false);
+
+                NFS::Rename(targetFileName + ChunkMetaSuffix + NFS::TempFileSuffix, targetFileName + ChunkMetaSuffix);
+                NFS::Rename(targetFileName + NFS::TempFileSuffix, targetFileName);
+                NFS::FlushDirectory(NFS::GetDirectoryName(targetFileName));
+            } catch (const std::exception& ex) {
+                for (const auto& fileName : {targetFileName, targetFileName + ChunkMetaSuffix}) {
+                    auto tempFileName = fileName + NFS::TempFileSuffix;
+                    if (NFS::Exists(tempFileName)) {
+                        NFS::Remove(tempFileName);
+                    }
+                }
+                THROW_ERROR_EXCEPTION(NChunkClient::EErrorCode::IOError, "Error copying chunk %v to location %v",
+                    ChunkId_,
+                    targetLocation->GetId())
+                    << ex;
+            }
+        })
+            .AsyncVia(targetLocation->GetAuxPoolInvoker())
+            .Run())
+            .ThrowOnError();
+
+        auto descriptor = TChunkDescriptor(ChunkId_, chunk->GetInfo().disk_space());
+        auto newChunk = New<TStoredBlobChunk>(
+            TChunkContext::Create(Bootstrap_),
+            location,
+            descriptor);
+        chunkStore->RegisterNewChunk(newChunk, /*session*/ nullptr, std::move(lockedChunkGuard));
+
+        YT_LOG_INFO("Chunk copied to local location (DiskSpace: %v)",
+            descriptor.DiskSpace);
+    }
+
+    TChunkReplicationJobDynamicConfigPtr GetDynamicConfig() const
+    {
+        const auto& dynamicConfigManager = Bootstrap_->GetDynamicConfigManager();
+        return dynamicConfigManager->GetConfig()->DataNode->ChunkReplicationJob;
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -497,11 +497,16 @@ public:
         IFileChangelogDispatcherPtr multiplexedChangelogDispatcher,
         TString path,
         IInvokerPtr invoker,
-        NLogging::TLogger logger)
+        NLogging::TLogger logger,
+        NProfiling::TProfiler profiler)
         : MultiplexedChangelogDispatcher_(std::move(multiplexedChangelogDispatcher))
         , Path_(std::move(path))
         , Invoker_(std::move(invoker))
         , Logger(std::move(logger))
+        , GroupCommitBatchRecordCount_(profiler.Summary("/group_commit/batch_record_count"))
+        , GroupCommitBatchDataSize_(profiler.Summary("/group_commit/batch_data_size"))
+        , GroupCommitWaitTimer_(profiler.Timer("/group_commit/wait_time"))
+        , GroupCommitTimer_(profiler.Timer("/group_commit/commit_time"))
         , MultiplexedCleanupExecutor_(New<TPeriodicExecutor>(
             Invoker_,
             BIND(&TMultiplexedWriter::OnMultiplexedCleanup, MakeWeak(this)),
@@ -661,6 +666,11 @@ private:
 
     const NLogging::TLogger Logger;
 
+    const NProfiling::TSummary GroupCommitBatchRecordCount_;
+    const NProfiling::TSummary GroupCommitBatchDataSize_;
+    const NProfiling::TEventTimer GroupCommitWaitTimer_;
+    const NProfiling::TEventTimer GroupCommitTimer_;
+
     const TPeriodicExecutorPtr MultiplexedCleanupExecutor_;
     const TPeriodicExecutorPtr BarrierCleanupExecutor_;
 
@@ -686,6 +696,15 @@ private:
     //! Used to guarantee that multiplexed changelogs are being marked as clean in proper order.
     THashMap<int, TPromise<void>> MultiplexedChangelogIdToCleanResult_;
 
+    //! Records gathered for the next group commit.
+    std::vector<TSharedRef> PendingRecords_;
+    i64 PendingDataSize_ = 0;
+    //! Set when the pending batch is committed.
+    TPromise<void> PendingBatchPromise_;
+    NProfiling::TCpuInstant PendingBatchStartTime_ = 0;
+    //! Incremented whenever a new batch is started; used to match group commit window expirations.
+    i64 PendingBatchId_ = 0;
+
 
     TFuture<void> WriteMultiplexedRecords(
         const TMultiplexedChangelogConfigPtr& config,
@@ -728,6 +747,94 @@ private:
 
         auto guard = Guard(SpinLock_);
 
+        if (!config->EnableGroupCommit) {
+            if (PendingRecords_.empty()) {
+                return AppendToMultiplexedChangelog(config, changelogRecords);
+            }
+
+            // NB: Group commit has just been disabled; keep records ordered.
+            auto [batchPromise, batchResult] = CommitPendingBatch(config);
+            auto appendResult = AppendToMultiplexedChangelog(config, changelogRecords);
+            guard.Release();
+            batchPromise.SetFrom(batchResult);
+            return appendResult;
+        }
+
+        if (PendingRecords_.empty()) {
+            PendingBatchPromise_ = NewPromise<void>();
+            PendingBatchStartTime_ = NProfiling::GetCpuInstant();
+            TDelayedExecutor::Submit(
+                BIND(&TMultiplexedWriter::OnGroupCommitWindowExpired, MakeWeak(this), ++PendingBatchId_),
+                config->GroupCommitWindow,
+                Invoker_);
+        }
+
+        PendingRecords_.insert(PendingRecords_.end(), changelogRecords.begin(), changelogRecords.end());
+        PendingDataSize_ += totalSize;
+
+        auto batchFuture = PendingBatchPromise_.ToFuture();
+
+        if (std::ssize(PendingRecords_) >= config->MaxGroupCommitRecordCount ||
+            PendingDataSize_ >= config->MaxGroupCommitDataSize)
+        {
+            auto [batchPromise, batchResult] = CommitPendingBatch(config);
+            guard.Release();
+            batchPromise.SetFrom(batchResult);
+        }
+
+        return batchFuture;
+    }
+
+    void OnGroupCommitWindowExpired(i64 batchId)
+    {
+        auto config = Config_.Acquire();
+
+        auto guard = Guard(SpinLock_);
+
+        if (batchId != PendingBatchId_ || PendingRecords_.empty()) {
+            return;
+        }
+
+        auto [batchPromise, batchResult] = CommitPendingBatch(config);
+        guard.Release();
+        batchPromise.SetFrom(batchResult);
+    }
+
+    //! Writes the pending batch with a single append and flushes it right away.
+    //! Returns the promise of the batch waiters and the result of the commit;
+    //! the former must be set from the latter outside of #SpinLock_.
+    std::pair<TPromise<void>, TFuture<void>> CommitPendingBatch(const TMultiplexedChangelogConfigPtr& config)
+    {
+        VERIFY_SPINLOCK_AFFINITY(SpinLock_);
+
+        auto now = NProfiling::GetCpuInstant();
+        GroupCommitBatchRecordCount_.Record(PendingRecords_.size());
+        GroupCommitBatchDataSize_.Record(PendingDataSize_);
+        GroupCommitWaitTimer_.Record(NProfiling::CpuDurationToDuration(now - PendingBatchStartTime_));
+
+        auto records = std::move(PendingRecords_);
+        PendingRecords_.clear();
+        PendingDataSize_ = 0;
+        auto batchPromise = std::move(PendingBatchPromise_);
+
+        auto changelog = MultiplexedChangelog_;
+        auto commitResult = AppendToMultiplexedChangelog(config, records);
+        // NB: Do not wait for the dispatcher to flush the batch on its own.
+        YT_UNUSED_FUTURE(changelog->Flush());
+
+        commitResult.Subscribe(BIND([this, this_ = MakeStrong(this), now] (const TError& /*error*/) {
+            GroupCommitTimer_.Record(NProfiling::CpuDurationToDuration(NProfiling::GetCpuInstant() - now));
+        }));
+
+        return {std::move(batchPromise), std::move(commitResult)};
+    }
+
+    TFuture<void> AppendToMultiplexedChangelog(
+        const TMultiplexedChangelogConfigPtr& config,
+        const std::vector<TSharedRef>& changelogRecords)
+    {
+        VERIFY_SPINLOCK_AFFINITY(SpinLock_);
+
         auto appendResult = MultiplexedChangelog_->Append(changelogRecords);
 
         // Check if it is time to rotate.
@@ -955,7 +1062,8 @@ public:
             MultiplexedChangelogDispatcher_,
             NFS::CombinePaths(Location_->GetPath(), MultiplexedDirectory),
             MultiplexedChangelogDispatcher_->GetInvoker(),
-            Logger);
+            Logger,
+            Location_->GetProfiler().WithPrefix("/multiplexed_changelogs"));
     }
 
     void Initialize() override
@@ -27,6 +27,9 @@ using namespace NProfiling;
 
 static const auto& Logger = P2PLogger;
 
+//! Deeper tree levels are reported as this one.
+static constexpr int MaxProfiledTreeLevel = 8;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TP2PBlock::TP2PBlock(NChunkClient::TBlockId blockId, NChunkClient::TBlock block)
@@ -154,22 +157,27 @@ TFuture<void> TP2PBlockCache::WaitSessionIteration(TGuid sessionId, i64 iteratio
     return waiter->Promise.ToFuture();
 }
 
-void TP2PBlockCache::HoldBlocks(
+std::vector<int> TP2PBlockCache::HoldBlocks(
     TChunkId chunkId,
     const std::vector<int>& blockIndices,
     const std::vector<NChunkClient::TBlock>& blocks)
 {
     YT_VERIFY(blockIndices.size() == blocks.size());
 
+    std::vector<int> newBlockPositions;
     for (int i = 0; i < std::ssize(blockIndices); i++) {
         auto p2pBlock = New<TP2PBlock>(
             TBlockId{chunkId, blockIndices[i]},
             blocks[i]);
 
-        if (!TryInsert(p2pBlock)) {
+        if (TryInsert(p2pBlock)) {
+            newBlockPositions.push_back(i);
+        } else {
             DuplicateBytes_.Increment(blocks[i].Size());
         }
     }
+
+    return newBlockPositions;
 }
 
 std::vector<NChunkClient::TBlock> TP2PBlockCache::LookupBlocks(TChunkId chunkId, const std::vector<int>& blockIndices)
@@ -263,6 +271,16 @@ TP2PSnooper::TP2PSnooper(TP2PConfigPtr config)
     , DistributedBytes_(P2PProfiler.Counter("/distributed_bytes"))
     , HitBytes_(P2PProfiler.Counter("/hit_bytes"))
 {
+    for (int level = 0; level <= MaxProfiledTreeLevel; ++level) {
+        auto profiler = P2PProfiler
+            .WithPrefix("/tree")
+            .WithTag("level", ToString(level));
+        TreeLevelCounters_.push_back(TTreeLevelCounters{
+            .ReceivedBytes = profiler.Counter("/received_bytes"),
+            .ForwardedBytes = profiler.Counter("/forwarded_bytes"),
+        });
+    }
+
     P2PProfiler.AddFuncGauge("/hot_chunks", MakeStrong(this), [this] {
         auto guard = Guard(ChunkLock_);
         return HotChunks_.size();
@@ -394,7 +412,7 @@ std::vector<TP2PSuggestion> TP2PSnooper::OnBlockRead(
                     }
 
                     if (chunk->Peers.empty()) {
-                        chunk->Peers = AllocatePeers();
+                        chunk->Peers = AllocatePeers(chunk->GetKey());
                         chunk->PeersAllocatedAt = CurrentTick_;
                     }
 
@@ -410,6 +428,9 @@ std::vector<TP2PSuggestion> TP2PSnooper::OnBlockRead(
                             .Peers = blockCounter.Peers,
                         });
                         DistributedBytes_.Increment((*blocks)[i].Size() * blockCounter.Peers.size());
+                        if (config->EnableTreeDistribution) {
+                            GetTreeLevelCounters(0).ForwardedBytes.Increment((*blocks)[i].Size() * blockCounter.Peers.size());
+                        }
                     }
                 }
 
@@ -479,10 +500,102 @@ std::vector<TP2PSuggestion> TP2PSnooper::OnBlockProbe(TChunkId chunkId, const st
     return suggestions;
 }
 
+void TP2PSnooper::OnBlocksReceived(
+    TChunkId chunkId,
+    const std::vector<int>& blockIndices,
+    const std::vector<NChunkClient::TBlock>& blocks)
+{
+    YT_VERIFY(blockIndices.size() == blocks.size());
+
+    auto config = GetConfig();
+    if (!config->Enabled || !config->EnableTreeDistribution || blockIndices.empty()) {
+        return;
+    }
+
+    auto location = LocateInTree(chunkId, config, /*seed*/ false);
+    if (!location) {
+        return;
+    }
+
+    auto& counters = GetTreeLevelCounters(location->Level);
+    for (const auto& block : blocks) {
+        counters.ReceivedBytes.Increment(block.Size());
+    }
+
+    if (location->Children.empty()) {
+        return;
+    }
+
+    auto chunk = Find(chunkId);
+    if (!chunk) {
+        chunk = New<TP2PChunk>(chunkId);
+        TryInsert(chunk, &chunk);
+    }
+
+    chunk->LastAccessTime = NProfiling::GetCpuInstant();
+    chunk->Reserve(*std::max_element(blockIndices.begin(), blockIndices.end()) + 1);
+
+    // NB: Received chunk is hot by definition; mark it so to have it cooled down eventually.
+    if (!chunk->Hot.exchange(true)) {
+        auto guard = Guard(ChunkLock_);
+        HotChunks_.insert(chunk);
+    }
+
+    auto guard = ReaderGuard(chunk->BlocksLock);
+    auto peersGuard = Guard(chunk->PeersLock);
+    auto queueGuard = Guard(QueueLock_);
+
+    for (int i = 0; i < std::ssize(blocks); i++) {
+        auto& blockCounter = chunk->Blocks[blockIndices[i]];
+        if (blockCounter.DistributedAt != 0) {
+            continue;
+        }
+
+        if (blocks[i].Size() >= static_cast<size_t>(config->MaxBlockSize)) {
+            continue;
+        }
+
+        blockCounter.Peers = location->Children;
+        blockCounter.DistributedAt = CurrentTick_;
+
+        BlockQueue_.push_back(TQueuedBlock{
+            .Chunk = chunk,
+            .Block = blocks[i],
+            .BlockIndex = blockIndices[i],
+            .Peers = location->Children,
+        });
+
+        auto forwardedBytes = blocks[i].Size() * location->Children.size();
+        DistributedBytes_.Increment(forwardedBytes);
+        counters.ForwardedBytes.Increment(forwardedBytes);
+    }
+
+    YT_LOG_DEBUG("Forwarding received blocks down the tree (ChunkId: %v, BlockIndexes: %v, Level: %v, Children: %v)",
+        chunkId,
+        MakeShrunkFormattableView(blockIndices, TDefaultFormatter(), 3),
+        location->Level,
+        location->Children);
+}
+
 void TP2PSnooper::SetEligiblePeers(const std::vector<TNodeId>& peers)
 {
+    THashSet<TNodeId> eligibleNodeSet(peers.begin(), peers.end());
+
     auto guard = Guard(NodesLock_);
     EligibleNodes_ = peers;
+    EligibleNodeSet_ = std::move(eligibleNodeSet);
+}
+
+void TP2PSnooper::SetTreeNodes(
+    std::vector<TNodeId> treeNodes,
+    TNodeId localNodeId)
+{
+    std::sort(treeNodes.begin(), treeNodes.end());
+    treeNodes.erase(std::unique(treeNodes.begin(), treeNodes.end()), treeNodes.end());
+
+    auto guard = Guard(NodesLock_);
+    TreeNodes_ = std::move(treeNodes);
+    LocalNodeId_ = localNodeId;
 }
 
 void TP2PSnooper::FinishTick(
@@ -528,10 +641,101 @@ void TP2PSnooper::CoolChunk(const TP2PChunkPtr& chunk)
     chunk->Hot = false;
 }
 
-TPeerList TP2PSnooper::AllocatePeers()
+std::optional<TP2PSnooper::TTreeLocation> TP2PSnooper::LocateInTree(
+    TChunkId chunkId,
+    const TP2PConfigPtr& config,
+    bool seed)
+{
+    auto guard = Guard(NodesLock_);
+
+    if (TreeNodes_.empty()) {
+        return std::nullopt;
+    }
+
+    auto nodeCount = std::ssize(TreeNodes_);
+    auto treeSize = std::min<i64>(nodeCount, config->MaxTreeNodeCount);
+    auto fanout = config->TreeFanout;
+    auto offset = static_cast<i64>(THash<TChunkId>()(chunkId) % nodeCount);
+
+    // NB: The local node is not a tree node if it does not satisfy the node tag filter;
+    // it may still seed the tree but never forwards received blocks then.
+    auto localIt = std::lower_bound(TreeNodes_.begin(), TreeNodes_.end(), LocalNodeId_);
+    if (localIt == TreeNodes_.end() || *localIt != LocalNodeId_) {
+        if (!seed) {
+            return std::nullopt;
+        }
+        localIt = TreeNodes_.end();
+    }
+    auto localPosition = localIt == TreeNodes_.end()
+        ? treeSize
+        : ((localIt - TreeNodes_.begin()) - offset + nodeCount) % nodeCount;
+
+    TTreeLocation location;
+
+    // Tree nodes that are not eligible at the moment (e.g. stale ones) are bypassed:
+    // their children are fed instead so that the subtree still gets the blocks.
+    auto addChildren = [&] (i64 firstChildPosition) {
+        std::vector<i64> firstChildPositions{firstChildPosition};
+        while (!firstChildPositions.empty()) {
+            auto firstPosition = firstChildPositions.back();
+            firstChildPositions.pop_back();
+
+            auto lastPosition = std::min<i64>(firstPosition + fanout, treeSize);
+            for (auto position = firstPosition; position < lastPosition; ++position) {
+                if (position == localPosition) {
+                    continue;
+                }
+
+                auto nodeId = TreeNodes_[(offset + position) % nodeCount];
+                if (EligibleNodeSet_.contains(nodeId)) {
+                    location.Children.push_back(nodeId);
+                } else {
+                    firstChildPositions.push_back(fanout * (position + 1));
+                }
+            }
+        }
+    };
+
+    if (seed) {
+        // NB: The seed feeds its own subtree as well since blocks it forwards are not
+        // considered received by it.
+        addChildren(0);
+        if (localPosition < treeSize) {
+            addChildren(fanout * (localPosition + 1));
+        }
+    } else {
+        location.Level = 1;
+        i64 levelWidth = fanout;
+        i64 levelEnd = fanout;
+        while (localPosition >= levelEnd) {
+            levelWidth *= fanout;
+            levelEnd += levelWidth;
+            ++location.Level;
+        }
+
+        if (localPosition < treeSize) {
+            addChildren(fanout * (localPosition + 1));
+        }
+    }
+
+    return location;
+}
+
+TP2PSnooper::TTreeLevelCounters& TP2PSnooper::GetTreeLevelCounters(int level)
+{
+    return TreeLevelCounters_[std::min(level, MaxProfiledTreeLevel)];
+}
+
+TPeerList TP2PSnooper::AllocatePeers(TChunkId chunkId)
 {
     auto config = GetConfig();
 
+    if (config->EnableTreeDistribution) {
+        if (auto location = LocateInTree(chunkId, config, /*seed*/ true)) {
+            return location->Children;
+        }
+    }
+
     TPeerList peerList;
 
     {
@@ -710,13 +914,19 @@ void TP2PDistributor::AllocateNodes()
 
     auto now = TInstant::Now();
 
+    // NB: Distribution trees must agree between nodes, so they are built from the node directory
+    // received from the master; liveness is local knowledge and is only accounted when forwarding.
+    std::vector<TNodeId> treeNodeIds;
+
     auto nodes = Bootstrap_->GetNodeDirectory()->GetAllDescriptors();
     for (const auto& [nodeId, nodeDescriptor] : nodes) {
-        if (nodeId == Bootstrap_->GetNodeId()) {
+        if (!config->NodeTagFilter.IsSatisfiedBy(nodeDescriptor.GetTags())) {
             continue;
         }
 
-        if (!config->NodeTagFilter.IsSatisfiedBy(nodeDescriptor.GetTags())) {
+        treeNodeIds.push_back(nodeId);
+
+        if (nodeId == Bootstrap_->GetNodeId()) {
             continue;
         }
 
@@ -727,8 +937,11 @@ void TP2PDistributor::AllocateNodes()
         eligiblePeerIds.push_back(nodeId);
     }
 
-    YT_LOG_DEBUG("Updated peer list (Size: %v)", eligiblePeerIds.size());
+    YT_LOG_DEBUG("Updated peer list (Size: %v, TreeSize: %v)",
+        eligiblePeerIds.size(),
+        treeNodeIds.size());
     Snooper_->SetEligiblePeers(eligiblePeerIds);
+    Snooper_->SetTreeNodes(std::move(treeNodeIds), Bootstrap_->GetNodeId());
 }
 
 void TP2PDistributor::CoolHotChunks()
@@ -61,7 +61,8 @@ public:
     void FinishSessionIteration(TGuid sessionId, i64 iteration);
     TFuture<void> WaitSessionIteration(TGuid sessionId, i64 iteration);
 
-    void HoldBlocks(
+    //! Returns positions (within #blockIndices) of the blocks that were not held before.
+    std::vector<int> HoldBlocks(
         TChunkId chunkId,
         const std::vector<int>& blockIndices,
         const std::vector<NChunkClient::TBlock>& blocks);
@@ -165,9 +166,30 @@ public:
         TChunkId chunkId,
         const std::vector<int>& blockIndices);
 
+    //! Called when #blocks are received from another node and were not held before.
+    /*!
+     *  In tree distribution mode, queues the blocks for forwarding to the children
+     *  of this node in the distribution tree of the chunk and suggests these children
+     *  to the readers of the blocks.
+     */
+    void OnBlocksReceived(
+        TChunkId chunkId,
+        const std::vector<int>& blockIndices,
+        const std::vector<NChunkClient::TBlock>& blocks);
+
     void UpdateConfig(const TP2PConfigPtr& config);
     void SetEligiblePeers(const std::vector<TNodeId>& peers);
 
+    //! Sets the nodes distribution trees are built of.
+    /*!
+     *  These must be the same on all nodes, e.g. all the nodes from the master-provided
+     *  node directory satisfying |node_tag_filter| regardless of their liveness.
+     *  The local node is a tree node only if it is listed in #treeNodes.
+     */
+    void SetTreeNodes(
+        std::vector<TNodeId> treeNodes,
+        TNodeId localNodeId);
+
     struct TQueuedBlock
     {
         TP2PChunkPtr Chunk;
@@ -193,6 +215,10 @@ private:
 
     YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, NodesLock_);
     std::vector<TNodeId> EligibleNodes_;
+    THashSet<TNodeId> EligibleNodeSet_;
+    TNodeId LocalNodeId_ = NNodeTrackerClient::InvalidNodeId;
+    //! Sorted nodes set via #SetTreeNodes.
+    std::vector<TNodeId> TreeNodes_;
 
     std::atomic<i64> CounterIteration_ = 0;
 
@@ -208,7 +234,38 @@ private:
     NProfiling::TCounter DistributedBytes_;
     NProfiling::TCounter HitBytes_;
 
-    TPeerList AllocatePeers();
+    struct TTreeLevelCounters
+    {
+        NProfiling::TCounter ReceivedBytes;
+        NProfiling::TCounter ForwardedBytes;
+    };
+
+    //! Indexed by tree level; the seeding node is at level zero.
+    std::vector<TTreeLevelCounters> TreeLevelCounters_;
+
+    struct TTreeLocation
+    {
+        int Level = 0;
+        TPeerList Children;
+    };
+
+    //! Locates the local node in the distribution tree of #chunkId.
+    /*!
+     *  Tree nodes are the sorted #TreeNodes_ rotated by the chunk id hash and truncated
+     *  to |max_tree_node_count|; the node at position |p| has children at positions
+     *  |fanout * (p + 1) ... fanout * (p + 2) - 1|; the seed sends to the first level
+     *  and to its own children. Children that are not eligible peers are replaced with
+     *  their own children.
+     *  Every node computes the same tree as long as tree node lists agree.
+     */
+    std::optional<TTreeLocation> LocateInTree(
+        TChunkId chunkId,
+        const TP2PConfigPtr& config,
+        bool seed);
+
+    TTreeLevelCounters& GetTreeLevelCounters(int level);
+
+    TPeerList AllocatePeers(TChunkId chunkId);
 
     TP2PConfigPtr GetConfig();
 };
@@ -23,6 +23,8 @@ inline const TString TrashDirectory("trash");
 inline const TString CleanExtension("clean");
 inline const TString SealedFlagExtension("sealed");
 inline const TString ArtifactMetaSuffix(".artifact");
+inline const TString SsdBlockCacheDataFileName("blocks");
+inline const TString SsdBlockCacheIndexFileName("index");
 
 ////////////////////////////////////////////////////////////////////////////////
 
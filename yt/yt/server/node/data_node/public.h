@@ -85,6 +85,7 @@ DECLARE_REFCOUNTED_CLASS(TMasterConnectorDynamicConfig)
 DECLARE_REFCOUNTED_CLASS(TAllyReplicaManagerDynamicConfig)
 DECLARE_REFCOUNTED_CLASS(TDataNodeTestingOptions)
 DECLARE_REFCOUNTED_CLASS(TJournalManagerConfig)
+DECLARE_REFCOUNTED_CLASS(TSsdBlockCacheConfig)
 DECLARE_REFCOUNTED_CLASS(TDataNodeConfig)
 DECLARE_REFCOUNTED_CLASS(TDataNodeDynamicConfig)
 DECLARE_REFCOUNTED_CLASS(TLayerLocationConfig)
@@ -100,6 +101,7 @@ DECLARE_REFCOUNTED_CLASS(TLocationHealthCheckerConfig)
 DECLARE_REFCOUNTED_CLASS(TLocationHealthCheckerDynamicConfig)
 DECLARE_REFCOUNTED_CLASS(TChunkMergerConfig);
 DECLARE_REFCOUNTED_CLASS(TChunkRepairJobDynamicConfig);
+DECLARE_REFCOUNTED_CLASS(TChunkReplicationJobDynamicConfig);
 
 DECLARE_REFCOUNTED_CLASS(TTableSchemaCache)
 DECLARE_REFCOUNTED_CLASS(TCachedTableSchemaWrapper)
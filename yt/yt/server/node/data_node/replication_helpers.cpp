@@ -0,0 +1,111 @@
+#include "replication_helpers.h"
+
+#include <yt/yt/core/concurrency/scheduler.h>
+
+#include <yt/yt/core/misc/checksum.h>
+#include <yt/yt/core/misc/fs.h>
+
+namespace NYT::NDataNode {
+
+using namespace NConcurrency;
+using namespace NIO;
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TChunkDataCopyBufferTag
+{ };
+
+////////////////////////////////////////////////////////////////////////////////
+
+int GetReplicationWindowBlockCount(
+    TRange<i64> blockSizes,
+    int firstBlockIndex,
+    i64 windowSize)
+{
+    int blockCount = std::ssize(blockSizes);
+    int lastBlockIndex = firstBlockIndex;
+    i64 size = 0;
+    while (lastBlockIndex < blockCount && (lastBlockIndex == firstBlockIndex || size + blockSizes[lastBlockIndex] <= windowSize)) {
+        size += blockSizes[lastBlockIndex];
+        ++lastBlockIndex;
+    }
+    return lastBlockIndex - firstBlockIndex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void CopyChunkDataFile(
+    const TFile& source,
+    const TFile& destination,
+    const TBlocksExt& blocksExt,
+    const TChunkDataCopyOptions& options)
+{
+    const auto& blocks = blocksExt.Blocks;
+
+    std::vector<i64> blockSizes;
+    blockSizes.reserve(blocks.size());
+    i64 blockEndOffset = 0;
+    for (int blockIndex = 0; blockIndex < std::ssize(blocks); ++blockIndex) {
+        const auto& block = blocks[blockIndex];
+        if (block.Offset < blockEndOffset || block.Size < 0) {
+            THROW_ERROR_EXCEPTION("Malformed block %v in chunk data file %v",
+                blockIndex,
+                source.GetName())
+                << TErrorAttribute("offset", block.Offset)
+                << TErrorAttribute("size", block.Size);
+        }
+        blockEndOffset = block.Offset + block.Size;
+        blockSizes.push_back(block.Size);
+    }
+
+    TSharedMutableRef buffer;
+    i64 copiedSize = 0;
+    int blockIndex = 0;
+    while (blockIndex < std::ssize(blocks)) {
+        int windowBlockCount = GetReplicationWindowBlockCount(blockSizes, blockIndex, options.WindowSize);
+        const auto& lastBlock = blocks[blockIndex + windowBlockCount - 1];
+        i64 windowSize = lastBlock.Offset + lastBlock.Size - copiedSize;
+
+        std::vector<TFuture<void>> throttleFutures;
+        throttleFutures.reserve(options.Throttlers.size());
+        for (const auto& throttler : options.Throttlers) {
+            throttleFutures.push_back(throttler->Throttle(windowSize));
+        }
+        WaitFor(AllSucceeded(std::move(throttleFutures)))
+            .ThrowOnError();
+
+        NFS::CopyFileRange(source, destination, options.WindowSize, windowSize);
+
+        // NB: Verify what has actually reached the destination rather than the source data.
+        if (std::ssize(buffer) < windowSize) {
+            buffer = TSharedMutableRef::Allocate<TChunkDataCopyBufferTag>(windowSize, {.InitializeStorage = false});
+        }
+        destination.Pload(buffer.Begin(), windowSize, copiedSize);
+
+        for (int index = blockIndex; index < blockIndex + windowBlockCount; ++index) {
+            const auto& block = blocks[index];
+            auto checksum = GetChecksum(buffer.Slice(
+                block.Offset - copiedSize,
+                block.Offset - copiedSize + block.Size));
+            if (checksum != block.Checksum) {
+                THROW_ERROR_EXCEPTION(
+                    NChunkClient::EErrorCode::IncorrectChunkFileChecksum,
+                    "Incorrect checksum of block %v in chunk data file %v: expected %v, actual %v",
+                    index,
+                    destination.GetName(),
+                    block.Checksum,
+                    checksum);
+            }
+        }
+
+        copiedSize += windowSize;
+        blockIndex += windowBlockCount;
+    }
+
+    // Copy whatever trails the last block.
+    NFS::CopyFileRange(source, destination, options.WindowSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NDataNode
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/server/lib/io/chunk_file_reader.h>
+
+#include <yt/yt/core/concurrency/throughput_throttler.h>
+
+#include <library/cpp/yt/memory/range.h>
+
+#include <util/generic/size_literals.h>
+
+#include <util/system/file.h>
+
+namespace NYT::NDataNode {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Returns the number of blocks starting from #firstBlockIndex that fit into a window of #windowSize bytes.
+//! A window always contains at least one block (provided there is any).
+int GetReplicationWindowBlockCount(
+    TRange<i64> blockSizes,
+    int firstBlockIndex,
+    i64 windowSize);
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TChunkDataCopyOptions
+{
+    //! Data is throttled, copied and verified in windows of (about) this size.
+    i64 WindowSize = 16_MB;
+
+    //! Every window is charged to each of these throttlers before being copied.
+    std::vector<NConcurrency::IThroughputThrottlerPtr> Throttlers;
+};
+
+//! Copies a blob chunk data file from #source to #destination (both at offset zero)
+//! via copy_file_range and verifies the checksums of the copied blocks against #blocksExt.
+/*!
+ *  Throws |IncorrectChunkFileChecksum| on checksum mismatch.
+ *  Must be invoked from a fiber since throttling and copying may release the thread.
+ */
+void CopyChunkDataFile(
+    const TFile& source,
+    const TFile& destination,
+    const NIO::TBlocksExt& blocksExt,
+    const TChunkDataCopyOptions& options);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NDataNode
@@ -0,0 +1,773 @@
+#include "ssd_block_cache.h"
+#include "config.h"
+#include "private.h"
+
+#include <yt/yt/server/lib/io/io_engine.h>
+
+#include <yt/yt/ytlib/chunk_client/block_cache.h>
+
+#include <yt/yt/client/misc/workload.h>
+
+#include <yt/yt/core/concurrency/scheduler.h>
+
+#include <yt/yt/core/misc/checksum.h>
+#include <yt/yt/core/misc/fs.h>
+
+#include <library/cpp/yt/misc/hash.h>
+
+#include <util/system/align.h>
+#include <util/system/file.h>
+
+#include <deque>
+#include <map>
+
+namespace NYT::NDataNode {
+
+using namespace NChunkClient;
+using namespace NConcurrency;
+using namespace NIO;
+using namespace NProfiling;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const auto& Logger = DataNodeLogger;
+
+static constexpr i64 SsdBlockCachePageSize = 4_KB;
+static constexpr i64 MaxWriteBatchSize = 16_MB;
+
+static constexpr ui64 RecordSignature = 0x3130524353535459ull; // YTSSCR01
+static constexpr ui64 IndexSignature = 0x3130494353535459ull; // YTSSCI01
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TSsdBlockRecordHeader
+{
+    ui64 Signature;
+    TChunkId ChunkId;
+    i32 BlockIndex;
+    i32 BlockType;
+    i64 DataSize;
+    TChecksum DataChecksum;
+};
+
+struct TSsdBlockCacheIndexHeader
+{
+    ui64 Signature;
+    i64 Capacity;
+    i64 WritePosition;
+    //! Size of the region starting at #WritePosition that could have been
+    //! overwritten after the index was flushed.
+    i64 UnsafeRegionSize;
+    i64 EntryCount;
+};
+
+struct TSsdBlockCacheIndexRecord
+{
+    TChunkId ChunkId;
+    i32 BlockIndex;
+    i32 BlockType;
+    i64 Offset;
+    i64 RecordSize;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TSsdBlockCacheKey
+{
+    TBlockId BlockId;
+    EBlockType BlockType;
+
+    bool operator == (const TSsdBlockCacheKey& other) const = default;
+};
+
+struct TSsdBlockCacheKeyHash
+{
+    size_t operator()(const TSsdBlockCacheKey& key) const
+    {
+        size_t result = THash<TBlockId>()(key.BlockId);
+        HashCombine(result, static_cast<size_t>(key.BlockType));
+        return result;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+i64 GetSsdBlockRecordSize(i64 dataSize)
+{
+    return AlignUp<i64>(sizeof(TSsdBlockRecordHeader) + dataSize, SsdBlockCachePageSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TSsdCachedBlockCookie
+    : public ICachedBlockCookie
+{
+public:
+    explicit TSsdCachedBlockCookie(TFuture<TCachedBlock> blockFuture)
+        : BlockFuture_(std::move(blockFuture))
+    { }
+
+    bool IsActive() const override
+    {
+        return false;
+    }
+
+    TFuture<TCachedBlock> GetBlockFuture() const override
+    {
+        return BlockFuture_;
+    }
+
+    void SetBlock(TErrorOr<TCachedBlock> /*blockOrError*/) override
+    {
+        YT_ABORT();
+    }
+
+private:
+    const TFuture<TCachedBlock> BlockFuture_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+DECLARE_REFCOUNTED_CLASS(TSsdBlockCache)
+
+class TSsdBlockCache
+    : public IClientBlockCache
+{
+public:
+    TSsdBlockCache(
+        TSsdBlockCacheConfigPtr config,
+        IClientBlockCachePtr underlyingCache,
+        const TProfiler& profiler)
+        : Config_(std::move(config))
+        , UnderlyingCache_(std::move(underlyingCache))
+        , DataFileName_(NFS::CombinePaths(Config_->Path, SsdBlockCacheDataFileName))
+        , IndexFileName_(NFS::CombinePaths(Config_->Path, SsdBlockCacheIndexFileName))
+        , IOEngine_(CreateIOEngine(
+            Config_->IOEngineType,
+            Config_->IOConfig,
+            "ssd_block_cache",
+            profiler.WithPrefix("/io"),
+            Logger))
+        , HitCounter_(profiler.Counter("/hit_count"))
+        , MissCounter_(profiler.Counter("/miss_count"))
+        , ReadErrorCounter_(profiler.Counter("/read_error_count"))
+        , ReadBytesCounter_(profiler.Counter("/read_bytes"))
+        , ReadTimer_(profiler.Timer("/read_time"))
+        , AdmittedBytesCounter_(profiler.Counter("/admitted_bytes"))
+        , DroppedBytesCounter_(profiler.Counter("/dropped_bytes"))
+        , WriteErrorCounter_(profiler.Counter("/write_error_count"))
+        , UsedSpaceGauge_(profiler.Gauge("/used_space"))
+        , EntryCountGauge_(profiler.Gauge("/entry_count"))
+    { }
+
+    void Initialize()
+    {
+        BIND(&TSsdBlockCache::DoInitialize, MakeStrong(this))
+            .AsyncVia(IOEngine_->GetAuxPoolInvoker())
+            .Run()
+            .Subscribe(BIND([path = Config_->Path] (const TError& error) {
+                YT_LOG_ERROR_UNLESS(error.IsOK(), error, "Failed to initialize SSD block cache; only in-memory tier will be used (Path: %v)",
+                    path);
+            }));
+
+        UnderlyingCache_->SubscribeBlockEvicted(
+            BIND_NO_PROPAGATE(&TSsdBlockCache::OnBlockEvicted, MakeWeak(this)));
+    }
+
+    void PutBlock(
+        const TBlockId& id,
+        EBlockType type,
+        const TBlock& block) override
+    {
+        UnderlyingCache_->PutBlock(id, type, block);
+    }
+
+    TCachedBlock FindBlock(
+        const TBlockId& id,
+        EBlockType type) override
+    {
+        // NB: Synchronous lookups only consult the in-memory tier.
+        return UnderlyingCache_->FindBlock(id, type);
+    }
+
+    std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
+        const TBlockId& id,
+        EBlockType type,
+        const TWorkloadDescriptor& workloadDescriptor) override
+    {
+        auto cookie = UnderlyingCache_->GetBlockCookie(id, type, workloadDescriptor);
+        if (!cookie->IsActive() || !Initialized_.load()) {
+            return cookie;
+        }
+
+        TSsdBlockCacheKey key{id, type};
+        auto entry = FindEntry(key);
+        if (!entry) {
+            MissCounter_.Increment();
+            return cookie;
+        }
+
+        HitCounter_.Increment();
+
+        auto blockFuture = ReadBlock(key, *entry, workloadDescriptor.Category);
+        // NB: On failure the pending in-memory insertion is canceled, so callers
+        // (and those waiting for the same block) treat the block as missing.
+        blockFuture.Subscribe(BIND([cookie = std::shared_ptr<ICachedBlockCookie>(std::move(cookie))] (const TErrorOr<TCachedBlock>& blockOrError) {
+            cookie->SetBlock(blockOrError);
+        }));
+        return std::make_unique<TSsdCachedBlockCookie>(std::move(blockFuture));
+    }
+
+    EBlockType GetSupportedBlockTypes() const override
+    {
+        return UnderlyingCache_->GetSupportedBlockTypes();
+    }
+
+    void Reconfigure(const TBlockCacheDynamicConfigPtr& config) override
+    {
+        UnderlyingCache_->Reconfigure(config);
+    }
+
+    void SubscribeBlockEvicted(const TCallback<void(const TBlockId&, EBlockType, const TBlock&)>& callback) override
+    {
+        UnderlyingCache_->SubscribeBlockEvicted(callback);
+    }
+
+    void UnsubscribeBlockEvicted(const TCallback<void(const TBlockId&, EBlockType, const TBlock&)>& callback) override
+    {
+        UnderlyingCache_->UnsubscribeBlockEvicted(callback);
+    }
+
+private:
+    struct TEntry
+    {
+        i64 Offset;
+        i64 RecordSize;
+    };
+
+    struct TPendingWrite
+    {
+        TSsdBlockCacheKey Key;
+        TBlock Block;
+    };
+
+    struct TSsdBlockCacheReadTag
+    { };
+
+    const TSsdBlockCacheConfigPtr Config_;
+    const IClientBlockCachePtr UnderlyingCache_;
+    const TString DataFileName_;
+    const TString IndexFileName_;
+    const IIOEnginePtr IOEngine_;
+
+    TCounter HitCounter_;
+    TCounter MissCounter_;
+    TCounter ReadErrorCounter_;
+    TCounter ReadBytesCounter_;
+    TEventTimer ReadTimer_;
+    TCounter AdmittedBytesCounter_;
+    TCounter DroppedBytesCounter_;
+    TCounter WriteErrorCounter_;
+    TGauge UsedSpaceGauge_;
+    TGauge EntryCountGauge_;
+
+    //! Set once the data file is opened and the index is loaded.
+    std::atomic<bool> Initialized_ = false;
+    TIOEngineHandlePtr DataHandle_;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, IndexLock_);
+    THashMap<TSsdBlockCacheKey, TEntry, TSsdBlockCacheKeyHash> Index_;
+    std::map<i64, TSsdBlockCacheKey> OffsetToKey_;
+    i64 UsedSpace_ = 0;
+
+    YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, PendingWritesLock_);
+    std::deque<TPendingWrite> PendingWrites_;
+    THashSet<TSsdBlockCacheKey, TSsdBlockCacheKeyHash> PendingKeys_;
+    i64 PendingWriteSize_ = 0;
+    bool WriterActive_ = false;
+
+    // These are only accessed by the writer (or during initialization).
+    i64 WritePosition_ = 0;
+    i64 BytesSinceIndexFlush_ = 0;
+
+
+    void DoInitialize()
+    {
+        NFS::MakeDirRecursive(Config_->Path);
+
+        auto mode = OpenAlways | RdWr | CloseOnExec;
+        if (Config_->UseDirectIO) {
+            TIOEngineHandle::MarkOpenForDirectIO(&mode);
+        }
+        DataHandle_ = WaitFor(IOEngine_->Open({DataFileName_, mode}))
+            .ValueOrThrow();
+
+        if (DataHandle_->GetLength() != Config_->Capacity) {
+            YT_LOG_INFO("Resizing SSD block cache data file (Path: %v, OldSize: %v, NewSize: %v)",
+                DataFileName_,
+                DataHandle_->GetLength(),
+                Config_->Capacity);
+            WaitFor(IOEngine_->Resize({DataHandle_, Config_->Capacity}))
+                .ThrowOnError();
+        }
+
+        try {
+            LoadIndex();
+        } catch (const std::exception& ex) {
+            YT_LOG_WARNING(ex, "Failed to load SSD block cache index; starting with empty cache (Path: %v)",
+                IndexFileName_);
+            auto guard = Guard(IndexLock_);
+            Index_.clear();
+            OffsetToKey_.clear();
+            UsedSpace_ = 0;
+            WritePosition_ = 0;
+        }
+
+        UpdateGauges();
+
+        YT_LOG_INFO("SSD block cache initialized (Path: %v, Capacity: %v, EntryCount: %v, UsedSpace: %v)",
+            Config_->Path,
+            Config_->Capacity,
+            Index_.size(),
+            UsedSpace_);
+
+        Initialized_.store(true);
+    }
+
+    void LoadIndex()
+    {
+        if (!NFS::Exists(IndexFileName_)) {
+            return;
+        }
+
+        TFile file(IndexFileName_, OpenExisting | RdOnly | CloseOnExec);
+        auto data = TSharedMutableRef::Allocate(file.GetLength(), {.InitializeStorage = false});
+        file.Load(data.Begin(), data.Size());
+
+        auto checksummedSize = static_cast<i64>(data.Size()) - static_cast<i64>(sizeof(TChecksum));
+        if (checksummedSize < static_cast<i64>(sizeof(TSsdBlockCacheIndexHeader))) {
+            THROW_ERROR_EXCEPTION("SSD block cache index is truncated");
+        }
+
+        TChecksum expectedChecksum;
+        ::memcpy(&expectedChecksum, data.Begin() + checksummedSize, sizeof(TChecksum));
+        if (GetChecksum(data.Slice(0, checksummedSize)) != expectedChecksum) {
+            THROW_ERROR_EXCEPTION("SSD block cache index checksum mismatch");
+        }
+
+        TSsdBlockCacheIndexHeader header;
+        ::memcpy(&header, data.Begin(), sizeof(header));
+        if (header.Signature != IndexSignature) {
+            THROW_ERROR_EXCEPTION("Invalid SSD block cache index signature")
+                << TErrorAttribute("expected_signature", IndexSignature)
+                << TErrorAttribute("actual_signature", header.Signature);
+        }
+        if (header.Capacity != Config_->Capacity) {
+            THROW_ERROR_EXCEPTION("SSD block cache capacity has changed")
+                << TErrorAttribute("index_capacity", header.Capacity)
+                << TErrorAttribute("config_capacity", Config_->Capacity);
+        }
+        if (checksummedSize != static_cast<i64>(sizeof(header) + header.EntryCount * sizeof(TSsdBlockCacheIndexRecord))) {
+            THROW_ERROR_EXCEPTION("SSD block cache index size mismatch")
+                << TErrorAttribute("entry_count", header.EntryCount);
+        }
+
+        auto guard = Guard(IndexLock_);
+
+        const auto* records = reinterpret_cast<const TSsdBlockCacheIndexRecord*>(data.Begin() + sizeof(header));
+        for (i64 index = 0; index < header.EntryCount; ++index) {
+            const auto& record = records[index];
+            if (record.Offset < 0 || record.Offset + record.RecordSize > Config_->Capacity) {
+                continue;
+            }
+            TSsdBlockCacheKey key{
+                TBlockId(record.ChunkId, record.BlockIndex),
+                static_cast<EBlockType>(record.BlockType)
+            };
+            DoAddEntry(key, TEntry{record.Offset, record.RecordSize});
+        }
+
+        // Drop entries that could have been overwritten after the index was flushed.
+        WritePosition_ = header.WritePosition;
+        auto unsafeEnd = header.WritePosition + header.UnsafeRegionSize;
+        DoInvalidateRange(header.WritePosition, std::min(unsafeEnd, Config_->Capacity));
+        if (unsafeEnd > Config_->Capacity) {
+            DoInvalidateRange(0, unsafeEnd - Config_->Capacity);
+        }
+
+        YT_LOG_INFO("SSD block cache index loaded (EntryCount: %v, WritePosition: %v)",
+            Index_.size(),
+            WritePosition_);
+    }
+
+    i64 GetUnsafeRegionSize() const
+    {
+        return Config_->IndexFlushWriteSize + MaxWriteBatchSize + GetSsdBlockRecordSize(Config_->MaxBlockSize);
+    }
+
+    void FlushIndex()
+    {
+        std::vector<TSsdBlockCacheIndexRecord> records;
+        {
+            auto guard = Guard(IndexLock_);
+            records.reserve(Index_.size());
+            for (const auto& [key, entry] : Index_) {
+                records.push_back({
+                    .ChunkId = key.BlockId.ChunkId,
+                    .BlockIndex = key.BlockId.BlockIndex,
+                    .BlockType = static_cast<i32>(key.BlockType),
+                    .Offset = entry.Offset,
+                    .RecordSize = entry.RecordSize,
+                });
+            }
+        }
+
+        TSsdBlockCacheIndexHeader header{
+            .Signature = IndexSignature,
+            .Capacity = Config_->Capacity,
+            .WritePosition = WritePosition_,
+            .UnsafeRegionSize = GetUnsafeRegionSize(),
+            .EntryCount = std::ssize(records),
+        };
+
+        auto recordsRef = TRef(records.data(), records.size() * sizeof(TSsdBlockCacheIndexRecord));
+        auto checksum = GetChecksum(recordsRef, GetChecksum(TRef(&header, sizeof(header))));
+
+        auto tempFileName = IndexFileName_ + NFS::TempFileSuffix;
+        {
+            TFile file(tempFileName, CreateAlways | WrOnly | CloseOnExec);
+            file.Write(&header, sizeof(header));
+            file.Write(recordsRef.Begin(), recordsRef.Size());
+            file.Write(&checksum, sizeof(checksum));
+            file.FlushData();
+            file.Close();
+        }
+        NFS::Rename(tempFileName, IndexFileName_);
+
+        BytesSinceIndexFlush_ = 0;
+
+        YT_LOG_DEBUG("SSD block cache index flushed (EntryCount: %v, WritePosition: %v)",
+            records.size(),
+            WritePosition_);
+    }
+
+    std::optional<TEntry> FindEntry(const TSsdBlockCacheKey& key)
+    {
+        auto guard = Guard(IndexLock_);
+        auto it = Index_.find(key);
+        return it == Index_.end() ? std::nullopt : std::make_optional(it->second);
+    }
+
+    void DoAddEntry(const TSsdBlockCacheKey& key, TEntry entry)
+    {
+        VERIFY_SPINLOCK_AFFINITY(IndexLock_);
+
+        DoInvalidateRange(entry.Offset, entry.Offset + entry.RecordSize);
+        if (auto it = Index_.find(key); it != Index_.end()) {
+            DoRemoveEntry(it);
+        }
+        Index_.emplace(key, entry);
+        OffsetToKey_.emplace(entry.Offset, key);
+        UsedSpace_ += entry.RecordSize;
+    }
+
+    void DoRemoveEntry(THashMap<TSsdBlockCacheKey, TEntry, TSsdBlockCacheKeyHash>::iterator it)
+    {
+        VERIFY_SPINLOCK_AFFINITY(IndexLock_);
+
+        OffsetToKey_.erase(it->second.Offset);
+        UsedSpace_ -= it->second.RecordSize;
+        Index_.erase(it);
+    }
+
+    //! Removes all entries intersecting [#begin, #end).
+    void DoInvalidateRange(i64 begin, i64 end)
+    {
+        VERIFY_SPINLOCK_AFFINITY(IndexLock_);
+
+        if (begin >= end) {
+            return;
+        }
+
+        auto it = OffsetToKey_.lower_bound(begin);
+        if (it != OffsetToKey_.begin()) {
+            auto prevIt = std::prev(it);
+            auto entryIt = Index_.find(prevIt->second);
+            YT_VERIFY(entryIt != Index_.end());
+            if (entryIt->second.Offset + entryIt->second.RecordSize > begin) {
+                DoRemoveEntry(entryIt);
+            }
+        }
+
+        while (it != OffsetToKey_.end() && it->first < end) {
+            auto entryIt = Index_.find((it++)->second);
+            YT_VERIFY(entryIt != Index_.end());
+            DoRemoveEntry(entryIt);
+        }
+    }
+
+    void RemoveEntry(const TSsdBlockCacheKey& key, i64 offset)
+    {
+        auto guard = Guard(IndexLock_);
+        auto it = Index_.find(key);
+        // NB: The entry may have been already rewritten.
+        if (it != Index_.end() && it->second.Offset == offset) {
+            DoRemoveEntry(it);
+        }
+    }
+
+    void UpdateGauges()
+    {
+        auto guard = Guard(IndexLock_);
+        UsedSpaceGauge_.Update(UsedSpace_);
+        EntryCountGauge_.Update(Index_.size());
+    }
+
+    TFuture<TCachedBlock> ReadBlock(
+        const TSsdBlockCacheKey& key,
+        TEntry entry,
+        EWorkloadCategory category)
+    {
+        auto timerGuard = std::make_shared<TEventTimerGuard>(ReadTimer_);
+        return IOEngine_->Read(
+            {{DataHandle_, entry.Offset, entry.RecordSize}},
+            category,
+            GetRefCountedTypeCookie<TSsdBlockCacheReadTag>())
+            .Apply(BIND([=, this, this_ = MakeStrong(this), timerGuard = std::move(timerGuard)] (const TErrorOr<IIOEngine::TReadResponse>& rspOrError) {
+                try {
+                    rspOrError.ThrowOnError();
+                    const auto& rsp = rspOrError.Value();
+                    YT_VERIFY(rsp.OutputBuffers.size() == 1);
+                    auto block = ParseRecord(key, rsp.OutputBuffers[0]);
+                    ReadBytesCounter_.Increment(block.Size());
+                    return TCachedBlock(std::move(block));
+                } catch (const std::exception& ex) {
+                    ReadErrorCounter_.Increment();
+                    RemoveEntry(key, entry.Offset);
+                    THROW_ERROR_EXCEPTION("Error reading block from SSD block cache")
+                        << TErrorAttribute("block_id", key.BlockId)
+                        << TErrorAttribute("offset", entry.Offset)
+                        << ex;
+                }
+            }));
+    }
+
+    static TBlock ParseRecord(const TSsdBlockCacheKey& key, const TSharedRef& buffer)
+    {
+        if (buffer.Size() < sizeof(TSsdBlockRecordHeader)) {
+            THROW_ERROR_EXCEPTION("SSD block cache record is truncated");
+        }
+
+        TSsdBlockRecordHeader header;
+        ::memcpy(&header, buffer.Begin(), sizeof(header));
+        if (header.Signature != RecordSignature ||
+            header.ChunkId != key.BlockId.ChunkId ||
+            header.BlockIndex != key.BlockId.BlockIndex ||
+            header.BlockType != static_cast<i32>(key.BlockType) ||
+            header.DataSize < 0 ||
+            header.DataSize > static_cast<i64>(buffer.Size() - sizeof(header)))
+        {
+            THROW_ERROR_EXCEPTION("SSD block cache record header mismatch; the record was probably overwritten");
+        }
+
+        auto data = buffer.Slice(sizeof(header), sizeof(header) + header.DataSize);
+        if (GetChecksum(data) != header.DataChecksum) {
+            THROW_ERROR_EXCEPTION("SSD block cache record checksum mismatch");
+        }
+
+        return TBlock(std::move(data), header.DataChecksum);
+    }
+
+    void OnBlockEvicted(const TBlockId& id, EBlockType type, const TBlock& block)
+    {
+        if (!Initialized_.load()) {
+            return;
+        }
+
+        i64 size = block.Size();
+        if (size == 0 || size > Config_->MaxBlockSize) {
+            return;
+        }
+
+        TSsdBlockCacheKey key{id, type};
+        if (FindEntry(key)) {
+            return;
+        }
+
+        {
+            auto guard = Guard(PendingWritesLock_);
+            if (PendingKeys_.contains(key)) {
+                return;
+            }
+            if (PendingWriteSize_ + size > Config_->MaxPendingWriteSize) {
+                DroppedBytesCounter_.Increment(size);
+                return;
+            }
+            PendingKeys_.insert(key);
+            PendingWrites_.push_back({key, block});
+            PendingWriteSize_ += size;
+            if (std::exchange(WriterActive_, true)) {
+                return;
+            }
+        }
+
+        IOEngine_->GetAuxPoolInvoker()->Invoke(
+            BIND(&TSsdBlockCache::WriteLoop, MakeStrong(this)));
+    }
+
+    void WriteLoop()
+    {
+        while (true) {
+            std::vector<TPendingWrite> batch;
+            {
+                auto guard = Guard(PendingWritesLock_);
+                if (PendingWrites_.empty()) {
+                    WriterActive_ = false;
+                    return;
+                }
+
+                i64 batchSize = 0;
+                while (!PendingWrites_.empty()) {
+                    auto recordSize = GetSsdBlockRecordSize(PendingWrites_.front().Block.Size());
+                    if (!batch.empty() && batchSize + recordSize > MaxWriteBatchSize) {
+                        break;
+                    }
+                    batchSize += recordSize;
+                    batch.push_back(std::move(PendingWrites_.front()));
+                    PendingWrites_.pop_front();
+                }
+            }
+
+            try {
+                WriteBatch(batch);
+            } catch (const std::exception& ex) {
+                WriteErrorCounter_.Increment();
+                YT_LOG_WARNING(ex, "Error writing blocks to SSD block cache (BlockCount: %v)",
+                    batch.size());
+            }
+
+            {
+                auto guard = Guard(PendingWritesLock_);
+                for (const auto& write : batch) {
+                    PendingKeys_.erase(write.Key);
+                    PendingWriteSize_ -= write.Block.Size();
+                }
+            }
+        }
+    }
+
+    void WriteBatch(const std::vector<TPendingWrite>& batch)
+    {
+        // Split the batch into groups of records that are contiguous in the ring.
+        int groupBegin = 0;
+        while (groupBegin < std::ssize(batch)) {
+            if (WritePosition_ + GetSsdBlockRecordSize(batch[groupBegin].Block.Size()) > Config_->Capacity) {
+                BytesSinceIndexFlush_ += Config_->Capacity - WritePosition_;
+                WritePosition_ = 0;
+            }
+
+            i64 groupSize = 0;
+            int groupEnd = groupBegin;
+            while (groupEnd < std::ssize(batch)) {
+                auto recordSize = GetSsdBlockRecordSize(batch[groupEnd].Block.Size());
+                if (WritePosition_ + groupSize + recordSize > Config_->Capacity) {
+                    break;
+                }
+                groupSize += recordSize;
+                ++groupEnd;
+            }
+
+            if (groupEnd == groupBegin) {
+                // The record does not fit even into an empty ring; skip it.
+                ++groupBegin;
+                continue;
+            }
+
+            WriteGroup(TRange(batch.data() + groupBegin, batch.data() + groupEnd), groupSize);
+            groupBegin = groupEnd;
+        }
+
+        UpdateGauges();
+    }
+
+    void WriteGroup(TRange<TPendingWrite> group, i64 groupSize)
+    {
+        auto groupOffset = WritePosition_;
+
+        {
+            auto guard = Guard(IndexLock_);
+            DoInvalidateRange(groupOffset, groupOffset + groupSize);
+        }
+
+        if (BytesSinceIndexFlush_ > 0 && BytesSinceIndexFlush_ + groupSize > Config_->IndexFlushWriteSize) {
+            FlushIndex();
+        }
+
+        auto buffer = TSharedMutableRef::AllocatePageAligned(groupSize, {.InitializeStorage = false});
+        std::vector<TEntry> entries;
+        entries.reserve(group.size());
+
+        i64 recordOffset = 0;
+        for (const auto& write : group) {
+            auto recordSize = GetSsdBlockRecordSize(write.Block.Size());
+            auto* ptr = buffer.Begin() + recordOffset;
+
+            TSsdBlockRecordHeader header{
+                .Signature = RecordSignature,
+                .ChunkId = write.Key.BlockId.ChunkId,
+                .BlockIndex = write.Key.BlockId.BlockIndex,
+                .BlockType = static_cast<i32>(write.Key.BlockType),
+                .DataSize = static_cast<i64>(write.Block.Size()),
+                .DataChecksum = write.Block.GetOrComputeChecksum(),
+            };
+            ::memcpy(ptr, &header, sizeof(header));
+            ::memcpy(ptr + sizeof(header), write.Block.Data.Begin(), write.Block.Size());
+            auto paddingOffset = sizeof(header) + write.Block.Size();
+            ::memset(ptr + paddingOffset, 0, recordSize - paddingOffset);
+
+            entries.push_back({groupOffset + recordOffset, recordSize});
+            recordOffset += recordSize;
+        }
+
+        WaitFor(IOEngine_->Write({DataHandle_, groupOffset, {std::move(buffer)}}))
+            .ThrowOnError();
+
+        WritePosition_ = groupOffset + groupSize;
+        BytesSinceIndexFlush_ += groupSize;
+
+        {
+            auto guard = Guard(IndexLock_);
+            for (int index = 0; index < std::ssize(group); ++index) {
+                DoAddEntry(group[index].Key, entries[index]);
+            }
+        }
+
+        AdmittedBytesCounter_.Increment(groupSize);
+
+        YT_LOG_DEBUG("Blocks written to SSD block cache (BlockCount: %v, Offset: %v, Size: %v)",
+            group.size(),
+            groupOffset,
+            groupSize);
+    }
+};
+
+DEFINE_REFCOUNTED_TYPE(TSsdBlockCache)
+
+////////////////////////////////////////////////////////////////////////////////
+
+IClientBlockCachePtr CreateSsdBlockCache(
+    TSsdBlockCacheConfigPtr config,
+    IClientBlockCachePtr underlyingCache,
+    const TProfiler& profiler)
+{
+    auto cache = New<TSsdBlockCache>(
+        std::move(config),
+        std::move(underlyingCache),
+        profiler);
+    cache->Initialize();
+    return cache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NDataNode
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/ytlib/chunk_client/client_block_cache.h>
+
+#include <yt/yt/library/profiling/sensor.h>
+
+namespace NYT::NDataNode {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Creates a two-tier block cache on top of #underlyingCache.
+/*!
+ *  Blocks evicted from #underlyingCache are appended to a ring-structured cache
+ *  file on a local SSD. Cookie requests that miss the in-memory tier but hit the
+ *  SSD tier are served by reading the block via IO engine; the block is then
+ *  re-inserted into the in-memory tier.
+ *
+ *  The index of the SSD tier is periodically persisted next to the data file,
+ *  so the cache content survives restarts.
+ *
+ *  \note
+ *  Thread affinity: any
+ */
+NChunkClient::IClientBlockCachePtr CreateSsdBlockCache(
+    TSsdBlockCacheConfigPtr config,
+    NChunkClient::IClientBlockCachePtr underlyingCache,
+    const NProfiling::TProfiler& profiler = {});
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NDataNode
@@ -187,6 +187,49 @@ TEST_F(TJournalTest, Write)
     }
 }
 
+class TJournalGroupCommitTest
+    : public TJournalTest
+{
+protected:
+    void SetUp() override
+    {
+        Config_->MultiplexedChangelog->EnableGroupCommit = true;
+        Config_->MultiplexedChangelog->MaxGroupCommitRecordCount = 5;
+        Start();
+    }
+};
+
+TEST_F(TJournalGroupCommitTest, Write)
+{
+    auto journalManager = ChunkStore_->Locations()[0]->GetJournalManager();
+
+    std::vector<NHydra::IFileChangelogPtr> changelogs;
+    for (int index = 0; index < 4; ++index) {
+        auto journalId = MakeRandomId(NObjectClient::EObjectType::JournalChunk, /*cellTag*/ 1);
+        changelogs.push_back(journalManager->CreateChangelog(journalId, /*enableMultiplexing*/ true, TWorkloadDescriptor{})
+            .Get()
+            .ValueOrThrow());
+    }
+
+    std::vector<TFuture<void>> appendFutures;
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        for (const auto& changelog : changelogs) {
+            appendFutures.push_back(changelog->Append({TSharedRef::FromString(Format("r%v", iteration))}));
+        }
+    }
+
+    AllSucceeded(std::move(appendFutures))
+        .Get()
+        .ThrowOnError();
+
+    for (const auto& changelog : changelogs) {
+        EXPECT_EQ(3, changelog->GetRecordCount());
+        changelog->Close()
+            .Get()
+            .ThrowOnError();
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace
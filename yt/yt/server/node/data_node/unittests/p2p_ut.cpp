@@ -3,6 +3,8 @@
 
 #include <yt/yt/core/concurrency/action_queue.h>
 
+#include <yt/yt/core/misc/collection_helpers.h>
+
 #include <yt/yt/server/node/data_node/config.h>
 #include <yt/yt/server/node/data_node/p2p.h>
 
@@ -214,6 +216,156 @@ TEST_F(TP2PTest, Snoop)
     }
 }
 
+//! Creates a snooper per node of #nodes; #treeNodes are the nodes satisfying the node tag filter
+//! and #staleNodes are excluded from the eligible peers.
+THashMap<TNodeId, TP2PSnooperPtr> CreateTreeSnoopers(
+    const TP2PConfigPtr& config,
+    const std::vector<TNodeId>& nodes,
+    const std::vector<TNodeId>& treeNodes,
+    const THashSet<TNodeId>& staleNodes = {})
+{
+    THashMap<TNodeId, TP2PSnooperPtr> snoopers;
+    for (auto nodeId : nodes) {
+        std::vector<TNodeId> peers;
+        for (auto peerId : treeNodes) {
+            if (peerId != nodeId && !staleNodes.contains(peerId)) {
+                peers.push_back(peerId);
+            }
+        }
+
+        auto snooper = New<TP2PSnooper>(config);
+        snooper->SetEligiblePeers(peers);
+        // NB: Pass the tree nodes shuffled to make sure the order does not matter.
+        auto shuffledTreeNodes = treeNodes;
+        std::rotate(shuffledTreeNodes.begin(), shuffledTreeNodes.begin() + nodeId % shuffledTreeNodes.size(), shuffledTreeNodes.end());
+        snooper->SetTreeNodes(shuffledTreeNodes, nodeId);
+        snoopers[nodeId] = snooper;
+    }
+    return snoopers;
+}
+
+//! Makes #seedId distribute a hot block and walks the tree; returns the nodes that received the block.
+THashSet<TNodeId> WalkTree(
+    const TP2PConfigPtr& config,
+    const THashMap<TNodeId, TP2PSnooperPtr>& snoopers,
+    TNodeId seedId)
+{
+    auto chunk0 = TChunkId::Create();
+    auto block0 = TBlock{TSharedRef::FromString("b0")};
+
+    const auto& seed = GetOrCrash(snoopers, seedId);
+
+    std::vector<TBlock> blocks{block0};
+    for (int i = 0; i < config->HotBlockThreshold; i++) {
+        EXPECT_TRUE(seed->OnBlockRead(chunk0, {0}, &blocks).empty());
+    }
+    auto suggestions = seed->OnBlockRead(chunk0, {0}, &blocks);
+    EXPECT_EQ(1u, suggestions.size());
+    if (suggestions.empty()) {
+        return {};
+    }
+
+    // Every node holds the block at most once, just like the block cache does.
+    THashSet<TNodeId> holders;
+    holders.insert(seedId);
+    std::vector<std::pair<TNodeId, TPeerList>> sends{{seedId, suggestions[0].Peers}};
+    while (!sends.empty()) {
+        auto [senderId, peers] = sends.back();
+        sends.pop_back();
+
+        for (auto peerId : peers) {
+            EXPECT_NE(senderId, peerId);
+            if (!holders.insert(peerId).second) {
+                continue;
+            }
+
+            const auto& snooper = GetOrCrash(snoopers, peerId);
+            snooper->OnBlocksReceived(chunk0, {0}, {block0});
+
+            i64 tick;
+            std::vector<TP2PSnooper::TQueuedBlock> queued;
+            snooper->FinishTick(&tick, &queued);
+            if (queued.empty()) {
+                EXPECT_TRUE(snooper->OnBlockProbe(chunk0, {0}).empty());
+                continue;
+            }
+
+            EXPECT_EQ(1u, queued.size());
+            EXPECT_EQ(0, queued[0].BlockIndex);
+
+            auto childSuggestions = snooper->OnBlockProbe(chunk0, {0});
+            EXPECT_EQ(1u, childSuggestions.size());
+            if (!childSuggestions.empty()) {
+                EXPECT_EQ(queued[0].Peers, childSuggestions[0].Peers);
+                EXPECT_EQ(snooper->GetSessionId(), childSuggestions[0].P2PSessionId);
+            }
+
+            sends.emplace_back(peerId, queued[0].Peers);
+        }
+    }
+
+    return holders;
+}
+
+TEST_F(TP2PTest, TreeDistribution)
+{
+    Config->EnableTreeDistribution = true;
+    Config->TreeFanout = 2;
+
+    std::vector<TNodeId> nodes = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto snoopers = CreateTreeSnoopers(Config, nodes, nodes);
+
+    auto holders = WalkTree(Config, snoopers, /*seedId*/ 1);
+    for (auto nodeId : nodes) {
+        EXPECT_TRUE(holders.contains(nodeId));
+    }
+}
+
+TEST_F(TP2PTest, TreeDistributionFilteredNodes)
+{
+    Config->EnableTreeDistribution = true;
+    Config->TreeFanout = 2;
+
+    // Nodes 1 and 4 do not satisfy the node tag filter; the seed is one of them.
+    std::vector<TNodeId> nodes = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<TNodeId> treeNodes = {2, 3, 5, 6, 7, 8, 9, 10};
+    auto snoopers = CreateTreeSnoopers(Config, nodes, treeNodes);
+
+    auto holders = WalkTree(Config, snoopers, /*seedId*/ 1);
+    EXPECT_FALSE(holders.contains(4));
+    for (auto nodeId : treeNodes) {
+        EXPECT_TRUE(holders.contains(nodeId));
+    }
+
+    // A filtered out node never forwards the blocks it happens to receive.
+    auto chunk0 = TChunkId::Create();
+    const auto& snooper = snoopers[4];
+    snooper->OnBlocksReceived(chunk0, {0}, {TBlock{TSharedRef::FromString("b0")}});
+    i64 tick;
+    std::vector<TP2PSnooper::TQueuedBlock> queued;
+    snooper->FinishTick(&tick, &queued);
+    EXPECT_TRUE(queued.empty());
+}
+
+TEST_F(TP2PTest, TreeDistributionStaleNodes)
+{
+    Config->EnableTreeDistribution = true;
+    Config->TreeFanout = 2;
+
+    // Stale nodes stay in the tree but are bypassed by their parents.
+    std::vector<TNodeId> nodes;
+    for (int nodeId = 1; nodeId <= 30; ++nodeId) {
+        nodes.push_back(nodeId);
+    }
+    THashSet<TNodeId> staleNodes{3, 4, 11, 17};
+    auto snoopers = CreateTreeSnoopers(Config, nodes, nodes, staleNodes);
+
+    auto holders = WalkTree(Config, snoopers, /*seedId*/ 1);
+    for (auto nodeId : nodes) {
+        EXPECT_EQ(!staleNodes.contains(nodeId), holders.contains(nodeId));
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace
@@ -0,0 +1,199 @@
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/server/node/data_node/replication_helpers.h>
+
+#include <yt/yt/core/concurrency/action_queue.h>
+
+#include <yt/yt/core/misc/checksum.h>
+#include <yt/yt/core/misc/fs.h>
+
+#include <util/folder/dirut.h>
+
+#include <util/stream/file.h>
+
+namespace NYT::NDataNode {
+namespace {
+
+using namespace NConcurrency;
+using namespace NIO;
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(TReplicationWindowTest, Simple)
+{
+    std::vector<i64> blockSizes{4, 4, 4, 10, 1, 1};
+
+    EXPECT_EQ(2, GetReplicationWindowBlockCount(blockSizes, 0, /*windowSize*/ 8));
+    EXPECT_EQ(1, GetReplicationWindowBlockCount(blockSizes, 2, /*windowSize*/ 8));
+    // An oversized block still forms a window of its own.
+    EXPECT_EQ(1, GetReplicationWindowBlockCount(blockSizes, 3, /*windowSize*/ 8));
+    EXPECT_EQ(2, GetReplicationWindowBlockCount(blockSizes, 4, /*windowSize*/ 8));
+    EXPECT_EQ(0, GetReplicationWindowBlockCount(blockSizes, 6, /*windowSize*/ 8));
+
+    EXPECT_EQ(6, GetReplicationWindowBlockCount(blockSizes, 0, /*windowSize*/ 1_GB));
+}
+
+TEST(TReplicationWindowTest, WindowsCoverAllBlocks)
+{
+    std::vector<i64> blockSizes;
+    for (int index = 0; index < 1000; ++index) {
+        blockSizes.push_back(1 + (index * 7919) % 3000);
+    }
+
+    for (i64 windowSize : {1, 100, 2999, 10000, 1000000}) {
+        int blockIndex = 0;
+        int windowCount = 0;
+        while (blockIndex < std::ssize(blockSizes)) {
+            int windowBlockCount = GetReplicationWindowBlockCount(blockSizes, blockIndex, windowSize);
+            ASSERT_GE(windowBlockCount, 1);
+
+            i64 size = 0;
+            for (int index = blockIndex; index < blockIndex + windowBlockCount; ++index) {
+                size += blockSizes[index];
+            }
+            EXPECT_TRUE(windowBlockCount == 1 || size <= windowSize);
+            if (blockIndex + windowBlockCount < std::ssize(blockSizes)) {
+                EXPECT_GT(size + blockSizes[blockIndex + windowBlockCount], windowSize);
+            }
+
+            blockIndex += windowBlockCount;
+            ++windowCount;
+        }
+        EXPECT_EQ(std::ssize(blockSizes), blockIndex);
+        EXPECT_LE(windowCount, std::ssize(blockSizes));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TRecordingThrottler
+    : public IThroughputThrottler
+{
+public:
+    TFuture<void> Throttle(i64 amount) override
+    {
+        Amounts_.push_back(amount);
+        return VoidFuture;
+    }
+
+    bool TryAcquire(i64 /*amount*/) override
+    {
+        YT_UNIMPLEMENTED();
+    }
+
+    i64 TryAcquireAvailable(i64 /*amount*/) override
+    {
+        YT_UNIMPLEMENTED();
+    }
+
+    void Acquire(i64 /*amount*/) override
+    {
+        YT_UNIMPLEMENTED();
+    }
+
+    bool IsOverdraft() override
+    {
+        return false;
+    }
+
+    i64 GetQueueTotalAmount() const override
+    {
+        return 0;
+    }
+
+    TDuration GetEstimatedOverdraftDuration() const override
+    {
+        return TDuration::Zero();
+    }
+
+    const std::vector<i64>& GetAmounts() const
+    {
+        return Amounts_;
+    }
+
+private:
+    std::vector<i64> Amounts_;
+};
+
+class TCopyChunkDataFileTest
+    : public ::testing::Test
+{
+protected:
+    const TActionQueuePtr ActionQueue_ = New<TActionQueue>("CopyTest");
+
+    const TString SourcePath_ = NFS::CombinePaths(NFs::CurrentWorkingDirectory(), "copy_chunk_data_source");
+    const TString DestinationPath_ = NFS::CombinePaths(NFs::CurrentWorkingDirectory(), "copy_chunk_data_destination");
+
+    TString Data_;
+    TBlocksExt BlocksExt_;
+
+    void SetUp() override
+    {
+        for (int index = 0; index < 50; ++index) {
+            TString block(100 + index * 37, 'a' + index % 26);
+            BlocksExt_.Blocks.push_back(TBlockInfo{
+                .Offset = std::ssize(Data_),
+                .Size = std::ssize(block),
+                .Checksum = GetChecksum(TRef::FromString(block)),
+            });
+            Data_ += block;
+        }
+
+        TFile source(SourcePath_, CreateAlways | WrOnly);
+        source.Write(Data_.data(), Data_.size());
+    }
+
+    void TearDown() override
+    {
+        for (const auto& path : {SourcePath_, DestinationPath_}) {
+            if (NFS::Exists(path)) {
+                NFS::Remove(path);
+            }
+        }
+        ActionQueue_->Shutdown();
+    }
+
+    TError Copy(const TChunkDataCopyOptions& options)
+    {
+        return BIND([&] {
+            TFile source(SourcePath_, OpenExisting | RdOnly);
+            TFile destination(DestinationPath_, CreateAlways | RdWr);
+            CopyChunkDataFile(source, destination, BlocksExt_, options);
+        })
+            .AsyncVia(ActionQueue_->GetInvoker())
+            .Run()
+            .Get();
+    }
+};
+
+TEST_F(TCopyChunkDataFileTest, CopyAndThrottle)
+{
+    auto throttler = New<TRecordingThrottler>();
+    ASSERT_TRUE(Copy({
+        .WindowSize = 1000,
+        .Throttlers = {throttler},
+    }).IsOK());
+
+    EXPECT_EQ(Data_, TUnbufferedFileInput(DestinationPath_).ReadAll());
+
+    i64 throttledSize = 0;
+    for (auto amount : throttler->GetAmounts()) {
+        throttledSize += amount;
+    }
+    EXPECT_EQ(std::ssize(Data_), throttledSize);
+    EXPECT_GT(std::ssize(throttler->GetAmounts()), 1);
+}
+
+TEST_F(TCopyChunkDataFileTest, ChecksumMismatch)
+{
+    BlocksExt_.Blocks[17].Checksum ^= 1;
+
+    auto error = Copy({.WindowSize = 1000});
+    EXPECT_FALSE(error.IsOK());
+    EXPECT_TRUE(error.FindMatching(NChunkClient::EErrorCode::IncorrectChunkFileChecksum));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NDataNode
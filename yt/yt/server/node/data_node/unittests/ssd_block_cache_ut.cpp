@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <yt/yt/server/node/data_node/config.h>
+#include <yt/yt/server/node/data_node/private.h>
+#include <yt/yt/server/node/data_node/ssd_block_cache.h>
+
+#include <yt/yt/ytlib/chunk_client/block_cache.h>
+#include <yt/yt/ytlib/chunk_client/client_block_cache.h>
+
+#include <yt/yt/client/misc/workload.h>
+
+#include <yt/yt/core/concurrency/scheduler.h>
+
+#include <library/cpp/testing/common/env.h>
+
+#include <util/system/file.h>
+
+namespace NYT::NDataNode {
+namespace {
+
+using namespace NConcurrency;
+using namespace NChunkClient;
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Never holds anything; evictions are triggered explicitly by the test.
+class TFakeInMemoryBlockCache
+    : public IClientBlockCache
+{
+public:
+    void PutBlock(const TBlockId& /*id*/, EBlockType /*type*/, const TBlock& /*block*/) override
+    { }
+
+    TCachedBlock FindBlock(const TBlockId& /*id*/, EBlockType /*type*/) override
+    {
+        return {};
+    }
+
+    std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
+        const TBlockId& /*id*/,
+        EBlockType /*type*/,
+        const TWorkloadDescriptor& /*workloadDescriptor*/) override
+    {
+        return CreateActiveCachedBlockCookie();
+    }
+
+    EBlockType GetSupportedBlockTypes() const override
+    {
+        return EBlockType::CompressedData;
+    }
+
+    void Reconfigure(const TBlockCacheDynamicConfigPtr& /*config*/) override
+    { }
+
+    void Evict(const TBlockId& id, const TBlock& block)
+    {
+        BlockEvicted_.Fire(id, EBlockType::CompressedData, block);
+    }
+
+    DEFINE_SIGNAL_OVERRIDE(void(const TBlockId& id, EBlockType type, const TBlock& block), BlockEvicted);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TSsdBlockCacheTest
+    : public ::testing::Test
+{
+protected:
+    const TChunkId ChunkId_ = TChunkId::Create();
+
+    TSsdBlockCacheConfigPtr CreateConfig()
+    {
+        auto config = New<TSsdBlockCacheConfig>();
+        config->Enable = true;
+        config->Path = GetOutputPath() / ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        config->Capacity = 64_MB;
+        config->UseDirectIO = false;
+        config->MaxBlockSize = 64_KB;
+        config->IndexFlushWriteSize = 64_KB;
+        return config;
+    }
+
+    static TBlock MakeBlock(int index)
+    {
+        return TBlock(TSharedRef::FromString(TString(16_KB, 'a' + index % 26)));
+    }
+
+    //! Waits until the block is served by the SSD tier.
+    static TBlock WaitForSsdBlock(const IBlockCachePtr& cache, const TBlockId& id)
+    {
+        for (int iteration = 0; iteration < 500; ++iteration) {
+            auto cookie = cache->GetBlockCookie(id, EBlockType::CompressedData, TWorkloadDescriptor());
+            if (!cookie->IsActive()) {
+                return WaitFor(cookie->GetBlockFuture())
+                    .ValueOrThrow()
+                    .Block;
+            }
+            Sleep(TDuration::MilliSeconds(10));
+        }
+        return {};
+    }
+};
+
+TEST_F(TSsdBlockCacheTest, EvictedBlockIsServedFromSsd)
+{
+    auto memoryCache = New<TFakeInMemoryBlockCache>();
+    auto cache = CreateSsdBlockCache(CreateConfig(), memoryCache);
+
+    TBlockId id(ChunkId_, 0);
+    auto block = MakeBlock(0);
+
+    // Wait for initialization to complete.
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        memoryCache->Evict(id, block);
+        auto cachedBlock = WaitForSsdBlock(cache, id);
+        if (cachedBlock) {
+            EXPECT_EQ(ToString(block.Data), ToString(cachedBlock.Data));
+            return;
+        }
+    }
+    FAIL() << "Block was never admitted into SSD block cache";
+}
+
+TEST_F(TSsdBlockCacheTest, SurvivesRestart)
+{
+    auto config = CreateConfig();
+    constexpr int BlockCount = 8;
+
+    {
+        auto memoryCache = New<TFakeInMemoryBlockCache>();
+        auto cache = CreateSsdBlockCache(config, memoryCache);
+
+        for (int index = 0; index < BlockCount; ++index) {
+            TBlockId id(ChunkId_, index);
+            TBlock cachedBlock;
+            // Keep evicting until the cache is initialized and the block is written.
+            for (int iteration = 0; iteration < 10 && !cachedBlock; ++iteration) {
+                memoryCache->Evict(id, MakeBlock(index));
+                cachedBlock = WaitForSsdBlock(cache, id);
+            }
+            ASSERT_TRUE(cachedBlock);
+        }
+    }
+
+    auto memoryCache = New<TFakeInMemoryBlockCache>();
+    auto cache = CreateSsdBlockCache(config, memoryCache);
+
+    // Blocks written before the last index flush must be recovered;
+    // the tail written afterwards is conservatively discarded.
+    auto cachedBlock = WaitForSsdBlock(cache, TBlockId(ChunkId_, 0));
+    ASSERT_TRUE(cachedBlock);
+    EXPECT_EQ(ToString(MakeBlock(0).Data), ToString(cachedBlock.Data));
+}
+
+TEST_F(TSsdBlockCacheTest, CorruptedRecordIsMiss)
+{
+    auto config = CreateConfig();
+    auto memoryCache = New<TFakeInMemoryBlockCache>();
+    auto cache = CreateSsdBlockCache(config, memoryCache);
+
+    TBlockId id(ChunkId_, 0);
+    TBlock cachedBlock;
+    for (int iteration = 0; iteration < 10 && !cachedBlock; ++iteration) {
+        memoryCache->Evict(id, MakeBlock(0));
+        cachedBlock = WaitForSsdBlock(cache, id);
+    }
+    ASSERT_TRUE(cachedBlock);
+
+    // Damage the payload of the only record.
+    {
+        TFile file(config->Path + "/" + SsdBlockCacheDataFileName, OpenExisting | WrOnly);
+        auto garbage = TString(1_KB, 'x');
+        file.Pwrite(garbage.data(), garbage.size(), 1_KB);
+    }
+
+    auto cookie = cache->GetBlockCookie(id, EBlockType::CompressedData, TWorkloadDescriptor());
+    ASSERT_FALSE(cookie->IsActive());
+    EXPECT_FALSE(WaitFor(cookie->GetBlockFuture()).IsOK());
+
+    // The damaged record is dropped and the block is fetched by the caller.
+    cookie = cache->GetBlockCookie(id, EBlockType::CompressedData, TWorkloadDescriptor());
+    EXPECT_TRUE(cookie->IsActive());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NDataNode
@@ -61,6 +61,8 @@
 #include <yt/yt/library/profiling/sensor.h>
 #include <yt/yt/library/profiling/producer.h>
 
+#include <yt/yt/core/bus/shm/client.h>
+
 #include <yt/yt/core/concurrency/thread_affinity.h>
 #include <yt/yt/core/concurrency/delayed_executor.h>
 
@@ -1974,6 +1976,9 @@ TJobProxyConfigPtr TJob::CreateConfig()
     proxyConfig->LocalHostName = Bootstrap_->GetLocalHostName();
 
     proxyConfig->BusServer = Slot_->GetBusServerConfig();
+    if (Config_->UseShmBusForJobProxy) {
+        proxyConfig->ShmBusServer = Slot_->GetShmBusServerConfig();
+    }
 
     proxyConfig->TmpfsManager = New<TTmpfsManagerConfig>();
     proxyConfig->TmpfsManager->TmpfsPaths = TmpfsPaths_;
@@ -2706,7 +2711,9 @@ void TJob::InitializeJobProbe()
 {
     VERIFY_THREAD_AFFINITY_ANY();
 
-    auto probe = CreateJobProbe(Slot_->GetBusClientConfig(), Id_);
+    auto probe = Config_->UseShmBusForJobProxy
+        ? CreateJobProbe(NBus::CreateShmBusClient(Slot_->GetShmBusClientConfig()), Id_)
+        : CreateJobProbe(Slot_->GetBusClientConfig(), Id_);
     {
         auto guard = Guard(JobProbeLock_);
         std::swap(JobProbe_, probe);
@@ -11,6 +11,8 @@
 
 #include <yt/yt/server/tools/tools.h>
 
+#include <yt/yt/core/bus/shm/config.h>
+
 #include <yt/yt/core/bus/tcp/client.h>
 
 #include <yt/yt/core/logging/log_manager.h>
@@ -55,6 +57,7 @@ public:
         , SlotIndex_(SlotGuard_->GetSlotIndex())
         , NodeTag_(nodeTag)
         , JobProxyUnixDomainSocketPath_(GetJobProxyUnixDomainSocketPath())
+        , JobProxyShmSocketPath_(GetJobProxyShmSocketPath())
         , NumaNodeAffinity_(numaNodeAffinity)
     {
         Location_->IncreaseSessionCount();
@@ -223,6 +226,16 @@ public:
         return TBusClientConfig::CreateUds(JobProxyUnixDomainSocketPath_);
     }
 
+    TShmBusServerConfigPtr GetShmBusServerConfig() const override
+    {
+        return TShmBusServerConfig::Create(JobProxyShmSocketPath_);
+    }
+
+    TShmBusClientConfigPtr GetShmBusClientConfig() const override
+    {
+        return TShmBusClientConfig::Create(JobProxyShmSocketPath_);
+    }
+
     TFuture<std::vector<TString>> PrepareSandboxDirectories(
         const TUserSandboxOptions& options) override
     {
@@ -305,6 +318,7 @@ private:
     bool PreparationCanceled_ = false;
 
     const TString JobProxyUnixDomainSocketPath_;
+    const TString JobProxyShmSocketPath_;
 
     const std::optional<TNumaNodeInfo> NumaNodeAffinity_;
 
@@ -331,6 +345,14 @@ private:
             "pipes",
             Format("%v-job-proxy-%v", NodeTag_, SlotIndex_)});
     }
+
+    TString GetJobProxyShmSocketPath() const
+    {
+        return NFS::CombinePaths({
+            Location_->GetSlotPath(SlotIndex_),
+            "pipes",
+            Format("%v-job-proxy-shm-%v", NodeTag_, SlotIndex_)});
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,8 @@
 
 #include <yt/yt/core/bus/public.h>
 
+#include <yt/yt/core/bus/shm/public.h>
+
 #include <yt/yt/core/logging/log.h>
 
 #include <yt/yt/core/misc/fs.h>
@@ -88,6 +90,9 @@ struct ISlot
     virtual NBus::TBusServerConfigPtr GetBusServerConfig() const = 0;
     virtual NBus::TBusClientConfigPtr GetBusClientConfig() const = 0;
 
+    virtual NBus::TShmBusServerConfigPtr GetShmBusServerConfig() const = 0;
+    virtual NBus::TShmBusClientConfigPtr GetShmBusClientConfig() const = 0;
+
     virtual int GetSlotIndex() const = 0;
 
     virtual int GetUserId() const = 0;
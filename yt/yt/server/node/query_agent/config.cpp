@@ -25,6 +25,9 @@ void TQueryAgentConfig::Register(TRegistrar registrar)
     registrar.Parameter("max_subqueries", &TThis::MaxSubqueries)
         .GreaterThan(0)
         .Default(16);
+    registrar.Parameter("late_materialization_key_batch_size", &TThis::LateMaterializationKeyBatchSize)
+        .GreaterThan(0)
+        .Default(16384);
     registrar.Parameter("max_query_retries", &TThis::MaxQueryRetries)
         .GreaterThanOrEqual(1)
         .Default(10);
@@ -41,6 +44,15 @@ void TQueryAgentConfig::Register(TRegistrar registrar)
     registrar.Parameter("reject_upon_throttler_overdraft", &TThis::RejectUponThrottlerOverdraft)
         .Default(true);
 
+    registrar.Parameter("enable_late_materialization", &TThis::EnableLateMaterialization)
+        .Default(false);
+    registrar.Parameter("late_materialization_min_skipped_column_count", &TThis::LateMaterializationMinSkippedColumnCount)
+        .GreaterThan(0)
+        .Default(16);
+
+    registrar.Parameter("enable_key_predicate_pushdown", &TThis::EnableKeyPredicatePushdown)
+        .Default(true);
+
     registrar.Preprocessor([] (TThis* config) {
         config->FunctionImplCache->Capacity = 100;
     });
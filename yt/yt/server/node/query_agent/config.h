@@ -31,6 +31,20 @@ public:
 
     bool RejectUponThrottlerOverdraft;
 
+    //! If |true|, range scans of sorted tables with a WHERE clause are executed in two phases:
+    //! the predicate is first evaluated over key and predicate columns only, then the remaining
+    //! columns are looked up for the matching keys.
+    bool EnableLateMaterialization;
+    //! Late materialization is only used if it allows to skip at least this many columns in the first phase.
+    int LateMaterializationMinSkippedColumnCount;
+    //! Maximum number of keys matched by the first phase of late materialization
+    //! that are buffered and looked up at once.
+    int LateMaterializationKeyBatchSize;
+
+    //! If |true|, comparisons of key columns with constants from the WHERE clause
+    //! are passed to chunk readers to skip rows before they are materialized.
+    bool EnableKeyPredicatePushdown;
+
     REGISTER_YSON_STRUCT(TQueryAgentConfig);
 
     static void Register(TRegistrar registrar);
@@ -0,0 +1,173 @@
+#include "key_predicates.h"
+
+#include <yt/yt/library/query/base/query.h>
+
+namespace NYT::NQueryAgent {
+
+using namespace NNewTableClient;
+using namespace NQueryClient;
+using namespace NTableClient;
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+std::optional<EKeyPredicateOp> GetKeyPredicateOp(EBinaryOp opcode)
+{
+    switch (opcode) {
+        case EBinaryOp::Equal:          return EKeyPredicateOp::Equal;
+        case EBinaryOp::NotEqual:       return EKeyPredicateOp::NotEqual;
+        case EBinaryOp::Less:           return EKeyPredicateOp::Less;
+        case EBinaryOp::LessOrEqual:    return EKeyPredicateOp::LessOrEqual;
+        case EBinaryOp::Greater:        return EKeyPredicateOp::Greater;
+        case EBinaryOp::GreaterOrEqual: return EKeyPredicateOp::GreaterOrEqual;
+        default:                        return std::nullopt;
+    }
+}
+
+bool IsPushableKeyType(EValueType type)
+{
+    // NB: Doubles are not pushed down since comparisons with NaN fail the query.
+    return
+        type == EValueType::Int64 ||
+        type == EValueType::Uint64 ||
+        type == EValueType::Boolean ||
+        type == EValueType::String;
+}
+
+class TKeyPredicateExtractor
+{
+public:
+    explicit TKeyPredicateExtractor(TConstQueryPtr query)
+        : Query_(std::move(query))
+    {
+        const auto& originalSchema = Query_->Schema.Original;
+        int keyColumnCount = originalSchema->GetKeyColumnCount();
+        for (const auto& item : Query_->Schema.Mapping) {
+            if (item.Index < keyColumnCount) {
+                KeyColumnIndexes_.emplace(item.Name, item.Index);
+            }
+        }
+    }
+
+    std::vector<TKeyColumnPredicate> Run()
+    {
+        if (Query_->WhereClause) {
+            VisitConjunct(Query_->WhereClause);
+        }
+        return std::move(Predicates_);
+    }
+
+private:
+    const TConstQueryPtr Query_;
+
+    THashMap<TString, int> KeyColumnIndexes_;
+    std::vector<TKeyColumnPredicate> Predicates_;
+
+    void VisitConjunct(const TConstExpressionPtr& expr)
+    {
+        if (auto binaryOpExpr = expr->As<TBinaryOpExpression>()) {
+            if (binaryOpExpr->Opcode == EBinaryOp::And) {
+                VisitConjunct(binaryOpExpr->Lhs);
+                VisitConjunct(binaryOpExpr->Rhs);
+            } else {
+                VisitComparison(binaryOpExpr);
+            }
+        } else if (auto inExpr = expr->As<TInExpression>()) {
+            VisitIn(inExpr);
+        }
+    }
+
+    void VisitComparison(const TBinaryOpExpression* binaryOpExpr)
+    {
+        auto opcode = binaryOpExpr->Opcode;
+        auto referenceExpr = binaryOpExpr->Lhs->As<TReferenceExpression>();
+        auto literalExpr = binaryOpExpr->Rhs->As<TLiteralExpression>();
+        if (!referenceExpr || !literalExpr) {
+            referenceExpr = binaryOpExpr->Rhs->As<TReferenceExpression>();
+            literalExpr = binaryOpExpr->Lhs->As<TLiteralExpression>();
+            opcode = GetReversedBinaryOpcode(opcode);
+        }
+        if (!referenceExpr || !literalExpr) {
+            return;
+        }
+
+        auto op = GetKeyPredicateOp(opcode);
+        auto keyColumnIndex = FindKeyColumnIndex(referenceExpr);
+        if (!op || !keyColumnIndex) {
+            return;
+        }
+
+        TUnversionedValue constant = literalExpr->Value;
+        if (constant.Type == EValueType::Null) {
+            return;
+        }
+
+        AddPredicate(*keyColumnIndex, *op, {constant});
+    }
+
+    void VisitIn(const TInExpression* inExpr)
+    {
+        if (inExpr->Arguments.size() != 1) {
+            return;
+        }
+
+        auto referenceExpr = inExpr->Arguments[0]->As<TReferenceExpression>();
+        if (!referenceExpr) {
+            return;
+        }
+
+        auto keyColumnIndex = FindKeyColumnIndex(referenceExpr);
+        if (!keyColumnIndex) {
+            return;
+        }
+
+        std::vector<TUnversionedValue> constants;
+        constants.reserve(inExpr->Values.Size());
+        for (auto row : inExpr->Values) {
+            YT_VERIFY(row.GetCount() == 1);
+            if (row[0].Type != EValueType::Null) {
+                constants.push_back(row[0]);
+            }
+        }
+
+        if (constants.empty()) {
+            return;
+        }
+
+        AddPredicate(*keyColumnIndex, EKeyPredicateOp::In, std::move(constants));
+    }
+
+    std::optional<int> FindKeyColumnIndex(const TReferenceExpression* referenceExpr) const
+    {
+        if (!IsPushableKeyType(referenceExpr->GetWireType())) {
+            return std::nullopt;
+        }
+
+        auto it = KeyColumnIndexes_.find(referenceExpr->ColumnName);
+        return it == KeyColumnIndexes_.end() ? std::nullopt : std::make_optional(it->second);
+    }
+
+    void AddPredicate(int keyColumnIndex, EKeyPredicateOp op, std::vector<TUnversionedValue> constants)
+    {
+        // NB: Constants point into literals and IN values owned by the query.
+        Predicates_.push_back(TKeyColumnPredicate{
+            .KeyColumnIndex = keyColumnIndex,
+            .Op = op,
+            .Constants = MakeSharedRange(std::move(constants), Query_),
+        });
+    }
+};
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::vector<TKeyColumnPredicate> ExtractKeyColumnPredicates(const TConstQueryPtr& query)
+{
+    return TKeyPredicateExtractor(query).Run();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NQueryAgent
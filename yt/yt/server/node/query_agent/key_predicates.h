@@ -0,0 +1,25 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/ytlib/new_table_client/public.h>
+
+#include <yt/yt/library/query/base/public.h>
+
+namespace NYT::NQueryAgent {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Extracts comparisons of key columns with constants from the top-level conjunction
+//! of the WHERE clause of #query so that chunk readers could skip rows early.
+/*!
+ *  Only conjuncts of form |key op literal|, |literal op key| and |key in (...)| are extracted;
+ *  the rest of the clause is ignored. Predicates are a necessary condition only:
+ *  the query still has to evaluate the whole WHERE clause.
+ */
+std::vector<NNewTableClient::TKeyColumnPredicate> ExtractKeyColumnPredicates(
+    const NQueryClient::TConstQueryPtr& query);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NQueryAgent
@@ -0,0 +1,494 @@
+#include "late_materialization.h"
+#include "config.h"
+
+#include <yt/yt/library/query/base/query.h>
+
+#include <yt/yt/client/table_client/row_batch.h>
+#include <yt/yt/client/table_client/row_buffer.h>
+#include <yt/yt/client/table_client/unversioned_reader.h>
+#include <yt/yt/client/table_client/unversioned_writer.h>
+
+#include <yt/yt/client/chunk_client/data_statistics.h>
+
+#include <yt/yt/core/misc/ring_queue.h>
+
+namespace NYT::NQueryAgent {
+
+using namespace NChunkClient;
+using namespace NQueryClient;
+using namespace NTableClient;
+
+using NChunkClient::NProto::TDataStatistics;
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TKeyBatcherBufferTag
+{ };
+
+class TKeyBatcher::TImpl
+    : public IUnversionedRowsetWriter
+{
+public:
+    TImpl(
+        int maxKeysPerBatch,
+        IMemoryChunkProviderPtr chunkProvider)
+        : MaxKeysPerBatch_(maxKeysPerBatch)
+        , ChunkProvider_(std::move(chunkProvider))
+    {
+        YT_VERIFY(MaxKeysPerBatch_ > 0);
+    }
+
+    bool Write(TRange<TUnversionedRow> rows) override
+    {
+        std::optional<TBatchDelivery> delivery;
+        bool ready;
+
+        {
+            auto guard = Guard(SpinLock_);
+
+            YT_VERIFY(!WriterClosed_);
+
+            if (!Error_.IsOK()) {
+                return false;
+            }
+
+            for (auto row : rows) {
+                if (!CurrentBuffer_) {
+                    CurrentBuffer_ = New<TRowBuffer>(TKeyBatcherBufferTag(), ChunkProvider_);
+                    CurrentKeys_.reserve(MaxKeysPerBatch_);
+                }
+                CurrentKeys_.push_back(CurrentBuffer_->CaptureRow(row));
+                if (std::ssize(CurrentKeys_) == MaxKeysPerBatch_) {
+                    SealCurrentBatch();
+                }
+            }
+
+            delivery = MaybeDeliverBatch();
+
+            ready = SealedBatches_.empty();
+            if (!ready && (!WriterReadyEvent_ || WriterReadyEvent_.IsSet())) {
+                WriterReadyEvent_ = NewPromise<void>();
+            }
+        }
+
+        if (delivery) {
+            delivery->Promise.Set(std::move(delivery->Batch));
+        }
+
+        return ready;
+    }
+
+    TFuture<void> GetReadyEvent() override
+    {
+        auto guard = Guard(SpinLock_);
+        if (!Error_.IsOK()) {
+            return MakeFuture(Error_);
+        }
+        return WriterReadyEvent_ ? WriterReadyEvent_.ToFuture() : VoidFuture;
+    }
+
+    TFuture<void> Close() override
+    {
+        std::optional<TBatchDelivery> delivery;
+
+        {
+            auto guard = Guard(SpinLock_);
+
+            YT_VERIFY(!WriterClosed_);
+            WriterClosed_ = true;
+
+            if (!Error_.IsOK()) {
+                return MakeFuture(Error_);
+            }
+
+            if (!CurrentKeys_.empty()) {
+                SealCurrentBatch();
+            }
+
+            delivery = MaybeDeliverBatch();
+        }
+
+        if (delivery) {
+            delivery->Promise.Set(std::move(delivery->Batch));
+        }
+
+        return VoidFuture;
+    }
+
+    TFuture<TSharedRange<TUnversionedRow>> GetNextBatch()
+    {
+        TPromise<void> writerReadyEvent;
+        TFuture<TSharedRange<TUnversionedRow>> result;
+
+        {
+            auto guard = Guard(SpinLock_);
+
+            YT_VERIFY(!BatchPromise_);
+
+            if (!Error_.IsOK()) {
+                return MakeFuture<TSharedRange<TUnversionedRow>>(Error_);
+            }
+
+            if (SealedBatches_.empty()) {
+                if (WriterClosed_) {
+                    return MakeFuture(TSharedRange<TUnversionedRow>());
+                }
+                BatchPromise_ = NewPromise<TSharedRange<TUnversionedRow>>();
+                return BatchPromise_.ToFuture();
+            }
+
+            result = MakeFuture(std::move(SealedBatches_.front()));
+            SealedBatches_.pop();
+
+            if (SealedBatches_.empty() && WriterReadyEvent_) {
+                writerReadyEvent = WriterReadyEvent_;
+            }
+        }
+
+        if (writerReadyEvent) {
+            writerReadyEvent.TrySet();
+        }
+
+        return result;
+    }
+
+    bool IsExhausted() const
+    {
+        auto guard = Guard(SpinLock_);
+        return WriterClosed_ && SealedBatches_.empty();
+    }
+
+    void Fail(const TError& error)
+    {
+        YT_VERIFY(!error.IsOK());
+
+        TPromise<void> writerReadyEvent;
+        TPromise<TSharedRange<TUnversionedRow>> batchPromise;
+
+        {
+            auto guard = Guard(SpinLock_);
+
+            if (!Error_.IsOK() || (WriterClosed_ && SealedBatches_.empty() && !BatchPromise_)) {
+                return;
+            }
+
+            Error_ = error;
+            writerReadyEvent = WriterReadyEvent_;
+            batchPromise = std::move(BatchPromise_);
+
+            SealedBatches_.clear();
+            CurrentKeys_.clear();
+            CurrentBuffer_.Reset();
+        }
+
+        if (writerReadyEvent) {
+            writerReadyEvent.TrySet(error);
+        }
+        if (batchPromise) {
+            batchPromise.TrySet(error);
+        }
+    }
+
+private:
+    struct TBatchDelivery
+    {
+        TPromise<TSharedRange<TUnversionedRow>> Promise;
+        TSharedRange<TUnversionedRow> Batch;
+    };
+
+    const int MaxKeysPerBatch_;
+    const IMemoryChunkProviderPtr ChunkProvider_;
+
+    mutable YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, SpinLock_);
+
+    TRowBufferPtr CurrentBuffer_;
+    std::vector<TUnversionedRow> CurrentKeys_;
+
+    TRingQueue<TSharedRange<TUnversionedRow>> SealedBatches_;
+
+    TPromise<TSharedRange<TUnversionedRow>> BatchPromise_;
+
+    TPromise<void> WriterReadyEvent_;
+
+    bool WriterClosed_ = false;
+    TError Error_;
+
+
+    void SealCurrentBatch()
+    {
+        VERIFY_SPINLOCK_AFFINITY(SpinLock_);
+
+        SealedBatches_.push(MakeSharedRange(std::move(CurrentKeys_), std::move(CurrentBuffer_)));
+        CurrentKeys_.clear();
+        CurrentBuffer_.Reset();
+    }
+
+    //! Hands the next sealed batch (or the end of stream) to the consumer waiting in #GetNextBatch, if any.
+    //! The returned promise must be set outside of the lock.
+    std::optional<TBatchDelivery> MaybeDeliverBatch()
+    {
+        VERIFY_SPINLOCK_AFFINITY(SpinLock_);
+
+        if (!BatchPromise_) {
+            return std::nullopt;
+        }
+
+        TBatchDelivery delivery;
+        if (!SealedBatches_.empty()) {
+            delivery.Batch = std::move(SealedBatches_.front());
+            SealedBatches_.pop();
+        } else if (!WriterClosed_) {
+            return std::nullopt;
+        }
+
+        delivery.Promise = std::move(BatchPromise_);
+        return delivery;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TKeyBatcher::TKeyBatcher(
+    int maxKeysPerBatch,
+    IMemoryChunkProviderPtr chunkProvider)
+    : Impl_(New<TImpl>(maxKeysPerBatch, std::move(chunkProvider)))
+{ }
+
+TKeyBatcher::~TKeyBatcher() = default;
+
+IUnversionedRowsetWriterPtr TKeyBatcher::GetWriter() const
+{
+    return Impl_;
+}
+
+TFuture<TSharedRange<TUnversionedRow>> TKeyBatcher::GetNextBatch()
+{
+    return Impl_->GetNextBatch();
+}
+
+bool TKeyBatcher::IsExhausted() const
+{
+    return Impl_->IsExhausted();
+}
+
+void TKeyBatcher::Fail(const TError& error)
+{
+    Impl_->Fail(error);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TLateMaterializingReader
+    : public ISchemafulUnversionedReader
+{
+public:
+    TLateMaterializingReader(
+        ISchemafulUnversionedReaderPtr filterReader,
+        TKeyBatcherPtr keyBatcher,
+        TLookupReaderFactory lookupReaderFactory)
+        : FilterReader_(std::move(filterReader))
+        , KeyBatcher_(std::move(keyBatcher))
+        , LookupReaderFactory_(std::move(lookupReaderFactory))
+    { }
+
+    ~TLateMaterializingReader()
+    {
+        KeyBatcher_->Fail(TError(NYT::EErrorCode::Canceled, "Late materializing reader destroyed"));
+    }
+
+    IUnversionedRowBatchPtr Read(const TRowBatchReadOptions& options) override
+    {
+        while (!Finished_) {
+            if (LookupReader_) {
+                auto batch = LookupReader_->Read(options);
+                if (batch) {
+                    if (batch->IsEmpty()) {
+                        ReadyEvent_ = LookupReader_->GetReadyEvent();
+                    }
+                    return batch;
+                }
+
+                FinishedLookupDataStatistics_ += LookupReader_->GetDataStatistics();
+                FinishedLookupDecompressionStatistics_ += LookupReader_->GetDecompressionStatistics();
+                LookupReader_.Reset();
+            }
+
+            if (!NextKeys_) {
+                NextKeys_ = KeyBatcher_->GetNextBatch();
+            }
+
+            if (!NextKeys_.IsSet()) {
+                ReadyEvent_ = NextKeys_.AsVoid();
+                return CreateEmptyUnversionedRowBatch();
+            }
+
+            auto keys = NextKeys_.Get().ValueOrThrow();
+            NextKeys_.Reset();
+
+            if (keys.Empty()) {
+                Finished_ = true;
+                break;
+            }
+
+            LookupReader_ = LookupReaderFactory_(std::move(keys));
+        }
+
+        return nullptr;
+    }
+
+    TFuture<void> GetReadyEvent() const override
+    {
+        return ReadyEvent_;
+    }
+
+    TDataStatistics GetDataStatistics() const override
+    {
+        auto statistics = FilterReader_->GetDataStatistics();
+        statistics += FinishedLookupDataStatistics_;
+        if (LookupReader_) {
+            statistics += LookupReader_->GetDataStatistics();
+        }
+        return statistics;
+    }
+
+    TCodecStatistics GetDecompressionStatistics() const override
+    {
+        auto statistics = FilterReader_->GetDecompressionStatistics();
+        statistics += FinishedLookupDecompressionStatistics_;
+        if (LookupReader_) {
+            statistics += LookupReader_->GetDecompressionStatistics();
+        }
+        return statistics;
+    }
+
+    bool IsFetchingCompleted() const override
+    {
+        if (Finished_) {
+            return true;
+        }
+        if (!KeyBatcher_->IsExhausted() || NextKeys_) {
+            return false;
+        }
+        return !LookupReader_ || LookupReader_->IsFetchingCompleted();
+    }
+
+    std::vector<TChunkId> GetFailedChunkIds() const override
+    {
+        auto chunkIds = FilterReader_->GetFailedChunkIds();
+        if (LookupReader_) {
+            auto lookupChunkIds = LookupReader_->GetFailedChunkIds();
+            chunkIds.insert(chunkIds.end(), lookupChunkIds.begin(), lookupChunkIds.end());
+        }
+        return chunkIds;
+    }
+
+private:
+    const ISchemafulUnversionedReaderPtr FilterReader_;
+    const TKeyBatcherPtr KeyBatcher_;
+    const TLookupReaderFactory LookupReaderFactory_;
+
+    TFuture<TSharedRange<TUnversionedRow>> NextKeys_;
+    ISchemafulUnversionedReaderPtr LookupReader_;
+    bool Finished_ = false;
+
+    TDataStatistics FinishedLookupDataStatistics_;
+    TCodecStatistics FinishedLookupDecompressionStatistics_;
+
+    TFuture<void> ReadyEvent_ = VoidFuture;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+ISchemafulUnversionedReaderPtr CreateLateMaterializingReader(
+    ISchemafulUnversionedReaderPtr filterReader,
+    TKeyBatcherPtr keyBatcher,
+    TLookupReaderFactory lookupReaderFactory)
+{
+    return New<TLateMaterializingReader>(
+        std::move(filterReader),
+        std::move(keyBatcher),
+        std::move(lookupReaderFactory));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct TReferenceCollector
+    : public TVisitor<TReferenceCollector>
+{
+    THashSet<TString> ColumnNames;
+
+    void OnReference(const TReferenceExpression* referenceExpr)
+    {
+        ColumnNames.insert(referenceExpr->ColumnName);
+    }
+};
+
+} // namespace
+
+TQueryPtr BuildLateMaterializationFilterQuery(
+    const TConstQueryPtr& query,
+    const TQueryAgentConfigPtr& config)
+{
+    if (!config->EnableLateMaterialization ||
+        !query->WhereClause ||
+        !query->JoinClauses.empty() ||
+        query->IsOrdered())
+    {
+        // Ordered queries with limit typically read only a prefix of the ranges,
+        // while the filtering phase reads them entirely.
+        return nullptr;
+    }
+
+    TReferenceCollector referenceCollector;
+    referenceCollector.Visit(query->WhereClause);
+
+    const auto& originalSchema = query->Schema.Original;
+    int keyColumnCount = originalSchema->GetKeyColumnCount();
+
+    auto filterQuery = New<TQuery>();
+    filterQuery->Schema.Original = originalSchema;
+    filterQuery->WhereClause = query->WhereClause;
+    filterQuery->InferRanges = query->InferRanges;
+
+    std::vector<std::optional<TString>> keyColumnNames(keyColumnCount);
+    THashSet<TString> mappedNames;
+    for (const auto& item : query->Schema.Mapping) {
+        mappedNames.insert(item.Name);
+        if (item.Index < keyColumnCount) {
+            keyColumnNames[item.Index] = item.Name;
+        }
+        if (item.Index < keyColumnCount || referenceCollector.ColumnNames.contains(item.Name)) {
+            filterQuery->Schema.Mapping.push_back(item);
+        }
+    }
+
+    int skippedColumnCount = std::ssize(query->Schema.Mapping) - std::ssize(filterQuery->Schema.Mapping);
+    if (skippedColumnCount < config->LateMaterializationMinSkippedColumnCount) {
+        return nullptr;
+    }
+
+    auto projectClause = New<TProjectClause>();
+    for (int index = 0; index < keyColumnCount; ++index) {
+        const auto& column = originalSchema->Columns()[index];
+        if (!keyColumnNames[index]) {
+            // Key columns not referenced by the query are read under their own names.
+            if (mappedNames.contains(column.Name())) {
+                return nullptr;
+            }
+            keyColumnNames[index] = column.Name();
+            filterQuery->Schema.Mapping.push_back({column.Name(), index});
+        }
+        projectClause->AddProjection(
+            New<TReferenceExpression>(column.LogicalType(), *keyColumnNames[index]),
+            *keyColumnNames[index]);
+    }
+    filterQuery->ProjectClause = std::move(projectClause);
+
+    return filterQuery;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NQueryAgent
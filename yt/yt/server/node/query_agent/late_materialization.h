@@ -0,0 +1,87 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/client/table_client/unversioned_row.h>
+
+#include <yt/yt/library/query/base/public.h>
+
+#include <yt/yt/core/actions/callback.h>
+#include <yt/yt/core/actions/future.h>
+
+#include <library/cpp/yt/memory/range.h>
+
+namespace NYT::NQueryAgent {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Collects keys of rows matched by the filtering phase of late materialization
+//! and hands them out in batches of bounded size.
+/*!
+ *  Keys are captured into row buffers backed by #chunkProvider, so they are accounted
+ *  as query memory. Each batch owns its buffer and releases it once the consumer drops it.
+ *
+ *  The writer side applies backpressure: once a write seals a batch, the writer
+ *  has to wait until all sealed batches are taken by the consumer.
+ *
+ *  Thread affinity: any
+ */
+class TKeyBatcher
+    : public TRefCounted
+{
+public:
+    TKeyBatcher(
+        int maxKeysPerBatch,
+        IMemoryChunkProviderPtr chunkProvider);
+    ~TKeyBatcher();
+
+    //! Returns the writer side that the filtering query writes keys into.
+    NTableClient::IUnversionedRowsetWriterPtr GetWriter() const;
+
+    //! Returns the next batch of keys.
+    /*!
+     *  Empty batch means that the writer is closed and all keys have already been returned.
+     *  At most one batch may be requested at a time.
+     */
+    TFuture<TSharedRange<NTableClient::TUnversionedRow>> GetNextBatch();
+
+    //! Returns |true| if the writer is closed and all keys have been returned.
+    bool IsExhausted() const;
+
+    //! Propagates the error to both sides.
+    void Fail(const TError& error);
+
+private:
+    class TImpl;
+    const TIntrusivePtr<TImpl> Impl_;
+};
+
+DEFINE_REFCOUNTED_TYPE(TKeyBatcher)
+
+////////////////////////////////////////////////////////////////////////////////
+
+using TLookupReaderFactory = TCallback<NTableClient::ISchemafulUnversionedReaderPtr(
+    TSharedRange<NTableClient::TUnversionedRow> keys)>;
+
+//! Creates a reader that serves rows looked up by #lookupReaderFactory
+//! for batches of keys produced by #keyBatcher, one batch at a time.
+/*!
+ *  #filterReader is the reader of the filtering phase; it is only used to report statistics.
+ *  Destroying the reader fails #keyBatcher, which stops the filtering phase.
+ */
+NTableClient::ISchemafulUnversionedReaderPtr CreateLateMaterializingReader(
+    NTableClient::ISchemafulUnversionedReaderPtr filterReader,
+    TKeyBatcherPtr keyBatcher,
+    TLookupReaderFactory lookupReaderFactory);
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Returns a query that evaluates the WHERE clause of #query over key and predicate columns only
+//! and produces keys of matching rows, or null if late materialization is not beneficial.
+NQueryClient::TQueryPtr BuildLateMaterializationFilterQuery(
+    const NQueryClient::TConstQueryPtr& query,
+    const TQueryAgentConfigPtr& config);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NQueryAgent
@@ -11,6 +11,8 @@ DECLARE_REFCOUNTED_STRUCT(IQuerySubexecutor)
 DECLARE_REFCOUNTED_CLASS(TQueryAgentConfig)
 DECLARE_REFCOUNTED_CLASS(TQueryAgentDynamicConfig)
 
+DECLARE_REFCOUNTED_CLASS(TKeyBatcher)
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NQueryAgent
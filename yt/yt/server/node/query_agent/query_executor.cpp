@@ -1,6 +1,8 @@
 #include "query_executor.h"
 #include "private.h"
 #include "config.h"
+#include "key_predicates.h"
+#include "late_materialization.h"
 
 #include <yt/yt/server/node/cluster_node/config.h>
 
@@ -69,6 +71,8 @@
 
 #include <library/cpp/yt/memory/chunked_memory_pool.h>
 
+#include <util/generic/algorithm.h>
+
 namespace NYT::NQueryClient {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -383,6 +387,9 @@ private:
 
     TClientChunkReadOptions ChunkReadOptions_;
 
+    TFunctionProfilerMapPtr FunctionGenerators_;
+    TAggregateProfilerMapPtr AggregateGenerators_;
+
     using TSubreaderCreator = std::function<ISchemafulUnversionedReaderPtr()>;
 
     void LogSplits(const std::vector<TDataSource>& splits)
@@ -427,6 +434,10 @@ private:
             FunctionImplCache_,
             ChunkReadOptions_);
 
+        // Filtering subqueries of late materialization may reference the same functions.
+        FunctionGenerators_ = functionGenerators;
+        AggregateGenerators_ = aggregateGenerators;
+
         return CoordinateAndExecute(
             Query_,
             Writer_,
@@ -1033,7 +1044,14 @@ private:
             };
 
             reader = CreateUnorderedSchemafulReader(std::move(bottomSplitReaderGenerator), 1);
+        } else if (auto filterQuery = BuildLateMaterializationFilterQuery(Query_, Config_)) {
+            reader = CreateLateMaterializingTabletReader(
+                std::move(tabletSnapshot),
+                std::move(filterQuery),
+                columnFilter,
+                bounds);
         } else {
+            auto keyPredicates = GetKeyPredicates(tabletSnapshot);
             reader = CreateSchemafulSortedTabletReader(
                 std::move(tabletSnapshot),
                 columnFilter,
@@ -1041,7 +1059,8 @@ private:
                 QueryOptions_.TimestampRange,
                 ChunkReadOptions_,
                 ETabletDistributedThrottlerKind::Select,
-                ChunkReadOptions_.WorkloadDescriptor.Category);
+                ChunkReadOptions_.WorkloadDescriptor.Category,
+                std::move(keyPredicates));
         }
 
         return New<TProfilingReaderWrapper>(
@@ -1050,6 +1069,104 @@ private:
             enableDetailedProfiling);
     }
 
+    //! Returns comparisons of key columns with constants from the WHERE clause
+    //! that readers of #tabletSnapshot may use to skip rows early.
+    std::vector<NNewTableClient::TKeyColumnPredicate> GetKeyPredicates(const TTabletSnapshotPtr& tabletSnapshot) const
+    {
+        if (!Config_->EnableKeyPredicatePushdown) {
+            return {};
+        }
+
+        auto keyPredicates = ExtractKeyColumnPredicates(Query_);
+
+        // NB: Predicates over key columns the tablet does not have are ignored.
+        int keyColumnCount = tabletSnapshot->TableSchema->GetKeyColumnCount();
+        EraseIf(keyPredicates, [&] (const auto& predicate) {
+            return predicate.KeyColumnIndex >= keyColumnCount;
+        });
+
+        return keyPredicates;
+    }
+
+    //! Evaluates #filterQuery over #bounds and then looks up the columns of #columnFilter
+    //! for the matching keys, one bounded batch of keys at a time.
+    ISchemafulUnversionedReaderPtr CreateLateMaterializingTabletReader(
+        TTabletSnapshotPtr tabletSnapshot,
+        TQueryPtr filterQuery,
+        const TColumnFilter& columnFilter,
+        const TSharedRange<TRowRange>& bounds)
+    {
+        YT_LOG_DEBUG("Using late materialization (FilterQueryId: %v, ReadColumnCount: %v, FilterColumnCount: %v, KeyBatchSize: %v)",
+            filterQuery->Id,
+            Query_->Schema.Mapping.size(),
+            filterQuery->Schema.Mapping.size(),
+            Config_->LateMaterializationKeyBatchSize);
+
+        auto filterReader = CreateSchemafulSortedTabletReader(
+            tabletSnapshot,
+            GetColumnFilter(*filterQuery->GetReadSchema(), *tabletSnapshot->QuerySchema),
+            bounds,
+            QueryOptions_.TimestampRange,
+            ChunkReadOptions_,
+            ETabletDistributedThrottlerKind::Select,
+            ChunkReadOptions_.WorkloadDescriptor.Category,
+            GetKeyPredicates(tabletSnapshot));
+
+        // Keys are allocated from the query memory chunk provider and are thus tracked.
+        auto keyBatcher = New<TKeyBatcher>(
+            Config_->LateMaterializationKeyBatchSize,
+            MemoryChunkProvider_);
+
+        // Output row limit applies to the final result only.
+        TQueryBaseOptions filterOptions = QueryOptions_;
+        filterOptions.OutputRowLimit = std::numeric_limits<i64>::max();
+
+        BIND(&IEvaluator::Run, Evaluator_)
+            .AsyncVia(Invoker_)
+            .Run(
+                filterQuery,
+                filterReader,
+                keyBatcher->GetWriter(),
+                nullptr,
+                FunctionGenerators_,
+                AggregateGenerators_,
+                MemoryChunkProvider_,
+                filterOptions)
+            .Subscribe(BIND([keyBatcher, filterQueryId = filterQuery->Id, Logger = Logger] (
+                const TErrorOr<TQueryStatistics>& resultOrError)
+            {
+                if (resultOrError.IsOK()) {
+                    YT_LOG_DEBUG("Filtering phase of late materialization completed (FilterQueryId: %v, KeyCount: %v)",
+                        filterQueryId,
+                        resultOrError.Value().RowsWritten);
+                } else {
+                    keyBatcher->Fail(TError("Filtering phase of late materialization failed")
+                        << resultOrError);
+                }
+            }));
+
+        auto lookupReaderFactory = BIND([
+            =,
+            this,
+            this_ = MakeStrong(this),
+            tabletSnapshot = std::move(tabletSnapshot)
+        ] (TSharedRange<TRow> keys) {
+            return CreateSchemafulLookupTabletReader(
+                tabletSnapshot,
+                columnFilter,
+                std::move(keys),
+                QueryOptions_.TimestampRange,
+                ChunkReadOptions_,
+                ETabletDistributedThrottlerKind::Select,
+                ChunkReadOptions_.WorkloadDescriptor.Category);
+        });
+
+        return CreateLateMaterializingReader(
+            std::move(filterReader),
+            std::move(keyBatcher),
+            std::move(lookupReaderFactory));
+    }
+
     ISchemafulUnversionedReaderPtr GetTabletReader(
         TTabletId tabletId,
         const TSharedRange<TRow>& keys)
@@ -182,8 +182,6 @@ public:
 
         ColumnEvaluatorCache_ = NQueryClient::CreateColumnEvaluatorCache(GetConfig()->TabletNode->ColumnEvaluatorCache);
 
-        RowComparerProvider_ = NTabletClient::CreateRowComparerProvider(GetConfig()->TabletNode->ColumnEvaluatorCache->CGCache);
-
         StoreCompactor_ = CreateStoreCompactor(this);
         StoreFlusher_ = CreateStoreFlusher(this);
         StoreRotator_ = CreateStoreRotator(this);
@@ -375,11 +373,6 @@ public:
         return ColumnEvaluatorCache_;
     }
 
-    const NTabletClient::IRowComparerProviderPtr& GetRowComparerProvider() const override
-    {
-        return RowComparerProvider_;
-    }
-
     const IMasterConnectorPtr& GetMasterConnector() const override
     {
         return MasterConnector_;
@@ -426,7 +419,6 @@ private:
     TEnumIndexedVector<ETabletNodeThrottlerKind, IThroughputThrottlerPtr> Throttlers_;
 
     NQueryClient::IColumnEvaluatorCachePtr ColumnEvaluatorCache_;
-    NTabletClient::IRowComparerProviderPtr RowComparerProvider_;
 
     IStoreCompactorPtr StoreCompactor_;
     IStoreFlusherPtr StoreFlusher_;
@@ -56,6 +56,12 @@ struct TCachedRow final
     {
         return NTableClient::TMutableVersionedRow(reinterpret_cast<NTableClient::TVersionedRowHeader*>(&Data[0]));
     }
+
+    //! Returns the number of bytes occupied by the row in the allocator.
+    i64 GetWeight() const
+    {
+        return sizeof(TCachedRow) + Space;
+    }
 };
 
 using TCachedRowPtr = TIntrusivePtr<TCachedRow>;
@@ -29,11 +29,19 @@
 #include <yt/yt/ytlib/chunk_client/chunk_reader_options.h>
 #include <yt/yt/ytlib/chunk_client/chunk_reader_statistics.h>
 #include <yt/yt/ytlib/chunk_client/dispatcher.h>
+#include <yt/yt/ytlib/chunk_client/memory_reader.h>
+#include <yt/yt/ytlib/chunk_client/memory_writer.h>
 
 #include <yt/yt/ytlib/misc/memory_usage_tracker.h>
 #include <yt/yt/ytlib/misc/memory_reference_tracker.h>
 
 #include <yt/yt/ytlib/table_client/chunk_lookup_hash_table.h>
+#include <yt/yt/ytlib/table_client/chunk_state.h>
+#include <yt/yt/ytlib/table_client/versioned_chunk_writer.h>
+
+#include <yt/yt/client/table_client/row_batch.h>
+#include <yt/yt/client/table_client/versioned_reader.h>
+#include <yt/yt/client/table_client/versioned_writer.h>
 
 #include <yt/yt/client/chunk_client/data_statistics.h>
 #include <yt/yt_proto/yt/client/chunk_client/proto/chunk_meta.pb.h>
@@ -72,6 +80,7 @@ using namespace NHydra;
 using namespace NNodeTrackerClient;
 using namespace NTableClient;
 using namespace NTabletClient;
+using namespace NYTree;
 
 using NChunkClient::NProto::TChunkMeta;
 using NChunkClient::NProto::TMiscExt;
@@ -87,6 +96,8 @@ const auto& Logger = TabletNodeLogger;
 
 using TInMemorySessionId = TGuid;
 
+static constexpr int TranscodingRowsPerRead = 1024;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TInMemoryChunkDataPtr CreateInMemoryChunkData(
@@ -168,6 +179,129 @@ TInMemoryChunkDataPtr CreateInMemoryChunkData(
         std::move(blocksWithCategory));
 }
 
+std::optional<TColumnarInMemoryChunk> TryTranscodeInMemoryChunkToColumnar(
+    const TRefCountedChunkMetaPtr& meta,
+    EInMemoryMode mode,
+    int startBlockIndex,
+    const std::vector<TBlock>& blocks,
+    const TTabletSnapshotPtr& tabletSnapshot)
+{
+    const auto& schema = tabletSnapshot->PhysicalSchema;
+    auto format = CheckedEnumCast<EChunkFormat>(meta->format());
+
+    if (mode != EInMemoryMode::Uncompressed ||
+        !tabletSnapshot->Settings.MountConfig->EnableColumnarInMemoryFormat ||
+        !schema->IsSorted() ||
+        schema->HasHunkColumns())
+    {
+        return std::nullopt;
+    }
+
+    if (format != EChunkFormat::TableVersionedSimple &&
+        format != EChunkFormat::TableVersionedIndexed &&
+        format != EChunkFormat::TableVersionedSlim)
+    {
+        return std::nullopt;
+    }
+
+    NProfiling::TWallTimer timer;
+
+    // Blocks are already decompressed.
+    auto uncompressedMeta = New<TRefCountedChunkMeta>(*meta);
+    auto miscExt = GetProtoExtension<TMiscExt>(meta->extensions());
+    miscExt.set_compression_codec(ToProto<int>(NCompression::ECodec::None));
+    SetProtoExtension(uncompressedMeta->mutable_extensions(), miscExt);
+
+    // Blocks preceding #startBlockIndex are never touched since reading is limited by tablet pivot keys.
+    std::vector<TBlock> readerBlocks(startBlockIndex);
+    readerBlocks.insert(readerBlocks.end(), blocks.begin(), blocks.end());
+    auto chunkReader = CreateMemoryReader(uncompressedMeta, std::move(readerBlocks));
+
+    auto chunkState = New<TChunkState>(GetNullBlockCache());
+    chunkState->TableSchema = schema;
+
+    auto reader = CreateVersionedChunkReader(
+        tabletSnapshot->Settings.StoreReaderConfig,
+        std::move(chunkReader),
+        std::move(chunkState),
+        TCachedVersionedChunkMeta::Create(
+            /*prepareColumnarMeta*/ false,
+            /*memoryTracker*/ nullptr,
+            uncompressedMeta),
+        /*chunkReadOptions*/ {},
+        tabletSnapshot->PivotKey,
+        tabletSnapshot->NextPivotKey,
+        TColumnFilter(),
+        AllCommittedTimestamp,
+        /*produceAllVersions*/ true);
+    WaitFor(reader->Open())
+        .ThrowOnError();
+
+    auto chunkWriter = New<TMemoryWriter>();
+
+    auto writerConfig = CloneYsonSerializable(tabletSnapshot->Settings.StoreWriterConfig);
+    writerConfig->WorkloadDescriptor = TWorkloadDescriptor(EWorkloadCategory::SystemTabletPreload);
+    writerConfig->Postprocess();
+
+    auto writerOptions = CloneYsonSerializable(tabletSnapshot->Settings.StoreWriterOptions);
+    writerOptions->OptimizeFor = EOptimizeFor::Scan;
+    writerOptions->CompressionCodec = NCompression::ECodec::None;
+    writerOptions->Postprocess();
+
+    auto writer = CreateVersionedChunkWriter(
+        std::move(writerConfig),
+        std::move(writerOptions),
+        schema,
+        chunkWriter);
+
+    TRowBatchReadOptions readOptions{
+        .MaxRowsPerRead = TranscodingRowsPerRead
+    };
+
+    while (auto batch = reader->Read(readOptions)) {
+        if (batch->IsEmpty()) {
+            WaitFor(reader->GetReadyEvent())
+                .ThrowOnError();
+            continue;
+        }
+
+        if (!writer->Write(batch->MaterializeRows())) {
+            WaitFor(writer->GetReadyEvent())
+                .ThrowOnError();
+        }
+    }
+
+    // NB: This also closes chunkWriter.
+    WaitFor(writer->Close())
+        .ThrowOnError();
+
+    TColumnarInMemoryChunk result{
+        .Meta = chunkWriter->GetChunkMeta(),
+        .Blocks = std::move(chunkWriter->GetBlocks()),
+    };
+
+    i64 oldSize = 0;
+    for (const auto& block : blocks) {
+        oldSize += block.Size();
+    }
+    i64 newSize = 0;
+    for (auto& block : result.Blocks) {
+        newSize += block.Size();
+        block.Data = TSharedRef::MakeCopy<TPreloadedBlockTag>(block.Data);
+    }
+
+    YT_LOG_DEBUG("In-memory chunk transcoded to columnar format "
+        "(%v, Format: %v, RowCount: %v, UncompressedSize: %v, ColumnarSize: %v, ElapsedTime: %v)",
+        tabletSnapshot->LoggingTag,
+        format,
+        writer->GetRowCount(),
+        oldSize,
+        newSize,
+        timer.GetElapsedTime());
+
+    return result;
+}
+
 EBlockType MapInMemoryModeToBlockType(EInMemoryMode mode)
 {
     switch (mode) {
@@ -478,7 +612,6 @@ TInMemoryChunkDataPtr PreloadInMemoryStore(
     }
 
     auto compressionCodecId = CheckedEnumCast<NCompression::ECodec>(miscExt.compression_codec());
-    auto* compressionCodec = NCompression::GetCodec(compressionCodecId);
     auto erasureCodecId = FromProto<NErasure::ECodec>(miscExt.erasure_codec());
 
     auto versionedChunkMeta = TCachedVersionedChunkMeta::Create(
@@ -486,6 +619,9 @@ TInMemoryChunkDataPtr PreloadInMemoryStore(
         /*memoryTracker*/ nullptr,
         meta);
 
+    // NB: Accounts for the compression dictionary; the meta keeps the codec alive.
+    auto* compressionCodec = versionedChunkMeta->GetBlockCodec();
+
     auto blockCount = versionedChunkMeta->DataBlockMeta()->data_blocks_size();
 
     int commonKeyPrefix = GetCommonKeyPrefix(
@@ -649,6 +785,15 @@ TInMemoryChunkDataPtr PreloadInMemoryStore(
     decompressionStatistics.Append(TCodecDuration{compressionCodecId, decompressionTime});
     readerProfiler->SetCodecStatistics(decompressionStatistics);
 
+    if (auto columnarChunk = TryTranscodeInMemoryChunkToColumnar(meta, mode, startBlockIndex, blocks, tabletSnapshot)) {
+        blocks = std::move(columnarChunk->Blocks);
+        startBlockIndex = 0;
+        versionedChunkMeta = TCachedVersionedChunkMeta::Create(
+            /*prepareColumnarMeta*/ false,
+            /*memoryTracker*/ nullptr,
+            columnarChunk->Meta);
+    }
+
     i64 allocatedMemory = 0;
     for (auto& block: blocks) {
         allocatedMemory += block.Size();
@@ -778,7 +923,8 @@ public:
 
     TCachedBlock FindBlock(
         const TBlockId& /* id */,
-        EBlockType /* type */) override
+        EBlockType /* type */,
+        const TWorkloadDescriptor& /* workloadDescriptor */) override
     {
         return TCachedBlock();
     }
@@ -957,7 +1103,8 @@ public:
 
     std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
         const TBlockId& /*id*/,
-        EBlockType /*type*/) override
+        EBlockType /*type*/,
+        const TWorkloadDescriptor& /*workloadDescriptor*/) override
     {
         return CreateActiveCachedBlockCookie();
     }
@@ -62,6 +62,29 @@ TInMemoryChunkDataPtr CreateInMemoryChunkData(
     const INodeMemoryReferenceTrackerPtr& memoryReferenceTracker,
     const IMemoryUsageTrackerPtr& memoryTracker);
 
+struct TColumnarInMemoryChunk
+{
+    NChunkClient::TRefCountedChunkMetaPtr Meta;
+    std::vector<NChunkClient::TBlock> Blocks;
+};
+
+//! Re-encodes an uncompressed chunk in a horizontal versioned format into the columnar one
+//! provided that |enable_columnar_in_memory_format| is set for the tablet; returns null otherwise.
+/*!
+ *  Columnar blocks keep integers bit-packed and strings dictionary-encoded, so they take
+ *  considerably less memory than uncompressed horizontal blocks and are served
+ *  by the columnar lookup and scan readers without any decompression.
+ *
+ *  #blocks start at #startBlockIndex and must contain all rows of the tablet.
+ *  Blocks of the resulting chunk start at zero.
+ */
+std::optional<TColumnarInMemoryChunk> TryTranscodeInMemoryChunkToColumnar(
+    const NChunkClient::TRefCountedChunkMetaPtr& meta,
+    NTabletClient::EInMemoryMode mode,
+    int startBlockIndex,
+    const std::vector<NChunkClient::TBlock>& blocks,
+    const TTabletSnapshotPtr& tabletSnapshot);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 //! Manages in-memory tables served by the node.
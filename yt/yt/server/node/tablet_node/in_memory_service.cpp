@@ -246,22 +246,37 @@ private:
 
                 auto meta = New<TRefCountedChunkMeta>(std::move(*request->mutable_chunk_meta(index)));
 
-                auto versionedChunkMeta = NTableClient::TCachedVersionedChunkMeta::Create(
-                    /*prepareColumnarMeta*/ false,
-                    /*memoryTracker*/ nullptr,
-                    meta);
+                auto asyncResult = BIND([
+                    meta,
+                    chunkId,
+                    tabletSnapshot,
+                    mode = session->GetInMemoryMode(),
+                    blocks = chunkData->Blocks,
+                    memoryReferenceTracker = Bootstrap_->GetNodeMemoryReferenceTracker(),
+                    memoryTracker = Bootstrap_->GetMemoryUsageTracker()->WithCategory(EMemoryCategory::TabletStatic)
+                ] () mutable {
+                    if (auto columnarChunk = TryTranscodeInMemoryChunkToColumnar(meta, mode, 0, blocks, tabletSnapshot)) {
+                        meta = std::move(columnarChunk->Meta);
+                        blocks = std::move(columnarChunk->Blocks);
+                    }
 
-                auto asyncResult = BIND(&CreateInMemoryChunkData)
-                    .AsyncVia(NRpc::TDispatcher::Get()->GetCompressionPoolInvoker())
-                    .Run(
+                    auto versionedChunkMeta = NTableClient::TCachedVersionedChunkMeta::Create(
+                        /*prepareColumnarMeta*/ false,
+                        /*memoryTracker*/ nullptr,
+                        meta);
+
+                    return CreateInMemoryChunkData(
                         chunkId,
-                        session->GetInMemoryMode(),
+                        mode,
                         0,
-                        chunkData->Blocks,
+                        std::move(blocks),
                         versionedChunkMeta,
                         tabletSnapshot,
-                        Bootstrap_->GetNodeMemoryReferenceTracker(),
-                        Bootstrap_->GetMemoryUsageTracker()->WithCategory(EMemoryCategory::TabletStatic))
+                        memoryReferenceTracker,
+                        memoryTracker);
+                })
+                    .AsyncVia(NRpc::TDispatcher::Get()->GetCompressionPoolInvoker())
+                    .Run()
                     .Apply(BIND(&IInMemoryManager::FinalizeChunk, Bootstrap_->GetInMemoryManager(), chunkId));
 
                 asyncResults.push_back(std::move(asyncResult));
@@ -281,6 +281,8 @@ protected:
         counters->CacheOutdated.Increment(CacheOutdated_);
         counters->CacheMisses.Increment(CacheMisses_);
         counters->CacheInserts.Increment(CacheInserts_);
+        counters->CacheAdmissionRejects.Increment(CacheAdmissionRejects_);
+        counters->CacheInsertedDataWeight.Increment(CacheInsertedDataWeight_);
     }
 
     TSharedRange<TUnversionedRow> Initialize(const TSharedRange<TUnversionedRow>& lookupKeys)
@@ -293,7 +295,22 @@ protected:
 
         CacheLookuper_ = RowCache_->GetCache()->GetLookuper();
         CacheInserter_ = RowCache_->GetCache()->GetInserter();
+
+        // Every lookup contributes to key frequencies, including hits;
+        // missed rows are admitted into cache based on these frequencies.
+        AdmissionSketch_ = RowCache_->GetAdmissionSketch();
+        AdmissionFrequency_ = RowCache_->GetAdmissionFrequency();
+        if (AdmissionSketch_) {
+            KeyFingerprints_.reserve(lookupKeys.Size());
+        }
+
         for (auto key : lookupKeys) {
+            if (AdmissionSketch_) {
+                auto fingerprint = THash<TCachedRow>()(key);
+                AdmissionSketch_->Increment(fingerprint);
+                KeyFingerprints_.push_back(fingerprint);
+            }
+
             auto foundItemRef = CacheLookuper_(key);
             auto foundItem = foundItemRef.Get();
 
@@ -435,8 +452,13 @@ protected:
                 cachedItemRef.Update(std::move(cachedItem), cachedItemHead.Get());
             } else {
                 YT_LOG_TRACE("Reinserting row");
-                lookupTable->Insert(std::move(cachedItem));
+                auto weight = cachedItem->GetWeight();
+                lookupTable->Insert(std::move(cachedItem), weight);
             }
+        } else if (!IsAdmittedToCache()) {
+            Merger_.AddPartialRow(RowsFromActiveStore_[WriteRowIndex_], Timestamp_ + 1);
+
+            ++CacheAdmissionRejects_;
         } else {
             Merger_.AddPartialRow(RowsFromActiveStore_[WriteRowIndex_], Timestamp_ + 1);
 
@@ -454,7 +476,7 @@ protected:
                 YT_LOG_TRACE("Populating cache (Row: %v, Revision: %v)",
                     cachedItem->GetVersionedRow(),
                     revision);
-                CacheInserter_.GetTable()->Insert(cachedItem);
+                CacheInserter_.GetTable()->Insert(cachedItem, cachedItem->GetWeight());
 
                 auto flushIndex = RowCache_->GetFlushIndex();
 
@@ -464,6 +486,7 @@ protected:
                 }
 
                 ++CacheInserts_;
+                CacheInsertedDataWeight_ += cachedItem->GetWeight();
             }
         }
 
@@ -617,6 +640,19 @@ private:
     int CacheMisses_ = 0;
     int CacheOutdated_ = 0;
     int CacheInserts_ = 0;
+    int CacheAdmissionRejects_ = 0;
+    i64 CacheInsertedDataWeight_ = 0;
+
+    TFrequencySketchPtr AdmissionSketch_;
+    int AdmissionFrequency_ = 0;
+    // Fingerprints of lookup keys; only filled if admission control is enabled.
+    std::vector<ui64> KeyFingerprints_;
+
+    bool IsAdmittedToCache() const
+    {
+        return !AdmissionSketch_ ||
+            AdmissionSketch_->Estimate(KeyFingerprints_[WriteRowIndex_]) >= AdmissionFrequency_;
+    }
 
     static TTimestamp GetCompactionTimestamp(
         const TTableMountConfigPtr& mountConfig,
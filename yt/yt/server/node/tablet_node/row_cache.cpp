@@ -82,6 +82,39 @@ TSlabAllocator* TRowCache::GetAllocator()
     return &Allocator_;
 }
 
+void TRowCache::ConfigureAdmission(int admissionFrequency, i64 capacity)
+{
+    if (admissionFrequency == 0) {
+        AdmissionFrequency_.store(0, std::memory_order::release);
+        AdmissionSketch_.Reset();
+        return;
+    }
+
+    auto sketch = AdmissionSketch_.Acquire();
+    if (!sketch || capacity > 2 * sketch->GetCapacity() || 2 * capacity < sketch->GetCapacity()) {
+        AdmissionSketch_.Store(New<TFrequencySketch>(capacity));
+    }
+    AdmissionFrequency_.store(admissionFrequency, std::memory_order::release);
+}
+
+TFrequencySketchPtr TRowCache::GetAdmissionSketch() const
+{
+    return AdmissionSketch_.Acquire();
+}
+
+int TRowCache::GetAdmissionFrequency() const
+{
+    return AdmissionFrequency_.load(std::memory_order::acquire);
+}
+
+void TRowCache::SetMaxDataSize(std::optional<i64> maxDataSize)
+{
+    // Rows of the previous lookup table generation stay alive until the next rotation.
+    Cache_.SetWeightLimit(maxDataSize
+        ? std::max<i64>(*maxDataSize / 2, 1)
+        : std::numeric_limits<i64>::max());
+}
+
 ui32 TRowCache::GetFlushIndex() const
 {
     return FlushIndex_.load(std::memory_order::acquire);
@@ -6,6 +6,9 @@
 
 #include <yt/yt/core/misc/slab_allocator.h>
 #include <yt/yt/core/misc/concurrent_cache.h>
+#include <yt/yt/core/misc/frequency_sketch.h>
+
+#include <library/cpp/yt/memory/atomic_intrusive_ptr.h>
 
 namespace NYT::NTabletNode {
 
@@ -26,6 +29,17 @@ public:
 
     TSlabAllocator* GetAllocator();
 
+    //! Enables TinyLFU-style admission of missed rows if #admissionFrequency is positive.
+    //! The frequency sketch is resized when #capacity changes significantly.
+    void ConfigureAdmission(int admissionFrequency, i64 capacity);
+
+    //! Returns null if admission control is disabled.
+    TFrequencySketchPtr GetAdmissionSketch() const;
+    int GetAdmissionFrequency() const;
+
+    //! Limits the total weight of cached rows.
+    void SetMaxDataSize(std::optional<i64> maxDataSize);
+
     ui32 GetFlushIndex() const;
     void SetFlushIndex(ui32 storeFlushIndex);
 
@@ -50,6 +64,9 @@ private:
     TSlabAllocator Allocator_;
     TConcurrentCache<TCachedRow> Cache_;
 
+    TAtomicIntrusivePtr<TFrequencySketch> AdmissionSketch_;
+    std::atomic<int> AdmissionFrequency_ = 0;
+
     // Rows with revision less than FlushIndex are considered outdated.
     std::atomic<ui32> FlushIndex_ = 0;
 };
@@ -29,6 +29,7 @@
 #include <yt/yt/ytlib/table_client/chunk_meta_extensions.h>
 #include <yt/yt/ytlib/table_client/chunk_state.h>
 #include <yt/yt/ytlib/table_client/indexed_versioned_chunk_reader.h>
+#include <yt/yt/ytlib/table_client/key_filter.h>
 #include <yt/yt/ytlib/table_client/versioned_offloading_reader.h>
 #include <yt/yt/ytlib/table_client/versioned_chunk_reader.h>
 #include <yt/yt/ytlib/table_client/versioned_reader_adapter.h>
@@ -181,6 +182,102 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////
 
+//! Interleaves rows of the underlying reader (which is only given keys that passed
+//! the key filter) with null rows for keys rejected by the filter.
+class TKeyFilteringReader
+    : public IVersionedReader
+{
+public:
+    TKeyFilteringReader(
+        IVersionedReaderPtr underlyingReader,
+        std::vector<bool> keyFilterMask)
+        : UnderlyingReader_(std::move(underlyingReader))
+        , KeyFilterMask_(std::move(keyFilterMask))
+    { }
+
+    TDataStatistics GetDataStatistics() const override
+    {
+        return UnderlyingReader_->GetDataStatistics();
+    }
+
+    TCodecStatistics GetDecompressionStatistics() const override
+    {
+        return UnderlyingReader_->GetDecompressionStatistics();
+    }
+
+    TFuture<void> Open() override
+    {
+        return UnderlyingReader_->Open();
+    }
+
+    TFuture<void> GetReadyEvent() const override
+    {
+        if (KeyIndex_ < std::ssize(KeyFilterMask_) && !KeyFilterMask_[KeyIndex_]) {
+            return VoidFuture;
+        }
+
+        return UnderlyingReader_->GetReadyEvent();
+    }
+
+    bool IsFetchingCompleted() const override
+    {
+        return UnderlyingReader_->IsFetchingCompleted();
+    }
+
+    std::vector<NChunkClient::TChunkId> GetFailedChunkIds() const override
+    {
+        return UnderlyingReader_->GetFailedChunkIds();
+    }
+
+    IVersionedRowBatchPtr Read(const TRowBatchReadOptions& options) override
+    {
+        if (KeyIndex_ == std::ssize(KeyFilterMask_)) {
+            return nullptr;
+        }
+
+        std::vector<TVersionedRow> rows;
+
+        // Serve keys rejected by the filter without touching the underlying reader.
+        while (KeyIndex_ < std::ssize(KeyFilterMask_) &&
+            !KeyFilterMask_[KeyIndex_] &&
+            std::ssize(rows) < options.MaxRowsPerRead)
+        {
+            rows.push_back(TVersionedRow());
+            ++KeyIndex_;
+        }
+
+        if (!rows.empty()) {
+            return CreateBatchFromVersionedRows(MakeSharedRange(std::move(rows)));
+        }
+
+        auto batch = UnderlyingReader_->Read(options);
+        if (!batch || batch->IsEmpty()) {
+            return batch;
+        }
+
+        auto underlyingRows = batch->MaterializeRows();
+        rows.reserve(underlyingRows.size());
+        for (auto row : underlyingRows) {
+            while (!KeyFilterMask_[KeyIndex_]) {
+                rows.push_back(TVersionedRow());
+                ++KeyIndex_;
+            }
+            rows.push_back(row);
+            ++KeyIndex_;
+        }
+
+        return CreateBatchFromVersionedRows(MakeSharedRange(std::move(rows), std::move(underlyingRows)));
+    }
+
+private:
+    const IVersionedReaderPtr UnderlyingReader_;
+    const std::vector<bool> KeyFilterMask_;
+
+    i64 KeyIndex_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 TSortedChunkStore::TSortedChunkStore(
     TTabletManagerConfigPtr config,
     TStoreId id,
@@ -285,6 +382,27 @@ IVersionedReaderPtr TSortedChunkStore::CreateReader(
     const TColumnFilter& columnFilter,
     const TClientChunkReadOptions& chunkReadOptions,
     std::optional<EWorkloadCategory> workloadCategory)
+{
+    return CreateReader(
+        tabletSnapshot,
+        std::move(ranges),
+        /*keyPredicates*/ {},
+        timestamp,
+        produceAllVersions,
+        columnFilter,
+        chunkReadOptions,
+        workloadCategory);
+}
+
+IVersionedReaderPtr TSortedChunkStore::CreateReader(
+    const TTabletSnapshotPtr& tabletSnapshot,
+    TSharedRange<TRowRange> ranges,
+    std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates,
+    TTimestamp timestamp,
+    bool produceAllVersions,
+    const TColumnFilter& columnFilter,
+    const TClientChunkReadOptions& chunkReadOptions,
+    std::optional<EWorkloadCategory> workloadCategory)
 {
     VERIFY_THREAD_AFFINITY_ANY();
 
@@ -308,6 +426,7 @@ IVersionedReaderPtr TSortedChunkStore::CreateReader(
     // Fast lane: check for in-memory reads.
     if (auto reader = TryCreateCacheBasedReader(
         ranges,
+        keyPredicates,
         timestamp,
         produceAllVersions,
         columnFilter,
@@ -368,7 +487,10 @@ IVersionedReaderPtr TSortedChunkStore::CreateReader(
             GetCurrentInvoker());
 
         return MaybeWrapWithTimestampResettingAdapter(NNewTableClient::CreateVersionedChunkReader(
-            std::move(ranges),
+            NNewTableClient::TRowRangesWithPredicates{
+                .Ranges = std::move(ranges),
+                .Predicates = std::move(keyPredicates),
+            },
             timestamp,
             chunkMeta,
             Schema_,
@@ -398,6 +520,7 @@ IVersionedReaderPtr TSortedChunkStore::CreateReader(
 
 IVersionedReaderPtr TSortedChunkStore::TryCreateCacheBasedReader(
     TSharedRange<TRowRange> ranges,
+    std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates,
     TTimestamp timestamp,
     bool produceAllVersions,
     const TColumnFilter& columnFilter,
@@ -428,7 +551,10 @@ IVersionedReaderPtr TSortedChunkStore::TryCreateCacheBasedReader(
             ChunkId_);
 
         return NNewTableClient::CreateVersionedChunkReader(
-            std::move(ranges),
+            NNewTableClient::TRowRangesWithPredicates{
+                .Ranges = std::move(ranges),
+                .Predicates = std::move(keyPredicates),
+            },
             timestamp,
             chunkMeta,
             Schema_,
@@ -478,10 +604,18 @@ IVersionedReaderPtr TSortedChunkStore::CreateReader(
         return CreateEmptyVersionedReader(keys.Size());
     }
 
+    // Nonempty iff some of #filteredKeys were rejected by the chunk key filter.
+    std::vector<bool> keyFilterMask;
+
     auto wrapReader = [&] (
         IVersionedReaderPtr underlyingReader,
         bool needSetTimestamp) -> IVersionedReaderPtr
     {
+        if (!keyFilterMask.empty()) {
+            underlyingReader = CreateKeyFilteringReader(
+                std::move(underlyingReader),
+                std::move(keyFilterMask));
+        }
         if (skippedBefore > 0 || skippedAfter > 0) {
             underlyingReader = New<TFilteringReader>(
                 std::move(underlyingReader),
@@ -554,6 +688,16 @@ IVersionedReaderPtr TSortedChunkStore::CreateReader(
 
     ValidateBlockSize(tabletSnapshot, chunkState, chunkReadOptions.WorkloadDescriptor);
 
+    if (mountConfig->EnableKeyFilterForLookup && chunkMeta->KeyFilter()) {
+        auto keyCount = filteredKeys.Size();
+        filteredKeys = FilterKeysByKeyFilter(chunkMeta->KeyFilter(), filteredKeys, &keyFilterMask);
+        PerformanceCounters_->StaticChunkRowLookupTrueNegativeCount += keyCount - filteredKeys.Size();
+
+        if (filteredKeys.Empty()) {
+            return CreateEmptyVersionedReader(keys.Size());
+        }
+    }
+
     if (mountConfig->EnableHashChunkIndexForLookup && chunkMeta->HashTableChunkIndexMeta()) {
         auto controller = CreateChunkIndexReadController(
             ChunkId_,
@@ -872,6 +1016,42 @@ TSharedRange<TLegacyKey> FilterKeysByReadRange(
     return keys.Slice(begin, end);
 }
 
+TSharedRange<TLegacyKey> FilterKeysByKeyFilter(
+    const TKeyFilterPtr& keyFilter,
+    const TSharedRange<TLegacyKey>& keys,
+    std::vector<bool>* keyFilterMask)
+{
+    std::vector<TLegacyKey> maybePresentKeys;
+    maybePresentKeys.reserve(keys.Size());
+
+    std::vector<bool> mask;
+    mask.reserve(keys.Size());
+
+    for (auto key : keys) {
+        bool maybePresent = keyFilter->Contains(key);
+        mask.push_back(maybePresent);
+        if (maybePresent) {
+            maybePresentKeys.push_back(key);
+        }
+    }
+
+    if (maybePresentKeys.size() == keys.Size()) {
+        return keys;
+    }
+
+    *keyFilterMask = std::move(mask);
+    return MakeSharedRange(std::move(maybePresentKeys), keys);
+}
+
+IVersionedReaderPtr CreateKeyFilteringReader(
+    IVersionedReaderPtr underlyingReader,
+    std::vector<bool> keyFilterMask)
+{
+    return New<TKeyFilteringReader>(
+        std::move(underlyingReader),
+        std::move(keyFilterMask));
+}
+
 TSharedRange<NTableClient::TRowRange> FilterRowRangesByReadRange(
     const NTableClient::TRowRange& readRange,
     const TSharedRange<NTableClient::TRowRange>& ranges)
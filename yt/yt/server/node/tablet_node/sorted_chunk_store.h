@@ -7,6 +7,10 @@
 
 #include <yt/yt/ytlib/node_tracker_client/public.h>
 
+#include <yt/yt/ytlib/table_client/public.h>
+
+#include <yt/yt/ytlib/new_table_client/public.h>
+
 #include <yt/yt/client/chunk_client/read_limit.h>
 
 #include <yt/yt/client/table_client/unversioned_row.h>
@@ -57,6 +61,21 @@ public:
         const NChunkClient::TClientChunkReadOptions& chunkReadOptions,
         std::optional<EWorkloadCategory> workloadCategory) override;
 
+    //! Same as the range reader above but also skips rows whose keys do not satisfy #keyPredicates.
+    /*!
+     *  Predicates are only applied by the new columnar scan reader and are ignored otherwise,
+     *  so the caller must still evaluate them.
+     */
+    NTableClient::IVersionedReaderPtr CreateReader(
+        const TTabletSnapshotPtr& tabletSnapshot,
+        TSharedRange<NTableClient::TRowRange> bounds,
+        std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates,
+        TTimestamp timestamp,
+        bool produceAllVersions,
+        const TColumnFilter& columnFilter,
+        const NChunkClient::TClientChunkReadOptions& chunkReadOptions,
+        std::optional<EWorkloadCategory> workloadCategory);
+
     NTableClient::IVersionedReaderPtr CreateReader(
         const TTabletSnapshotPtr& tabletSnapshot,
         const TSharedRange<TLegacyKey>& keys,
@@ -105,6 +124,7 @@ private:
         bool enableNewScanReader);
     NTableClient::IVersionedReaderPtr TryCreateCacheBasedReader(
         TSharedRange<NTableClient::TRowRange> bounds,
+        std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates,
         TTimestamp timestamp,
         bool produceAllVersions,
         const TColumnFilter& columnFilter,
@@ -146,6 +166,19 @@ TSharedRange<TLegacyKey> FilterKeysByReadRange(
     int* skippedBefore,
     int* skippedAfter);
 
+//! Returns the subset of |keys| that may be present in the chunk according to |keyFilter|.
+//! Unless all keys pass, |keyFilterMask| is filled with per-key filter outcomes.
+TSharedRange<TLegacyKey> FilterKeysByKeyFilter(
+    const NTableClient::TKeyFilterPtr& keyFilter,
+    const TSharedRange<TLegacyKey>& keys,
+    std::vector<bool>* keyFilterMask);
+
+//! Wraps |underlyingReader| that is only given the keys passed by the key filter
+//! (see #FilterKeysByKeyFilter); keys rejected according to |keyFilterMask| are answered with null rows.
+NTableClient::IVersionedReaderPtr CreateKeyFilteringReader(
+    NTableClient::IVersionedReaderPtr underlyingReader,
+    std::vector<bool> keyFilterMask);
+
 //! Returns the slice of |ranges| having non-empty intersection with the half-interval |readRange|.
 TSharedRange<NTableClient::TRowRange> FilterRowRangesByReadRange(
     const NTableClient::TRowRange& readRange,
@@ -742,6 +742,7 @@ public:
             MaxRevision,
             columnFilter)
         , Keys_(keys)
+        , RowsFinger_(Store_->Rows_.get())
     { }
 
     TFuture<void> Open() override
@@ -757,11 +758,12 @@ public:
     IVersionedRowBatchPtr Read(const TRowBatchReadOptions& options) override
     {
         YT_ASSERT(options.MaxRowsPerRead > 0);
+        auto rowLimit = std::min(
+            std::ssize(Keys_) - RowCount_,
+            options.MaxRowsPerRead);
+
         std::vector<TVersionedRow> rows;
-        rows.reserve(
-            std::min(
-                std::ssize(Keys_) - RowCount_,
-                options.MaxRowsPerRead));
+        rows.reserve(rowLimit);
         Pool_.Clear();
 
         if (Finished_) {
@@ -770,24 +772,32 @@ public:
 
         i64 dataWeight = 0;
 
-        while (rows.size() < rows.capacity()) {
-            YT_VERIFY(RowCount_ < std::ssize(Keys_));
-
-            TVersionedRow row;
-            if (Y_LIKELY(Store_->LookupHashTable_)) {
-                auto dynamicRow = Store_->LookupHashTable_->Find(Keys_[RowCount_]);
+        // Keys are resolved in windows: all rows of a window are found and prefetched first,
+        // so that fetching row data overlaps with searching for subsequent keys.
+        while (std::ssize(rows) < rowLimit) {
+            auto windowSize = std::min({
+                LookupWindowSize,
+                rowLimit - std::ssize(rows),
+                std::ssize(Keys_) - RowCount_});
+            YT_VERIFY(windowSize > 0);
+
+            for (i64 index = 0; index < windowSize; ++index) {
+                auto dynamicRow = FindRow(Keys_[RowCount_ + index]);
                 if (dynamicRow) {
-                    row = ProduceRow(dynamicRow);
+                    Y_PREFETCH_READ(dynamicRow.GetHeader(), 3);
                 }
-            } else {
-                auto iterator = Store_->Rows_->FindEqualTo(ToKeyRef(Keys_[RowCount_]));
-                if (iterator.IsValid()) {
-                    row = ProduceRow(iterator.GetCurrent());
+                WindowRows_[index] = dynamicRow;
+            }
+
+            for (i64 index = 0; index < windowSize; ++index) {
+                TVersionedRow row;
+                if (auto dynamicRow = WindowRows_[index]) {
+                    row = ProduceRow(dynamicRow);
                 }
+                rows.push_back(row);
+                dataWeight += GetDataWeight(row);
             }
-            rows.push_back(row);
-            ++RowCount_;
-            dataWeight += GetDataWeight(row);
+            RowCount_ += windowSize;
         }
 
         if (rows.empty()) {
@@ -826,11 +836,27 @@ public:
     }
 
 private:
+    static constexpr i64 LookupWindowSize = 32;
+
     const TSharedRange<TLegacyKey> Keys_;
     i64 RowCount_  = 0;
     i64 DataWeight_ = 0;
     bool Finished_ = false;
 
+    //! Lookup keys usually come sorted, so consecutive skip list searches resume from the previous position.
+    TSkipList<TSortedDynamicRow, TSortedDynamicRowKeyComparer>::TFinger RowsFinger_;
+    std::array<TSortedDynamicRow, LookupWindowSize> WindowRows_;
+
+    TSortedDynamicRow FindRow(TLegacyKey key)
+    {
+        if (Y_LIKELY(Store_->LookupHashTable_)) {
+            return Store_->LookupHashTable_->Find(key);
+        }
+
+        auto iterator = RowsFinger_.FindEqualTo(ToKeyRef(key));
+        return iterator.IsValid() ? iterator.GetCurrent() : TSortedDynamicRow();
+    }
+
     TVersionedRow ProduceRow(const TSortedDynamicRow& dynamicRow)
     {
         return ProduceAllVersions_
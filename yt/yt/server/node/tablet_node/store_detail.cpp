@@ -712,7 +712,8 @@ public:
 
     TCachedBlock FindBlock(
         const TBlockId& id,
-        EBlockType type) override
+        EBlockType type,
+        const TWorkloadDescriptor& workloadDescriptor) override
     {
         if (Any(type & GetSupportedBlockTypes())) {
             YT_ASSERT(id.ChunkId == ChunkId_);
@@ -734,7 +735,7 @@ public:
             YT_VERIFY(blockIndex >= 0 && blockIndex < std::ssize(ChunkData_->Blocks));
             return CreatePresetCachedBlockCookie(TCachedBlock(ChunkData_->Blocks[blockIndex]));
         } else {
-            return UnderlyingCache_->GetBlockCookie(id, type);
+            return UnderlyingCache_->GetBlockCookie(id, type, workloadDescriptor);
         }
     }
 
@@ -1749,6 +1749,10 @@ void TTablet::ReconfigureRowCache(const ITabletSlotPtr& slot)
     }
 
     RowCache_->GetCache()->SetCapacity(lookupCacheCapacity);
+    RowCache_->ConfigureAdmission(
+        Settings_.MountConfig->LookupCacheAdmissionFrequency,
+        lookupCacheCapacity);
+    RowCache_->SetMaxDataSize(Settings_.MountConfig->LookupCacheMaxDataSize);
 }
 
 void TTablet::InvalidateChunkReaders()
@@ -2273,8 +2277,11 @@ void TTablet::UpdateUnmergedRowCount()
                 unmergedRowCount += ActiveStore_->GetRowCount();
             }
 
-            i64 lookupCacheCapacity = lookupCacheRowsRatio * unmergedRowCount;
-            RowCache_->GetCache()->SetCapacity(std::max<i64>(lookupCacheCapacity, 1));
+            i64 lookupCacheCapacity = std::max<i64>(lookupCacheRowsRatio * unmergedRowCount, 1);
+            RowCache_->GetCache()->SetCapacity(lookupCacheCapacity);
+            RowCache_->ConfigureAdmission(
+                Settings_.MountConfig->LookupCacheAdmissionFrequency,
+                lookupCacheCapacity);
         }
     }
 }
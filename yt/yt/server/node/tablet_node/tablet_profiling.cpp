@@ -53,6 +53,8 @@ TLookupCounters::TLookupCounters(
     , CacheOutdated(profiler.Counter("/lookup/cache_outdated"))
     , CacheMisses(profiler.Counter("/lookup/cache_misses"))
     , CacheInserts(profiler.Counter("/lookup/cache_inserts"))
+    , CacheAdmissionRejects(profiler.Counter("/lookup/cache_admission_rejects"))
+    , CacheInsertedDataWeight(profiler.Counter("/lookup/cache_inserted_data_weight"))
     , RowCount(profiler.Counter("/lookup/row_count"))
     , MissingKeyCount(profiler.Counter("/lookup/missing_key_count"))
     , DataWeight(profiler.Counter("/lookup/data_weight"))
@@ -37,6 +37,8 @@ struct TLookupCounters
     NProfiling::TCounter CacheOutdated;
     NProfiling::TCounter CacheMisses;
     NProfiling::TCounter CacheInserts;
+    NProfiling::TCounter CacheAdmissionRejects;
+    NProfiling::TCounter CacheInsertedDataWeight;
 
     NProfiling::TCounter RowCount;
     NProfiling::TCounter MissingKeyCount;
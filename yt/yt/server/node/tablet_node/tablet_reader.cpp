@@ -2,6 +2,7 @@
 #include "private.h"
 #include "partition.h"
 #include "store.h"
+#include "sorted_chunk_store.h"
 #include "tablet.h"
 #include "tablet_slot.h"
 #include "bootstrap.h"
@@ -241,7 +242,8 @@ ISchemafulUnversionedReaderPtr CreateSchemafulSortedTabletReader(
     TReadTimestampRange timestampRange,
     const TClientChunkReadOptions& chunkReadOptions,
     std::optional<ETabletDistributedThrottlerKind> tabletThrottlerKind,
-    std::optional<EWorkloadCategory> workloadCategory)
+    std::optional<EWorkloadCategory> workloadCategory,
+    std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates)
 {
     auto timestamp = timestampRange.Timestamp;
     ValidateTabletRetainedTimestamp(tabletSnapshot, timestamp);
@@ -302,7 +304,8 @@ ISchemafulUnversionedReaderPtr CreateSchemafulSortedTabletReader(
     }
 
     YT_LOG_DEBUG("Creating schemaful sorted tablet reader (TabletId: %v, CellId: %v, Timestamp: %v, "
-        "LowerBound: %v, UpperBound: %v, WorkloadDescriptor: %v, ReadSessionId: %v, StoreIds: %v, StoreRanges: %v, BoundCount: %v)",
+        "LowerBound: %v, UpperBound: %v, WorkloadDescriptor: %v, ReadSessionId: %v, StoreIds: %v, StoreRanges: %v, BoundCount: %v, "
+        "KeyPredicateCount: %v)",
         tabletSnapshot->TabletId,
         tabletSnapshot->CellId,
         timestamp,
@@ -312,7 +315,8 @@ ISchemafulUnversionedReaderPtr CreateSchemafulSortedTabletReader(
         chunkReadOptions.ReadSessionId,
         MakeFormattableView(stores, TStoreIdFormatter()),
         MakeFormattableView(stores, TStoreRangeFormatter()),
-        bounds.Size());
+        bounds.Size(),
+        keyPredicates.size());
 
     auto rowMerger = std::make_unique<TSchemafulRowMerger>(
         New<TRowBuffer>(TTabletReaderPoolTag()),
@@ -334,11 +338,27 @@ ISchemafulUnversionedReaderPtr CreateSchemafulSortedTabletReader(
         [
             =,
             stores = std::move(stores),
-            boundsPerStore = std::move(boundsPerStore)
+            boundsPerStore = std::move(boundsPerStore),
+            keyPredicates = std::move(keyPredicates)
         ] (int index) {
             YT_ASSERT(index < std::ssize(stores));
 
-            return stores[index]->CreateReader(
+            const auto& store = stores[index];
+            // NB: Only chunk stores read with the new columnar reader are able to apply key predicates;
+            // the rest of the stores return all rows and the query filters them anyway.
+            if (!keyPredicates.empty() && store->GetType() == EStoreType::SortedChunk) {
+                return store->AsSortedChunk()->CreateReader(
+                    tabletSnapshot,
+                    boundsPerStore[index],
+                    keyPredicates,
+                    timestamp,
+                    false,
+                    columnFilter,
+                    chunkReadOptions,
+                    workloadCategory);
+            }
+
+            return store->CreateReader(
                 tabletSnapshot,
                 boundsPerStore[index],
                 timestamp,
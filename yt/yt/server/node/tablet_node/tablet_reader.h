@@ -4,6 +4,8 @@
 
 #include <yt/yt/ytlib/table_client/public.h>
 
+#include <yt/yt/ytlib/new_table_client/public.h>
+
 #include <yt/yt/ytlib/tablet_client/helpers.h>
 
 #include <yt/yt/core/actions/public.h>
@@ -44,7 +46,8 @@ NTableClient::ISchemafulUnversionedReaderPtr CreateSchemafulSortedTabletReader(
     NTransactionClient::TReadTimestampRange timestampRange,
     const NChunkClient::TClientChunkReadOptions& chunkReadOptions,
     std::optional<ETabletDistributedThrottlerKind> tabletThrottlerKind,
-    std::optional<EWorkloadCategory> workloadCategory);
+    std::optional<EWorkloadCategory> workloadCategory,
+    std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates = {});
 
 //! Creates a range reader that handles ordered stores.
 /*!
@@ -0,0 +1,404 @@
+#include <yt/yt/server/node/tablet_node/in_memory_manager.h>
+#include <yt/yt/server/node/tablet_node/tablet.h>
+
+#include <yt/yt/server/lib/tablet_node/config.h>
+#include <yt/yt/server/lib/tablet_node/table_settings.h>
+
+#include <yt/yt/ytlib/chunk_client/client_block_cache.h>
+#include <yt/yt/ytlib/chunk_client/memory_reader.h>
+#include <yt/yt/ytlib/chunk_client/memory_writer.h>
+#include <yt/yt/ytlib/chunk_client/preloaded_block_cache.h>
+
+#include <yt/yt/ytlib/table_client/cache_based_versioned_chunk_reader.h>
+#include <yt/yt/ytlib/table_client/cached_versioned_chunk_meta.h>
+#include <yt/yt/ytlib/table_client/chunk_column_mapping.h>
+#include <yt/yt/ytlib/table_client/chunk_lookup_hash_table.h>
+#include <yt/yt/ytlib/table_client/chunk_state.h>
+#include <yt/yt/ytlib/table_client/config.h>
+#include <yt/yt/ytlib/table_client/versioned_chunk_reader.h>
+#include <yt/yt/ytlib/table_client/versioned_chunk_writer.h>
+
+#include <yt/yt/ytlib/new_table_client/versioned_chunk_reader.h>
+
+#include <yt/yt/client/table_client/helpers.h>
+#include <yt/yt/client/table_client/row_batch.h>
+#include <yt/yt/client/table_client/versioned_reader.h>
+#include <yt/yt/client/table_client/versioned_writer.h>
+
+#include <yt/yt/core/test_framework/framework.h>
+
+namespace NYT::NTabletNode {
+namespace {
+
+using namespace NChunkClient;
+using namespace NTableClient;
+using namespace NTabletClient;
+using namespace NTransactionClient;
+
+////////////////////////////////////////////////////////////////////////////////
+
+const TTableSchemaPtr Schema = New<TTableSchema>(std::vector{
+    TColumnSchema("k", EValueType::Int64).SetSortOrder(ESortOrder::Ascending),
+    TColumnSchema("v", EValueType::Int64),
+    TColumnSchema("s", EValueType::String),
+});
+
+constexpr int RowCount = 2000;
+
+//! Only even keys are present in the chunk.
+TString MakeKeyYson(int index)
+{
+    return Format("<id=0> %v", 2 * index);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TColumnarInMemoryChunkTest
+    : public ::testing::TestWithParam<EChunkFormat>
+{
+protected:
+    const TChunkId ChunkId_ = TChunkId::Create();
+
+    TRefCountedChunkMetaPtr Meta_;
+    std::vector<TBlock> Blocks_;
+
+    void SetUp() override
+    {
+        auto memoryWriter = New<TMemoryWriter>();
+
+        auto config = New<TChunkWriterConfig>();
+        config->BlockSize = 1_KB;
+        config->Postprocess();
+
+        auto options = New<TChunkWriterOptions>();
+        options->OptimizeFor = EOptimizeFor::Lookup;
+        options->ChunkFormat = GetParam();
+        options->CompressionCodec = NCompression::ECodec::None;
+        options->Postprocess();
+
+        auto writer = CreateVersionedChunkWriter(config, options, Schema, memoryWriter);
+
+        auto rowBuffer = New<TRowBuffer>();
+        std::vector<TVersionedRow> rows;
+        for (int index = 0; index < RowCount; ++index) {
+            // Strings repeat to make dictionary encoding worthwhile; some rows have several versions
+            // and some are deleted.
+            auto valueYson = Format("<id=1;ts=100> %v; <id=2;ts=100> \"value_%v\"", index, index % 7);
+            if (index % 3 == 0) {
+                valueYson += Format("; <id=1;ts=200> %v", -index);
+            }
+            std::vector<TTimestamp> deleteTimestamps;
+            if (index % 5 == 0) {
+                deleteTimestamps.push_back(150);
+            }
+            rows.push_back(YsonToVersionedRow(rowBuffer, MakeKeyYson(index), valueYson, deleteTimestamps));
+        }
+
+        EXPECT_TRUE(writer->Write(rows));
+        EXPECT_TRUE(writer->Close().Get().IsOK());
+
+        Meta_ = memoryWriter->GetChunkMeta();
+        Blocks_ = memoryWriter->GetBlocks();
+
+        ASSERT_GT(std::ssize(Blocks_), 2);
+        ASSERT_EQ(GetParam(), GetChunkMeta(Meta_)->GetChunkFormat());
+    }
+
+    static TCachedVersionedChunkMetaPtr GetChunkMeta(const TRefCountedChunkMetaPtr& meta)
+    {
+        return TCachedVersionedChunkMeta::Create(
+            /*prepareColumnarMeta*/ false,
+            /*memoryTracker*/ nullptr,
+            meta);
+    }
+
+    static TTabletSnapshotPtr CreateTabletSnapshot(
+        TLegacyOwningKey pivotKey = MinKey(),
+        TLegacyOwningKey nextPivotKey = MaxKey())
+    {
+        auto tabletSnapshot = New<TTabletSnapshot>();
+        tabletSnapshot->LoggingTag = "TabletId: test";
+        tabletSnapshot->Settings = TTableSettings::CreateNew();
+        tabletSnapshot->Settings.MountConfig->InMemoryMode = EInMemoryMode::Uncompressed;
+        tabletSnapshot->Settings.MountConfig->EnableColumnarInMemoryFormat = true;
+        tabletSnapshot->PhysicalSchema = Schema;
+        tabletSnapshot->PivotKey = std::move(pivotKey);
+        tabletSnapshot->NextPivotKey = std::move(nextPivotKey);
+        tabletSnapshot->HashTableSize = RowCount;
+        return tabletSnapshot;
+    }
+
+    //! Returns the range of blocks the preload would fetch for the given pivot keys.
+    std::pair<int, int> GetPreloadedBlockRange(
+        const TLegacyOwningKey& pivotKey,
+        const TLegacyOwningKey& nextPivotKey) const
+    {
+        const auto& blockLastKeys = GetChunkMeta(Meta_)->BlockLastKeys();
+        int blockCount = std::ssize(blockLastKeys);
+
+        // Block range is only deduced for simple chunks, see PreloadInMemoryStore.
+        if (GetParam() != EChunkFormat::TableVersionedSimple) {
+            return {0, blockCount};
+        }
+
+        int startBlockIndex = 0;
+        while (startBlockIndex < blockCount && CompareRows(blockLastKeys[startBlockIndex], pivotKey) < 0) {
+            ++startBlockIndex;
+        }
+
+        int endBlockIndex = startBlockIndex;
+        while (endBlockIndex < blockCount && CompareRows(blockLastKeys[endBlockIndex], nextPivotKey) < 0) {
+            ++endBlockIndex;
+        }
+
+        return {startBlockIndex, std::min(endBlockIndex + 1, blockCount)};
+    }
+
+    static std::vector<TString> ReadAll(const IVersionedReaderPtr& reader)
+    {
+        EXPECT_TRUE(reader->Open().Get().IsOK());
+
+        std::vector<TString> rows;
+        while (auto batch = reader->Read()) {
+            if (batch->IsEmpty()) {
+                EXPECT_TRUE(reader->GetReadyEvent().Get().IsOK());
+                continue;
+            }
+            for (auto row : batch->MaterializeRows()) {
+                rows.push_back(ToString(row));
+            }
+        }
+        return rows;
+    }
+
+    //! Reads rows of a chunk within [#lowerKey, #upperKey).
+    /*!
+     *  #blocks start at #startBlockIndex, as they do for in-memory chunk data.
+     */
+    static std::vector<TString> ReadRange(
+        const TRefCountedChunkMetaPtr& meta,
+        int startBlockIndex,
+        const std::vector<TBlock>& blocks,
+        TLegacyOwningKey lowerKey = MinKey(),
+        TLegacyOwningKey upperKey = MaxKey())
+    {
+        std::vector<TBlock> readerBlocks(startBlockIndex);
+        readerBlocks.insert(readerBlocks.end(), blocks.begin(), blocks.end());
+
+        auto chunkState = New<TChunkState>(GetNullBlockCache());
+        chunkState->TableSchema = Schema;
+
+        return ReadAll(CreateVersionedChunkReader(
+            TChunkReaderConfig::GetDefault(),
+            CreateMemoryReader(meta, std::move(readerBlocks)),
+            chunkState,
+            GetChunkMeta(meta),
+            /*chunkReadOptions*/ {},
+            std::move(lowerKey),
+            std::move(upperKey),
+            TColumnFilter(),
+            AllCommittedTimestamp,
+            /*produceAllVersions*/ true));
+    }
+
+    //! Looks up #keys in the original horizontal chunk via the cache-based reader,
+    //! using the lookup hash table if the format supports it.
+    std::vector<TString> LookupOriginal(
+        int startBlockIndex,
+        const std::vector<TBlock>& blocks,
+        const TSharedRange<TLegacyKey>& keys,
+        bool useLookupHashTable)
+    {
+        auto chunkMeta = GetChunkMeta(Meta_);
+
+        std::vector<TBlock> cachedBlocks(startBlockIndex);
+        cachedBlocks.insert(cachedBlocks.end(), blocks.begin(), blocks.end());
+
+        auto chunkState = New<TChunkState>(GetPreloadedBlockCache(ChunkId_, cachedBlocks));
+        chunkState->TableSchema = Schema;
+        chunkState->ChunkColumnMapping = New<TChunkColumnMapping>(Schema, chunkMeta->GetChunkSchema());
+        chunkState->PerformanceCounters = New<TChunkReaderPerformanceCounters>();
+        if (useLookupHashTable) {
+            chunkState->LookupHashTable = CreateChunkLookupHashTable(
+                ChunkId_,
+                startBlockIndex,
+                blocks,
+                chunkMeta,
+                Schema,
+                /*keyComparer*/ {});
+        }
+
+        return ReadAll(CreateCacheBasedVersionedChunkReader(
+            ChunkId_,
+            chunkState,
+            chunkMeta,
+            /*chunkReadOptions*/ {},
+            keys,
+            TColumnFilter(),
+            AllCommittedTimestamp,
+            /*produceAllVersions*/ true));
+    }
+
+    //! Looks up #keys in the preloaded chunk data the same way sorted chunk stores do.
+    std::vector<TString> LookupPreloaded(
+        const TInMemoryChunkDataPtr& chunkData,
+        const TSharedRange<TLegacyKey>& keys)
+    {
+        const auto& chunkMeta = chunkData->ChunkMeta;
+        EXPECT_EQ(EChunkFormat::TableVersionedColumnar, chunkMeta->GetChunkFormat());
+        EXPECT_EQ(0, chunkData->StartBlockIndex);
+
+        auto blockManagerFactory = NNewTableClient::CreateSyncBlockWindowManagerFactory(
+            GetPreloadedBlockCache(ChunkId_, chunkData->Blocks),
+            chunkMeta,
+            ChunkId_);
+
+        auto chunkColumnMapping = New<TChunkColumnMapping>(Schema, chunkMeta->GetChunkSchema());
+        auto performanceCounters = New<TChunkReaderPerformanceCounters>();
+
+        if (chunkData->LookupHashTable) {
+            auto keysWithHints = NNewTableClient::BuildKeyHintsUsingLookupTable(
+                *chunkData->LookupHashTable,
+                keys);
+            return ReadAll(NNewTableClient::CreateVersionedChunkReader(
+                std::move(keysWithHints),
+                AllCommittedTimestamp,
+                chunkMeta,
+                Schema,
+                TColumnFilter(),
+                chunkColumnMapping,
+                std::move(blockManagerFactory),
+                std::move(performanceCounters),
+                /*produceAllVersions*/ true));
+        }
+
+        return ReadAll(NNewTableClient::CreateVersionedChunkReader(
+            keys,
+            AllCommittedTimestamp,
+            chunkMeta,
+            Schema,
+            TColumnFilter(),
+            chunkColumnMapping,
+            std::move(blockManagerFactory),
+            std::move(performanceCounters),
+            /*produceAllVersions*/ true));
+    }
+
+    static TSharedRange<TLegacyKey> MakeKeys(int beginIndex, int endIndex)
+    {
+        auto rowBuffer = New<TRowBuffer>();
+        std::vector<TLegacyKey> keys;
+        // Odd keys are missing in the chunk.
+        for (int key = 2 * beginIndex; key < 2 * endIndex; ++key) {
+            keys.push_back(rowBuffer->CaptureRow(YsonToKey(ToString(key))));
+        }
+        return MakeSharedRange(std::move(keys), std::move(rowBuffer));
+    }
+
+    TInMemoryChunkDataPtr CreateChunkData(
+        const TColumnarInMemoryChunk& columnarChunk,
+        const TTabletSnapshotPtr& tabletSnapshot)
+    {
+        return CreateInMemoryChunkData(
+            ChunkId_,
+            EInMemoryMode::Uncompressed,
+            /*startBlockIndex*/ 0,
+            columnarChunk.Blocks,
+            GetChunkMeta(columnarChunk.Meta),
+            tabletSnapshot,
+            /*memoryReferenceTracker*/ nullptr,
+            /*memoryTracker*/ nullptr);
+    }
+};
+
+TEST_P(TColumnarInMemoryChunkTest, Disabled)
+{
+    auto tabletSnapshot = CreateTabletSnapshot();
+
+    EXPECT_FALSE(TryTranscodeInMemoryChunkToColumnar(Meta_, EInMemoryMode::Compressed, 0, Blocks_, tabletSnapshot));
+
+    tabletSnapshot->Settings.MountConfig->EnableColumnarInMemoryFormat = false;
+    EXPECT_FALSE(TryTranscodeInMemoryChunkToColumnar(Meta_, EInMemoryMode::Uncompressed, 0, Blocks_, tabletSnapshot));
+}
+
+// Intercepted chunks are transcoded as a whole: their blocks start at zero.
+TEST_P(TColumnarInMemoryChunkTest, Intercept)
+{
+    auto tabletSnapshot = CreateTabletSnapshot();
+
+    auto columnarChunk = TryTranscodeInMemoryChunkToColumnar(
+        Meta_,
+        EInMemoryMode::Uncompressed,
+        /*startBlockIndex*/ 0,
+        Blocks_,
+        tabletSnapshot);
+    ASSERT_TRUE(columnarChunk);
+    EXPECT_EQ(EChunkFormat::TableVersionedColumnar, GetChunkMeta(columnarChunk->Meta)->GetChunkFormat());
+
+    auto expectedRows = ReadRange(Meta_, 0, Blocks_);
+    EXPECT_EQ(RowCount, std::ssize(expectedRows));
+    EXPECT_EQ(expectedRows, ReadRange(columnarChunk->Meta, 0, columnarChunk->Blocks));
+
+    auto chunkData = CreateChunkData(*columnarChunk, tabletSnapshot);
+    EXPECT_TRUE(chunkData->LookupHashTable);
+
+    auto keys = MakeKeys(0, RowCount);
+    auto expectedLookupRows = LookupOriginal(0, Blocks_, keys, /*useLookupHashTable*/ false);
+    EXPECT_EQ(expectedLookupRows, LookupOriginal(0, Blocks_, keys, /*useLookupHashTable*/ true));
+    EXPECT_EQ(expectedLookupRows, LookupPreloaded(chunkData, keys));
+}
+
+// Preloaded chunks are transcoded from the blocks covering tablet pivot keys only.
+TEST_P(TColumnarInMemoryChunkTest, PreloadWithPivotKeys)
+{
+    int firstIndex = RowCount / 3;
+    int lastIndex = 2 * RowCount / 3;
+
+    auto pivotKey = YsonToKey(ToString(2 * firstIndex));
+    auto nextPivotKey = YsonToKey(ToString(2 * lastIndex));
+    auto tabletSnapshot = CreateTabletSnapshot(pivotKey, nextPivotKey);
+
+    auto [startBlockIndex, endBlockIndex] = GetPreloadedBlockRange(pivotKey, nextPivotKey);
+    if (GetParam() == EChunkFormat::TableVersionedSimple) {
+        ASSERT_GT(startBlockIndex, 0);
+        ASSERT_LT(endBlockIndex, std::ssize(Blocks_));
+    }
+
+    std::vector<TBlock> blocks(Blocks_.begin() + startBlockIndex, Blocks_.begin() + endBlockIndex);
+
+    auto columnarChunk = TryTranscodeInMemoryChunkToColumnar(
+        Meta_,
+        EInMemoryMode::Uncompressed,
+        startBlockIndex,
+        blocks,
+        tabletSnapshot);
+    ASSERT_TRUE(columnarChunk);
+
+    // Rows outside of the tablet are trimmed.
+    auto expectedRows = ReadRange(Meta_, 0, Blocks_, pivotKey, nextPivotKey);
+    EXPECT_EQ(lastIndex - firstIndex, std::ssize(expectedRows));
+    EXPECT_EQ(expectedRows, ReadRange(Meta_, startBlockIndex, blocks, pivotKey, nextPivotKey));
+    EXPECT_EQ(expectedRows, ReadRange(columnarChunk->Meta, 0, columnarChunk->Blocks));
+    EXPECT_EQ(expectedRows, ReadRange(columnarChunk->Meta, 0, columnarChunk->Blocks, pivotKey, nextPivotKey));
+
+    auto chunkData = CreateChunkData(*columnarChunk, tabletSnapshot);
+    EXPECT_TRUE(chunkData->LookupHashTable);
+
+    auto keys = MakeKeys(firstIndex, lastIndex);
+    auto expectedLookupRows = LookupOriginal(startBlockIndex, blocks, keys, /*useLookupHashTable*/ false);
+    EXPECT_EQ(std::ssize(keys), std::ssize(expectedLookupRows));
+    EXPECT_EQ(expectedLookupRows, LookupOriginal(startBlockIndex, blocks, keys, /*useLookupHashTable*/ true));
+    EXPECT_EQ(expectedLookupRows, LookupPreloaded(chunkData, keys));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TColumnarInMemoryChunkTest,
+    TColumnarInMemoryChunkTest,
+    ::testing::Values(
+        EChunkFormat::TableVersionedSimple,
+        EChunkFormat::TableVersionedSlim));
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NTabletNode
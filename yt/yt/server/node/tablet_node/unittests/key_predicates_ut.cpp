@@ -0,0 +1,182 @@
+#include <yt/yt/server/node/query_agent/key_predicates.h>
+
+#include <yt/yt/library/query/base/query.h>
+
+#include <yt/yt/client/table_client/row_buffer.h>
+
+#include <yt/yt/core/test_framework/framework.h>
+
+namespace NYT::NQueryAgent {
+namespace {
+
+using namespace NNewTableClient;
+using namespace NQueryClient;
+using namespace NTableClient;
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TKeyPredicatesTest
+    : public ::testing::Test
+{
+protected:
+    const TTableSchemaPtr Schema_ = New<TTableSchema>(std::vector{
+        TColumnSchema("k0", EValueType::Int64).SetSortOrder(ESortOrder::Ascending),
+        TColumnSchema("k1", EValueType::String).SetSortOrder(ESortOrder::Ascending),
+        TColumnSchema("k2", EValueType::Double).SetSortOrder(ESortOrder::Ascending),
+        TColumnSchema("v0", EValueType::Int64),
+    });
+
+    //! Returns a query reading all columns under their own names with the given WHERE clause.
+    TQueryPtr MakeQuery(TConstExpressionPtr whereClause) const
+    {
+        auto query = New<TQuery>();
+        query->Schema.Original = Schema_;
+        for (int index = 0; index < Schema_->GetColumnCount(); ++index) {
+            query->Schema.Mapping.push_back({Schema_->Columns()[index].Name(), index});
+        }
+        query->WhereClause = std::move(whereClause);
+        return query;
+    }
+
+    TConstExpressionPtr MakeReference(const TString& name) const
+    {
+        return New<TReferenceExpression>(Schema_->GetColumn(name).LogicalType(), name);
+    }
+
+    static TConstExpressionPtr MakeLiteral(TUnversionedValue value)
+    {
+        return New<TLiteralExpression>(value.Type, TOwningValue(value));
+    }
+
+    static TConstExpressionPtr MakeBinary(EBinaryOp opcode, TConstExpressionPtr lhs, TConstExpressionPtr rhs)
+    {
+        return New<TBinaryOpExpression>(EValueType::Boolean, opcode, std::move(lhs), std::move(rhs));
+    }
+
+    static TConstExpressionPtr MakeIn(TConstExpressionPtr argument, std::vector<TUnversionedValue> values)
+    {
+        auto rowBuffer = New<TRowBuffer>();
+        std::vector<TRow> rows;
+        for (auto value : values) {
+            rows.push_back(rowBuffer->CaptureRow(TUnversionedValueRange(&value, 1)));
+        }
+        return New<TInExpression>(
+            std::vector<TConstExpressionPtr>{std::move(argument)},
+            MakeSharedRange(std::move(rows), std::move(rowBuffer)));
+    }
+
+    static std::vector<TUnversionedValue> GetConstants(const TKeyColumnPredicate& predicate)
+    {
+        return {predicate.Constants.begin(), predicate.Constants.end()};
+    }
+};
+
+TEST_F(TKeyPredicatesTest, Comparisons)
+{
+    auto query = MakeQuery(MakeBinary(
+        EBinaryOp::And,
+        MakeBinary(EBinaryOp::Less, MakeReference("k0"), MakeLiteral(MakeUnversionedInt64Value(10))),
+        MakeBinary(EBinaryOp::LessOrEqual, MakeLiteral(MakeUnversionedStringValue("abc")), MakeReference("k1"))));
+
+    auto predicates = ExtractKeyColumnPredicates(query);
+    ASSERT_EQ(2u, predicates.size());
+
+    EXPECT_EQ(0, predicates[0].KeyColumnIndex);
+    EXPECT_EQ(EKeyPredicateOp::Less, predicates[0].Op);
+    EXPECT_EQ(std::vector{MakeUnversionedInt64Value(10)}, GetConstants(predicates[0]));
+
+    // Operands are swapped, so is the comparison.
+    EXPECT_EQ(1, predicates[1].KeyColumnIndex);
+    EXPECT_EQ(EKeyPredicateOp::GreaterOrEqual, predicates[1].Op);
+    EXPECT_EQ(std::vector{MakeUnversionedStringValue("abc")}, GetConstants(predicates[1]));
+}
+
+TEST_F(TKeyPredicatesTest, In)
+{
+    auto query = MakeQuery(MakeIn(
+        MakeReference("k0"),
+        {MakeUnversionedInt64Value(1), MakeUnversionedNullValue(), MakeUnversionedInt64Value(3)}));
+
+    auto predicates = ExtractKeyColumnPredicates(query);
+    ASSERT_EQ(1u, predicates.size());
+    EXPECT_EQ(0, predicates[0].KeyColumnIndex);
+    EXPECT_EQ(EKeyPredicateOp::In, predicates[0].Op);
+    EXPECT_EQ(
+        (std::vector{MakeUnversionedInt64Value(1), MakeUnversionedInt64Value(3)}),
+        GetConstants(predicates[0]));
+}
+
+TEST_F(TKeyPredicatesTest, ConstantsOutliveQuery)
+{
+    auto query = MakeQuery(MakeBinary(
+        EBinaryOp::Equal,
+        MakeReference("k1"),
+        MakeLiteral(MakeUnversionedStringValue("some long enough string"))));
+
+    auto predicates = ExtractKeyColumnPredicates(query);
+    query.Reset();
+
+    ASSERT_EQ(1u, predicates.size());
+    EXPECT_EQ(std::vector{MakeUnversionedStringValue("some long enough string")}, GetConstants(predicates[0]));
+}
+
+TEST_F(TKeyPredicatesTest, NotExtracted)
+{
+    auto literal = MakeLiteral(MakeUnversionedInt64Value(1));
+
+    // No WHERE clause.
+    EXPECT_TRUE(ExtractKeyColumnPredicates(MakeQuery(nullptr)).empty());
+    // Value column.
+    EXPECT_TRUE(ExtractKeyColumnPredicates(MakeQuery(
+        MakeBinary(EBinaryOp::Equal, MakeReference("v0"), literal))).empty());
+    // Double key column.
+    EXPECT_TRUE(ExtractKeyColumnPredicates(MakeQuery(
+        MakeBinary(EBinaryOp::Equal, MakeReference("k2"), MakeLiteral(MakeUnversionedDoubleValue(1.0))))).empty());
+    // Null constant.
+    EXPECT_TRUE(ExtractKeyColumnPredicates(MakeQuery(
+        MakeBinary(EBinaryOp::Equal, MakeReference("k0"), MakeLiteral(MakeUnversionedNullValue())))).empty());
+    // Disjunction.
+    EXPECT_TRUE(ExtractKeyColumnPredicates(MakeQuery(MakeBinary(
+        EBinaryOp::Or,
+        MakeBinary(EBinaryOp::Equal, MakeReference("k0"), literal),
+        MakeBinary(EBinaryOp::Equal, MakeReference("v0"), literal)))).empty());
+    // Arithmetics over a key column.
+    EXPECT_TRUE(ExtractKeyColumnPredicates(MakeQuery(MakeBinary(
+        EBinaryOp::Equal,
+        MakeBinary(EBinaryOp::Plus, MakeReference("k0"), literal),
+        literal))).empty());
+}
+
+TEST_F(TKeyPredicatesTest, ConjunctionIsPartiallyExtracted)
+{
+    auto literal = MakeLiteral(MakeUnversionedInt64Value(1));
+    auto query = MakeQuery(MakeBinary(
+        EBinaryOp::And,
+        MakeBinary(EBinaryOp::Equal, MakeReference("v0"), literal),
+        MakeBinary(EBinaryOp::NotEqual, MakeReference("k0"), literal)));
+
+    auto predicates = ExtractKeyColumnPredicates(query);
+    ASSERT_EQ(1u, predicates.size());
+    EXPECT_EQ(0, predicates[0].KeyColumnIndex);
+    EXPECT_EQ(EKeyPredicateOp::NotEqual, predicates[0].Op);
+}
+
+TEST_F(TKeyPredicatesTest, RenamedKeyColumn)
+{
+    auto query = MakeQuery(nullptr);
+    // SELECT k1 AS a, v0 WHERE a = "x": k0 is not read by the query.
+    query->Schema.Mapping = {{"a", 1}, {"v0", 3}};
+    query->WhereClause = MakeBinary(
+        EBinaryOp::Equal,
+        New<TReferenceExpression>(Schema_->GetColumn("k1").LogicalType(), "a"),
+        MakeLiteral(MakeUnversionedStringValue("x")));
+
+    auto predicates = ExtractKeyColumnPredicates(query);
+    ASSERT_EQ(1u, predicates.size());
+    EXPECT_EQ(1, predicates[0].KeyColumnIndex);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NQueryAgent
@@ -0,0 +1,428 @@
+#include <yt/yt/server/node/query_agent/config.h>
+#include <yt/yt/server/node/query_agent/late_materialization.h>
+
+#include <yt/yt/library/query/base/query.h>
+
+#include <yt/yt/client/chunk_client/data_statistics.h>
+
+#include <yt/yt/client/table_client/row_batch.h>
+#include <yt/yt/client/table_client/row_buffer.h>
+#include <yt/yt/client/table_client/unversioned_reader.h>
+#include <yt/yt/client/table_client/unversioned_writer.h>
+
+#include <yt/yt/core/test_framework/framework.h>
+
+namespace NYT::NQueryAgent {
+namespace {
+
+using namespace NChunkClient;
+using namespace NQueryClient;
+using namespace NTableClient;
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TCountingMemoryChunkProvider
+    : public IMemoryChunkProvider
+{
+public:
+    std::unique_ptr<TAllocationHolder> Allocate(size_t size, TRefCountedTypeCookie cookie) override
+    {
+        std::unique_ptr<THolder> result(TAllocationHolder::Allocate<THolder>(size, cookie));
+        result->Owner = this;
+        Allocated_ += result->GetRef().Size();
+        return result;
+    }
+
+    i64 GetAllocated() const
+    {
+        return Allocated_;
+    }
+
+private:
+    struct THolder
+        : public TAllocationHolder
+    {
+        THolder(TMutableRef ref, TRefCountedTypeCookie cookie)
+            : TAllocationHolder(ref, cookie)
+        { }
+
+        ~THolder()
+        {
+            Owner->Allocated_ -= GetRef().Size();
+        }
+
+        TIntrusivePtr<TCountingMemoryChunkProvider> Owner;
+    };
+
+    std::atomic<i64> Allocated_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TKeysReader
+    : public ISchemafulUnversionedReader
+{
+public:
+    explicit TKeysReader(TSharedRange<TUnversionedRow> keys)
+        : Keys_(std::move(keys))
+    { }
+
+    IUnversionedRowBatchPtr Read(const TRowBatchReadOptions& /*options*/) override
+    {
+        if (Done_) {
+            return nullptr;
+        }
+        Done_ = true;
+        return CreateBatchFromUnversionedRows(Keys_);
+    }
+
+    TFuture<void> GetReadyEvent() const override
+    {
+        return VoidFuture;
+    }
+
+    NChunkClient::NProto::TDataStatistics GetDataStatistics() const override
+    {
+        NChunkClient::NProto::TDataStatistics statistics;
+        statistics.set_row_count(Done_ ? Keys_.Size() : 0);
+        return statistics;
+    }
+
+    TCodecStatistics GetDecompressionStatistics() const override
+    {
+        return {};
+    }
+
+    bool IsFetchingCompleted() const override
+    {
+        return Done_;
+    }
+
+    std::vector<TChunkId> GetFailedChunkIds() const override
+    {
+        return {};
+    }
+
+private:
+    const TSharedRange<TUnversionedRow> Keys_;
+    bool Done_ = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TLateMaterializationTest
+    : public ::testing::Test
+{
+protected:
+    const TIntrusivePtr<TCountingMemoryChunkProvider> ChunkProvider_ = New<TCountingMemoryChunkProvider>();
+    const TRowBufferPtr RowBuffer_ = New<TRowBuffer>();
+
+    std::vector<TUnversionedRow> MakeKeys(int begin, int end)
+    {
+        std::vector<TUnversionedRow> keys;
+        for (int index = begin; index < end; ++index) {
+            auto key = RowBuffer_->AllocateUnversioned(1);
+            key[0] = MakeUnversionedInt64Value(index, 0);
+            keys.push_back(key);
+        }
+        return keys;
+    }
+
+    static std::vector<i64> GetValues(TRange<TUnversionedRow> rows)
+    {
+        std::vector<i64> values;
+        for (auto row : rows) {
+            values.push_back(row[0].Data.Int64);
+        }
+        return values;
+    }
+
+    static std::vector<i64> MakeRange(int begin, int end)
+    {
+        std::vector<i64> values;
+        for (int index = begin; index < end; ++index) {
+            values.push_back(index);
+        }
+        return values;
+    }
+
+    static std::vector<i64> ReadAll(const ISchemafulUnversionedReaderPtr& reader)
+    {
+        std::vector<i64> values;
+        while (auto batch = reader->Read()) {
+            if (batch->IsEmpty()) {
+                WaitFor(reader->GetReadyEvent())
+                    .ThrowOnError();
+                continue;
+            }
+            auto batchValues = GetValues(batch->MaterializeRows());
+            values.insert(values.end(), batchValues.begin(), batchValues.end());
+        }
+        return values;
+    }
+
+    static ISchemafulUnversionedReaderPtr CreateEmptyReader()
+    {
+        return New<TKeysReader>(TSharedRange<TUnversionedRow>());
+    }
+};
+
+TEST_F(TLateMaterializationTest, BatchesAreBounded)
+{
+    auto keyBatcher = New<TKeyBatcher>(3, ChunkProvider_);
+    auto writer = keyBatcher->GetWriter();
+
+    EXPECT_FALSE(writer->Write(MakeKeys(0, 7)));
+    auto readyEvent = writer->GetReadyEvent();
+    EXPECT_GT(ChunkProvider_->GetAllocated(), 0);
+
+    auto batch = keyBatcher->GetNextBatch().Get().ValueOrThrow();
+    EXPECT_EQ(MakeRange(0, 3), GetValues(batch));
+    EXPECT_FALSE(readyEvent.IsSet());
+
+    batch = keyBatcher->GetNextBatch().Get().ValueOrThrow();
+    EXPECT_EQ(MakeRange(3, 6), GetValues(batch));
+    EXPECT_TRUE(readyEvent.IsSet());
+    EXPECT_TRUE(readyEvent.Get().IsOK());
+
+    // The last key stays in the unsealed batch until the writer is closed.
+    auto asyncBatch = keyBatcher->GetNextBatch();
+    EXPECT_FALSE(asyncBatch.IsSet());
+    EXPECT_TRUE(writer->Write(MakeKeys(7, 8)));
+    EXPECT_FALSE(asyncBatch.IsSet());
+    EXPECT_FALSE(keyBatcher->IsExhausted());
+
+    EXPECT_TRUE(writer->Close().Get().IsOK());
+    EXPECT_EQ(MakeRange(6, 8), GetValues(asyncBatch.Get().ValueOrThrow()));
+    EXPECT_TRUE(keyBatcher->IsExhausted());
+    EXPECT_TRUE(keyBatcher->GetNextBatch().Get().ValueOrThrow().Empty());
+}
+
+TEST_F(TLateMaterializationTest, KeysAreTracked)
+{
+    auto keyBatcher = New<TKeyBatcher>(1000, ChunkProvider_);
+    auto writer = keyBatcher->GetWriter();
+
+    EXPECT_TRUE(writer->Write(MakeKeys(0, 100)));
+    EXPECT_TRUE(writer->Close().Get().IsOK());
+    EXPECT_GT(ChunkProvider_->GetAllocated(), 0);
+
+    {
+        auto batch = keyBatcher->GetNextBatch().Get().ValueOrThrow();
+        EXPECT_EQ(100, std::ssize(batch));
+    }
+
+    EXPECT_EQ(0, ChunkProvider_->GetAllocated());
+}
+
+TEST_F(TLateMaterializationTest, ReaderLooksUpBatches)
+{
+    auto keyBatcher = New<TKeyBatcher>(4, ChunkProvider_);
+    auto writer = keyBatcher->GetWriter();
+
+    int lookupCount = 0;
+    auto reader = CreateLateMaterializingReader(
+        CreateEmptyReader(),
+        keyBatcher,
+        BIND([&] (TSharedRange<TUnversionedRow> keys) -> ISchemafulUnversionedReaderPtr {
+            EXPECT_LE(std::ssize(keys), 4);
+            ++lookupCount;
+            return New<TKeysReader>(std::move(keys));
+        }));
+
+    auto batch = reader->Read();
+    ASSERT_TRUE(batch);
+    EXPECT_TRUE(batch->IsEmpty());
+    EXPECT_FALSE(reader->GetReadyEvent().IsSet());
+    EXPECT_FALSE(reader->IsFetchingCompleted());
+
+    EXPECT_FALSE(writer->Write(MakeKeys(0, 10)));
+    EXPECT_TRUE(reader->GetReadyEvent().IsSet());
+
+    auto writerReadyEvent = writer->GetReadyEvent();
+    auto writeFuture = writerReadyEvent.Apply(BIND([=] {
+        return writer->Close();
+    }));
+
+    EXPECT_EQ(MakeRange(0, 10), ReadAll(reader));
+    EXPECT_TRUE(writeFuture.Get().IsOK());
+    EXPECT_TRUE(reader->IsFetchingCompleted());
+    EXPECT_EQ(3, lookupCount);
+    EXPECT_EQ(10, reader->GetDataStatistics().row_count());
+}
+
+TEST_F(TLateMaterializationTest, FilterFailurePropagates)
+{
+    auto keyBatcher = New<TKeyBatcher>(4, ChunkProvider_);
+
+    auto reader = CreateLateMaterializingReader(
+        CreateEmptyReader(),
+        keyBatcher,
+        BIND([] (TSharedRange<TUnversionedRow> keys) -> ISchemafulUnversionedReaderPtr {
+            return New<TKeysReader>(std::move(keys));
+        }));
+
+    EXPECT_TRUE(reader->Read()->IsEmpty());
+    keyBatcher->Fail(TError("Filter failed"));
+
+    EXPECT_FALSE(reader->GetReadyEvent().Get().IsOK());
+    EXPECT_THROW(reader->Read(), std::exception);
+}
+
+TEST_F(TLateMaterializationTest, ReaderDestructionStopsWriter)
+{
+    auto keyBatcher = New<TKeyBatcher>(2, ChunkProvider_);
+    auto writer = keyBatcher->GetWriter();
+
+    auto reader = CreateLateMaterializingReader(
+        CreateEmptyReader(),
+        keyBatcher,
+        BIND([] (TSharedRange<TUnversionedRow> keys) -> ISchemafulUnversionedReaderPtr {
+            return New<TKeysReader>(std::move(keys));
+        }));
+
+    EXPECT_FALSE(writer->Write(MakeKeys(0, 5)));
+    auto readyEvent = writer->GetReadyEvent();
+    EXPECT_FALSE(readyEvent.IsSet());
+
+    reader.Reset();
+
+    EXPECT_TRUE(readyEvent.IsSet());
+    EXPECT_FALSE(readyEvent.Get().IsOK());
+    EXPECT_EQ(0, ChunkProvider_->GetAllocated());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TLateMaterializationFilterQueryTest
+    : public ::testing::Test
+{
+protected:
+    const TTableSchemaPtr Schema_ = New<TTableSchema>(std::vector{
+        TColumnSchema("k0", EValueType::Int64).SetSortOrder(ESortOrder::Ascending),
+        TColumnSchema("k1", EValueType::Int64).SetSortOrder(ESortOrder::Ascending),
+        TColumnSchema("v0", EValueType::Int64),
+        TColumnSchema("v1", EValueType::Int64),
+        TColumnSchema("v2", EValueType::Int64),
+        TColumnSchema("v3", EValueType::Int64),
+    });
+
+    TQueryAgentConfigPtr Config_;
+
+    void SetUp() override
+    {
+        Config_ = New<TQueryAgentConfig>();
+        Config_->EnableLateMaterialization = true;
+        Config_->LateMaterializationMinSkippedColumnCount = 1;
+    }
+
+    //! Returns a query reading all columns under their own names with |WHERE v0 = 1|.
+    TQueryPtr MakeQuery() const
+    {
+        auto query = New<TQuery>();
+        query->Schema.Original = Schema_;
+        for (int index = 0; index < Schema_->GetColumnCount(); ++index) {
+            query->Schema.Mapping.push_back({Schema_->Columns()[index].Name(), index});
+        }
+        query->WhereClause = New<TBinaryOpExpression>(
+            EValueType::Boolean,
+            EBinaryOp::Equal,
+            New<TReferenceExpression>(Schema_->GetColumn("v0").LogicalType(), "v0"),
+            New<TLiteralExpression>(EValueType::Int64, MakeUnversionedInt64Value(1)));
+        return query;
+    }
+
+    static std::vector<TString> GetMappedNames(const TQueryPtr& query)
+    {
+        std::vector<TString> names;
+        for (const auto& item : query->Schema.Mapping) {
+            names.push_back(item.Name);
+        }
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+    static std::vector<TString> GetProjectedNames(const TQueryPtr& query)
+    {
+        std::vector<TString> names;
+        for (const auto& item : query->ProjectClause->Projections) {
+            names.push_back(item.Name);
+        }
+        return names;
+    }
+};
+
+TEST_F(TLateMaterializationFilterQueryTest, ReadsKeyAndPredicateColumns)
+{
+    auto query = MakeQuery();
+    auto filterQuery = BuildLateMaterializationFilterQuery(query, Config_);
+    ASSERT_TRUE(filterQuery);
+
+    EXPECT_EQ(query->WhereClause, filterQuery->WhereClause);
+    EXPECT_EQ((std::vector<TString>{"k0", "k1", "v0"}), GetMappedNames(filterQuery));
+    EXPECT_EQ((std::vector<TString>{"k0", "k1"}), GetProjectedNames(filterQuery));
+}
+
+TEST_F(TLateMaterializationFilterQueryTest, NotApplicable)
+{
+    {
+        Config_->EnableLateMaterialization = false;
+        EXPECT_FALSE(BuildLateMaterializationFilterQuery(MakeQuery(), Config_));
+        Config_->EnableLateMaterialization = true;
+    }
+
+    {
+        auto query = MakeQuery();
+        query->WhereClause.Reset();
+        EXPECT_FALSE(BuildLateMaterializationFilterQuery(query, Config_));
+    }
+
+    {
+        auto query = MakeQuery();
+        query->JoinClauses.push_back(New<TJoinClause>());
+        EXPECT_FALSE(BuildLateMaterializationFilterQuery(query, Config_));
+    }
+
+    {
+        auto query = MakeQuery();
+        query->Limit = 10;
+        ASSERT_TRUE(query->IsOrdered());
+        EXPECT_FALSE(BuildLateMaterializationFilterQuery(query, Config_));
+    }
+}
+
+TEST_F(TLateMaterializationFilterQueryTest, MinSkippedColumnCount)
+{
+    // Three value columns are not referenced by the predicate.
+    Config_->LateMaterializationMinSkippedColumnCount = 3;
+    EXPECT_TRUE(BuildLateMaterializationFilterQuery(MakeQuery(), Config_));
+
+    Config_->LateMaterializationMinSkippedColumnCount = 4;
+    EXPECT_FALSE(BuildLateMaterializationFilterQuery(MakeQuery(), Config_));
+}
+
+TEST_F(TLateMaterializationFilterQueryTest, UnreferencedKeyColumns)
+{
+    auto query = MakeQuery();
+    // SELECT k0 AS a, v0, v1, v2, v3: k1 is not read by the query.
+    query->Schema.Mapping = {{"a", 0}, {"v0", 2}, {"v1", 3}, {"v2", 4}, {"v3", 5}};
+
+    auto filterQuery = BuildLateMaterializationFilterQuery(query, Config_);
+    ASSERT_TRUE(filterQuery);
+    EXPECT_EQ((std::vector<TString>{"a", "k1", "v0"}), GetMappedNames(filterQuery));
+    EXPECT_EQ((std::vector<TString>{"a", "k1"}), GetProjectedNames(filterQuery));
+}
+
+TEST_F(TLateMaterializationFilterQueryTest, UnreferencedKeyColumnNameCollision)
+{
+    auto query = MakeQuery();
+    // SELECT k0, v0, v1 AS k1, v2, v3: k1 cannot be read under its own name.
+    query->Schema.Mapping = {{"k0", 0}, {"v0", 2}, {"k1", 3}, {"v2", 4}, {"v3", 5}};
+
+    EXPECT_FALSE(BuildLateMaterializationFilterQuery(query, Config_));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NQueryAgent
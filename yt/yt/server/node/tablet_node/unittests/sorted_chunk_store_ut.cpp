@@ -2,7 +2,18 @@
 
 #include <yt/yt/server/node/tablet_node/sorted_chunk_store.h>
 
+#include <yt/yt/ytlib/table_client/key_filter.h>
+
+#include <yt/yt/ytlib/table_client/proto/key_filter.pb.h>
+
+#include <yt/yt/client/chunk_client/data_statistics.h>
+
+#include <yt/yt/client/table_client/config.h>
 #include <yt/yt/client/table_client/helpers.h>
+#include <yt/yt/client/table_client/row_batch.h>
+#include <yt/yt/client/table_client/row_buffer.h>
+#include <yt/yt/client/table_client/versioned_reader.h>
+#include <yt/yt/client/table_client/versioned_row.h>
 
 namespace NYT {
 namespace NTabletNode {
@@ -15,6 +26,9 @@ using namespace NYson;
 
 using NChunkClient::TLegacyReadRange;
 using NChunkClient::TLegacyReadLimit;
+using NChunkClient::TChunkId;
+using NChunkClient::TCodecStatistics;
+using NChunkClient::NProto::TDataStatistics;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -161,6 +175,223 @@ INSTANTIATE_TEST_SUITE_P(
 
 ////////////////////////////////////////////////////////////////////////////////
 
+TKeyFilterPtr BuildKeyFilter(const std::vector<TLegacyOwningKey>& keys)
+{
+    auto config = New<TKeyFilterWriterConfig>();
+    config->Enable = true;
+    config->FalsePositiveRate = 0.01;
+
+    auto builder = CreateKeyFilterBuilder(config, /*keyColumnCount*/ 1);
+    for (const auto& key : keys) {
+        builder->AddKey(key.Elements());
+    }
+    builder->FlushBlock(keys.back().Elements());
+
+    return New<TKeyFilter>(builder->FlushExtension());
+}
+
+TEST(TSortedChunkStoreTestKeyFilter, RejectedKeysAreMasked)
+{
+    std::vector<TLegacyOwningKey> chunkKeys;
+    for (int value = 0; value < 100; value += 2) {
+        chunkKeys.push_back(MakeUnversionedOwningRow(value));
+    }
+    auto keyFilter = BuildKeyFilter(chunkKeys);
+
+    std::vector<TLegacyOwningKey> owningKeys;
+    for (int value = 0; value < 100; ++value) {
+        owningKeys.push_back(MakeUnversionedOwningRow(value));
+    }
+    // Keys beyond the last chunk key are always rejected.
+    owningKeys.push_back(MakeUnversionedOwningRow(1000));
+
+    std::vector<TLegacyKey> keys;
+    for (const auto& key : owningKeys) {
+        keys.push_back(key.Get());
+    }
+
+    std::vector<bool> keyFilterMask;
+    auto filteredKeys = FilterKeysByKeyFilter(keyFilter, MakeSharedRange(keys), &keyFilterMask);
+
+    ASSERT_EQ(keys.size(), keyFilterMask.size());
+    EXPECT_FALSE(keyFilterMask.back());
+
+    std::vector<TLegacyKey> expectedKeys;
+    for (int index = 0; index < std::ssize(keys); ++index) {
+        if (index < 100 && index % 2 == 0) {
+            EXPECT_TRUE(keyFilterMask[index]);
+        }
+        if (keyFilterMask[index]) {
+            expectedKeys.push_back(keys[index]);
+        }
+    }
+
+    EXPECT_TRUE(std::equal(
+        expectedKeys.begin(),
+        expectedKeys.end(),
+        filteredKeys.begin(),
+        filteredKeys.end()));
+}
+
+TEST(TSortedChunkStoreTestKeyFilter, AllKeysPass)
+{
+    std::vector<TLegacyOwningKey> chunkKeys;
+    for (int value = 0; value < 10; ++value) {
+        chunkKeys.push_back(MakeUnversionedOwningRow(value));
+    }
+    auto keyFilter = BuildKeyFilter(chunkKeys);
+
+    std::vector<TLegacyKey> keys;
+    for (const auto& key : chunkKeys) {
+        keys.push_back(key.Get());
+    }
+    auto keyRange = MakeSharedRange(keys);
+
+    std::vector<bool> keyFilterMask;
+    auto filteredKeys = FilterKeysByKeyFilter(keyFilter, keyRange, &keyFilterMask);
+
+    EXPECT_TRUE(keyFilterMask.empty());
+    EXPECT_EQ(keyRange.Begin(), filteredKeys.Begin());
+    EXPECT_EQ(keyRange.Size(), filteredKeys.Size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TMockVersionedReader
+    : public IVersionedReader
+{
+public:
+    explicit TMockVersionedReader(std::vector<TVersionedRow> rows)
+        : Rows_(std::move(rows))
+    { }
+
+    TFuture<void> Open() override
+    {
+        return VoidFuture;
+    }
+
+    IVersionedRowBatchPtr Read(const TRowBatchReadOptions& options) override
+    {
+        if (Position_ == std::ssize(Rows_)) {
+            return nullptr;
+        }
+
+        std::vector<TVersionedRow> rows;
+        while (Position_ < std::ssize(Rows_) && std::ssize(rows) < options.MaxRowsPerRead) {
+            rows.push_back(Rows_[Position_++]);
+        }
+        ++ReadCount_;
+
+        return CreateBatchFromVersionedRows(MakeSharedRange(std::move(rows), MakeStrong(this)));
+    }
+
+    TFuture<void> GetReadyEvent() const override
+    {
+        return VoidFuture;
+    }
+
+    TDataStatistics GetDataStatistics() const override
+    {
+        return TDataStatistics();
+    }
+
+    TCodecStatistics GetDecompressionStatistics() const override
+    {
+        return TCodecStatistics();
+    }
+
+    bool IsFetchingCompleted() const override
+    {
+        return true;
+    }
+
+    std::vector<TChunkId> GetFailedChunkIds() const override
+    {
+        return {};
+    }
+
+    int GetReadCount() const
+    {
+        return ReadCount_;
+    }
+
+private:
+    const std::vector<TVersionedRow> Rows_;
+
+    int Position_ = 0;
+    int ReadCount_ = 0;
+};
+
+TVersionedRow MakeRow(const TRowBufferPtr& rowBuffer, i64 key)
+{
+    TVersionedRowBuilder builder(rowBuffer);
+    builder.AddKey(MakeUnversionedInt64Value(key, 0));
+    builder.AddDeleteTimestamp(1);
+    return builder.FinishRow();
+}
+
+TEST(TKeyFilteringReaderTest, InterleavesNullRows)
+{
+    const std::vector<bool> keyFilterMask{false, true, false, false, true, true, false, false};
+
+    auto rowBuffer = New<TRowBuffer>();
+    std::vector<TVersionedRow> underlyingRows;
+    for (int index = 0; index < std::ssize(keyFilterMask); ++index) {
+        if (keyFilterMask[index]) {
+            underlyingRows.push_back(MakeRow(rowBuffer, index));
+        }
+    }
+
+    auto underlyingReader = New<TMockVersionedReader>(underlyingRows);
+    auto reader = CreateKeyFilteringReader(underlyingReader, keyFilterMask);
+    EXPECT_TRUE(reader->Open().Get().IsOK());
+
+    std::vector<TVersionedRow> rows;
+    while (auto batch = reader->Read({.MaxRowsPerRead = 2})) {
+        EXPECT_TRUE(reader->GetReadyEvent().IsSet());
+        auto batchRows = batch->MaterializeRows();
+        ASSERT_FALSE(batchRows.empty());
+        rows.insert(rows.end(), batchRows.begin(), batchRows.end());
+    }
+
+    ASSERT_EQ(keyFilterMask.size(), rows.size());
+    for (int index = 0; index < std::ssize(rows); ++index) {
+        if (keyFilterMask[index]) {
+            ASSERT_TRUE(rows[index]);
+            EXPECT_EQ(MakeUnversionedInt64Value(index, 0), rows[index].Keys()[0]);
+        } else {
+            EXPECT_FALSE(rows[index]);
+        }
+    }
+
+    // Rejected keys are served without reading the underlying reader.
+    EXPECT_EQ(2, underlyingReader->GetReadCount());
+}
+
+TEST(TKeyFilteringReaderTest, RejectedKeysRespectBatchSize)
+{
+    const std::vector<bool> keyFilterMask{false, false, false, false, false, true};
+
+    auto rowBuffer = New<TRowBuffer>();
+    auto underlyingReader = New<TMockVersionedReader>(std::vector{MakeRow(rowBuffer, 5)});
+    auto reader = CreateKeyFilteringReader(underlyingReader, keyFilterMask);
+
+    std::vector<int> batchSizes;
+    std::vector<TVersionedRow> rows;
+    while (auto batch = reader->Read({.MaxRowsPerRead = 3})) {
+        auto batchRows = batch->MaterializeRows();
+        batchSizes.push_back(batchRows.size());
+        rows.insert(rows.end(), batchRows.begin(), batchRows.end());
+    }
+
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), batchSizes);
+    ASSERT_EQ(keyFilterMask.size(), rows.size());
+    EXPECT_FALSE(rows.front());
+    EXPECT_TRUE(rows.back());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace
 } // namespace NChunkServer
 } // namespace NYT
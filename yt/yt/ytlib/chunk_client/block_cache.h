@@ -3,6 +3,8 @@
 #include "block.h"
 #include "block_id.h"
 
+#include <yt/yt/client/misc/public.h>
+
 #include <yt/yt/client/node_tracker_client/node_directory.h>
 
 #include <library/cpp/yt/memory/ref.h>
@@ -71,9 +73,17 @@ struct IBlockCache
         EBlockType type) = 0;
 
     //! Returns a cookie for working with block in cache.
+    /*!
+     *  #workloadDescriptor describes the caller; caches that need to do IO
+     *  to serve the block use it to prioritize their reads.
+     *
+     *  A failed block future of an inactive cookie means that the cache could not
+     *  serve the block; callers should treat it as a miss and fetch the block themselves.
+     */
     virtual std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
         const TBlockId& id,
-        EBlockType type) = 0;
+        EBlockType type,
+        const TWorkloadDescriptor& workloadDescriptor) = 0;
 
     //! Returns the set of supported block types.
     virtual EBlockType GetSupportedBlockTypes() const = 0;
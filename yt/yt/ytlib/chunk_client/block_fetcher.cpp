@@ -36,7 +36,8 @@ TBlockFetcher::TBlockFetcher(
     NCompression::ECodec codecId,
     double compressionRatio,
     const TClientChunkReadOptions& chunkReadOptions,
-    IInvokerPtr sessionInvoker)
+    IInvokerPtr sessionInvoker,
+    NCompression::IDictionaryBlockCodecPtr dictionaryCodec)
     : Config_(std::move(config))
     , BlockInfos_(std::move(blockInfos))
     , BlockCache_(std::move(blockCache))
@@ -45,7 +46,8 @@ TBlockFetcher::TBlockFetcher(
     , ReaderInvoker_(CreateSerializedInvoker(SessionInvoker_ ? SessionInvoker_ : TDispatcher::Get()->GetReaderInvoker()))
     , CompressionRatio_(compressionRatio)
     , MemoryManager_(std::move(memoryManager))
-    , Codec_(NCompression::GetCodec(codecId))
+    , DictionaryCodec_(std::move(dictionaryCodec))
+    , Codec_(DictionaryCodec_ ? DictionaryCodec_.Get() : NCompression::GetCodec(codecId))
     , ChunkReadOptions_(chunkReadOptions)
     , Logger(ChunkClientLogger)
     , Chunks_(chunkReaders.size())
@@ -636,7 +638,8 @@ TSequentialBlockFetcher::TSequentialBlockFetcher(
     NCompression::ECodec codecId,
     double compressionRatio,
     const TClientChunkReadOptions& chunkReadOptions,
-    IInvokerPtr sessionnInvoker)
+    IInvokerPtr sessionnInvoker,
+    NCompression::IDictionaryBlockCodecPtr dictionaryCodec)
     : TBlockFetcher(
         std::move(config),
         blockInfos,
@@ -646,7 +649,8 @@ TSequentialBlockFetcher::TSequentialBlockFetcher(
         codecId,
         compressionRatio,
         chunkReadOptions,
-        std::move(sessionnInvoker))
+        std::move(sessionnInvoker),
+        std::move(dictionaryCodec))
     , OriginalOrderBlockInfos_(std::move(blockInfos))
 { }
 
@@ -8,7 +8,7 @@
 
 #include <yt/yt/core/actions/future.h>
 
-#include <yt/yt/core/compression/public.h>
+#include <yt/yt/core/compression/dictionary_codec.h>
 
 #include <yt/yt/core/concurrency/async_semaphore.h>
 
@@ -51,7 +51,8 @@ public:
         NCompression::ECodec codecId,
         double compressionRatio,
         const TClientChunkReadOptions& chunkReadOptions,
-        IInvokerPtr sessionnInvoker = nullptr);
+        IInvokerPtr sessionnInvoker = nullptr,
+        NCompression::IDictionaryBlockCodecPtr dictionaryCodec = nullptr);
 
     ~TBlockFetcher();
 
@@ -103,6 +104,8 @@ private:
     const IInvokerPtr ReaderInvoker_;
     const double CompressionRatio_;
     const TChunkReaderMemoryManagerPtr MemoryManager_;
+    //! If set, blocks are compressed with a per-chunk dictionary; keeps #Codec_ alive.
+    const NCompression::IDictionaryBlockCodecPtr DictionaryCodec_;
     NCompression::ICodec* const Codec_;
     const TClientChunkReadOptions ChunkReadOptions_;
     NLogging::TLogger Logger;
@@ -206,7 +209,8 @@ public:
         NCompression::ECodec codecId,
         double compressionRatio,
         const TClientChunkReadOptions& chunkReadOptions,
-        IInvokerPtr sessionnInvoker = nullptr);
+        IInvokerPtr sessionnInvoker = nullptr,
+        NCompression::IDictionaryBlockCodecPtr dictionaryCodec = nullptr);
 
     TFuture<TBlock> FetchNextBlock();
 
@@ -2,6 +2,8 @@
 
 #include "public.h"
 
+#include <yt/yt/ytlib/chunk_client/proto/compression_dictionary.pb.h>
+
 #include <yt/yt_proto/yt/client/chunk_client/proto/chunk_meta.pb.h>
 
 #include <yt/yt/core/misc/protobuf_helpers.h>
@@ -14,6 +16,7 @@ DECLARE_PROTO_EXTENSION(NChunkClient::NProto::TMiscExt, 0)
 DECLARE_PROTO_EXTENSION(NChunkClient::NProto::TBlocksExt, 1)
 DECLARE_PROTO_EXTENSION(NChunkClient::NProto::TErasurePlacementExt, 2)
 DECLARE_PROTO_EXTENSION(NChunkClient::NProto::TStripedErasurePlacementExt, 3)
+DECLARE_PROTO_EXTENSION(NChunkClient::NProto::TCompressionDictionaryExt, 68)
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -116,12 +116,14 @@ public:
         EBlockType type,
         TSlruCacheConfigPtr config,
         const NProfiling::TProfiler& profiler,
-        INodeMemoryReferenceTrackerPtr memoryReferenceTracker)
+        INodeMemoryReferenceTrackerPtr memoryReferenceTracker,
+        TCallback<void(const TBlockId&, EBlockType, const TBlock&)> onBlockEvicted)
         : TAsyncSlruCacheBase(
             std::move(config),
             profiler)
         , Type_(type)
         , MemoryReferenceTracker_(std::move(memoryReferenceTracker))
+        , OnBlockEvicted_(std::move(onBlockEvicted))
     { }
 
     void PutBlock(const TBlockId& id, const TBlock& block)
@@ -186,6 +188,7 @@ public:
 private:
     const EBlockType Type_;
     const INodeMemoryReferenceTrackerPtr MemoryReferenceTracker_;
+    const TCallback<void(const TBlockId&, EBlockType, const TBlock&)> OnBlockEvicted_;
 
     i64 GetWeight(const TAsyncBlockCacheEntryPtr& entry) const override
     {
@@ -193,6 +196,13 @@ private:
 
         return entry->GetCachedBlock().Block.Size();
     }
+
+    void OnRemoved(const TAsyncBlockCacheEntryPtr& entry) override
+    {
+        VERIFY_THREAD_AFFINITY_ANY();
+
+        OnBlockEvicted_(entry->GetKey(), Type_, entry->GetCachedBlock().Block);
+    }
 };
 
 DEFINE_REFCOUNTED_TYPE(TPerTypeClientBlockCache)
@@ -220,7 +230,8 @@ public:
                     type,
                     config,
                     profiler.WithPrefix("/" + FormatEnum(type)),
-                    MemoryReferenceTracker_);
+                    MemoryReferenceTracker_,
+                    BIND_NO_PROPAGATE(&TClientBlockCache::OnBlockEvicted, Unretained(this)));
                 YT_VERIFY(PerTypeCaches_.emplace(type, cache).second);
                 capacity += cache->GetCapacity();
             }
@@ -259,7 +270,8 @@ public:
 
     std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
         const TBlockId& id,
-        EBlockType type) override
+        EBlockType type,
+        const TWorkloadDescriptor& /*workloadDescriptor*/) override
     {
         const auto& cache = FindPerTypeCache(type);
         return cache
@@ -272,6 +284,8 @@ public:
         return SupportedBlockTypes_;
     }
 
+    DEFINE_SIGNAL_OVERRIDE(void(const TBlockId& id, EBlockType type, const TBlock& block), BlockEvicted);
+
     void Reconfigure(const TBlockCacheDynamicConfigPtr& config) override
     {
         i64 newCapacity = 0;
@@ -302,6 +316,11 @@ private:
         static TPerTypeClientBlockCachePtr NullCache;
         return it == PerTypeCaches_.end() ? NullCache : it->second;
     }
+
+    void OnBlockEvicted(const TBlockId& id, EBlockType type, const TBlock& block)
+    {
+        BlockEvicted_.Fire(id, type, block);
+    }
 };
 
 IClientBlockCachePtr CreateClientBlockCache(
@@ -344,7 +363,8 @@ public:
 
     std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
         const TBlockId& /* id */,
-        EBlockType /* type */) override
+        EBlockType /* type */,
+        const TWorkloadDescriptor& /* workloadDescriptor */) override
     {
         return CreateActiveCachedBlockCookie();
     }
@@ -21,6 +21,10 @@ struct IClientBlockCache
     : public IBlockCache
 {
     virtual void Reconfigure(const TBlockCacheDynamicConfigPtr& config) = 0;
+
+    //! Raised when a block leaves the in-memory cache (e.g. due to capacity pressure).
+    //! Used to admit evicted blocks into lower cache tiers.
+    DECLARE_INTERFACE_SIGNAL(void(const TBlockId& id, EBlockType type, const TBlock& block), BlockEvicted);
 };
 
 DEFINE_REFCOUNTED_TYPE(IClientBlockCache)
@@ -20,7 +20,8 @@ TEncodingChunkWriter::TEncodingChunkWriter(
     TEncodingWriterOptionsPtr options,
     IChunkWriterPtr chunkWriter,
     IBlockCachePtr blockCache,
-    NLogging::TLogger logger)
+    NLogging::TLogger logger,
+    TCompressionDictionaryWriterConfigPtr compressionDictionaryConfig)
     : Meta_(New<TMemoryTrackedDeferredChunkMeta>(
           TMemoryUsageTrackerGuard::Acquire(
               options->MemoryTracker,
@@ -33,7 +34,8 @@ TEncodingChunkWriter::TEncodingChunkWriter(
         options,
         ChunkWriter_,
         blockCache,
-        std::move(logger)))
+        std::move(logger),
+        std::move(compressionDictionaryConfig)))
 {
     MiscExt_.set_compression_codec(ToProto<int>(options->CompressionCodec));
     MiscExt_.set_erasure_codec(ToProto<int>(ChunkWriter_->GetErasureCodecId()));
@@ -72,6 +74,12 @@ void TEncodingChunkWriter::Close()
     }
     SetProtoExtension(Meta_->mutable_extensions(), MiscExt_);
 
+    if (auto dictionary = EncodingWriter_->GetCompressionDictionary()) {
+        NProto::TCompressionDictionaryExt compressionDictionaryExt;
+        compressionDictionaryExt.set_dictionary(dictionary.Begin(), dictionary.Size());
+        SetProtoExtension(Meta_->mutable_extensions(), compressionDictionaryExt);
+    }
+
     WaitFor(ChunkWriter_->Close(Config_->WorkloadDescriptor, Meta_))
         .ThrowOnError();
 
@@ -28,7 +28,8 @@ public:
         TEncodingWriterOptionsPtr options,
         IChunkWriterPtr chunkWriter,
         IBlockCachePtr blockCache,
-        NLogging::TLogger logger);
+        NLogging::TLogger logger,
+        TCompressionDictionaryWriterConfigPtr compressionDictionaryConfig = nullptr);
 
     void WriteBlock(std::vector<TSharedRef> vectorizedBlock, std::optional<int> groupIndex = {});
     void WriteBlock(TSharedRef block, std::optional<int> groupIndex = {});
@@ -7,6 +7,7 @@
 #include <yt/yt/client/node_tracker_client/node_directory.h>
 
 #include <yt/yt/core/compression/codec.h>
+#include <yt/yt/core/compression/dictionary_codec.h>
 
 #include <yt/yt/core/concurrency/action_queue.h>
 
@@ -31,7 +32,8 @@ TEncodingWriter::TEncodingWriter(
     TEncodingWriterOptionsPtr options,
     IChunkWriterPtr chunkWriter,
     IBlockCachePtr blockCache,
-    NLogging::TLogger logger)
+    NLogging::TLogger logger,
+    TCompressionDictionaryWriterConfigPtr compressionDictionaryConfig)
     : Config_(std::move(config))
     , Options_(std::move(options))
     , ChunkWriter_(std::move(chunkWriter))
@@ -39,6 +41,7 @@ TEncodingWriter::TEncodingWriter(
     , Logger(std::move(logger))
     , SizeSemaphore_(New<TAsyncSemaphore>(Config_->EncodeWindowSize))
     , CodecSemaphore_(New<TAsyncSemaphore>(Config_->CompressionConcurrency))
+    , CompressionDictionaryConfig_(std::move(compressionDictionaryConfig))
     , Codec_(NCompression::GetCodec(Options_->CompressionCodec))
     , CompressionInvoker_(CreateFixedPriorityInvoker(
         NRpc::TDispatcher::Get()->GetPrioritizedCompressionPoolInvoker(),
@@ -48,7 +51,16 @@ TEncodingWriter::TEncodingWriter(
         MakeWeak(this)).Via(CompressionInvoker_))
     , CompressionRatio_(Config_->DefaultCompressionRatio)
     , CodecTime_({Options_->CompressionCodec, TDuration::Zero()})
-{ }
+{
+    if (CompressionDictionaryConfig_ && CompressionDictionaryConfig_->Enable) {
+        if (NCompression::TryGetZstdCompressionLevel(Options_->CompressionCodec)) {
+            TrainingCompressionDictionary_ = true;
+        } else {
+            YT_LOG_DEBUG("Compression dictionary is not supported by codec, ignored (Codec: %v)",
+                Options_->CompressionCodec);
+        }
+    }
+}
 
 void TEncodingWriter::WriteBlock(TSharedRef block, std::optional<int> groupIndex)
 {
@@ -56,24 +68,11 @@ void TEncodingWriter::WriteBlock(TSharedRef block, std::optional<int> groupIndex
 
     EnsureOpen();
 
-    UncompressedSize_ += block.Size();
-    SizeSemaphore_->Acquire(block.Size());
-
-    TPromise<TBlock> promise = NewPromise<TBlock>();
-    PendingBlocks_.Enqueue(promise.ToFuture());
-
-    YT_LOG_DEBUG("Pending block added (Block: %v)", AddedBlockIndex_);
-
-    CodecSemaphore_->AsyncAcquire(BIND(
-        &TEncodingWriter::DoCompressBlock,
-        MakeWeak(this),
-        std::move(block),
-        AddedBlockIndex_,
-        groupIndex,
-        std::move(promise)),
-        CompressionInvoker_);
+    i64 blockSize = block.Size();
+    UncompressedSize_ += blockSize;
+    SizeSemaphore_->Acquire(blockSize);
 
-    ++AddedBlockIndex_;
+    AddBlock(std::move(block), blockSize, groupIndex);
 }
 
 void TEncodingWriter::WriteBlock(std::vector<TSharedRef> vectorizedBlock, std::optional<int> groupIndex)
@@ -89,23 +88,123 @@ void TEncodingWriter::WriteBlock(std::vector<TSharedRef> vectorizedBlock, std::o
         UncompressedSize_ += part.Size();
     }
 
+    auto blockSize = GetByteSize(vectorizedBlock);
+    AddBlock(std::move(vectorizedBlock), blockSize, groupIndex);
+}
+
+void TEncodingWriter::AddBlock(
+    TUncompressedBlock block,
+    i64 blockSize,
+    std::optional<int> groupIndex)
+{
     TPromise<TBlock> promise = NewPromise<TBlock>();
     PendingBlocks_.Enqueue(promise.ToFuture());
 
     YT_LOG_DEBUG("Pending block added (Block: %v)", AddedBlockIndex_);
 
-    CodecSemaphore_->AsyncAcquire(BIND(
-        &TEncodingWriter::DoCompressVector,
-        MakeWeak(this),
-        std::move(vectorizedBlock),
-        AddedBlockIndex_,
-        groupIndex,
-        std::move(promise)),
-        CompressionInvoker_);
+    if (TrainingCompressionDictionary_) {
+        HeldBlocks_.push_back({
+            .Block = std::move(block),
+            .BlockIndex = AddedBlockIndex_,
+            .GroupIndex = groupIndex,
+            .Promise = std::move(promise),
+        });
+        HeldBlocksSize_ += blockSize;
+
+        // NB: Held blocks occupy the encode window, so they must be released
+        // before the writer is told to wait for it.
+        if (HeldBlocksSize_ >= CompressionDictionaryConfig_->SampleSize || !SizeSemaphore_->IsReady()) {
+            ReleaseHeldBlocks();
+        }
+    } else {
+        ScheduleCompression(std::move(block), AddedBlockIndex_, groupIndex, std::move(promise));
+    }
 
     ++AddedBlockIndex_;
 }
 
+void TEncodingWriter::ScheduleCompression(
+    TUncompressedBlock block,
+    int blockIndex,
+    std::optional<int> groupIndex,
+    TPromise<TBlock> promise)
+{
+    if (auto* singleBlock = std::get_if<TSharedRef>(&block)) {
+        CodecSemaphore_->AsyncAcquire(BIND(
+            &TEncodingWriter::DoCompressBlock,
+            MakeWeak(this),
+            std::move(*singleBlock),
+            blockIndex,
+            groupIndex,
+            std::move(promise)),
+            CompressionInvoker_);
+    } else {
+        CodecSemaphore_->AsyncAcquire(BIND(
+            &TEncodingWriter::DoCompressVector,
+            MakeWeak(this),
+            std::move(std::get<std::vector<TSharedRef>>(block)),
+            blockIndex,
+            groupIndex,
+            std::move(promise)),
+            CompressionInvoker_);
+    }
+}
+
+void TEncodingWriter::ReleaseHeldBlocks()
+{
+    YT_VERIFY(TrainingCompressionDictionary_);
+    TrainingCompressionDictionary_ = false;
+
+    TrainCompressionDictionary();
+
+    for (auto& heldBlock : HeldBlocks_) {
+        ScheduleCompression(
+            std::move(heldBlock.Block),
+            heldBlock.BlockIndex,
+            heldBlock.GroupIndex,
+            std::move(heldBlock.Promise));
+    }
+    HeldBlocks_.clear();
+    HeldBlocksSize_ = 0;
+}
+
+void TEncodingWriter::TrainCompressionDictionary()
+{
+    struct TCompressionDictionarySampleTag
+    { };
+
+    std::vector<TSharedRef> samples;
+    samples.reserve(HeldBlocks_.size());
+    for (const auto& heldBlock : HeldBlocks_) {
+        if (const auto* singleBlock = std::get_if<TSharedRef>(&heldBlock.Block)) {
+            samples.push_back(*singleBlock);
+        } else {
+            samples.push_back(MergeRefsToRef<TCompressionDictionarySampleTag>(
+                std::get<std::vector<TSharedRef>>(heldBlock.Block)));
+        }
+    }
+
+    try {
+        auto dictionary = NCompression::GetDictionaryCompressionCodec()->TrainCompressionDictionary(
+            CompressionDictionaryConfig_->DictionarySize,
+            samples);
+        DictionaryCodec_ = NCompression::CreateDictionaryBlockCodec(Options_->CompressionCodec, std::move(dictionary));
+        // NB: No block has been scheduled for compression yet.
+        Codec_ = DictionaryCodec_.Get();
+
+        YT_LOG_DEBUG("Compression dictionary trained (SampleCount: %v, SampleSize: %v, DictionarySize: %v)",
+            samples.size(),
+            HeldBlocksSize_,
+            DictionaryCodec_->GetDictionary().Size());
+    } catch (const std::exception& ex) {
+        // Typically the chunk is too small to benefit from a dictionary anyway.
+        YT_LOG_DEBUG(ex, "Failed to train compression dictionary, blocks are compressed without it "
+            "(SampleCount: %v, SampleSize: %v)",
+            samples.size(),
+            HeldBlocksSize_);
+    }
+}
+
 void TEncodingWriter::EnsureOpen()
 {
     if (!OpenFuture_) {
@@ -334,6 +433,10 @@ TFuture<void> TEncodingWriter::Flush()
 {
     YT_LOG_DEBUG("Flushing encoding writer");
 
+    if (TrainingCompressionDictionary_) {
+        ReleaseHeldBlocks();
+    }
+
     // This must be the last enqueued element.
     PendingBlocks_.Enqueue(TBlock());
     return CompletionError_.ToFuture();
@@ -361,6 +464,11 @@ TCodecDuration TEncodingWriter::GetCompressionDuration() const
     return CodecTime_;
 }
 
+TSharedRef TEncodingWriter::GetCompressionDictionary() const
+{
+    return DictionaryCodec_ ? DictionaryCodec_->GetDictionary() : TSharedRef();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NChunkClient
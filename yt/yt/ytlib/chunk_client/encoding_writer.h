@@ -11,6 +11,8 @@
 
 #include <yt/yt/core/logging/log.h>
 
+#include <variant>
+
 namespace NYT::NChunkClient {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -29,7 +31,8 @@ public:
         TEncodingWriterOptionsPtr options,
         IChunkWriterPtr chunkWriter,
         IBlockCachePtr blockCache,
-        NLogging::TLogger logger);
+        NLogging::TLogger logger,
+        TCompressionDictionaryWriterConfigPtr compressionDictionaryConfig = nullptr);
 
     bool IsReady() const;
     TFuture<void> GetReadyEvent();
@@ -42,6 +45,12 @@ public:
 
     TCodecDuration GetCompressionDuration() const;
 
+    //! Returns the dictionary all blocks are compressed with or null if there is none.
+    /*!
+     *  Only meaningful after #Flush is called.
+     */
+    TSharedRef GetCompressionDictionary() const;
+
 private:
     const TEncodingWriterConfigPtr Config_;
     const TEncodingWriterOptionsPtr Options_;
@@ -51,7 +60,8 @@ private:
     const NLogging::TLogger Logger;
     const NConcurrency::TAsyncSemaphorePtr SizeSemaphore_;
     const NConcurrency::TAsyncSemaphorePtr CodecSemaphore_;
-    NCompression::ICodec* const Codec_;
+    const TCompressionDictionaryWriterConfigPtr CompressionDictionaryConfig_;
+    NCompression::ICodec* Codec_;
     const IInvokerPtr CompressionInvoker_;
     const TCallback<void(const TErrorOr<TBlock>&)> WritePendingBlockCallback_;
 
@@ -70,7 +80,35 @@ private:
     TFuture<void> OpenFuture_;
     TPromise<void> CompletionError_ = NewPromise<void>();
 
+    using TUncompressedBlock = std::variant<TSharedRef, std::vector<TSharedRef>>;
+
+    struct THeldBlock
+    {
+        TUncompressedBlock Block;
+        int BlockIndex;
+        std::optional<int> GroupIndex;
+        TPromise<TBlock> Promise;
+    };
+
+    //! While |true|, blocks are held back until enough of them are collected to train a dictionary.
+    bool TrainingCompressionDictionary_ = false;
+    std::vector<THeldBlock> HeldBlocks_;
+    i64 HeldBlocksSize_ = 0;
+    NCompression::IDictionaryBlockCodecPtr DictionaryCodec_;
+
 private:
+    void AddBlock(
+        TUncompressedBlock block,
+        i64 blockSize,
+        std::optional<int> groupIndex);
+    void ScheduleCompression(
+        TUncompressedBlock block,
+        int blockIndex,
+        std::optional<int> groupIndex,
+        TPromise<TBlock> promise);
+    void ReleaseHeldBlocks();
+    void TrainCompressionDictionary();
+
     void WritePendingBlock(const TErrorOr<TBlock>& blockOrError);
 
     void EnsureOpen();
@@ -72,6 +72,15 @@ void SetRpcAttachedBlocks(const TRpcPtr& rpc, const std::vector<TBlock>& blocks)
         rpc->Attachments().push_back(block.Data);
         rpc->add_block_checksums(block.Checksum);
     }
+
+    // Let the transport reuse block checksums instead of computing them once again.
+    if constexpr (requires { rpc->AttachmentChecksums(); }) {
+        if (rpc->AttachmentChecksums().size() + blocks.size() == rpc->Attachments().size()) {
+            for (const auto& block : blocks) {
+                rpc->AttachmentChecksums().push_back(block.Checksum);
+            }
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
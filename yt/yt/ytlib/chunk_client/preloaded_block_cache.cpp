@@ -9,6 +9,7 @@
 
 #include <yt/yt/core/concurrency/scheduler.h>
 #include <yt/yt/core/compression/codec.h>
+#include <yt/yt/core/compression/dictionary_codec.h>
 
 #include <library/cpp/yt/misc/cast.h>
 
@@ -50,7 +51,8 @@ public:
 
     std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
         const NChunkClient::TBlockId& /*id*/,
-        EBlockType /*type*/) override
+        EBlockType /*type*/,
+        const TWorkloadDescriptor& /*workloadDescriptor*/) override
     {
         return nullptr;
     }
@@ -77,6 +79,14 @@ IBlockCachePtr GetPreloadedBlockCache(IChunkReaderPtr chunkReader)
     auto codecId = CheckedEnumCast<NCompression::ECodec>(miscExt.compression_codec());
     auto* codec = NCompression::GetCodec(codecId);
 
+    NCompression::IDictionaryBlockCodecPtr dictionaryCodec;
+    if (auto compressionDictionaryExt = FindProtoExtension<NProto::TCompressionDictionaryExt>(meta->extensions())) {
+        dictionaryCodec = NCompression::CreateDictionaryBlockCodec(
+            codecId,
+            TSharedRef::FromString(std::move(*compressionDictionaryExt->mutable_dictionary())));
+        codec = dictionaryCodec.Get();
+    }
+
     std::vector<TBlock> cachedBlocks;
     for (const auto& compressedBlock : compressedBlocks) {
         cachedBlocks.emplace_back(codec->Decompress(compressedBlock.Data));
@@ -1722,7 +1722,10 @@ private:
             const auto& readerConfig = reader->Config_;
             if (readerConfig->UseBlockCache) {
                 if (reader->Config_->UseAsyncBlockCache) {
-                    auto cookie = blockCache->GetBlockCookie(blockId, EBlockType::CompressedData);
+                    auto cookie = blockCache->GetBlockCookie(
+                        blockId,
+                        EBlockType::CompressedData,
+                        SessionOptions_.WorkloadDescriptor);
                     if (cookie->IsActive()) {
                         uncachedBlocks.push_back(TBlockWithCookie(blockIndex, std::move(cookie)));
                     } else {
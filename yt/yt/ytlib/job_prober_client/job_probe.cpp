@@ -11,6 +11,7 @@
 
 namespace NYT::NJobProberClient {
 
+using NBus::IBusClientPtr;
 using NBus::TBusClientConfigPtr;
 using NChunkClient::TChunkId;
 using NYson::TYsonString;
@@ -26,8 +27,8 @@ class TJobProberClient
     : public IJobProbe
 {
 public:
-    TJobProberClient(TBusClientConfigPtr config, TJobId jobId)
-        : TcpBusClientConfig_(config)
+    TJobProberClient(IBusClientPtr client, TJobId jobId)
+        : BusClient_(std::move(client))
         , JobId_(jobId)
     { }
 
@@ -122,7 +123,7 @@ public:
     }
 
 private:
-    const TBusClientConfigPtr TcpBusClientConfig_;
+    const IBusClientPtr BusClient_;
     const TJobId JobId_;
 
     YT_DECLARE_SPIN_LOCK(NThreading::TSpinLock, SpinLock_);
@@ -133,8 +134,7 @@ private:
     {
         auto guard = Guard(SpinLock_);
         if (!JobProberProxy_) {
-            auto client = CreateBusClient(TcpBusClientConfig_);
-            auto channel = NRpc::NBus::CreateBusChannel(std::move(client));
+            auto channel = NRpc::NBus::CreateBusChannel(BusClient_);
             JobProberProxy_ = std::make_unique<TJobProberServiceProxy>(std::move(channel));
         }
         return JobProberProxy_.get();
@@ -147,7 +147,14 @@ IJobProbePtr CreateJobProbe(
     NBus::TBusClientConfigPtr config,
     TJobId jobId)
 {
-    return New<TJobProberClient>(config, jobId);
+    return CreateJobProbe(CreateBusClient(std::move(config)), jobId);
+}
+
+IJobProbePtr CreateJobProbe(
+    IBusClientPtr client,
+    TJobId jobId)
+{
+    return New<TJobProberClient>(std::move(client), jobId);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
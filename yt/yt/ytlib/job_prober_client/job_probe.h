@@ -42,6 +42,11 @@ IJobProbePtr CreateJobProbe(
     NBus::TBusClientConfigPtr config,
     NJobTrackerClient::TJobId jobId);
 
+//! Same as above but talks to the job proxy via an arbitrary (e.g. shared memory) bus #client.
+IJobProbePtr CreateJobProbe(
+    NBus::IBusClientPtr client,
+    NJobTrackerClient::TJobId jobId);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NJobProberClient
@@ -354,7 +354,8 @@ TBlockManagerFactory CreateAsyncBlockWindowManagerFactory(
                 CheckedEnumCast<NCompression::ECodec>(chunkMeta->Misc().compression_codec()),
                 static_cast<double>(compressedSize) / uncompressedSize,
                 chunkReadOptions,
-                sessionInvoker);
+                sessionInvoker,
+                chunkMeta->GetDictionaryBlockCodec());
 
             blockFetcher->Start();
 
@@ -385,8 +386,10 @@ public:
         : BlockHolders_(std::move(blockHolders))
         , BlockCache_(std::move(blockCache))
         , ChunkId_(chunkId)
+        , DictionaryCodec_(chunkMeta->GetDictionaryBlockCodec())
     {
         YT_VERIFY(TryEnumCast(chunkMeta->Misc().compression_codec(), &CodecId_));
+        Codec_ = chunkMeta->GetBlockCodec();
     }
 
     void ClearUsedBlocks() override
@@ -440,6 +443,9 @@ private:
     NChunkClient::IBlockCachePtr BlockCache_;
     NChunkClient::TChunkId ChunkId_;
     NCompression::ECodec CodecId_;
+    //! Keeps #Codec_ alive if blocks are compressed with a dictionary.
+    const NCompression::IDictionaryBlockCodecPtr DictionaryCodec_;
+    NCompression::ICodec* Codec_;
     std::vector<TSharedRef> UsedBlocks_;
 
     TDuration DecompressionDuration_;
@@ -455,10 +461,8 @@ private:
 
         auto compressedBlock = BlockCache_->FindBlock(blockId, EBlockType::CompressedData).Block;
         if (compressedBlock) {
-            auto* codec = NCompression::GetCodec(CodecId_);
-
             NProfiling::TFiberWallTimer timer;
-            auto uncompressedBlock = codec->Decompress(compressedBlock.Data);
+            auto uncompressedBlock = Codec_->Decompress(compressedBlock.Data);
             DecompressionDuration_ += timer.GetElapsedTime();
 
             if (CodecId_ != NCompression::ECodec::None) {
@@ -0,0 +1,270 @@
+#include "key_predicate_kernels.h"
+
+#include <library/cpp/yt/small_containers/compact_vector.h>
+
+#include <util/system/cpu_id.h>
+
+#if defined(__clang__) && defined(__x86_64__)
+#    include <immintrin.h>
+#endif
+
+namespace NYT::NNewTableClient {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Larger IN-lists are evaluated with binary search.
+constexpr int MaxVectorizedInListSize = 16;
+
+// Predicates are reduced to these by (possibly) inverting the result.
+DEFINE_ENUM(EBasePredicateOp,
+    (Equal)
+    (Less)
+    (Greater)
+    (In)
+);
+
+std::pair<EBasePredicateOp, bool> NormalizePredicateOp(EKeyPredicateOp op)
+{
+    switch (op) {
+        case EKeyPredicateOp::Equal:
+            return {EBasePredicateOp::Equal, false};
+        case EKeyPredicateOp::NotEqual:
+            return {EBasePredicateOp::Equal, true};
+        case EKeyPredicateOp::Less:
+            return {EBasePredicateOp::Less, false};
+        case EKeyPredicateOp::GreaterOrEqual:
+            return {EBasePredicateOp::Less, true};
+        case EKeyPredicateOp::Greater:
+            return {EBasePredicateOp::Greater, false};
+        case EKeyPredicateOp::LessOrEqual:
+            return {EBasePredicateOp::Greater, true};
+        case EKeyPredicateOp::In:
+            return {EBasePredicateOp::In, false};
+    }
+    YT_ABORT();
+}
+
+// All kernels operate on signed words; unsigned values are biased by flipping the sign bit,
+// which preserves their order.
+constexpr i64 GetBias(bool isUnsigned)
+{
+    return isUnsigned ? std::numeric_limits<i64>::min() : 0;
+}
+
+void EvaluateScalar(
+    const i64* values,
+    i64 beginIndex,
+    i64 endIndex,
+    EBasePredicateOp op,
+    TRange<i64> sortedConstants,
+    i64 bias,
+    ui64* resultBitmap)
+{
+    for (auto index = beginIndex; index < endIndex; ++index) {
+        auto value = values[index] ^ bias;
+        bool result;
+        switch (op) {
+            case EBasePredicateOp::Equal:
+                result = value == sortedConstants[0];
+                break;
+            case EBasePredicateOp::Less:
+                result = value < sortedConstants[0];
+                break;
+            case EBasePredicateOp::Greater:
+                result = value > sortedConstants[0];
+                break;
+            case EBasePredicateOp::In:
+                result = std::binary_search(sortedConstants.begin(), sortedConstants.end(), value);
+                break;
+        }
+        resultBitmap[index >> 6] |= static_cast<ui64>(result) << (index & 63);
+    }
+}
+
+#if defined(__clang__) && defined(__x86_64__)
+
+__attribute__((target("avx2")))
+i64 EvaluateAvx2(
+    const i64* values,
+    i64 count,
+    EBasePredicateOp op,
+    TRange<i64> constants,
+    i64 bias,
+    ui64* resultBitmap)
+{
+    const auto biasVector = _mm256_set1_epi64x(bias);
+    __m256i constantVectors[MaxVectorizedInListSize];
+    for (int index = 0; index < std::ssize(constants); ++index) {
+        constantVectors[index] = _mm256_set1_epi64x(constants[index]);
+    }
+
+    i64 index = 0;
+    for (; index + 4 <= count; index += 4) {
+        auto vector = _mm256_xor_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index)),
+            biasVector);
+
+        __m256i mask;
+        switch (op) {
+            case EBasePredicateOp::Equal:
+                mask = _mm256_cmpeq_epi64(vector, constantVectors[0]);
+                break;
+            case EBasePredicateOp::Less:
+                mask = _mm256_cmpgt_epi64(constantVectors[0], vector);
+                break;
+            case EBasePredicateOp::Greater:
+                mask = _mm256_cmpgt_epi64(vector, constantVectors[0]);
+                break;
+            case EBasePredicateOp::In:
+                mask = _mm256_setzero_si256();
+                for (int constantIndex = 0; constantIndex < std::ssize(constants); ++constantIndex) {
+                    mask = _mm256_or_si256(mask, _mm256_cmpeq_epi64(vector, constantVectors[constantIndex]));
+                }
+                break;
+        }
+
+        auto bits = static_cast<ui64>(_mm256_movemask_pd(_mm256_castsi256_pd(mask)));
+        resultBitmap[index >> 6] |= bits << (index & 63);
+    }
+
+    return index;
+}
+
+__attribute__((target("sse4.2")))
+i64 EvaluateSse42(
+    const i64* values,
+    i64 count,
+    EBasePredicateOp op,
+    TRange<i64> constants,
+    i64 bias,
+    ui64* resultBitmap)
+{
+    const auto biasVector = _mm_set1_epi64x(bias);
+    __m128i constantVectors[MaxVectorizedInListSize];
+    for (int index = 0; index < std::ssize(constants); ++index) {
+        constantVectors[index] = _mm_set1_epi64x(constants[index]);
+    }
+
+    i64 index = 0;
+    for (; index + 2 <= count; index += 2) {
+        auto vector = _mm_xor_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)),
+            biasVector);
+
+        __m128i mask;
+        switch (op) {
+            case EBasePredicateOp::Equal:
+                mask = _mm_cmpeq_epi64(vector, constantVectors[0]);
+                break;
+            case EBasePredicateOp::Less:
+                mask = _mm_cmpgt_epi64(constantVectors[0], vector);
+                break;
+            case EBasePredicateOp::Greater:
+                mask = _mm_cmpgt_epi64(vector, constantVectors[0]);
+                break;
+            case EBasePredicateOp::In:
+                mask = _mm_setzero_si128();
+                for (int constantIndex = 0; constantIndex < std::ssize(constants); ++constantIndex) {
+                    mask = _mm_or_si128(mask, _mm_cmpeq_epi64(vector, constantVectors[constantIndex]));
+                }
+                break;
+        }
+
+        auto bits = static_cast<ui64>(_mm_movemask_pd(_mm_castsi128_pd(mask)));
+        resultBitmap[index >> 6] |= bits << (index & 63);
+    }
+
+    return index;
+}
+
+#endif
+
+void DoEvaluateKeyPredicate(
+    const i64* values,
+    i64 count,
+    EKeyPredicateOp op,
+    TRange<i64> constants,
+    bool isUnsigned,
+    ui64* resultBitmap)
+{
+    auto wordCount = (count + 63) / 64;
+    std::fill(resultBitmap, resultBitmap + wordCount, 0);
+
+    auto [baseOp, invert] = NormalizePredicateOp(op);
+    auto bias = GetBias(isUnsigned);
+
+    if (baseOp == EBasePredicateOp::In && constants.Empty()) {
+        // Nothing matches.
+    } else {
+        YT_VERIFY(baseOp == EBasePredicateOp::In || constants.Size() == 1);
+
+        TCompactVector<i64, MaxVectorizedInListSize> biasedConstants;
+        biasedConstants.reserve(constants.Size());
+        for (auto constant : constants) {
+            biasedConstants.push_back(constant ^ bias);
+        }
+        std::sort(biasedConstants.begin(), biasedConstants.end());
+        auto sortedConstants = MakeRange(biasedConstants);
+
+        i64 scalarBeginIndex = 0;
+#if defined(__clang__) && defined(__x86_64__)
+        if (baseOp != EBasePredicateOp::In || std::ssize(sortedConstants) <= MaxVectorizedInListSize) {
+            if (NX86::CachedHaveAVX2()) {
+                scalarBeginIndex = EvaluateAvx2(values, count, baseOp, sortedConstants, bias, resultBitmap);
+            } else if (NX86::CachedHaveSSE42()) {
+                scalarBeginIndex = EvaluateSse42(values, count, baseOp, sortedConstants, bias, resultBitmap);
+            }
+        }
+#endif
+        EvaluateScalar(values, scalarBeginIndex, count, baseOp, sortedConstants, bias, resultBitmap);
+    }
+
+    if (invert) {
+        for (i64 wordIndex = 0; wordIndex < wordCount; ++wordIndex) {
+            resultBitmap[wordIndex] = ~resultBitmap[wordIndex];
+        }
+        if (count & 63) {
+            resultBitmap[wordCount - 1] &= (1ULL << (count & 63)) - 1;
+        }
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EvaluateKeyPredicate(
+    TRange<i64> values,
+    EKeyPredicateOp op,
+    TRange<i64> constants,
+    ui64* resultBitmap)
+{
+    DoEvaluateKeyPredicate(
+        values.Begin(),
+        std::ssize(values),
+        op,
+        constants,
+        /*isUnsigned*/ false,
+        resultBitmap);
+}
+
+void EvaluateKeyPredicate(
+    TRange<ui64> values,
+    EKeyPredicateOp op,
+    TRange<ui64> constants,
+    ui64* resultBitmap)
+{
+    DoEvaluateKeyPredicate(
+        reinterpret_cast<const i64*>(values.Begin()),
+        std::ssize(values),
+        op,
+        MakeRange(reinterpret_cast<const i64*>(constants.Begin()), constants.Size()),
+        /*isUnsigned*/ true,
+        resultBitmap);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NNewTableClient
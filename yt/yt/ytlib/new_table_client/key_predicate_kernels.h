@@ -0,0 +1,28 @@
+#pragma once
+
+#include "public.h"
+
+#include <library/cpp/yt/memory/range.h>
+
+namespace NYT::NNewTableClient {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Evaluates #op over #values and sets the i-th bit of #resultBitmap iff it holds for the i-th value.
+//! #resultBitmap must hold at least (values.Size() + 63) / 64 words; it is overwritten.
+//! Uses AVX2 or SSE4.2 kernels when available.
+void EvaluateKeyPredicate(
+    TRange<i64> values,
+    EKeyPredicateOp op,
+    TRange<i64> constants,
+    ui64* resultBitmap);
+
+void EvaluateKeyPredicate(
+    TRange<ui64> values,
+    EKeyPredicateOp op,
+    TRange<ui64> constants,
+    ui64* resultBitmap);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NNewTableClient
@@ -71,6 +71,38 @@ struct TKeysWithHints
     TSharedRange<NTableClient::TLegacyKey> Keys;
 };
 
+DEFINE_ENUM(EKeyPredicateOp,
+    (Equal)
+    (NotEqual)
+    (Less)
+    (LessOrEqual)
+    (Greater)
+    (GreaterOrEqual)
+    (In)
+);
+
+//! Compares a key column with constants.
+/*!
+ *  Int64 and Uint64 columns are filtered with SIMD kernels, Boolean and String columns value by value.
+ *  Predicates over other columns or with constants of another type are ignored.
+ *  Null column values are never filtered out.
+ */
+struct TKeyColumnPredicate
+{
+    int KeyColumnIndex = 0;
+    EKeyPredicateOp Op = EKeyPredicateOp::Equal;
+    //! Single constant for comparisons, list of admissible values for #EKeyPredicateOp::In.
+    TSharedRange<NTableClient::TUnversionedValue> Constants;
+};
+
+//! Row ranges accompanied by a conjunction of key column predicates.
+//! Rows that do not satisfy the predicates are skipped before materialization.
+struct TRowRangesWithPredicates
+{
+    TSharedRange<NTableClient::TRowRange> Ranges;
+    std::vector<TKeyColumnPredicate> Predicates;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NNewTableClient
@@ -92,6 +92,18 @@ TReadSpan TColumnIterator<Type>::SkipWhile(TPredicate pred)
     return TReadSpan{lower, upper};
 }
 
+template <EValueType Type>
+template <class TConsumer>
+void TColumnIterator<Type>::ForEachValue(TConsumer consumer)
+{
+    while (Span_.Lower < Span_.Upper) {
+        SkipTo(Span_.Lower);
+        auto upper = std::min(UpperRowBound(Position_), Span_.Upper);
+        consumer(TReadSpan{Span_.Lower, upper}, GetValue(Position_));
+        Span_.Lower = upper;
+    }
+}
+
 template <EValueType Type>
 bool TColumnIterator<Type>::IsExhausted() const
 {
@@ -55,6 +55,11 @@ public:
     template <class TPredicate>
     Y_FORCE_INLINE TReadSpan SkipWhile(TPredicate pred);
 
+    //! Calls #consumer(rowSpan, value) for each run of a single value within the read span.
+    //! Exhausts the span.
+    template <class TConsumer>
+    void ForEachValue(TConsumer consumer);
+
     bool IsExhausted() const;
 
 private:
@@ -3,6 +3,7 @@
 #include "dispatch_by_type.h"
 #include "reader_statistics.h"
 #include "column_block_manager.h"
+#include "key_predicate_kernels.h"
 
 namespace NYT::NNewTableClient {
 
@@ -1812,6 +1813,228 @@ struct TColumnRefiner
 
 ////////////////////////////////////////////////////////////////////////////////
 
+struct IKeyPredicateFilter
+{
+    virtual ~IKeyPredicateFilter() = default;
+
+    //! Appends parts of #spans containing rows that satisfy the predicate to #result.
+    virtual void Filter(
+        TRange<TReadSpan> spans,
+        std::vector<TReadSpan>* result) = 0;
+};
+
+template <EValueType Type>
+class TKeyPredicateFilterBase
+    : public IKeyPredicateFilter
+    , public TColumnIterator<Type>
+    , public TColumnBase
+{
+protected:
+    using TIterator = TColumnIterator<Type>;
+
+    explicit TKeyPredicateFilterBase(const TColumnBase* columnInfo)
+        : TColumnBase(columnInfo)
+    { }
+
+    //! Calls #consumer(rowSpan, value) for each run of a single key value within #spans.
+    //! Key columns are run-length encoded, so predicates are evaluated once per run.
+    template <class TConsumer>
+    void ForEachRun(TRange<TReadSpan> spans, TConsumer consumer)
+    {
+        if (GetBlock()) {
+            // Blocks are not set for null columns.
+            TIterator::SetBlock(GetBlock(), GetSegmentMetas<TKeyMeta<Type>>());
+        }
+
+        for (auto span : spans) {
+            TIterator::SetReadSpan(span);
+            TIterator::ForEachValue(consumer);
+        }
+    }
+
+    static void AppendSpan(std::vector<TReadSpan>* result, TReadSpan span)
+    {
+        if (!result->empty() && result->back().Upper == span.Lower) {
+            result->back().Upper = span.Upper;
+        } else {
+            result->push_back(span);
+        }
+    }
+};
+
+//! Evaluates predicates over integer columns in batches with SIMD kernels.
+template <EValueType Type>
+class TIntegerKeyPredicateFilter
+    : public TKeyPredicateFilterBase<Type>
+{
+public:
+    static_assert(Type == EValueType::Int64 || Type == EValueType::Uint64);
+
+    using TValue = std::conditional_t<Type == EValueType::Int64, i64, ui64>;
+
+    TIntegerKeyPredicateFilter(const TColumnBase* columnInfo, const TKeyColumnPredicate& predicate)
+        : TKeyPredicateFilterBase<Type>(columnInfo)
+        , Op_(predicate.Op)
+    {
+        Constants_.reserve(predicate.Constants.size());
+        for (const auto& constant : predicate.Constants) {
+            if constexpr (Type == EValueType::Int64) {
+                Constants_.push_back(constant.Data.Int64);
+            } else {
+                Constants_.push_back(constant.Data.Uint64);
+            }
+        }
+    }
+
+    void Filter(
+        TRange<TReadSpan> spans,
+        std::vector<TReadSpan>* result) override
+    {
+        this->ForEachRun(spans, [&] (TReadSpan valueSpan, const TUnversionedValue& value) {
+            IsNull_[Count_] = value.Type == EValueType::Null;
+            if constexpr (Type == EValueType::Int64) {
+                Values_[Count_] = value.Data.Int64;
+            } else {
+                Values_[Count_] = value.Data.Uint64;
+            }
+            Spans_[Count_] = valueSpan;
+
+            if (++Count_ == BatchSize) {
+                Flush(result);
+            }
+        });
+
+        Flush(result);
+    }
+
+private:
+    static constexpr int BatchSize = 256;
+
+    const EKeyPredicateOp Op_;
+    std::vector<TValue> Constants_;
+
+    int Count_ = 0;
+    std::array<TValue, BatchSize> Values_;
+    std::array<TReadSpan, BatchSize> Spans_;
+    std::array<bool, BatchSize> IsNull_;
+    std::array<ui64, BatchSize / 64> ResultBitmap_;
+
+    void Flush(std::vector<TReadSpan>* result)
+    {
+        if (Count_ == 0) {
+            return;
+        }
+
+        EvaluateKeyPredicate(
+            MakeRange(Values_.data(), Count_),
+            Op_,
+            MakeRange(Constants_),
+            ResultBitmap_.data());
+
+        for (int index = 0; index < Count_; ++index) {
+            // Nulls are left for the query to decide upon.
+            if (IsNull_[index] || (ResultBitmap_[index >> 6] & (1ULL << (index & 63)))) {
+                this->AppendSpan(result, Spans_[index]);
+            }
+        }
+
+        Count_ = 0;
+    }
+};
+
+//! Evaluates predicates over boolean and string columns value by value.
+template <EValueType Type>
+class TComparingKeyPredicateFilter
+    : public TKeyPredicateFilterBase<Type>
+{
+public:
+    static_assert(Type == EValueType::Boolean || Type == EValueType::String);
+
+    TComparingKeyPredicateFilter(const TColumnBase* columnInfo, const TKeyColumnPredicate& predicate)
+        : TKeyPredicateFilterBase<Type>(columnInfo)
+        , Op_(predicate.Op)
+        , Constants_(predicate.Constants)
+    { }
+
+    void Filter(
+        TRange<TReadSpan> spans,
+        std::vector<TReadSpan>* result) override
+    {
+        this->ForEachRun(spans, [&] (TReadSpan valueSpan, const TUnversionedValue& value) {
+            // Nulls are left for the query to decide upon.
+            if (value.Type == EValueType::Null || Matches(value)) {
+                this->AppendSpan(result, valueSpan);
+            }
+        });
+    }
+
+private:
+    const EKeyPredicateOp Op_;
+    const TSharedRange<TUnversionedValue> Constants_;
+
+    bool Matches(const TUnversionedValue& value) const
+    {
+        if (Op_ == EKeyPredicateOp::In) {
+            return std::any_of(Constants_.begin(), Constants_.end(), [&] (const TUnversionedValue& constant) {
+                return CompareValues<Type>(value, constant) == 0;
+            });
+        }
+
+        int result = CompareValues<Type>(value, Constants_[0]);
+        switch (Op_) {
+            case EKeyPredicateOp::Equal:
+                return result == 0;
+            case EKeyPredicateOp::NotEqual:
+                return result != 0;
+            case EKeyPredicateOp::Less:
+                return result < 0;
+            case EKeyPredicateOp::LessOrEqual:
+                return result <= 0;
+            case EKeyPredicateOp::Greater:
+                return result > 0;
+            case EKeyPredicateOp::GreaterOrEqual:
+                return result >= 0;
+            default:
+                YT_ABORT();
+        }
+    }
+};
+
+std::unique_ptr<IKeyPredicateFilter> CreateKeyPredicateFilter(
+    EValueType type,
+    const TColumnBase* columnInfo,
+    const TKeyColumnPredicate& predicate)
+{
+    if (predicate.Constants.Empty() ||
+        (predicate.Op != EKeyPredicateOp::In && predicate.Constants.Size() != 1))
+    {
+        return nullptr;
+    }
+
+    // Comparisons across types are left for the query to decide upon.
+    for (const auto& constant : predicate.Constants) {
+        if (constant.Type != type) {
+            return nullptr;
+        }
+    }
+
+    switch (type) {
+        case EValueType::Int64:
+            return std::make_unique<TIntegerKeyPredicateFilter<EValueType::Int64>>(columnInfo, predicate);
+        case EValueType::Uint64:
+            return std::make_unique<TIntegerKeyPredicateFilter<EValueType::Uint64>>(columnInfo, predicate);
+        case EValueType::Boolean:
+            return std::make_unique<TComparingKeyPredicateFilter<EValueType::Boolean>>(columnInfo, predicate);
+        case EValueType::String:
+            return std::make_unique<TComparingKeyPredicateFilter<EValueType::String>>(columnInfo, predicate);
+        default:
+            // NB: Doubles are not filtered since the query throws on NaN comparisons.
+            return nullptr;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 // Environment variable options for debug and benchmark purposes.
 #ifdef FULL_UNPACK
 static bool IsFullUnpack()
@@ -1842,6 +2065,7 @@ public:
 
     TRangeReader(
         TSharedRange<TRowRange> keyRanges,
+        TRange<TKeyColumnPredicate> keyPredicates,
         const TRowsetBuilderParams& params)
         : TRowsetBuilder<TReadSpan>(params)
         , KeyRanges_(std::move(keyRanges))
@@ -1849,6 +2073,18 @@ public:
         for (int index = 0; index < std::ssize(params.KeyTypes); ++index) {
             ColumnRefiners_.push_back(DispatchByDataType<TCreateRefiner>(params.KeyTypes[index], &params.ColumnInfos[index]));
         }
+
+        for (const auto& predicate : keyPredicates) {
+            YT_VERIFY(predicate.KeyColumnIndex >= 0 && predicate.KeyColumnIndex < std::ssize(params.KeyTypes));
+            auto filter = CreateKeyPredicateFilter(
+                params.KeyTypes[predicate.KeyColumnIndex],
+                &params.ColumnInfos[predicate.KeyColumnIndex],
+                predicate);
+            // Predicates over unsupported column types are not applied.
+            if (filter) {
+                KeyPredicateFilters_.push_back(std::move(filter));
+            }
+        }
     }
 
     bool IsReadListEmpty() const override
@@ -2021,6 +2257,9 @@ private:
     const TSharedRange<TRowRange> KeyRanges_;
     std::vector<std::unique_ptr<IColumnRefiner<TRowRange>>> ColumnRefiners_;
 
+    std::vector<std::unique_ptr<IKeyPredicateFilter>> KeyPredicateFilters_;
+    std::vector<TReadSpan> FilteredReadList_;
+
     ui32 GetStartRowIndex() const
     {
         YT_VERIFY(!ReadList_.empty());
@@ -2081,6 +2320,19 @@ private:
         }
 
         ReadList_ = MakeMutableRange(ReadListHolder_.GetData(), it);
+
+        for (const auto& filter : KeyPredicateFilters_) {
+            if (ReadList_.empty()) {
+                break;
+            }
+
+            FilteredReadList_.clear();
+            filter->Filter(ReadList_, &FilteredReadList_);
+
+            auto* data = ReadListHolder_.Resize(FilteredReadList_.size());
+            std::copy(FilteredReadList_.begin(), FilteredReadList_.end(), data);
+            ReadList_ = MakeMutableRange(data, FilteredReadList_.size());
+        }
     }
 };
 
@@ -2088,7 +2340,17 @@ std::unique_ptr<IRowsetBuilder> CreateRowsetBuilder(
     TSharedRange<TRowRange> keyRanges,
     const TRowsetBuilderParams& params)
 {
-    return std::make_unique<TRangeReader>(std::move(keyRanges), params);
+    return std::make_unique<TRangeReader>(std::move(keyRanges), TRange<TKeyColumnPredicate>(), params);
+}
+
+std::unique_ptr<IRowsetBuilder> CreateRowsetBuilder(
+    TRowRangesWithPredicates rangesWithPredicates,
+    const TRowsetBuilderParams& params)
+{
+    return std::make_unique<TRangeReader>(
+        std::move(rangesWithPredicates.Ranges),
+        MakeRange(rangesWithPredicates.Predicates),
+        params);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
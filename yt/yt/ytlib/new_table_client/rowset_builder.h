@@ -71,6 +71,10 @@ std::unique_ptr<IRowsetBuilder> CreateRowsetBuilder(
     TKeysWithHints keysWithHints,
     const TRowsetBuilderParams& params);
 
+std::unique_ptr<IRowsetBuilder> CreateRowsetBuilder(
+    TRowRangesWithPredicates rangesWithPredicates,
+    const TRowsetBuilderParams& params);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace NYT::NNewTableClient
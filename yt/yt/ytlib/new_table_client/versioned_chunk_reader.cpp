@@ -185,6 +185,14 @@ std::vector<TSpanMatching> BuildReadWindows(
         TPredicate{chunkMeta->GetChunkKeyColumnCount(), keyColumnCount});
 }
 
+std::vector<TSpanMatching> BuildReadWindows(
+    const TRowRangesWithPredicates& rangesWithPredicates,
+    const TCachedVersionedChunkMetaPtr& chunkMeta,
+    int keyColumnCount)
+{
+    return BuildReadWindows(rangesWithPredicates.Ranges, chunkMeta, keyColumnCount);
+}
+
 std::vector<TSpanMatching> BuildReadWindows(
     TRange<TLegacyKey> keys,
     const TCachedVersionedChunkMetaPtr& chunkMeta,
@@ -586,6 +594,11 @@ bool IsKeys(const TSharedRange<TRowRange>&)
     return false;
 }
 
+bool IsKeys(const TRowRangesWithPredicates&)
+{
+    return false;
+}
+
 bool IsKeys(const TSharedRange<TLegacyKey>&)
 {
     return true;
@@ -601,6 +614,11 @@ size_t GetReadItemCount(const TSharedRange<TRowRange>& readItems)
     return readItems.size();
 }
 
+size_t GetReadItemCount(const TRowRangesWithPredicates& readItems)
+{
+    return readItems.Ranges.size();
+}
+
 size_t GetReadItemCount(const TSharedRange<TLegacyKey>& readItems)
 {
     return readItems.size();
@@ -756,6 +774,19 @@ IVersionedReaderPtr CreateVersionedChunkReader<TSharedRange<TRowRange>>(
     bool produceAll,
     TReaderStatisticsPtr readerStatistics);
 
+template
+IVersionedReaderPtr CreateVersionedChunkReader<TRowRangesWithPredicates>(
+    TRowRangesWithPredicates readItems,
+    TTimestamp timestamp,
+    TCachedVersionedChunkMetaPtr chunkMeta,
+    const TTableSchemaPtr& tableSchema,
+    const TColumnFilter& columnFilter,
+    const TChunkColumnMappingPtr& chunkColumnMapping,
+    TBlockManagerFactory blockManagerFactory,
+    TChunkReaderPerformanceCountersPtr performanceCounters,
+    bool produceAll,
+    TReaderStatisticsPtr readerStatistics);
+
 template
 IVersionedReaderPtr CreateVersionedChunkReader<TSharedRange<TLegacyKey>>(
     TSharedRange<TLegacyKey> readItems,
@@ -0,0 +1,272 @@
+#include "helpers.h"
+
+#include <yt/yt/client/table_client/helpers.h>
+
+#include <yt/yt/core/misc/random.h>
+
+namespace NYT::NTableClient {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const std::vector<NCompression::ECodec> Codecs = {
+    NCompression::ECodec::None,
+    NCompression::ECodec::Lz4,
+    NCompression::ECodec::Zstd_3,
+};
+
+constexpr int WideValueColumnCount = 64;
+constexpr int DistinctDuplicateCount = 16;
+constexpr int StringLength = 24;
+constexpr TTimestamp WriteTimestamp = 0x1000;
+
+EValueType GetValueColumnType(int index)
+{
+    static const EValueType Types[] = {
+        EValueType::Int64,
+        EValueType::String,
+        EValueType::Double,
+        EValueType::Boolean,
+        EValueType::Uint64,
+    };
+    return Types[index % std::size(Types)];
+}
+
+class TRowGenerator
+{
+public:
+    TRowGenerator(const TDataOptions& options, const TRowBufferPtr& rowBuffer)
+        : Options_(options)
+        , Schema_(MakeSchema(options))
+        , RowBuffer_(rowBuffer)
+        , Random_(42)
+    { }
+
+    int GetKeyColumnCount() const
+    {
+        return Options_.Wide ? 2 : 1;
+    }
+
+    int GetValueColumnCount() const
+    {
+        return Schema_->GetColumnCount() - GetKeyColumnCount();
+    }
+
+    void FillKey(TUnversionedValue* key, int rowIndex)
+    {
+        // Unsorted datasets get keys in random order.
+        i64 keyIndex = Options_.Sorted
+            ? rowIndex
+            : static_cast<i64>(Random_.Generate<ui64>() % Options_.RowCount);
+
+        key[0] = MakeUnversionedInt64Value(keyIndex, 0);
+        if (Options_.Wide) {
+            key[1] = RowBuffer_->CaptureValue(MakeUnversionedStringValue(Format("key_%010v", keyIndex), 1));
+        }
+    }
+
+    TUnversionedValue GenerateValue(int valueIndex)
+    {
+        int id = GetKeyColumnCount() + valueIndex;
+        auto type = Schema_->Columns()[id].GetWireType();
+
+        if (static_cast<int>(Random_.Generate<ui64>() % 100) < Options_.NullPercent) {
+            return MakeUnversionedNullValue(id);
+        }
+
+        ui64 seed = static_cast<int>(Random_.Generate<ui64>() % 100) < Options_.DuplicatePercent
+            ? Random_.Generate<ui64>() % DistinctDuplicateCount
+            : Random_.Generate<ui64>();
+
+        switch (type) {
+            case EValueType::Int64:
+                return MakeUnversionedInt64Value(static_cast<i64>(seed >> 16), id);
+            case EValueType::Uint64:
+                return MakeUnversionedUint64Value(seed >> 16, id);
+            case EValueType::Double:
+                return MakeUnversionedDoubleValue(static_cast<double>(seed >> 16) / 1024, id);
+            case EValueType::Boolean:
+                return MakeUnversionedBooleanValue(seed & 1, id);
+            case EValueType::String: {
+                char* data = RowBuffer_->GetPool()->AllocateUnaligned(StringLength);
+                for (int index = 0; index < StringLength; ++index) {
+                    data[index] = 'a' + (seed >> (index % 8 * 8)) % 26;
+                }
+                return MakeUnversionedStringValue(TStringBuf(data, StringLength), id);
+            }
+            default:
+                YT_ABORT();
+        }
+    }
+
+private:
+    const TDataOptions Options_;
+    const TTableSchemaPtr Schema_;
+    const TRowBufferPtr RowBuffer_;
+
+    TRandomGenerator Random_;
+};
+
+TRange<TUnversionedValue> GetKeyValues(TUnversionedRow row, int keyColumnCount)
+{
+    return MakeRange(row.Begin(), keyColumnCount);
+}
+
+TRange<TUnversionedValue> GetKeyValues(TVersionedRow row, int /*keyColumnCount*/)
+{
+    return row.Keys();
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TDataOptions ParseDataOptions(const benchmark::State& state)
+{
+    return TDataOptions{
+        .Wide = state.range(0) != 0,
+        .Sorted = state.range(1) != 0,
+        .OptimizeFor = state.range(2) != 0 ? EOptimizeFor::Scan : EOptimizeFor::Lookup,
+        .Codec = Codecs[state.range(3)],
+        .NullPercent = static_cast<int>(state.range(4)),
+        .DuplicatePercent = static_cast<int>(state.range(5)),
+    };
+}
+
+void ApplyDataArguments(benchmark::internal::Benchmark* benchmark, bool allowUnsorted)
+{
+    benchmark
+        ->ArgNames({"wide", "sorted", "scan", "codec", "null_pct", "dup_pct"})
+        ->ArgsProduct({
+            {0, 1},
+            allowUnsorted ? std::vector<i64>{0, 1} : std::vector<i64>{1},
+            {0, 1},
+            {0, 1, 2},
+            {0, 50},
+            {0, 90},
+        })
+        ->Unit(benchmark::kMillisecond);
+}
+
+TTableSchemaPtr MakeSchema(const TDataOptions& options)
+{
+    auto sortOrder = options.Sorted ? std::make_optional(ESortOrder::Ascending) : std::nullopt;
+
+    std::vector<TColumnSchema> columns;
+    columns.push_back(TColumnSchema("k0", EValueType::Int64, sortOrder));
+    if (options.Wide) {
+        columns.push_back(TColumnSchema("k1", EValueType::String, sortOrder));
+    }
+
+    int valueColumnCount = options.Wide ? WideValueColumnCount : 4;
+    for (int index = 0; index < valueColumnCount; ++index) {
+        columns.push_back(TColumnSchema(Format("v%v", index), GetValueColumnType(index)));
+    }
+
+    return New<TTableSchema>(std::move(columns), /*strict*/ true, /*uniqueKeys*/ options.Sorted);
+}
+
+std::vector<TUnversionedRow> GenerateUnversionedRows(
+    const TDataOptions& options,
+    const TRowBufferPtr& rowBuffer)
+{
+    TRowGenerator generator(options, rowBuffer);
+    int keyColumnCount = generator.GetKeyColumnCount();
+    int valueColumnCount = generator.GetValueColumnCount();
+
+    std::vector<TUnversionedRow> rows;
+    rows.reserve(options.RowCount);
+    for (int rowIndex = 0; rowIndex < options.RowCount; ++rowIndex) {
+        auto row = rowBuffer->AllocateUnversioned(keyColumnCount + valueColumnCount);
+        generator.FillKey(row.Begin(), rowIndex);
+        for (int valueIndex = 0; valueIndex < valueColumnCount; ++valueIndex) {
+            row[keyColumnCount + valueIndex] = generator.GenerateValue(valueIndex);
+        }
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+std::vector<TVersionedRow> GenerateVersionedRows(
+    const TDataOptions& options,
+    const TRowBufferPtr& rowBuffer)
+{
+    YT_VERIFY(options.Sorted);
+
+    TRowGenerator generator(options, rowBuffer);
+    int keyColumnCount = generator.GetKeyColumnCount();
+    int valueColumnCount = generator.GetValueColumnCount();
+
+    std::vector<TVersionedRow> rows;
+    rows.reserve(options.RowCount);
+    for (int rowIndex = 0; rowIndex < options.RowCount; ++rowIndex) {
+        auto row = rowBuffer->AllocateVersioned(
+            keyColumnCount,
+            valueColumnCount,
+            /*writeTimestampCount*/ 1,
+            /*deleteTimestampCount*/ 0);
+        generator.FillKey(row.BeginKeys(), rowIndex);
+        for (int valueIndex = 0; valueIndex < valueColumnCount; ++valueIndex) {
+            auto value = generator.GenerateValue(valueIndex);
+            row.BeginValues()[valueIndex] = MakeVersionedValue(value, WriteTimestamp);
+        }
+        row.BeginWriteTimestamps()[0] = WriteTimestamp;
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+template <class TRow>
+TSharedRange<TLegacyKey> SampleKeys(
+    const std::vector<TRow>& rows,
+    int keyColumnCount,
+    int count,
+    const TRowBufferPtr& rowBuffer)
+{
+    TRandomGenerator random(17);
+
+    std::vector<int> rowIndexes;
+    rowIndexes.reserve(count);
+    for (int index = 0; index < count; ++index) {
+        rowIndexes.push_back(random.Generate<ui64>() % rows.size());
+    }
+    std::sort(rowIndexes.begin(), rowIndexes.end());
+    rowIndexes.erase(std::unique(rowIndexes.begin(), rowIndexes.end()), rowIndexes.end());
+
+    std::vector<TLegacyKey> keys;
+    keys.reserve(rowIndexes.size());
+    for (auto rowIndex : rowIndexes) {
+        auto keyValues = GetKeyValues(rows[rowIndex], keyColumnCount);
+        auto key = rowBuffer->AllocateUnversioned(keyValues.Size());
+        std::copy(keyValues.Begin(), keyValues.End(), key.Begin());
+        keys.push_back(key);
+    }
+
+    return MakeSharedRange(std::move(keys), rowBuffer);
+}
+
+template TSharedRange<TLegacyKey> SampleKeys(
+    const std::vector<TUnversionedRow>& rows,
+    int keyColumnCount,
+    int count,
+    const TRowBufferPtr& rowBuffer);
+
+template TSharedRange<TLegacyKey> SampleKeys(
+    const std::vector<TVersionedRow>& rows,
+    int keyColumnCount,
+    int count,
+    const TRowBufferPtr& rowBuffer);
+
+void SetThroughputCounters(benchmark::State& state, i64 rowCount, i64 dataWeight)
+{
+    state.SetItemsProcessed(state.iterations() * rowCount);
+    state.SetBytesProcessed(state.iterations() * dataWeight);
+    state.counters["rows/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * rowCount),
+        benchmark::Counter::kIsRate);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NTableClient
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <yt/yt/ytlib/table_client/public.h>
+
+#include <yt/yt/client/table_client/row_buffer.h>
+#include <yt/yt/client/table_client/schema.h>
+#include <yt/yt/client/table_client/unversioned_row.h>
+#include <yt/yt/client/table_client/versioned_row.h>
+
+#include <yt/yt/core/compression/public.h>
+
+#include <benchmark/benchmark.h>
+
+namespace NYT::NTableClient {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Describes a synthetic dataset.
+/*!
+ *  Benchmarks are parametrized with
+ *  (wide, sorted, optimizeFor, codec index, null percent, duplicate percent),
+ *  see #ParseDataOptions and #ApplyDataArguments.
+ */
+struct TDataOptions
+{
+    //! Narrow schema has 5 columns, wide one has 66 columns.
+    bool Wide = false;
+    bool Sorted = true;
+    EOptimizeFor OptimizeFor = EOptimizeFor::Lookup;
+    NCompression::ECodec Codec = NCompression::ECodec::None;
+    //! Percentage of null values in non-key columns.
+    int NullPercent = 0;
+    //! Percentage of non-key values taken from a small set of repeating values.
+    int DuplicatePercent = 0;
+
+    int RowCount = 100'000;
+};
+
+TDataOptions ParseDataOptions(const benchmark::State& state);
+
+//! Registers the common set of dataset parameters for #benchmark.
+//! Unsorted datasets are only registered if #allowUnsorted is set.
+void ApplyDataArguments(benchmark::internal::Benchmark* benchmark, bool allowUnsorted);
+
+TTableSchemaPtr MakeSchema(const TDataOptions& options);
+
+//! Generates rows of #MakeSchema(options); sorted datasets have unique keys.
+std::vector<TUnversionedRow> GenerateUnversionedRows(
+    const TDataOptions& options,
+    const TRowBufferPtr& rowBuffer);
+
+//! Same as #GenerateUnversionedRows but every value gets a single version.
+std::vector<TVersionedRow> GenerateVersionedRows(
+    const TDataOptions& options,
+    const TRowBufferPtr& rowBuffer);
+
+//! Picks #count random keys of #rows in ascending order.
+template <class TRow>
+TSharedRange<TLegacyKey> SampleKeys(
+    const std::vector<TRow>& rows,
+    int keyColumnCount,
+    int count,
+    const TRowBufferPtr& rowBuffer);
+
+//! Reports rows/s and bytes/s.
+void SetThroughputCounters(benchmark::State& state, i64 rowCount, i64 dataWeight);
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NTableClient
@@ -0,0 +1,219 @@
+#include "helpers.h"
+
+#include <yt/yt/ytlib/chunk_client/chunk_reader.h>
+#include <yt/yt/ytlib/chunk_client/chunk_reader_options.h>
+#include <yt/yt/ytlib/chunk_client/memory_reader.h>
+#include <yt/yt/ytlib/chunk_client/memory_writer.h>
+
+#include <yt/yt/ytlib/table_client/cached_versioned_chunk_meta.h>
+#include <yt/yt/ytlib/table_client/chunk_state.h>
+#include <yt/yt/ytlib/table_client/config.h>
+#include <yt/yt/ytlib/table_client/schemaless_chunk_reader.h>
+#include <yt/yt/ytlib/table_client/schemaless_chunk_writer.h>
+
+#include <yt/yt/client/table_client/name_table.h>
+#include <yt/yt/client/table_client/row_batch.h>
+
+#include <yt/yt/core/concurrency/scheduler.h>
+
+namespace NYT::NTableClient {
+namespace {
+
+using namespace NChunkClient;
+using namespace NConcurrency;
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr int LookupKeyCount = 1'000;
+constexpr int MaxRowsPerRead = 1'024;
+
+struct TSchemalessChunk
+{
+    TTableSchemaPtr Schema;
+    IChunkReaderPtr Reader;
+    TRefCountedChunkMetaPtr Meta;
+    TSharedRange<TLegacyKey> LookupKeys;
+    i64 DataWeight = 0;
+};
+
+TMemoryWriterPtr WriteChunk(
+    const TDataOptions& options,
+    const TTableSchemaPtr& schema,
+    const std::vector<TUnversionedRow>& rows)
+{
+    auto memoryWriter = New<TMemoryWriter>();
+
+    auto config = New<TChunkWriterConfig>();
+    config->Postprocess();
+
+    auto writerOptions = New<TChunkWriterOptions>();
+    writerOptions->OptimizeFor = options.OptimizeFor;
+    writerOptions->CompressionCodec = options.Codec;
+    writerOptions->ValidateSorted = options.Sorted;
+    writerOptions->ValidateUniqueKeys = options.Sorted;
+    writerOptions->Postprocess();
+
+    auto writer = CreateSchemalessChunkWriter(
+        config,
+        writerOptions,
+        schema,
+        TNameTable::FromSchema(*schema),
+        memoryWriter);
+
+    writer->Write(rows);
+    WaitFor(writer->Close())
+        .ThrowOnError();
+
+    return memoryWriter;
+}
+
+TSchemalessChunk PrepareChunk(const TDataOptions& options)
+{
+    auto rowBuffer = New<TRowBuffer>();
+    auto schema = MakeSchema(options);
+    auto rows = GenerateUnversionedRows(options, rowBuffer);
+    auto memoryWriter = WriteChunk(options, schema, rows);
+
+    TSchemalessChunk chunk{
+        .Schema = schema,
+        .Reader = CreateMemoryReader(memoryWriter->GetChunkMeta(), memoryWriter->GetBlocks()),
+        .Meta = memoryWriter->GetChunkMeta(),
+        .DataWeight = static_cast<i64>(GetDataWeight(MakeRange(rows))),
+    };
+    if (options.Sorted) {
+        chunk.LookupKeys = SampleKeys(rows, schema->GetKeyColumnCount(), LookupKeyCount, rowBuffer);
+    }
+    return chunk;
+}
+
+TChunkStatePtr CreateChunkState(const TSchemalessChunk& chunk)
+{
+    auto chunkState = New<TChunkState>(GetNullBlockCache());
+    chunkState->TableSchema = chunk.Schema;
+    return chunkState;
+}
+
+//! Drains #reader and returns the number of rows read.
+i64 ReadAll(const ISchemalessChunkReaderPtr& reader)
+{
+    TRowBatchReadOptions options{
+        .MaxRowsPerRead = MaxRowsPerRead,
+    };
+
+    i64 rowCount = 0;
+    while (auto batch = reader->Read(options)) {
+        if (batch->IsEmpty()) {
+            WaitFor(reader->GetReadyEvent())
+                .ThrowOnError();
+            continue;
+        }
+        for (auto row : batch->MaterializeRows()) {
+            benchmark::DoNotOptimize(row);
+            ++rowCount;
+        }
+    }
+    return rowCount;
+}
+
+void ScanChunk(benchmark::State& state, const TColumnFilter& columnFilter)
+{
+    auto options = ParseDataOptions(state);
+    auto chunk = PrepareChunk(options);
+    auto chunkMeta = New<TColumnarChunkMeta>(*chunk.Meta);
+
+    i64 rowCount = 0;
+    for (auto _ : state) {
+        auto reader = CreateSchemalessRangeChunkReader(
+            CreateChunkState(chunk),
+            chunkMeta,
+            TChunkReaderConfig::GetDefault(),
+            TChunkReaderOptions::GetDefault(),
+            chunk.Reader,
+            TNameTable::FromSchema(*chunk.Schema),
+            /*chunkReadOptions*/ {},
+            /*sortColumns*/ {},
+            /*omittedInaccessibleColumns*/ {},
+            columnFilter,
+            TReadRange());
+        rowCount = ReadAll(reader);
+    }
+
+    // Approximate data weight of the projection by the fraction of columns read.
+    auto dataWeight = columnFilter.IsUniversal()
+        ? chunk.DataWeight
+        : chunk.DataWeight * std::ssize(columnFilter.GetIndexes()) / chunk.Schema->GetColumnCount();
+    SetThroughputCounters(state, rowCount, dataWeight);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BM_SchemalessWrite(benchmark::State& state)
+{
+    auto options = ParseDataOptions(state);
+    auto rowBuffer = New<TRowBuffer>();
+    auto schema = MakeSchema(options);
+    auto rows = GenerateUnversionedRows(options, rowBuffer);
+
+    for (auto _ : state) {
+        auto memoryWriter = WriteChunk(options, schema, rows);
+        benchmark::DoNotOptimize(memoryWriter);
+    }
+
+    SetThroughputCounters(state, std::ssize(rows), GetDataWeight(MakeRange(rows)));
+}
+
+void BM_SchemalessScan(benchmark::State& state)
+{
+    ScanChunk(state, TColumnFilter());
+}
+
+void BM_SchemalessProjectedScan(benchmark::State& state)
+{
+    // The first key column and the first two value ones.
+    auto options = ParseDataOptions(state);
+    int keyColumnCount = options.Wide ? 2 : 1;
+    ScanChunk(state, TColumnFilter({0, keyColumnCount, keyColumnCount + 1}));
+}
+
+void BM_SchemalessLookup(benchmark::State& state)
+{
+    auto options = ParseDataOptions(state);
+    auto chunk = PrepareChunk(options);
+
+    auto chunkMeta = TCachedVersionedChunkMeta::Create(
+        /*prepareColumnarMeta*/ false,
+        /*memoryTracker*/ nullptr,
+        chunk.Meta);
+
+    auto readerOptions = New<TChunkReaderOptions>();
+    readerOptions->DynamicTable = true;
+
+    i64 rowCount = 0;
+    for (auto _ : state) {
+        auto reader = CreateSchemalessLookupChunkReader(
+            CreateChunkState(chunk),
+            chunkMeta,
+            TChunkReaderConfig::GetDefault(),
+            readerOptions,
+            chunk.Reader,
+            TNameTable::FromSchema(*chunk.Schema),
+            /*chunkReadOptions*/ {},
+            chunk.Schema->GetSortColumns(),
+            /*omittedInaccessibleColumns*/ {},
+            TColumnFilter(),
+            chunk.LookupKeys);
+        rowCount = ReadAll(reader);
+    }
+
+    SetThroughputCounters(state, rowCount, chunk.DataWeight / options.RowCount * rowCount);
+}
+
+BENCHMARK(BM_SchemalessWrite)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ true); });
+BENCHMARK(BM_SchemalessScan)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ true); });
+BENCHMARK(BM_SchemalessProjectedScan)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ true); });
+BENCHMARK(BM_SchemalessLookup)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ false); });
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NTableClient
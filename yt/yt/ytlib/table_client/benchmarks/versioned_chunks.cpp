@@ -0,0 +1,233 @@
+#include "helpers.h"
+
+#include <yt/yt/ytlib/chunk_client/chunk_reader.h>
+#include <yt/yt/ytlib/chunk_client/memory_reader.h>
+#include <yt/yt/ytlib/chunk_client/memory_writer.h>
+
+#include <yt/yt/ytlib/new_table_client/versioned_chunk_reader.h>
+
+#include <yt/yt/ytlib/table_client/cached_versioned_chunk_meta.h>
+#include <yt/yt/ytlib/table_client/chunk_state.h>
+#include <yt/yt/ytlib/table_client/config.h>
+#include <yt/yt/ytlib/table_client/versioned_chunk_reader.h>
+#include <yt/yt/ytlib/table_client/versioned_chunk_writer.h>
+
+#include <yt/yt/client/table_client/versioned_reader.h>
+#include <yt/yt/client/table_client/versioned_writer.h>
+
+#include <yt/yt/core/concurrency/scheduler.h>
+
+namespace NYT::NTableClient {
+namespace {
+
+using namespace NChunkClient;
+using namespace NConcurrency;
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr int LookupKeyCount = 1'000;
+constexpr int MaxRowsPerRead = 1'024;
+
+struct TVersionedChunk
+{
+    TDataOptions Options;
+    TTableSchemaPtr Schema;
+    IChunkReaderPtr Reader;
+    TCachedVersionedChunkMetaPtr Meta;
+    TSharedRange<TLegacyKey> LookupKeys;
+    i64 DataWeight = 0;
+};
+
+i64 GetDataWeight(const std::vector<TVersionedRow>& rows)
+{
+    i64 dataWeight = 0;
+    for (auto row : rows) {
+        dataWeight += NTableClient::GetDataWeight(row);
+    }
+    return dataWeight;
+}
+
+TMemoryWriterPtr WriteChunk(
+    const TDataOptions& options,
+    const TTableSchemaPtr& schema,
+    const std::vector<TVersionedRow>& rows)
+{
+    auto memoryWriter = New<TMemoryWriter>();
+
+    auto config = New<TChunkWriterConfig>();
+    config->Postprocess();
+
+    auto writerOptions = New<TChunkWriterOptions>();
+    writerOptions->OptimizeFor = options.OptimizeFor;
+    writerOptions->CompressionCodec = options.Codec;
+    writerOptions->Postprocess();
+
+    auto writer = CreateVersionedChunkWriter(
+        config,
+        writerOptions,
+        schema,
+        memoryWriter);
+
+    writer->Write(rows);
+    WaitFor(writer->Close())
+        .ThrowOnError();
+
+    return memoryWriter;
+}
+
+TVersionedChunk PrepareChunk(const TDataOptions& options)
+{
+    auto rowBuffer = New<TRowBuffer>();
+    auto schema = MakeSchema(options);
+    auto rows = GenerateVersionedRows(options, rowBuffer);
+    auto memoryWriter = WriteChunk(options, schema, rows);
+
+    return TVersionedChunk{
+        .Options = options,
+        .Schema = schema,
+        .Reader = CreateMemoryReader(memoryWriter->GetChunkMeta(), memoryWriter->GetBlocks()),
+        .Meta = TCachedVersionedChunkMeta::Create(
+            /*prepareColumnarMeta*/ false,
+            /*memoryTracker*/ nullptr,
+            memoryWriter->GetChunkMeta()),
+        .LookupKeys = SampleKeys(rows, schema->GetKeyColumnCount(), LookupKeyCount, rowBuffer),
+        .DataWeight = GetDataWeight(rows),
+    };
+}
+
+//! Columnar chunks are read with the new reader, horizontal ones with the old one
+//! since this is what tablet nodes do.
+template <class TReadItems>
+IVersionedReaderPtr CreateReader(
+    const TVersionedChunk& chunk,
+    const TReadItems& readItems,
+    const TColumnFilter& columnFilter)
+{
+    if (chunk.Options.OptimizeFor == EOptimizeFor::Scan) {
+        auto blockManagerFactory = NNewTableClient::CreateAsyncBlockWindowManagerFactory(
+            TChunkReaderConfig::GetDefault(),
+            chunk.Reader,
+            GetNullBlockCache(),
+            /*chunkReadOptions*/ {},
+            chunk.Meta);
+
+        return NNewTableClient::CreateVersionedChunkReader(
+            readItems,
+            AsyncLastCommittedTimestamp,
+            chunk.Meta,
+            chunk.Schema,
+            columnFilter,
+            /*chunkColumnMapping*/ nullptr,
+            blockManagerFactory,
+            /*performanceCounters*/ nullptr,
+            /*produceAll*/ false);
+    }
+
+    auto chunkState = New<TChunkState>(GetNullBlockCache());
+    chunkState->TableSchema = chunk.Schema;
+
+    return CreateVersionedChunkReader(
+        TChunkReaderConfig::GetDefault(),
+        chunk.Reader,
+        std::move(chunkState),
+        chunk.Meta,
+        /*chunkReadOptions*/ {},
+        readItems,
+        columnFilter,
+        AsyncLastCommittedTimestamp,
+        /*produceAllVersions*/ false);
+}
+
+//! Drains #reader and returns the number of rows read.
+i64 ReadAll(const IVersionedReaderPtr& reader)
+{
+    WaitFor(reader->Open())
+        .ThrowOnError();
+
+    TRowBatchReadOptions options{
+        .MaxRowsPerRead = MaxRowsPerRead,
+    };
+
+    i64 rowCount = 0;
+    while (auto batch = reader->Read(options)) {
+        if (batch->IsEmpty()) {
+            WaitFor(reader->GetReadyEvent())
+                .ThrowOnError();
+            continue;
+        }
+        for (auto row : batch->MaterializeRows()) {
+            benchmark::DoNotOptimize(row);
+            ++rowCount;
+        }
+    }
+    return rowCount;
+}
+
+void ScanChunk(benchmark::State& state, const TColumnFilter& columnFilter)
+{
+    auto chunk = PrepareChunk(ParseDataOptions(state));
+    auto ranges = MakeSingletonRowRange(MinKey(), MaxKey());
+
+    i64 rowCount = 0;
+    for (auto _ : state) {
+        rowCount = ReadAll(CreateReader(chunk, ranges, columnFilter));
+    }
+
+    // Approximate data weight of the projection by the fraction of columns read.
+    auto dataWeight = columnFilter.IsUniversal()
+        ? chunk.DataWeight
+        : chunk.DataWeight * std::ssize(columnFilter.GetIndexes()) / chunk.Schema->GetColumnCount();
+    SetThroughputCounters(state, rowCount, dataWeight);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BM_VersionedWrite(benchmark::State& state)
+{
+    auto options = ParseDataOptions(state);
+    auto rowBuffer = New<TRowBuffer>();
+    auto schema = MakeSchema(options);
+    auto rows = GenerateVersionedRows(options, rowBuffer);
+
+    for (auto _ : state) {
+        auto memoryWriter = WriteChunk(options, schema, rows);
+        benchmark::DoNotOptimize(memoryWriter);
+    }
+
+    SetThroughputCounters(state, std::ssize(rows), GetDataWeight(rows));
+}
+
+void BM_VersionedScan(benchmark::State& state)
+{
+    ScanChunk(state, TColumnFilter());
+}
+
+void BM_VersionedProjectedScan(benchmark::State& state)
+{
+    // Versioned readers always return keys; read a single value column on top of them.
+    auto options = ParseDataOptions(state);
+    int keyColumnCount = options.Wide ? 2 : 1;
+    ScanChunk(state, TColumnFilter({0, keyColumnCount}));
+}
+
+void BM_VersionedLookup(benchmark::State& state)
+{
+    auto chunk = PrepareChunk(ParseDataOptions(state));
+
+    i64 rowCount = 0;
+    for (auto _ : state) {
+        rowCount = ReadAll(CreateReader(chunk, chunk.LookupKeys, TColumnFilter()));
+    }
+
+    SetThroughputCounters(state, rowCount, chunk.DataWeight / chunk.Options.RowCount * rowCount);
+}
+
+BENCHMARK(BM_VersionedWrite)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ false); });
+BENCHMARK(BM_VersionedScan)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ false); });
+BENCHMARK(BM_VersionedProjectedScan)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ false); });
+BENCHMARK(BM_VersionedLookup)->Apply([] (auto* benchmark) { ApplyDataArguments(benchmark, /*allowUnsorted*/ false); });
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NTableClient
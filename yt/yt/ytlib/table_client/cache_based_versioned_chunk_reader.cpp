@@ -223,7 +223,7 @@ private:
         if (compressedBlock) {
             NCompression::ECodec codecId;
             YT_VERIFY(TryEnumCast(chunkMeta->Misc().compression_codec(), &codecId));
-            auto* codec = NCompression::GetCodec(codecId);
+            auto* codec = chunkMeta->GetBlockCodec();
 
             NProfiling::TFiberWallTimer timer;
             auto uncompressedBlock = codec->Decompress(compressedBlock.Data);
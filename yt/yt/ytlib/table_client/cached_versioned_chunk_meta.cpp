@@ -1,4 +1,5 @@
 #include "cached_versioned_chunk_meta.h"
+#include "key_filter.h"
 
 #include <yt/yt/client/misc/workload.h>
 
@@ -78,6 +79,10 @@ TCachedVersionedChunkMeta::TCachedVersionedChunkMeta(
         ParseHashTableChunkIndexMeta(*optionalSystemBlockMetaExt);
     }
 
+    if (auto optionalKeyFilterExt = FindProtoExtension<TKeyFilterExt>(chunkMeta.extensions())) {
+        KeyFilter_ = New<TKeyFilter>(*optionalKeyFilterExt);
+    }
+
     if (ColumnarMetaPrepared_) {
         GetPreparedChunkMeta();
         ClearColumnMeta();
@@ -111,6 +116,7 @@ i64 TCachedVersionedChunkMeta::GetMemoryUsage() const
     return TColumnarChunkMeta::GetMemoryUsage()
         + HunkChunkRefsExt().SpaceUsedLong()
         + HunkChunkMetasExt().SpaceUsedLong()
+        + (KeyFilter_ ? KeyFilter_->GetMemoryUsage() : 0)
         + PreparedMetaSize_;
 }
 
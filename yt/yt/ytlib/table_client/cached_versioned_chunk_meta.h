@@ -56,6 +56,9 @@ public:
 
     DEFINE_BYREF_RO_PROPERTY(std::optional<THashTableChunkIndexMeta>, HashTableChunkIndexMeta);
 
+    //! Null unless the chunk was written with key filters enabled.
+    DEFINE_BYVAL_RO_PROPERTY(TKeyFilterPtr, KeyFilter);
+
     static TCachedVersionedChunkMetaPtr Create(
         bool preparedColumnarMeta,
         const IMemoryUsageTrackerPtr& memoryTracker,
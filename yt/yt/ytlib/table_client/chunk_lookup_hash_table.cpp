@@ -62,7 +62,8 @@ public:
 
     std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
         const TBlockId& id,
-        EBlockType type) override
+        EBlockType type,
+        const TWorkloadDescriptor& /*workloadDescriptor*/) override
     {
         YT_VERIFY(type == EBlockType::UncompressedData);
         return id.BlockIndex >= StartBlockIndex_ && id.BlockIndex < StartBlockIndex_ + static_cast<int>(Blocks_.size())
@@ -33,6 +33,7 @@ REGISTER_PROTO_EXTENSION(THunkChunkMiscExt, 63, hunk_chunk_misc)
 REGISTER_PROTO_EXTENSION(THunkChunkMetasExt, 64, hunk_chunk_metas)
 REGISTER_PROTO_EXTENSION(TSystemBlockMetaExt, 65, system_block_meta)
 REGISTER_PROTO_EXTENSION(TVersionedRowDigestExt, 66, versioned_row_digest)
+REGISTER_PROTO_EXTENSION(TKeyFilterExt, 67, key_filter)
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -2,6 +2,8 @@
 
 #include "public.h"
 
+#include <yt/yt/ytlib/table_client/proto/key_filter.pb.h>
+
 #include <yt/yt_proto/yt/client/table_chunk_format/proto/chunk_meta.pb.h>
 
 #include <yt/yt/client/table_client/unversioned_row.h>
@@ -29,6 +31,7 @@ DECLARE_PROTO_EXTENSION(NTableClient::NProto::THunkChunkMiscExt, 63)
 DECLARE_PROTO_EXTENSION(NTableClient::NProto::THunkChunkMetasExt, 64)
 DECLARE_PROTO_EXTENSION(NTableClient::NProto::TSystemBlockMetaExt, 65)
 DECLARE_PROTO_EXTENSION(NTableClient::NProto::TVersionedRowDigestExt, 66)
+DECLARE_PROTO_EXTENSION(NTableClient::NProto::TKeyFilterExt, 67)
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -63,7 +63,8 @@ TChunkReaderBase::~TChunkReaderBase()
 TFuture<void> TChunkReaderBase::DoOpen(
     std::vector<TBlockFetcher::TBlockInfo> blockSequence,
     const TMiscExt& miscExt,
-    IInvokerPtr sessionInvoker)
+    IInvokerPtr sessionInvoker,
+    NCompression::IDictionaryBlockCodecPtr dictionaryCodec)
 {
     TCurrentTraceContextGuard traceGuard(TraceContext_);
 
@@ -87,7 +88,8 @@ TFuture<void> TChunkReaderBase::DoOpen(
         CheckedEnumCast<ECodec>(miscExt.compression_codec()),
         static_cast<double>(miscExt.compressed_data_size()) / miscExt.uncompressed_data_size(),
         ChunkReadOptions_,
-        std::move(sessionInvoker));
+        std::move(sessionInvoker),
+        std::move(dictionaryCodec));
     SequentialBlockFetcher_->Start();
 
     InitFirstBlockNeeded_ = true;
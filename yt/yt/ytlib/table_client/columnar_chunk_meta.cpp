@@ -99,6 +99,12 @@ TColumnarChunkMeta::TColumnarChunkMeta(const TChunkMeta& chunkMeta)
     BlockLastKeys_ = MakeSharedRange(
         blockLastKeys,
         std::move(buffer));
+
+    if (auto compressionDictionaryExt = FindProtoExtension<TCompressionDictionaryExt>(chunkMeta.extensions())) {
+        DictionaryBlockCodec_ = NCompression::CreateDictionaryBlockCodec(
+            CheckedEnumCast<NCompression::ECodec>(Misc_.compression_codec()),
+            TSharedRef::FromString(std::move(*compressionDictionaryExt->mutable_dictionary())));
+    }
 }
 
 i64 TColumnarChunkMeta::GetMemoryUsage() const
@@ -114,7 +120,20 @@ i64 TColumnarChunkMeta::GetMemoryUsage() const
         Misc_.SpaceUsedLong() +
         DataBlockMeta_->GetSize() * metaMemoryFactor +
         (ColumnMeta_ ? ColumnMeta_->GetSize() * metaMemoryFactor : 0) +
-        ChunkSchema_->GetMemoryUsage();
+        ChunkSchema_->GetMemoryUsage() +
+        (DictionaryBlockCodec_ ? DictionaryBlockCodec_->GetDictionary().Size() * metaMemoryFactor : 0);
+}
+
+NCompression::ICodec* TColumnarChunkMeta::GetBlockCodec() const
+{
+    return DictionaryBlockCodec_
+        ? DictionaryBlockCodec_.Get()
+        : NCompression::GetCodec(CheckedEnumCast<NCompression::ECodec>(Misc_.compression_codec()));
+}
+
+const NCompression::IDictionaryBlockCodecPtr& TColumnarChunkMeta::GetDictionaryBlockCodec() const
+{
+    return DictionaryBlockCodec_;
 }
 
 void TColumnarChunkMeta::ClearColumnMeta()
@@ -7,6 +7,8 @@
 
 #include <yt/yt/client/table_client/schema.h>
 
+#include <yt/yt/core/compression/dictionary_codec.h>
+
 namespace NYT::NTableClient {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -29,11 +31,23 @@ public:
 
     virtual i64 GetMemoryUsage() const;
 
+    //! Returns the codec to decompress data blocks with.
+    /*!
+     *  Accounts for the compression dictionary stored in the chunk meta, if any.
+     *  Digested dictionaries are built once and shared by all readers of the chunk.
+     */
+    NCompression::ICodec* GetBlockCodec() const;
+
+    //! Returns the dictionary codec if blocks are compressed with a dictionary and null otherwise.
+    const NCompression::IDictionaryBlockCodecPtr& GetDictionaryBlockCodec() const;
+
     // Free space if there is prepared meta.
     void ClearColumnMeta();
 
 private:
     i64 BlockLastKeysSize_;
+
+    NCompression::IDictionaryBlockCodecPtr DictionaryBlockCodec_;
 };
 
 DEFINE_REFCOUNTED_TYPE(TColumnarChunkMeta)
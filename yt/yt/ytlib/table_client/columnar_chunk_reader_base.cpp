@@ -444,7 +444,8 @@ void TColumnarRangeChunkReaderBase::InitBlockFetcher(IInvokerPtr sessionInvoker)
             CheckedEnumCast<NCompression::ECodec>(ChunkMeta_->Misc().compression_codec()),
             static_cast<double>(ChunkMeta_->Misc().compressed_data_size()) / ChunkMeta_->Misc().uncompressed_data_size(),
             ChunkReadOptions_,
-            std::move(sessionInvoker));
+            std::move(sessionInvoker),
+            ChunkMeta_->GetDictionaryBlockCodec());
         BlockFetcher_->Start();
     }
 }
@@ -597,7 +598,9 @@ void TColumnarLookupChunkReaderBase::InitBlockFetcher()
         BlockCache_,
         CheckedEnumCast<NCompression::ECodec>(ChunkMeta_->Misc().compression_codec()),
         static_cast<double>(ChunkMeta_->Misc().compressed_data_size()) / ChunkMeta_->Misc().uncompressed_data_size(),
-        ChunkReadOptions_);
+        ChunkReadOptions_,
+        /*sessionInvoker*/ nullptr,
+        ChunkMeta_->GetDictionaryBlockCodec());
     BlockFetcher_->Start();
 }
 
@@ -0,0 +1,153 @@
+#include "key_filter.h"
+
+#include <yt/yt/client/table_client/config.h>
+
+#include <yt/yt/ytlib/table_client/proto/key_filter.pb.h>
+
+#include <yt/yt_proto/yt/core/misc/proto/bloom_filter.pb.h>
+
+namespace NYT::NTableClient {
+
+using NYT::ToProto;
+using NYT::FromProto;
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TKeyFilterBuilder
+    : public IKeyFilterBuilder
+{
+public:
+    TKeyFilterBuilder(
+        TKeyFilterWriterConfigPtr config,
+        int keyColumnCount)
+        : Config_(std::move(config))
+        , KeyColumnCount_(keyColumnCount)
+    {
+        KeyFilterExt_.set_key_column_count(KeyColumnCount_);
+    }
+
+    void AddKey(TUnversionedValueRange key) override
+    {
+        YT_VERIFY(std::ssize(key) == KeyColumnCount_);
+
+        Fingerprints_.push_back(GetFarmFingerprint(key));
+    }
+
+    void FlushBlock(TUnversionedValueRange lastKey) override
+    {
+        if (Fingerprints_.empty()) {
+            return;
+        }
+
+        TBloomFilterBuilder bloomFilterBuilder(
+            std::ssize(Fingerprints_),
+            Config_->FalsePositiveRate);
+        for (auto fingerprint : Fingerprints_) {
+            bloomFilterBuilder.Insert(fingerprint);
+        }
+        bloomFilterBuilder.Shrink();
+
+        auto* block = KeyFilterExt_.add_blocks();
+        ToProto(block->mutable_bloom_filter(), bloomFilterBuilder);
+        ToProto(block->mutable_last_key(), lastKey);
+        block->set_key_count(std::ssize(Fingerprints_));
+
+        MetaSize_ += block->ByteSizeLong();
+
+        Fingerprints_.clear();
+    }
+
+    i64 GetMetaSize() const override
+    {
+        return MetaSize_;
+    }
+
+    NProto::TKeyFilterExt FlushExtension() override
+    {
+        YT_VERIFY(Fingerprints_.empty());
+
+        return std::move(KeyFilterExt_);
+    }
+
+private:
+    const TKeyFilterWriterConfigPtr Config_;
+    const int KeyColumnCount_;
+
+    std::vector<TFingerprint> Fingerprints_;
+
+    NProto::TKeyFilterExt KeyFilterExt_;
+    i64 MetaSize_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+IKeyFilterBuilderPtr CreateKeyFilterBuilder(
+    const TKeyFilterWriterConfigPtr& config,
+    int keyColumnCount)
+{
+    if (!config->Enable) {
+        return nullptr;
+    }
+    return New<TKeyFilterBuilder>(config, keyColumnCount);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TKeyFilter::TKeyFilter(const NProto::TKeyFilterExt& keyFilterExt)
+    : KeyColumnCount_(keyFilterExt.key_column_count())
+{
+    BlockLastKeys_.reserve(keyFilterExt.blocks_size());
+    BlockFilters_.reserve(keyFilterExt.blocks_size());
+
+    for (const auto& block : keyFilterExt.blocks()) {
+        auto& lastKey = BlockLastKeys_.emplace_back(FromProto<TLegacyOwningKey>(block.last_key()));
+        auto& bloomFilter = BlockFilters_.emplace_back();
+        FromProto(&bloomFilter, block.bloom_filter());
+
+        MemoryUsage_ += lastKey.GetSpaceUsed() + bloomFilter.Size();
+    }
+
+    MemoryUsage_ += BlockLastKeys_.capacity() * sizeof(TLegacyOwningKey) +
+        BlockFilters_.capacity() * sizeof(TBloomFilter);
+}
+
+bool TKeyFilter::Contains(TLegacyKey key) const
+{
+    if (static_cast<int>(key.GetCount()) < KeyColumnCount_) {
+        // Should not happen; be conservative.
+        return true;
+    }
+
+    // Chunk rows are padded with nulls for key columns added after the chunk was written.
+    for (int index = KeyColumnCount_; index < static_cast<int>(key.GetCount()); ++index) {
+        if (key[index].Type != EValueType::Null) {
+            return false;
+        }
+    }
+
+    auto keyPrefix = TUnversionedValueRange(key.Begin(), key.Begin() + KeyColumnCount_);
+
+    auto it = std::lower_bound(
+        BlockLastKeys_.begin(),
+        BlockLastKeys_.end(),
+        keyPrefix,
+        [] (const TLegacyOwningKey& lastKey, TUnversionedValueRange key) {
+            return CompareValueRanges(lastKey.Elements(), key) < 0;
+        });
+
+    if (it == BlockLastKeys_.end()) {
+        return false;
+    }
+
+    const auto& bloomFilter = BlockFilters_[it - BlockLastKeys_.begin()];
+    return bloomFilter.Contains(GetFarmFingerprint(keyPrefix));
+}
+
+i64 TKeyFilter::GetMemoryUsage() const
+{
+    return MemoryUsage_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NTableClient
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "public.h"
+
+#include <yt/yt/client/table_client/unversioned_row.h>
+
+#include <yt/yt/core/misc/bloom_filter.h>
+
+namespace NYT::NTableClient {
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Builds per-block Bloom filters over chunk keys to be stored in TKeyFilterExt.
+/*!
+ *  Keys must be added in the order they are written into the chunk.
+ *  Filter block boundaries are chosen by the chunk writer via #FlushBlock.
+ */
+struct IKeyFilterBuilder
+    : public TRefCounted
+{
+    virtual void AddKey(TUnversionedValueRange key) = 0;
+
+    //! Finishes current filter block; #lastKey must be the last key added so far.
+    virtual void FlushBlock(TUnversionedValueRange lastKey) = 0;
+
+    //! Returns the (estimated) size of the extension built so far.
+    virtual i64 GetMetaSize() const = 0;
+
+    virtual NProto::TKeyFilterExt FlushExtension() = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(IKeyFilterBuilder)
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Returns null if key filters are disabled in #config.
+IKeyFilterBuilderPtr CreateKeyFilterBuilder(
+    const TKeyFilterWriterConfigPtr& config,
+    int keyColumnCount);
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Reader counterpart of IKeyFilterBuilder.
+class TKeyFilter
+    : public TRefCounted
+{
+public:
+    explicit TKeyFilter(const NProto::TKeyFilterExt& keyFilterExt);
+
+    //! Returns |false| if #key is definitely not present in the chunk.
+    /*!
+     *  #key may be wider than the chunk key (e.g. after key columns were added
+     *  via alter); extra columns are expected to be null in that case.
+     */
+    bool Contains(TLegacyKey key) const;
+
+    i64 GetMemoryUsage() const;
+
+private:
+    const int KeyColumnCount_;
+
+    std::vector<TLegacyOwningKey> BlockLastKeys_;
+    std::vector<TBloomFilter> BlockFilters_;
+
+    i64 MemoryUsage_ = 0;
+};
+
+DEFINE_REFCOUNTED_TYPE(TKeyFilter)
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace NYT::NTableClient
@@ -9,6 +9,7 @@ namespace NYT::NTableClient {
 namespace NProto {
 
 class TVirtualValueDirectory;
+class TKeyFilterExt;
 
 } // namespace NProto
 
@@ -90,6 +91,9 @@ DECLARE_REFCOUNTED_STRUCT(TVirtualValueDirectory)
 
 DECLARE_REFCOUNTED_STRUCT(IVersionedRowDigestBuilder)
 
+DECLARE_REFCOUNTED_STRUCT(IKeyFilterBuilder)
+DECLARE_REFCOUNTED_CLASS(TKeyFilter)
+
 struct TOwningBoundaryKeys;
 
 struct TBlobTableSchema;
@@ -534,7 +534,11 @@ TFuture<void> THorizontalSchemalessChunkReaderBase::InitBlockFetcher()
         });
     }
 
-    return DoOpen(std::move(blocks), ChunkMeta_->Misc());
+    return DoOpen(
+        std::move(blocks),
+        ChunkMeta_->Misc(),
+        /*sessionInvoker*/ nullptr,
+        ChunkMeta_->GetDictionaryBlockCodec());
 }
 
 TDataStatistics THorizontalSchemalessChunkReaderBase::GetDataStatistics() const
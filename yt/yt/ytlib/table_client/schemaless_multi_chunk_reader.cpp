@@ -103,7 +103,8 @@ TFuture<TColumnarChunkMetaPtr> DownloadChunkMeta(
         TProtoExtensionTag<NProto::TDataBlockMetaExt>::Value,
         TProtoExtensionTag<NProto::TColumnMetaExt>::Value,
         TProtoExtensionTag<NProto::TNameTableExt>::Value,
-        TProtoExtensionTag<NProto::TKeyColumnsExt>::Value
+        TProtoExtensionTag<NProto::TKeyColumnsExt>::Value,
+        TProtoExtensionTag<NChunkClient::NProto::TCompressionDictionaryExt>::Value
     };
 
     return chunkReader->GetMeta(
@@ -0,0 +1,101 @@
+#include <yt/yt/ytlib/table_client/key_filter.h>
+
+#include <yt/yt/ytlib/table_client/proto/key_filter.pb.h>
+
+#include <yt/yt/client/table_client/config.h>
+#include <yt/yt/client/table_client/helpers.h>
+
+#include <yt/yt/core/test_framework/framework.h>
+
+namespace NYT::NTableClient {
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+TKeyFilterPtr BuildKeyFilter(
+    const std::vector<TUnversionedOwningRow>& keys,
+    int keysPerBlock,
+    int keyColumnCount)
+{
+    auto config = New<TKeyFilterWriterConfig>();
+    config->Enable = true;
+    config->FalsePositiveRate = 0.01;
+
+    auto builder = CreateKeyFilterBuilder(config, keyColumnCount);
+    YT_VERIFY(builder);
+
+    for (int index = 0; index < std::ssize(keys); ++index) {
+        builder->AddKey(keys[index].Elements());
+        if ((index + 1) % keysPerBlock == 0 || index + 1 == std::ssize(keys)) {
+            builder->FlushBlock(keys[index].Elements());
+        }
+    }
+
+    EXPECT_GT(builder->GetMetaSize(), 0);
+
+    return New<TKeyFilter>(builder->FlushExtension());
+}
+
+std::vector<TUnversionedOwningRow> MakeKeys(int begin, int end, int step)
+{
+    std::vector<TUnversionedOwningRow> keys;
+    for (int value = begin; value < end; value += step) {
+        keys.push_back(MakeUnversionedOwningRow(value));
+    }
+    return keys;
+}
+
+TEST(TKeyFilterTest, Disabled)
+{
+    auto config = New<TKeyFilterWriterConfig>();
+    EXPECT_FALSE(CreateKeyFilterBuilder(config, /*keyColumnCount*/ 1));
+}
+
+TEST(TKeyFilterTest, NoFalseNegatives)
+{
+    auto keys = MakeKeys(0, 10000, 2);
+    auto keyFilter = BuildKeyFilter(keys, /*keysPerBlock*/ 100, /*keyColumnCount*/ 1);
+
+    for (const auto& key : keys) {
+        EXPECT_TRUE(keyFilter->Contains(key));
+    }
+}
+
+TEST(TKeyFilterTest, FalsePositiveRate)
+{
+    auto keys = MakeKeys(0, 20000, 2);
+    auto keyFilter = BuildKeyFilter(keys, /*keysPerBlock*/ 1000, /*keyColumnCount*/ 1);
+
+    int falsePositiveCount = 0;
+    auto absentKeys = MakeKeys(1, 20000, 2);
+    for (const auto& key : absentKeys) {
+        if (keyFilter->Contains(key)) {
+            ++falsePositiveCount;
+        }
+    }
+
+    EXPECT_LT(falsePositiveCount, std::ssize(absentKeys) / 10);
+}
+
+TEST(TKeyFilterTest, OutOfRange)
+{
+    auto keys = MakeKeys(100, 200, 1);
+    auto keyFilter = BuildKeyFilter(keys, /*keysPerBlock*/ 10, /*keyColumnCount*/ 1);
+
+    EXPECT_FALSE(keyFilter->Contains(MakeUnversionedOwningRow(200)));
+    EXPECT_FALSE(keyFilter->Contains(MakeUnversionedOwningRow(1000)));
+}
+
+TEST(TKeyFilterTest, WidenedKey)
+{
+    auto keys = MakeKeys(0, 100, 1);
+    auto keyFilter = BuildKeyFilter(keys, /*keysPerBlock*/ 10, /*keyColumnCount*/ 1);
+
+    EXPECT_TRUE(keyFilter->Contains(MakeUnversionedOwningRow(42, std::nullopt)));
+    EXPECT_FALSE(keyFilter->Contains(MakeUnversionedOwningRow(42, 1)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NTableClient
@@ -0,0 +1,108 @@
+#include <yt/yt/ytlib/new_table_client/key_predicate_kernels.h>
+
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <util/random/fast.h>
+
+namespace NYT::NNewTableClient {
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EvaluateNaive(T value, EKeyPredicateOp op, const std::vector<T>& constants)
+{
+    switch (op) {
+        case EKeyPredicateOp::Equal:
+            return value == constants[0];
+        case EKeyPredicateOp::NotEqual:
+            return value != constants[0];
+        case EKeyPredicateOp::Less:
+            return value < constants[0];
+        case EKeyPredicateOp::LessOrEqual:
+            return value <= constants[0];
+        case EKeyPredicateOp::Greater:
+            return value > constants[0];
+        case EKeyPredicateOp::GreaterOrEqual:
+            return value >= constants[0];
+        case EKeyPredicateOp::In:
+            return std::find(constants.begin(), constants.end(), value) != constants.end();
+    }
+    YT_ABORT();
+}
+
+template <class T>
+void CheckKernel(const std::vector<T>& values, EKeyPredicateOp op, const std::vector<T>& constants)
+{
+    // Garbage in the bitmap must be overwritten.
+    std::vector<ui64> bitmap((values.size() + 63) / 64, ~0ULL);
+    EvaluateKeyPredicate(MakeRange(values), op, MakeRange(constants), bitmap.data());
+
+    for (int index = 0; index < std::ssize(values); ++index) {
+        bool actual = bitmap[index / 64] & (1ULL << (index % 64));
+        EXPECT_EQ(EvaluateNaive(values[index], op, constants), actual)
+            << "Op: " << ToString(op) << ", Index: " << index << ", Value: " << values[index];
+    }
+
+    if (values.size() % 64 != 0) {
+        EXPECT_EQ(0u, bitmap.back() >> (values.size() % 64));
+    }
+}
+
+template <class T>
+std::vector<T> GenerateValues(TFastRng64* rng, int count)
+{
+    std::vector<T> values;
+    for (int index = 0; index < count; ++index) {
+        // Cover both small and extreme values, including those differing in sign bit.
+        switch (rng->Uniform(3)) {
+            case 0:
+                values.push_back(static_cast<T>(rng->Uniform(8)) - 4);
+                break;
+            case 1:
+                values.push_back(std::numeric_limits<T>::max() - static_cast<T>(rng->Uniform(4)));
+                break;
+            default:
+                values.push_back(std::numeric_limits<T>::min() + static_cast<T>(rng->Uniform(4)));
+                break;
+        }
+    }
+    return values;
+}
+
+template <class T>
+void RunRandomizedTest()
+{
+    TFastRng64 rng(42);
+
+    for (int count : {0, 1, 3, 4, 5, 63, 64, 65, 255, 256}) {
+        auto values = GenerateValues<T>(&rng, count);
+
+        for (auto op : TEnumTraits<EKeyPredicateOp>::GetDomainValues()) {
+            if (op == EKeyPredicateOp::In) {
+                for (int constantCount : {0, 1, 5, 16, 17, 100}) {
+                    CheckKernel(values, op, GenerateValues<T>(&rng, constantCount));
+                }
+            } else {
+                for (int iteration = 0; iteration < 4; ++iteration) {
+                    CheckKernel(values, op, GenerateValues<T>(&rng, 1));
+                }
+            }
+        }
+    }
+}
+
+TEST(TKeyPredicateKernelsTest, Int64)
+{
+    RunRandomizedTest<i64>();
+}
+
+TEST(TKeyPredicateKernelsTest, Uint64)
+{
+    RunRandomizedTest<ui64>();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NNewTableClient
@@ -1,6 +1,7 @@
 #include <yt/yt/core/test_framework/framework.h>
 
 #include <yt/yt/ytlib/chunk_client/chunk_fragment_reader.h>
+#include <yt/yt/ytlib/chunk_client/chunk_meta_extensions.h>
 #include <yt/yt/ytlib/chunk_client/chunk_reader.h>
 #include <yt/yt/ytlib/chunk_client/chunk_reader_options.h>
 #include <yt/yt/ytlib/chunk_client/chunk_reader_statistics.h>
@@ -14,14 +15,18 @@
 #include <yt/yt/ytlib/table_client/cached_versioned_chunk_meta.h>
 #include <yt/yt/ytlib/table_client/chunk_column_mapping.h>
 #include <yt/yt/ytlib/table_client/chunk_index_read_controller.h>
+#include <yt/yt/ytlib/table_client/chunk_meta_extensions.h>
 #include <yt/yt/ytlib/table_client/chunk_state.h>
 #include <yt/yt/ytlib/table_client/config.h>
 #include <yt/yt/ytlib/table_client/indexed_versioned_chunk_reader.h>
+#include <yt/yt/ytlib/table_client/key_filter.h>
 #include <yt/yt/ytlib/table_client/versioned_chunk_reader.h>
 #include <yt/yt/ytlib/table_client/versioned_chunk_writer.h>
 
 #include <yt/yt/ytlib/table_client/chunk_lookup_hash_table.h>
 
+#include <yt/yt/ytlib/table_client/proto/key_filter.pb.h>
+
 #include <yt/yt/ytlib/new_table_client/versioned_chunk_reader.h>
 
 #include <yt/yt/ytlib/transaction_client/public.h>
@@ -35,13 +40,15 @@
 
 #include <yt/yt/client/table_client/unittests/helpers/helpers.h>
 
-#include <yt/yt/core/compression/public.h>
+#include <yt/yt/core/compression/codec.h>
 
 #include <yt/yt/core/misc/random.h>
 #include <yt/yt/core/misc/algorithm_helpers.h>
 
 #include <yt/yt/core/misc/range_formatters.h>
 
+#include <util/generic/algorithm.h>
+
 #include <util/random/shuffle.h>
 
 namespace NYT::NTableClient {
@@ -70,16 +77,18 @@ struct TTestOptions
     bool UseIndexedReaderForLookup = false;
     // Cache based mode.
     bool CacheBased = false;
+    bool EnableCompressionDictionary = false;
 };
 
 TString ToString(const TTestOptions& options)
 {
-    return Format("%v%v%v%v%v",
+    return Format("%v%v%v%v%v%v",
         options.OptimizeFor,
         options.ChunkFormat ? ToString(*options.ChunkFormat) : "",
         options.UseNewReader ? "New" : "",
         options.UseIndexedReaderForLookup ? "IndexedReader" : "",
-        options.CacheBased ? "CacheBased" : "");
+        options.CacheBased ? "CacheBased" : "",
+        options.EnableCompressionDictionary ? "CompressionDictionary" : "");
 }
 
 const auto TestOptionsValues = testing::Values(
@@ -204,7 +213,8 @@ public:
 
     std::unique_ptr<ICachedBlockCookie> GetBlockCookie(
         const NChunkClient::TBlockId& /*id*/,
-        EBlockType /*type*/) override
+        EBlockType /*type*/,
+        const TWorkloadDescriptor& /*workloadDescriptor*/) override
     {
         return nullptr;
     }
@@ -290,7 +300,7 @@ protected:
         return startIndex + N;
     }
 
-    void WriteManyRows(const TTestOptions& testOptions)
+    void WriteManyRows(const TTestOptions& testOptions, bool enableKeyFilter = false)
     {
         auto memoryWriter = New<TMemoryWriter>();
 
@@ -298,11 +308,18 @@ protected:
         config->BlockSize = testOptions.ChunkFormat == EChunkFormat::TableVersionedIndexed
             ? THashTableChunkIndexFormatDetail::SectorSize + 1
             : 1025;
+        config->KeyFilter->Enable = enableKeyFilter;
+        config->CompressionDictionary->Enable = testOptions.EnableCompressionDictionary;
+        config->CompressionDictionary->SampleSize = 64_KB;
+        config->CompressionDictionary->DictionarySize = 4_KB;
         config->Postprocess();
 
         auto options = New<TChunkWriterOptions>();
         options->OptimizeFor = testOptions.OptimizeFor;
         options->ChunkFormat = testOptions.ChunkFormat;
+        if (testOptions.EnableCompressionDictionary) {
+            options->CompressionCodec = NCompression::ECodec::Zstd_3;
+        }
         options->Postprocess();
 
         auto chunkWriter = CreateVersionedChunkWriter(
@@ -491,7 +508,11 @@ const auto LookupTestOptionsValues = testing::Values(
     TTestOptions{.OptimizeFor = EOptimizeFor::Lookup},
     TTestOptions{.OptimizeFor = EOptimizeFor::Lookup, .CacheBased = true},
     TTestOptions{.OptimizeFor = EOptimizeFor::Lookup, .ChunkFormat = EChunkFormat::TableVersionedIndexed},
-    TTestOptions{.OptimizeFor = EOptimizeFor::Lookup, .ChunkFormat = EChunkFormat::TableVersionedIndexed, .UseIndexedReaderForLookup = true});
+    TTestOptions{.OptimizeFor = EOptimizeFor::Lookup, .ChunkFormat = EChunkFormat::TableVersionedIndexed, .UseIndexedReaderForLookup = true},
+    TTestOptions{.OptimizeFor = EOptimizeFor::Scan, .EnableCompressionDictionary = true},
+    TTestOptions{.OptimizeFor = EOptimizeFor::Scan, .UseNewReader = true, .EnableCompressionDictionary = true},
+    TTestOptions{.OptimizeFor = EOptimizeFor::Scan, .UseNewReader = true, .CacheBased = true, .EnableCompressionDictionary = true},
+    TTestOptions{.OptimizeFor = EOptimizeFor::Lookup, .EnableCompressionDictionary = true});
 
 INSTANTIATE_TEST_SUITE_P(
     TVersionedChunkLookupTest,
@@ -540,6 +561,140 @@ TEST_F(TVersionedChunkLookupTest, TestIndexedMetadata)
     EXPECT_EQ(1, versionedChunkMeta->Misc().block_format_version());
 }
 
+TEST_F(TVersionedChunkLookupTest, TestKeyFilterExt)
+{
+    auto makeKey = [] (i64 index) {
+        TUnversionedOwningRowBuilder builder;
+        builder.AddValue(MakeUnversionedStringValue(A, 0));
+        builder.AddValue(MakeUnversionedInt64Value(index, 1));
+        builder.AddValue(MakeUnversionedSentinelValue(EValueType::Null, 2));
+        return builder.FinishRow();
+    };
+
+    for (auto optimizeFor : {EOptimizeFor::Lookup, EOptimizeFor::Scan}) {
+        WriteManyRows({.OptimizeFor = optimizeFor}, /*enableKeyFilter*/ true);
+
+        auto chunkMeta = MemoryReader->GetMeta(/*chunkReadOptions*/ {})
+            .Get()
+            .ValueOrThrow();
+
+        auto keyFilterExt = FindProtoExtension<NProto::TKeyFilterExt>(chunkMeta->extensions());
+        ASSERT_TRUE(keyFilterExt);
+        EXPECT_EQ(Schema->GetKeyColumnCount(), keyFilterExt->key_column_count());
+
+        // Filter blocks follow data blocks (key column blocks for columnar chunks).
+        auto dataBlockMetaExt = GetProtoExtension<NProto::TDataBlockMetaExt>(chunkMeta->extensions());
+        if (optimizeFor == EOptimizeFor::Lookup) {
+            EXPECT_EQ(dataBlockMetaExt.data_blocks_size(), keyFilterExt->blocks_size());
+        } else {
+            EXPECT_LT(1, keyFilterExt->blocks_size());
+            EXPECT_GE(dataBlockMetaExt.data_blocks_size(), keyFilterExt->blocks_size());
+        }
+
+        i64 keyCount = 0;
+        TUnversionedOwningRow previousLastKey;
+        for (const auto& block : keyFilterExt->blocks()) {
+            EXPECT_LT(0, block.key_count());
+            keyCount += block.key_count();
+
+            auto lastKey = FromProto<TUnversionedOwningRow>(block.last_key());
+            if (previousLastKey) {
+                EXPECT_LT(previousLastKey, lastKey);
+            }
+            previousLastKey = std::move(lastKey);
+        }
+        EXPECT_EQ(300000, keyCount);
+        EXPECT_EQ(makeKey(299999), previousLastKey);
+
+        auto versionedChunkMeta = TCachedVersionedChunkMeta::Create(
+            /*prepareColumnarMeta*/ false,
+            /*memoryTracker*/ nullptr,
+            chunkMeta);
+        const auto& keyFilter = versionedChunkMeta->KeyFilter();
+        ASSERT_TRUE(keyFilter);
+
+        for (i64 index = 0; index < 300000; index += 997) {
+            EXPECT_TRUE(keyFilter->Contains(makeKey(index)));
+        }
+        EXPECT_FALSE(keyFilter->Contains(makeKey(300000)));
+    }
+}
+
+TEST_F(TVersionedChunkLookupTest, TestNoKeyFilterExtByDefault)
+{
+    WriteManyRows({.OptimizeFor = EOptimizeFor::Lookup});
+
+    auto chunkMeta = MemoryReader->GetMeta(/*chunkReadOptions*/ {})
+        .Get()
+        .ValueOrThrow();
+
+    EXPECT_FALSE(FindProtoExtension<NProto::TKeyFilterExt>(chunkMeta->extensions()));
+    EXPECT_FALSE(FindProtoExtension<NChunkClient::NProto::TCompressionDictionaryExt>(chunkMeta->extensions()));
+}
+
+TEST_F(TVersionedChunkLookupTest, TestCompressionDictionaryExt)
+{
+    for (auto optimizeFor : {EOptimizeFor::Lookup, EOptimizeFor::Scan}) {
+        WriteManyRows({.OptimizeFor = optimizeFor, .EnableCompressionDictionary = true});
+
+        auto chunkMeta = MemoryReader->GetMeta(/*chunkReadOptions*/ {})
+            .Get()
+            .ValueOrThrow();
+
+        auto compressionDictionaryExt = FindProtoExtension<NChunkClient::NProto::TCompressionDictionaryExt>(chunkMeta->extensions());
+        ASSERT_TRUE(compressionDictionaryExt);
+        EXPECT_LT(0u, compressionDictionaryExt->dictionary().size());
+        EXPECT_GE(4_KB, std::ssize(compressionDictionaryExt->dictionary()));
+
+        auto versionedChunkMeta = TCachedVersionedChunkMeta::Create(
+            /*prepareColumnarMeta*/ false,
+            /*memoryTracker*/ nullptr,
+            chunkMeta);
+        ASSERT_TRUE(versionedChunkMeta->GetDictionaryBlockCodec());
+        EXPECT_EQ(versionedChunkMeta->GetDictionaryBlockCodec().Get(), versionedChunkMeta->GetBlockCodec());
+
+        // Every data block is compressed with the dictionary, including those written before it was trained.
+        auto blocks = MemoryReader->ReadBlocks(
+            /*chunkReadOptions*/ {},
+            /*firstBlockIndex*/ 0,
+            versionedChunkMeta->DataBlockMeta()->data_blocks_size())
+            .Get()
+            .ValueOrThrow();
+        for (const auto& block : blocks) {
+            EXPECT_THROW(NCompression::GetCodec(NCompression::ECodec::Zstd_3)->Decompress(block.Data), std::exception);
+            EXPECT_NO_THROW(versionedChunkMeta->GetBlockCodec()->Decompress(block.Data));
+        }
+    }
+}
+
+TEST_F(TVersionedChunkLookupTest, TestCompressionDictionaryRequiresZstd)
+{
+    auto memoryWriter = New<TMemoryWriter>();
+
+    auto config = New<TChunkWriterConfig>();
+    config->CompressionDictionary->Enable = true;
+    config->Postprocess();
+
+    auto options = New<TChunkWriterOptions>();
+    options->OptimizeFor = EOptimizeFor::Lookup;
+    options->CompressionCodec = NCompression::ECodec::Lz4;
+    options->Postprocess();
+
+    auto chunkWriter = CreateVersionedChunkWriter(
+        config,
+        options,
+        Schema,
+        memoryWriter);
+
+    TChunkedMemoryPool memoryPool;
+    std::vector<TVersionedRow> rows;
+    CreateManyRows(&memoryPool, &rows, /*startIndex*/ 0);
+    EXPECT_TRUE(chunkWriter->Write(rows));
+    EXPECT_TRUE(chunkWriter->Close().Get().IsOK());
+
+    EXPECT_FALSE(FindProtoExtension<NChunkClient::NProto::TCompressionDictionaryExt>(memoryWriter->GetChunkMeta()->extensions()));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 template <class TIter>
@@ -767,9 +922,13 @@ protected:
         TSharedRange<TRowRange> ranges,
         TColumnFilter columnFilter,
         TTimestamp timestamp,
-        bool produceAllVersions)
+        bool produceAllVersions,
+        std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates = {})
     {
         auto expectedRows = CreateExpected(initialRows, writeSchema, readSchema, ranges, timestamp, columnFilter);
+        EraseIf(expectedRows, [&] (TVersionedRow row) {
+            return !SatisfiesKeyPredicates(row, keyPredicates);
+        });
 
         auto chunkMeta = memoryReader->GetMeta(/*chunkReadOptions*/ {})
             .Apply(BIND(
@@ -784,6 +943,7 @@ protected:
         chunkState->ChunkColumnMapping = New<TChunkColumnMapping>(readSchema, chunkMeta->GetChunkSchema());
 
         YT_VERIFY(!GetTestOptions().UseIndexedReaderForLookup);
+        YT_VERIFY(GetTestOptions().UseNewReader || keyPredicates.empty());
 
         IVersionedReaderPtr versionedReader;
         if (GetTestOptions().UseNewReader) {
@@ -803,16 +963,32 @@ protected:
                     /* chunkReadOptions */ {},
                     chunkMeta);
 
-            versionedReader = NNewTableClient::CreateVersionedChunkReader(
-                ranges,
-                timestamp,
-                chunkMeta,
-                readSchema,
-                columnFilter,
-                chunkState->ChunkColumnMapping,
-                blockManagerFactory,
-                chunkState->PerformanceCounters,
-                produceAllVersions);
+            if (keyPredicates.empty()) {
+                versionedReader = NNewTableClient::CreateVersionedChunkReader(
+                    ranges,
+                    timestamp,
+                    chunkMeta,
+                    readSchema,
+                    columnFilter,
+                    chunkState->ChunkColumnMapping,
+                    blockManagerFactory,
+                    chunkState->PerformanceCounters,
+                    produceAllVersions);
+            } else {
+                versionedReader = NNewTableClient::CreateVersionedChunkReader(
+                    NNewTableClient::TRowRangesWithPredicates{
+                        .Ranges = ranges,
+                        .Predicates = std::move(keyPredicates),
+                    },
+                    timestamp,
+                    chunkMeta,
+                    readSchema,
+                    columnFilter,
+                    chunkState->ChunkColumnMapping,
+                    blockManagerFactory,
+                    chunkState->PerformanceCounters,
+                    produceAllVersions);
+            }
         } else {
             if (GetTestOptions().CacheBased) {
                 chunkState->BlockCache = GetPreloadedBlockCache(memoryReader);
@@ -1245,6 +1421,53 @@ protected:
         return expectedRows;
     }
 
+    //! Mirrors the filtering done by the new reader: predicates over unsupported types
+    //! or with constants of another type are ignored, null values always pass.
+    static bool SatisfiesKeyPredicates(
+        TVersionedRow row,
+        const std::vector<NNewTableClient::TKeyColumnPredicate>& keyPredicates)
+    {
+        using NNewTableClient::EKeyPredicateOp;
+
+        for (const auto& predicate : keyPredicates) {
+            auto value = row.Keys()[predicate.KeyColumnIndex];
+            if (value.Type == EValueType::Null || value.Type == EValueType::Double) {
+                continue;
+            }
+
+            const auto& constants = predicate.Constants;
+            if (std::any_of(constants.begin(), constants.end(), [&] (const TUnversionedValue& constant) {
+                return constant.Type != value.Type;
+            })) {
+                continue;
+            }
+
+            bool satisfies = false;
+            if (predicate.Op == EKeyPredicateOp::In) {
+                satisfies = std::any_of(constants.begin(), constants.end(), [&] (const TUnversionedValue& constant) {
+                    return CompareRowValues(value, constant) == 0;
+                });
+            } else {
+                int result = CompareRowValues(value, constants[0]);
+                switch (predicate.Op) {
+                    case EKeyPredicateOp::Equal:          satisfies = result == 0; break;
+                    case EKeyPredicateOp::NotEqual:       satisfies = result != 0; break;
+                    case EKeyPredicateOp::Less:           satisfies = result < 0; break;
+                    case EKeyPredicateOp::LessOrEqual:    satisfies = result <= 0; break;
+                    case EKeyPredicateOp::Greater:        satisfies = result > 0; break;
+                    case EKeyPredicateOp::GreaterOrEqual: satisfies = result >= 0; break;
+                    default:                              YT_ABORT();
+                }
+            }
+
+            if (!satisfies) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     std::vector<TVersionedRow> CreateExpectedRows(
         TRange<TVersionedRow> rows,
         const TTableSchemaPtr& writeSchema,
@@ -1421,6 +1644,48 @@ protected:
             SyncLastCommittedTimestamp,
             /*produceAllVersions*/ false);
     }
+
+    void DoKeyPredicates(
+        std::vector<NNewTableClient::TKeyColumnPredicate> keyPredicates,
+        bool extraKeyColumn = false)
+    {
+        auto writeSchema = New<TTableSchema>(ColumnSchemas_);
+
+        auto memoryChunkReader = CreateChunk(
+            InitialRows_,
+            writeSchema);
+
+        auto columnSchemas = ColumnSchemas_;
+        if (extraKeyColumn) {
+            columnSchemas.insert(
+                columnSchemas.begin() + 5,
+                TColumnSchema("extraKey", EValueType::Boolean).SetSortOrder(ESortOrder::Ascending));
+        }
+        auto readSchema = New<TTableSchema>(columnSchemas);
+
+        TestRangeReader(
+            InitialRows_,
+            memoryChunkReader,
+            writeSchema,
+            readSchema,
+            MakeSingletonRowRange(MinKey(), MaxKey()),
+            TColumnFilter(),
+            /*timestamp*/ 50,
+            /*produceAllVersions*/ false,
+            std::move(keyPredicates));
+    }
+
+    static NNewTableClient::TKeyColumnPredicate MakeKeyPredicate(
+        int keyColumnIndex,
+        NNewTableClient::EKeyPredicateOp op,
+        std::vector<TUnversionedValue> constants)
+    {
+        return {
+            .KeyColumnIndex = keyColumnIndex,
+            .Op = op,
+            .Constants = MakeSharedRange(std::move(constants)),
+        };
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1487,6 +1752,79 @@ INSTANTIATE_TEST_SUITE_P(
 
 ////////////////////////////////////////////////////////////////////////////////
 
+class TVersionedChunksKeyPredicatesTest
+    : public TVersionedChunksHeavyTestBase
+    , public testing::WithParamInterface<TTestOptions>
+{
+private:
+    TTestOptions GetTestOptions() override
+    {
+        return GetParam();
+    }
+};
+
+using NNewTableClient::EKeyPredicateOp;
+
+TEST_P(TVersionedChunksKeyPredicatesTest, Int64)
+{
+    DoKeyPredicates({MakeKeyPredicate(0, EKeyPredicateOp::GreaterOrEqual, {MakeUnversionedInt64Value(100)})});
+    DoKeyPredicates({MakeKeyPredicate(0, EKeyPredicateOp::NotEqual, {MakeUnversionedInt64Value(-10)})});
+}
+
+TEST_P(TVersionedChunksKeyPredicatesTest, Uint64In)
+{
+    DoKeyPredicates({MakeKeyPredicate(1, EKeyPredicateOp::In, {
+        MakeUnversionedUint64Value(0),
+        MakeUnversionedUint64Value(1280),
+        MakeUnversionedUint64Value(1281),
+        MakeUnversionedUint64Value(128 * 1000),
+    })});
+}
+
+TEST_P(TVersionedChunksKeyPredicatesTest, StringAndBoolean)
+{
+    DoKeyPredicates({MakeKeyPredicate(2, EKeyPredicateOp::Less, {MakeUnversionedStringValue(StringData_.back())})});
+    DoKeyPredicates({MakeKeyPredicate(4, EKeyPredicateOp::Equal, {MakeUnversionedBooleanValue(true)})});
+}
+
+TEST_P(TVersionedChunksKeyPredicatesTest, Conjunction)
+{
+    DoKeyPredicates({
+        MakeKeyPredicate(0, EKeyPredicateOp::Greater, {MakeUnversionedInt64Value(-5)}),
+        MakeKeyPredicate(0, EKeyPredicateOp::Less, {MakeUnversionedInt64Value(300)}),
+        MakeKeyPredicate(1, EKeyPredicateOp::NotEqual, {MakeUnversionedUint64Value(1280)}),
+        MakeKeyPredicate(4, EKeyPredicateOp::Equal, {MakeUnversionedBooleanValue(false)}),
+    });
+}
+
+TEST_P(TVersionedChunksKeyPredicatesTest, Ignored)
+{
+    // Doubles are not supported.
+    DoKeyPredicates({MakeKeyPredicate(3, EKeyPredicateOp::Less, {MakeUnversionedDoubleValue(100.0)})});
+    // Constant type differs from the column type.
+    DoKeyPredicates({MakeKeyPredicate(0, EKeyPredicateOp::Equal, {MakeUnversionedUint64Value(0)})});
+}
+
+TEST_P(TVersionedChunksKeyPredicatesTest, ExtraKeyColumn)
+{
+    // The column is missing in the chunk, so all of its values are null.
+    DoKeyPredicates(
+        {MakeKeyPredicate(5, EKeyPredicateOp::Equal, {MakeUnversionedBooleanValue(true)})},
+        /*extraKeyColumn*/ true);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TVersionedChunksKeyPredicatesTest,
+    TVersionedChunksKeyPredicatesTest,
+    ::testing::Values(
+        TTestOptions{.OptimizeFor = EOptimizeFor::Scan, .UseNewReader = true},
+        TTestOptions{.OptimizeFor = EOptimizeFor::Scan, .UseNewReader = true, .CacheBased = true}),
+    [] (const auto& info) {
+        return ToString(info.param);
+    });
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TVersionedChunksHeavyWithBoundsTest
     : public TVersionedChunksHeavyTestBase
     , public testing::WithParamInterface<std::tuple<
@@ -225,7 +225,11 @@ public:
     {
         YT_VERIFY(ChunkMeta_->GetChunkFormat() == TBlockReader::ChunkFormat);
 
-        SetReadyEvent(DoOpen(GetBlockSequence(), ChunkMeta_->Misc(), sessionInvoker));
+        SetReadyEvent(DoOpen(
+            GetBlockSequence(),
+            ChunkMeta_->Misc(),
+            sessionInvoker,
+            ChunkMeta_->GetDictionaryBlockCodec()));
     }
 
     IVersionedRowBatchPtr Read(const TRowBatchReadOptions& options) override
@@ -488,7 +492,11 @@ public:
         , Keys_(keys)
         , KeyFilterTest_(Keys_.Size(), true)
     {
-        SetReadyEvent(DoOpen(GetBlockSequence(), ChunkMeta_->Misc()));
+        SetReadyEvent(DoOpen(
+            GetBlockSequence(),
+            ChunkMeta_->Misc(),
+            /*sessionInvoker*/ nullptr,
+            ChunkMeta_->GetDictionaryBlockCodec()));
     }
 
     IVersionedRowBatchPtr Read(const TRowBatchReadOptions& options) override
@@ -4,6 +4,7 @@
 #include "chunk_meta_extensions.h"
 #include "config.h"
 #include "helpers.h"
+#include "key_filter.h"
 #include "private.h"
 #include "row_merger.h"
 #include "versioned_block_writer.h"
@@ -85,7 +86,8 @@ public:
             Options_,
             chunkWriter,
             std::move(blockCache),
-            Logger))
+            Logger,
+            Config_->CompressionDictionary))
         , LastKey_(TUnversionedValueRange(nullptr, nullptr))
         , MinTimestamp_(MaxTimestamp)
         , MaxTimestamp_(MinTimestamp)
@@ -93,6 +95,7 @@ public:
         , SamplingThreshold_(static_cast<ui64>(MaxFloor<ui64>() * Config_->SampleRate))
         , SamplingRowMerger_(New<TRowBuffer>(TVersionedChunkWriterBaseTag()), Schema_)
         , RowDigestBuilder_(CreateVersionedRowDigestBuilder(Config_->VersionedRowDigest))
+        , KeyFilterBuilder_(CreateKeyFilterBuilder(Config_->KeyFilter, Schema_->GetKeyColumnCount()))
         , TraceContext_(CreateTraceContextFromCurrent("ChunkWriter"))
         , FinishGuard_(TraceContext_)
     {
@@ -163,7 +166,10 @@ public:
     i64 GetMetaSize() const override
     {
         // Other meta parts are negligible.
-        return BlockMetaExtSize_ + SamplesExtSize_;
+        return
+            BlockMetaExtSize_ +
+            SamplesExtSize_ +
+            (KeyFilterBuilder_ ? KeyFilterBuilder_->GetMetaSize() : 0);
     }
 
     bool IsCloseDemanded() const override
@@ -236,6 +242,8 @@ protected:
 
     IVersionedRowDigestBuilderPtr RowDigestBuilder_;
 
+    const IKeyFilterBuilderPtr KeyFilterBuilder_;
+
     const TTraceContextPtr TraceContext_;
     const TTraceContextFinishGuard FinishGuard_;
 
@@ -268,6 +276,9 @@ protected:
             ToProto(&rowDigestExt, RowDigestBuilder_->FlushDigest());
             SetProtoExtension(meta->mutable_extensions(), rowDigestExt);
         }
+        if (KeyFilterBuilder_) {
+            SetProtoExtension(meta->mutable_extensions(), KeyFilterBuilder_->FlushExtension());
+        }
 
         meta->UpdateMemoryUsage();
 
@@ -277,6 +288,20 @@ protected:
         miscExt.set_data_weight(DataWeight_);
     }
 
+    void AddKeyToFilter(TVersionedRow row)
+    {
+        if (KeyFilterBuilder_) {
+            KeyFilterBuilder_->AddKey(row.Keys());
+        }
+    }
+
+    void FlushKeyFilterBlock(TUnversionedValueRange lastKey)
+    {
+        if (KeyFilterBuilder_) {
+            KeyFilterBuilder_->FlushBlock(lastKey);
+        }
+    }
+
     void EmitSampleRandomly(TVersionedRow row)
     {
         if (RandomGenerator_.Generate<ui64>() < SamplingThreshold_) {
@@ -549,6 +574,7 @@ private:
         DataWeight_ += rowWeight;
 
         UpdateColumnarStatistics(ColumnarStatisticsExt_, row);
+        AddKeyToFilter(row);
 
         BlockWriter_->WriteRow(row);
     }
@@ -577,6 +603,8 @@ private:
         BlockMetaExt_.add_data_blocks()->Swap(&block.Meta);
         EncodingChunkWriter_->WriteBlock(std::move(block.Data));
 
+        FlushKeyFilterBlock(keyRange);
+
         MaxTimestamp_ = std::max(MaxTimestamp_, BlockWriter_->GetMaxTimestamp());
         MinTimestamp_ = std::min(MinTimestamp_, BlockWriter_->GetMinTimestamp());
     }
@@ -750,6 +778,10 @@ private:
             }
             TimestampWriter_->WriteTimestamps(range);
 
+            for (auto row : range) {
+                AddKeyToFilter(row);
+            }
+
             RowCount_ += range.Size();
             DataWeight_ += weight;
 
@@ -812,6 +844,12 @@ private:
 
         BlockMetaExt_.add_data_blocks()->Swap(&block.Meta);
         EncodingChunkWriter_->WriteBlock(std::move(block.Data));
+
+        // Key columns are always stored in the first block writer,
+        // so key filter blocks follow its boundaries.
+        if (blockWriterIndex == 0) {
+            FlushKeyFilterBlock(keyRange);
+        }
     }
 
     void PrepareChunkMeta() override
@@ -840,6 +878,8 @@ private:
             }
         }
 
+        FlushKeyFilterBlock(LastKey_.Elements());
+
         PrepareChunkMeta();
 
         EncodingChunkWriter_->Close();
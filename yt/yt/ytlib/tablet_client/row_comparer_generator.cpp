@@ -1,5 +1,6 @@
 #include "row_comparer_generator.h"
 #include "llvm_types.h"
+#include "private.h"
 
 #include <yt/yt/client/table_client/llvm_types.h>
 #include <yt/yt/client/table_client/unversioned_row.h>
@@ -11,6 +12,7 @@
 #include <yt/yt/library/codegen/routine_registry.h>
 #include <yt/yt/library/codegen/type_builder.h>
 
+#include <atomic>
 #include <mutex>
 
 #include <llvm/ADT/Twine.h>
@@ -28,6 +30,8 @@ using namespace NTableClient;
 using namespace NCodegen;
 using namespace llvm;
 
+static const auto& Logger = TabletClientLogger;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 static void RegisterComparerRoutinesImpl(TRoutineRegistry* registry)
@@ -540,45 +544,323 @@ TCGKeyComparers GenerateComparers(TRange<EValueType> keyColumnTypes)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+class TDynamicKeyAccessor
+{
+public:
+    TDynamicKeyAccessor(
+        TRange<EValueType> keyColumnTypes,
+        ui32 nullKeyMask,
+        const TDynamicValueData* keys)
+        : KeyColumnTypes_(keyColumnTypes)
+        , NullKeyMask_(nullKeyMask)
+        , Keys_(keys)
+    { }
+
+    EValueType GetType(int index) const
+    {
+        return (NullKeyMask_ & (1U << index)) ? EValueType::Null : KeyColumnTypes_[index];
+    }
+
+    const TDynamicValueData& GetData(int index) const
+    {
+        return Keys_[index];
+    }
+
+    TStringBuf GetString(int index) const
+    {
+        const auto* string = Keys_[index].String;
+        return TStringBuf(string->Data, string->Length);
+    }
+
+private:
+    const TRange<EValueType> KeyColumnTypes_;
+    const ui32 NullKeyMask_;
+    const TDynamicValueData* const Keys_;
+};
+
+class TUnversionedKeyAccessor
+{
+public:
+    explicit TUnversionedKeyAccessor(const TUnversionedValue* keys)
+        : Keys_(keys)
+    { }
+
+    EValueType GetType(int index) const
+    {
+        return Keys_[index].Type;
+    }
+
+    const TUnversionedValueData& GetData(int index) const
+    {
+        return Keys_[index].Data;
+    }
+
+    TStringBuf GetString(int index) const
+    {
+        return TStringBuf(Keys_[index].Data.String, Keys_[index].Length);
+    }
+
+private:
+    const TUnversionedValue* const Keys_;
+};
+
+template <class T>
+std::optional<int> CompareScalars(T lhs, T rhs, int index)
+{
+    // NB: Mirrors the generated code: NaN compares as lower.
+    if (!(lhs >= rhs)) {
+        return -(index + 1);
+    }
+    if (lhs > rhs) {
+        return index + 1;
+    }
+    return std::nullopt;
+}
+
+//! Interpreted counterpart of the generated comparers' main loop.
+//! Returns zero if the first #length key values are equal.
+template <class TLhs, class TRhs>
+int CompareKeysGeneric(
+    TRange<EValueType> keyColumnTypes,
+    const TLhs& lhs,
+    const TRhs& rhs,
+    int length)
+{
+    for (int index = 0; index < std::ssize(keyColumnTypes) && index != length; ++index) {
+        auto lhsType = lhs.GetType(index);
+        auto rhsType = rhs.GetType(index);
+        if (auto result = CompareScalars(lhsType, rhsType, index)) {
+            return *result;
+        }
+        if (lhsType <= EValueType::Null || lhsType >= EValueType::Max) {
+            continue;
+        }
+
+        std::optional<int> result;
+        switch (keyColumnTypes[index]) {
+            case EValueType::Int64:
+                result = CompareScalars(lhs.GetData(index).Int64, rhs.GetData(index).Int64, index);
+                break;
+            case EValueType::Uint64:
+                result = CompareScalars(lhs.GetData(index).Uint64, rhs.GetData(index).Uint64, index);
+                break;
+            case EValueType::Double:
+                result = CompareScalars(lhs.GetData(index).Double, rhs.GetData(index).Double, index);
+                break;
+            case EValueType::Boolean:
+                result = CompareScalars(lhs.GetData(index).Boolean, rhs.GetData(index).Boolean, index);
+                break;
+            case EValueType::String: {
+                auto lhsString = lhs.GetString(index);
+                auto rhsString = rhs.GetString(index);
+                auto minLength = std::min(lhsString.size(), rhsString.size());
+                if (int memcmpResult = ::memcmp(lhsString.data(), rhsString.data(), minLength)) {
+                    return memcmpResult > 0 ? index + 1 : -(index + 1);
+                }
+                result = CompareScalars(lhsString.size(), rhsString.size(), index);
+                break;
+            }
+            default:
+                YT_ABORT();
+        }
+        if (result) {
+            return *result;
+        }
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+//! Serves interpreted comparers until the compiled ones are published,
+//! then forwards to the latter.
+class TRowComparerState
+    : public TRefCounted
+{
+public:
+    explicit TRowComparerState(TKeyColumnTypes keyColumnTypes)
+        : KeyColumnTypes_(std::move(keyColumnTypes))
+    { }
+
+    //! Returns the compiled comparers or null if they are not ready yet.
+    const TCGKeyComparers* FindCompiledComparers() const
+    {
+        return Compiled_.load(std::memory_order::acquire) ? &CompiledComparers_ : nullptr;
+    }
+
+    //! May be called at most once.
+    void SetCompiledComparers(TCGKeyComparers comparers)
+    {
+        YT_VERIFY(!Compiled_.load());
+        CompiledComparers_ = std::move(comparers);
+        Compiled_.store(true, std::memory_order::release);
+    }
+
+    int CompareDD(
+        ui32 lhsNullKeyMask,
+        const TDynamicValueData* lhs,
+        ui32 rhsNullKeyMask,
+        const TDynamicValueData* rhs) const
+    {
+        if (const auto* compiledComparers = FindCompiledComparers()) {
+            return compiledComparers->DDComparer(lhsNullKeyMask, lhs, rhsNullKeyMask, rhs);
+        }
+        return CompareKeysGeneric(
+            KeyColumnTypes_,
+            TDynamicKeyAccessor(KeyColumnTypes_, lhsNullKeyMask, lhs),
+            TDynamicKeyAccessor(KeyColumnTypes_, rhsNullKeyMask, rhs),
+            std::ssize(KeyColumnTypes_));
+    }
+
+    int CompareDU(
+        ui32 lhsNullKeyMask,
+        const TDynamicValueData* lhs,
+        const TUnversionedValue* rhs,
+        int length) const
+    {
+        if (const auto* compiledComparers = FindCompiledComparers()) {
+            return compiledComparers->DUComparer(lhsNullKeyMask, lhs, rhs, length);
+        }
+        if (auto result = CompareKeysGeneric(
+            KeyColumnTypes_,
+            TDynamicKeyAccessor(KeyColumnTypes_, lhsNullKeyMask, lhs),
+            TUnversionedKeyAccessor(rhs),
+            length))
+        {
+            return result;
+        }
+        return static_cast<int>(KeyColumnTypes_.size()) - length;
+    }
+
+    int CompareUU(
+        const TUnversionedValue* lhs,
+        const TUnversionedValue* rhs,
+        i32 length) const
+    {
+        if (const auto* compiledComparers = FindCompiledComparers()) {
+            return compiledComparers->UUComparer(lhs, rhs, length);
+        }
+        return CompareKeysGeneric(
+            KeyColumnTypes_,
+            TUnversionedKeyAccessor(lhs),
+            TUnversionedKeyAccessor(rhs),
+            length);
+    }
+
+private:
+    const TKeyColumnTypes KeyColumnTypes_;
+
+    std::atomic<bool> Compiled_ = false;
+    TCGKeyComparers CompiledComparers_;
+};
+
+using TRowComparerStatePtr = TIntrusivePtr<TRowComparerState>;
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TCachedRowComparer
     : public TSyncCacheValueBase<TKeyColumnTypes, TCachedRowComparer, THash<TRange<EValueType>>>
-    , public TCGKeyComparers
 {
 public:
-    TCachedRowComparer(
-        TKeyColumnTypes keyColumnTypes,
-        TCGKeyComparers comparers)
+    explicit TCachedRowComparer(TKeyColumnTypes keyColumnTypes)
         : TSyncCacheValueBase(keyColumnTypes)
-        , TCGKeyComparers(std::move(comparers))
+        , State_(New<TRowComparerState>(std::move(keyColumnTypes)))
+        , ForwardingComparers_{
+            BIND_NO_PROPAGATE(&TRowComparerState::CompareDD, State_),
+            BIND_NO_PROPAGATE(&TRowComparerState::CompareDU, State_),
+            BIND_NO_PROPAGATE(&TRowComparerState::CompareUU, State_),
+        }
     { }
+
+    const TRowComparerStatePtr& GetState() const
+    {
+        return State_;
+    }
+
+    //! Returns the compiled comparers once they are ready and
+    //! forwarding ones (which switch over on their own) before that.
+    const TCGKeyComparers& GetComparers() const
+    {
+        if (const auto* compiledComparers = State_->FindCompiledComparers()) {
+            return *compiledComparers;
+        }
+        return ForwardingComparers_;
+    }
+
+private:
+    const TRowComparerStatePtr State_;
+    const TCGKeyComparers ForwardingComparers_;
 };
 
+using TCachedRowComparerPtr = TIntrusivePtr<TCachedRowComparer>;
+
+////////////////////////////////////////////////////////////////////////////////
+
 class TRowComparerCache
     : public TSyncSlruCacheBase<TKeyColumnTypes, TCachedRowComparer, THash<TRange<EValueType>>>
     , public IRowComparerProvider
 {
 public:
-    using TSyncSlruCacheBase::TSyncSlruCacheBase;
+    TRowComparerCache(
+        TSlruCacheConfigPtr config,
+        IInvokerPtr compilationInvoker,
+        const NProfiling::TProfiler& profiler)
+        : TSyncSlruCacheBase(std::move(config), profiler)
+        , CompilationInvoker_(std::move(compilationInvoker))
+        , CompileTimer_(profiler.Timer("/compile_time"))
+    { }
 
     TCGKeyComparers Get(TKeyColumnTypes keyColumnTypes) override
     {
-        auto cachedEvaluator = TSyncSlruCacheBase::Find(keyColumnTypes);
-        if (!cachedEvaluator) {
-            cachedEvaluator = New<TCachedRowComparer>(
-                keyColumnTypes,
-                TCGKeyComparers(NTabletClient::GenerateComparers(keyColumnTypes)));
-
-            TryInsert(cachedEvaluator, &cachedEvaluator);
+        // May be called from the automaton thread with context switches forbidden,
+        // so never wait for the compilation. Until it completes, callers get
+        // interpreted comparers that switch over to the compiled ones.
+        auto cachedComparer = Find(keyColumnTypes);
+        if (!cachedComparer) {
+            auto newComparer = New<TCachedRowComparer>(keyColumnTypes);
+            if (TryInsert(newComparer, &cachedComparer)) {
+                cachedComparer = std::move(newComparer);
+                CompilationInvoker_->Invoke(BIND(
+                    &TRowComparerCache::Compile,
+                    MakeStrong(this),
+                    cachedComparer->GetState(),
+                    std::move(keyColumnTypes)));
+            }
         }
 
-        return *cachedEvaluator;
+        return cachedComparer->GetComparers();
     }
 
+private:
+    const IInvokerPtr CompilationInvoker_;
+    const NProfiling::TEventTimer CompileTimer_;
+
+    void Compile(const TRowComparerStatePtr& state, const TKeyColumnTypes& keyColumnTypes)
+    {
+        try {
+            NProfiling::TEventTimerGuard timerGuard(CompileTimer_);
+            state->SetCompiledComparers(GenerateComparers(keyColumnTypes));
+        } catch (const std::exception& ex) {
+            // Interpreted comparers keep serving this key schema.
+            YT_LOG_WARNING(ex, "Failed to compile row comparer (KeyColumnTypes: %v)",
+                keyColumnTypes);
+        }
+    }
 };
 
-IRowComparerProviderPtr CreateRowComparerProvider(TSlruCacheConfigPtr config)
+} // namespace
+
+IRowComparerProviderPtr CreateRowComparerProvider(
+    TSlruCacheConfigPtr config,
+    IInvokerPtr compilationInvoker,
+    const NProfiling::TProfiler& profiler)
 {
-    return New<TRowComparerCache>(config);
+    return New<TRowComparerCache>(
+        std::move(config),
+        std::move(compilationInvoker),
+        profiler);
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -7,6 +7,10 @@
 
 #include <yt/yt/ytlib/tablet_client/dynamic_value.h>
 
+#include <yt/yt/core/actions/invoker_util.h>
+
+#include <yt/yt/library/profiling/sensor.h>
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace NYT::NTabletClient {
@@ -42,6 +46,16 @@ struct IRowComparerProvider
 
 DEFINE_REFCOUNTED_TYPE(IRowComparerProvider)
 
-IRowComparerProviderPtr CreateRowComparerProvider(TSlruCacheConfigPtr config);
+//! Creates a cache of compiled comparers keyed by key column types.
+//! A single instance is meant to be shared by all tablets and chunk readers of the process.
+/*!
+ *  Comparers are compiled via #compilationInvoker; until that completes,
+ *  #IRowComparerProvider::Get returns interpreted ones which switch over
+ *  to the compiled code once it is ready.
+ */
+IRowComparerProviderPtr CreateRowComparerProvider(
+    TSlruCacheConfigPtr config,
+    IInvokerPtr compilationInvoker = GetSyncInvoker(),
+    const NProfiling::TProfiler& profiler = {});
 
 } // namespace NYT::NTabletClient
@@ -0,0 +1,194 @@
+#include <yt/yt/ytlib/tablet_client/row_comparer_generator.h>
+
+#include <yt/yt/core/test_framework/framework.h>
+
+#include <yt/yt/core/concurrency/action_queue.h>
+#include <yt/yt/core/concurrency/thread_pool.h>
+
+#include <yt/yt/core/misc/cache_config.h>
+
+#include <array>
+#include <limits>
+
+namespace NYT::NTabletClient {
+namespace {
+
+using namespace NConcurrency;
+using namespace NTableClient;
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(TRowComparerProviderTest, SharedBetweenIdenticalKeyTypes)
+{
+    auto provider = CreateRowComparerProvider(New<TSlruCacheConfig>());
+
+    TKeyColumnTypes keyTypes{EValueType::Int64, EValueType::String};
+    auto comparers = provider->Get(keyTypes);
+    EXPECT_TRUE(comparers.UUComparer == provider->Get(keyTypes).UUComparer);
+
+    TKeyColumnTypes otherKeyTypes{EValueType::Uint64};
+    EXPECT_FALSE(comparers.UUComparer == provider->Get(otherKeyTypes).UUComparer);
+
+    auto lhs = MakeUnversionedInt64Value(1);
+    auto rhs = MakeUnversionedInt64Value(2);
+    EXPECT_LT(comparers.UUComparer(&lhs, &rhs, 1), 0);
+    EXPECT_GT(comparers.UUComparer(&rhs, &lhs, 1), 0);
+}
+
+TEST(TRowComparerProviderTest, ConcurrentRequestsShareComparers)
+{
+    auto provider = CreateRowComparerProvider(New<TSlruCacheConfig>());
+    auto threadPool = CreateThreadPool(4, "Comparer");
+
+    TKeyColumnTypes keyTypes{EValueType::Int64, EValueType::Double, EValueType::String};
+
+    std::vector<TFuture<TCGKeyComparers>> asyncComparers;
+    for (int index = 0; index < 16; ++index) {
+        asyncComparers.push_back(BIND([=] {
+            return provider->Get(keyTypes);
+        })
+            .AsyncVia(threadPool->GetInvoker())
+            .Run());
+    }
+
+    // Racing callers may get interpreted comparers while the winner compiles;
+    // all of them must agree.
+    auto lhs = MakeUnversionedInt64Value(1);
+    auto rhs = MakeUnversionedInt64Value(2);
+    auto comparers = WaitFor(AllSucceeded(asyncComparers))
+        .ValueOrThrow();
+    for (const auto& comparer : comparers) {
+        EXPECT_LT(comparer.UUComparer(&lhs, &rhs, 1), 0);
+    }
+
+    // Once compiled, comparers are shared.
+    auto compiledComparers = provider->Get(keyTypes);
+    EXPECT_TRUE(compiledComparers.DDComparer == provider->Get(keyTypes).DDComparer);
+    EXPECT_TRUE(compiledComparers.DUComparer == provider->Get(keyTypes).DUComparer);
+    EXPECT_TRUE(compiledComparers.UUComparer == provider->Get(keyTypes).UUComparer);
+
+    threadPool->Shutdown();
+}
+
+class TInterpretedRowComparerTest
+    : public ::testing::Test
+{
+protected:
+    const TActionQueuePtr CompilationQueue_ = New<TActionQueue>("Compile");
+    const ISuspendableInvokerPtr CompilationInvoker_ = CreateSuspendableInvoker(CompilationQueue_->GetInvoker());
+
+    void SetUp() override
+    {
+        WaitFor(CompilationInvoker_->Suspend())
+            .ThrowOnError();
+    }
+
+    void FinishCompilation()
+    {
+        CompilationInvoker_->Resume();
+        WaitFor(BIND([] { })
+            .AsyncVia(CompilationInvoker_)
+            .Run())
+            .ThrowOnError();
+    }
+};
+
+TEST_F(TInterpretedRowComparerTest, UUMatchesCompiled)
+{
+    auto provider = CreateRowComparerProvider(New<TSlruCacheConfig>(), CompilationInvoker_);
+
+    TKeyColumnTypes keyTypes{EValueType::Int64, EValueType::Double, EValueType::String};
+    auto interpreted = provider->Get(keyTypes);
+    auto compiled = GenerateComparers(keyTypes);
+
+    auto nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<std::array<TUnversionedValue, 3>> keys{
+        {MakeUnversionedInt64Value(1), MakeUnversionedDoubleValue(0.5), MakeUnversionedStringValue("a")},
+        {MakeUnversionedInt64Value(1), MakeUnversionedDoubleValue(0.5), MakeUnversionedStringValue("ab")},
+        {MakeUnversionedInt64Value(1), MakeUnversionedDoubleValue(nan), MakeUnversionedStringValue("a")},
+        {MakeUnversionedNullValue(), MakeUnversionedDoubleValue(0.5), MakeUnversionedStringValue("b")},
+        {MakeUnversionedInt64Value(-2), MakeUnversionedDoubleValue(-1.0), MakeUnversionedStringValue("")},
+        {MakeUnversionedInt64Value(1), MakeUnversionedSentinelValue(EValueType::Max), MakeUnversionedStringValue("")},
+    };
+
+    auto check = [&] {
+        for (const auto& lhs : keys) {
+            for (const auto& rhs : keys) {
+                for (int length = 0; length <= 3; ++length) {
+                    EXPECT_EQ(
+                        compiled.UUComparer(lhs.data(), rhs.data(), length),
+                        interpreted.UUComparer(lhs.data(), rhs.data(), length));
+                }
+            }
+        }
+    };
+
+    check();
+
+    FinishCompilation();
+    EXPECT_FALSE(interpreted.UUComparer == provider->Get(keyTypes).UUComparer);
+    EXPECT_TRUE(provider->Get(keyTypes).UUComparer == provider->Get(keyTypes).UUComparer);
+
+    // Comparers handed out before the compilation switch over to the compiled code.
+    check();
+}
+
+TEST_F(TInterpretedRowComparerTest, DynamicMatchesCompiled)
+{
+    auto provider = CreateRowComparerProvider(New<TSlruCacheConfig>(), CompilationInvoker_);
+
+    TKeyColumnTypes keyTypes{EValueType::Int64, EValueType::Double};
+    auto interpreted = provider->Get(keyTypes);
+    auto compiled = GenerateComparers(keyTypes);
+
+    struct TDynamicKey
+    {
+        ui32 NullKeyMask;
+        std::array<TDynamicValueData, 2> Values;
+    };
+
+    auto makeDynamicKey = [] (std::optional<i64> first, double second) {
+        TDynamicKey key{};
+        if (first) {
+            key.Values[0].Int64 = *first;
+        } else {
+            key.NullKeyMask |= 1;
+        }
+        key.Values[1].Double = second;
+        return key;
+    };
+
+    std::vector<TDynamicKey> dynamicKeys{
+        makeDynamicKey(1, 0.5),
+        makeDynamicKey(1, 1.5),
+        makeDynamicKey(std::nullopt, 0.5),
+        makeDynamicKey(-3, 0.5),
+    };
+    std::vector<std::array<TUnversionedValue, 2>> unversionedKeys{
+        {MakeUnversionedInt64Value(1), MakeUnversionedDoubleValue(0.5)},
+        {MakeUnversionedNullValue(), MakeUnversionedDoubleValue(2.5)},
+        {MakeUnversionedInt64Value(0), MakeUnversionedSentinelValue(EValueType::Max)},
+    };
+
+    for (const auto& lhs : dynamicKeys) {
+        for (const auto& rhs : dynamicKeys) {
+            EXPECT_EQ(
+                compiled.DDComparer(lhs.NullKeyMask, lhs.Values.data(), rhs.NullKeyMask, rhs.Values.data()),
+                interpreted.DDComparer(lhs.NullKeyMask, lhs.Values.data(), rhs.NullKeyMask, rhs.Values.data()));
+        }
+        for (const auto& rhs : unversionedKeys) {
+            for (int length = 0; length <= 2; ++length) {
+                EXPECT_EQ(
+                    compiled.DUComparer(lhs.NullKeyMask, lhs.Values.data(), rhs.data(), length),
+                    interpreted.DUComparer(lhs.NullKeyMask, lhs.Values.data(), rhs.data(), length));
+            }
+        }
+    }
+
+    FinishCompilation();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace
+} // namespace NYT::NTabletClient